@@ -1,3 +1,5 @@
 include(CMakeFindDependencyMacro)
 
+find_dependency(Threads)
+
 include("${CMAKE_CURRENT_LIST_DIR}/stick-targets.cmake")
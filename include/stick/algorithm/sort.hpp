@@ -0,0 +1,247 @@
+/**
+ * Sorting of arrays: pattern-defeating quicksort for any type, LSD radix
+ * sort for numbers, multikey quicksort for strings and a parallel sample
+ * sort running in a thread pool.
+ * @brief Sorting algorithms.
+ * @file sort.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_algorithm_sort_)
+#	define _stick_lib_algorithm_sort_
+
+
+
+#	include "../data_structures/array.tpp"
+#	include "../defines/types.hpp"
+#	include "../string/string.hpp"
+#	include "../string/string_view.hpp"
+#	include "../thread/thread_pool.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Default order of the sorts, by operator<.
+	 * @tparam type Type of the values.
+	 */
+	template<typename type>
+	struct sort_less {
+		/**
+		 * Check if a value goes before another.
+		 * @param [in] left First value.
+		 * @param [in] right Second value.
+		 * @return True if left < right, false otherwise.
+		 */
+		inline bool_t operator()(const type &left, const type &right) const;
+	};
+
+
+	/**
+	 * Unsigned key radix_sort() orders the values of a type by, giving the
+	 * same order as operator<. Specialized for integers and floating point
+	 * numbers, where NaNs go after +infinity when positive and before
+	 * -infinity when negative.
+	 * @tparam type Type of the values.
+	 */
+	template<typename type>
+	struct radix_key {
+		/// Whether the type has a key.
+		static constexpr bool_t available = false;
+	};
+
+	/**
+	 * Radix key of integers, with the sign bit flipped when signed.
+	 * @tparam type Type of the integers.
+	 * @tparam key_type Unsigned integer at least as wide as type.
+	 */
+	template<typename type, typename key_type>
+	struct integer_radix_key {
+		/// The type has a key.
+		static constexpr bool_t available = true;
+		/// Type of the keys.
+		typedef key_type key;
+
+		/**
+		 * Get the key of an integer.
+		 * @param [in] value Integer.
+		 * @return Key of the integer.
+		 */
+		static inline key_type get(type value) noexcept;
+	};
+
+	/**
+	 * Radix key of IEEE 754 floating point numbers: the bits of positive
+	 * numbers with the sign bit set, and the bits of negative ones flipped.
+	 * @tparam type Type of the numbers.
+	 * @tparam key_type Unsigned integer as wide as type.
+	 */
+	template<typename type, typename key_type>
+	struct floating_radix_key {
+		/// The type has a key.
+		static constexpr bool_t available = true;
+		/// Type of the keys.
+		typedef key_type key;
+
+		/**
+		 * Get the key of a number.
+		 * @param [in] value Number.
+		 * @return Key of the number.
+		 */
+		static inline key_type get(type value) noexcept;
+	};
+
+
+	template<>
+	struct radix_key<char_t> : integer_radix_key<char_t, uint8_t> {};
+	template<>
+	struct radix_key<schar_t> : integer_radix_key<schar_t, uint8_t> {};
+	template<>
+	struct radix_key<uchar_t> : integer_radix_key<uchar_t, uint8_t> {};
+	template<>
+	struct radix_key<wchar_t> : integer_radix_key<wchar_t, uint32_t> {};
+	template<>
+	struct radix_key<short_t> : integer_radix_key<short_t, uint16_t> {};
+	template<>
+	struct radix_key<ushort_t> : integer_radix_key<ushort_t, uint16_t> {};
+	template<>
+	struct radix_key<int_t> : integer_radix_key<int_t, uint32_t> {};
+	template<>
+	struct radix_key<uint_t> : integer_radix_key<uint_t, uint32_t> {};
+	template<>
+	struct radix_key<long_t> : integer_radix_key<long_t, uint64_t> {};
+	template<>
+	struct radix_key<ulong_t> : integer_radix_key<ulong_t, uint64_t> {};
+	template<>
+	struct radix_key<llong_t> : integer_radix_key<llong_t, uint64_t> {};
+	template<>
+	struct radix_key<ullong_t> : integer_radix_key<ullong_t, uint64_t> {};
+	template<>
+	struct radix_key<float_t> : floating_radix_key<float_t, uint32_t> {};
+	template<>
+	struct radix_key<double_t> : floating_radix_key<double_t, uint64_t> {};
+
+
+	/**
+	 * Sort values with pattern-defeating quicksort: introsort taking linear
+	 * time on sorted, reversed and equal runs, falling back to heapsort on
+	 * bad pivots. Numbers compared with sort_less are partitioned in blocks
+	 * without branches. Not stable.
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order, called as compare(left, right)
+	 * and returning true if left goes before right. Default = sort_less.
+	 * @param [in,out] first First value.
+	 * @param [in,out] last Value after the last one.
+	 * @param [in] compare Strict weak order of the values.
+	 */
+	template<typename type, typename compare_type = sort_less<type>>
+	void_t sort(type *first, type *last,
+	            const compare_type &compare = compare_type());
+	/**
+	 * Sort the values of an array, see sort(type *, type *, const
+	 * compare_type &).
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order. Default = sort_less.
+	 * @param [in,out] values Values to sort.
+	 * @param [in] compare Strict weak order of the values.
+	 */
+	template<typename type, typename compare_type = sort_less<type>>
+	void_t sort(array<type> &values,
+	            const compare_type &compare = compare_type());
+
+	/**
+	 * Sort strings by their characters, as string::compare() orders them,
+	 * with multikey quicksort. Each character is read about once per level
+	 * instead of comparing whole prefixes again, and the strings are only
+	 * moved once, at the end.
+	 * @param [in,out] first First string.
+	 * @param [in,out] last String after the last one.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	void_t sort(string *first, string *last);
+	/**
+	 * Sort the strings of an array, see sort(string *, string *).
+	 * @param [in,out] values Strings to sort.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	void_t sort(array<string> &values);
+	/**
+	 * Sort views by their characters, see sort(string *, string *).
+	 * @param [in,out] first First view.
+	 * @param [in,out] last View after the last one.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	void_t sort(string_view *first, string_view *last);
+	/**
+	 * Sort the views of an array, see sort(string *, string *).
+	 * @param [in,out] values Views to sort.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	void_t sort(array<string_view> &values);
+
+	/**
+	 * Sort numbers with LSD radix sort, one pass per byte of their key that
+	 * is not the same for every number. Takes linear time and as much extra
+	 * memory as the numbers. Stable.
+	 * @tparam type Type of the numbers, with a radix_key.
+	 * @param [in,out] first First number.
+	 * @param [in,out] last Number after the last one.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	template<typename type>
+	void_t radix_sort(type *first, type *last);
+	/**
+	 * Sort the numbers of an array, see radix_sort(type *, type *).
+	 * @tparam type Type of the numbers, with a radix_key.
+	 * @param [in,out] values Numbers to sort.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	template<typename type>
+	void_t radix_sort(array<type> &values);
+
+	/**
+	 * Sort values with sample sort in a thread pool. A sorted sample picks
+	 * a splitter between every two buckets, every part of the values is
+	 * classified into the buckets in parallel, and the buckets are moved
+	 * apart and sorted with sort() in parallel. Takes as much extra memory
+	 * as the values. Small inputs and single worker pools are sorted in the
+	 * calling thread. Not stable.
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order. Default = sort_less.
+	 * @param [in,out] first First value.
+	 * @param [in,out] last Value after the last one.
+	 * @param [in] compare Strict weak order of the values, that must not
+	 * throw.
+	 * @param [in] pool Pool to run in. Default = shared pool.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	template<typename type, typename compare_type = sort_less<type>>
+	void_t parallel_sort(type *first, type *last,
+	                     const compare_type &compare = compare_type(),
+	                     thread_pool &pool = thread_pool::shared());
+	/**
+	 * Sort the values of an array in a thread pool, see parallel_sort(type *,
+	 * type *, const compare_type &, thread_pool &).
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order. Default = sort_less.
+	 * @param [in,out] values Values to sort.
+	 * @param [in] compare Strict weak order of the values, that must not
+	 * throw.
+	 * @param [in] pool Pool to run in. Default = shared pool.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	template<typename type, typename compare_type = sort_less<type>>
+	void_t parallel_sort(array<type> &values,
+	                     const compare_type &compare = compare_type(),
+	                     thread_pool &pool = thread_pool::shared());
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_algorithm_sort_impl_
+#	include "../algorithm/sort_impl.tpp"
+#	undef _stick_lib_algorithm_sort_impl_
+
+
+#endif   //_stick_lib_algorithm_sort_
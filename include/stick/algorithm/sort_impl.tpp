@@ -0,0 +1,824 @@
+/**
+ * Sorting algorithms. Template implementations.
+ * @brief Sorting algorithms template implementations.
+ * @file sort_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_algorithm_sort_impl_)
+
+
+#	include "../memory/management.tpp"
+#	include "../templates/bit.tpp"
+#	include "../templates/reference.tpp"
+#	include "../templates/traits.tpp"
+#	include "../thread/parallel.tpp"
+
+
+namespace stick {
+
+
+	/// Ranges shorter than this are sorted by insertion.
+	static const size_t sort_insertion_threshold = 24ul;
+	/// Ranges longer than this pick their pivot as the median of 3 medians.
+	static const size_t sort_ninther_threshold = 128ul;
+	/// Most moves the insertion sort of an already partitioned range does
+	/// before giving up.
+	static const size_t sort_partial_insertion_limit = 8ul;
+	/// Values classified per step of a branchless partition.
+	static const size_t sort_block_length = 64ul;
+	/// Ranges shorter than this are not worth a radix sort.
+	static const size_t sort_radix_threshold = 256ul;
+	/// Values a parallel sort needs per worker before splitting the work.
+	static const size_t sort_parallel_threshold = 16384ul;
+	/// Buckets of a parallel sort per worker, so idle workers can take
+	/// buckets from slow ones.
+	static const size_t sort_buckets_per_worker = 4ul;
+	/// Most buckets of a parallel sort, they are indexed by a byte.
+	static const size_t sort_max_buckets = 256ul;
+	/// Sampled values per bucket to choose the splitters from.
+	static const size_t sort_oversampling = 32ul;
+
+
+	/**
+	 * Tells the sort whether comparing values is cheap and without side
+	 * effects, so a partition can compare values without branching on the
+	 * result. True for numbers ordered with sort_less.
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order.
+	 */
+	template<typename type, typename compare_type>
+	struct sort_branchless {
+		/// Whether to partition without branches.
+		static constexpr bool_t value = false;
+	};
+	/**
+	 * Numbers ordered with sort_less are partitioned without branches.
+	 * @tparam type Type of the values.
+	 */
+	template<typename type>
+	struct sort_branchless<type, sort_less<type>> {
+		/// Whether to partition without branches.
+		static constexpr bool_t value = radix_key<type>::available;
+	};
+
+
+	template<typename type>
+	bool_t sort_less<type>::operator()(const type &left,
+	                                   const type &right) const {
+		return left < right;
+	}
+
+
+	template<typename type, typename key_type>
+	key_type integer_radix_key<type, key_type>::get(type value) noexcept {
+		// Sign extending a negative number keeps it under the positive ones
+		// once the highest bit of the key is flipped.
+		key_type sign = static_cast<key_type>(
+		    key_type(1) << (sizeof(key_type) * 8ul - 1ul));
+
+		return static_cast<key_type>(value)
+		       ^ (type(-1) < type(0) ? sign : key_type(0));
+	}
+
+	template<typename type, typename key_type>
+	key_type floating_radix_key<type, key_type>::get(type value) noexcept {
+		key_type bits;
+		__builtin_memcpy(&bits, &value, sizeof(key_type));
+
+		key_type sign = static_cast<key_type>(
+		    key_type(1) << (sizeof(key_type) * 8ul - 1ul));
+
+		if ((bits & sign) != key_type(0))
+			return static_cast<key_type>(~bits);
+
+		return static_cast<key_type>(bits | sign);
+	}
+
+
+	/**
+	 * Swap two values.
+	 * @tparam type Type of the values.
+	 * @param [in,out] left First value.
+	 * @param [in,out] right Second value.
+	 */
+	template<typename type>
+	inline void_t sort_swap(type &left, type &right) {
+		type tempy(move(left));
+		left = move(right);
+		right = move(tempy);
+	}
+
+	/**
+	 * Put two values in order.
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order.
+	 * @param [in,out] left Value that must go first.
+	 * @param [in,out] right Value that must go second.
+	 * @param [in] compare Order of the values.
+	 */
+	template<typename type, typename compare_type>
+	inline void_t sort_order(type *left, type *right,
+	                         const compare_type &compare) {
+		if (compare(*right, *left))
+			sort_swap(*left, *right);
+	}
+	/**
+	 * Put three values in order.
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order.
+	 * @param [in,out] first Value that must go first.
+	 * @param [in,out] second Value that must go second.
+	 * @param [in,out] third Value that must go third.
+	 * @param [in] compare Order of the values.
+	 */
+	template<typename type, typename compare_type>
+	inline void_t sort_order(type *first, type *second, type *third,
+	                         const compare_type &compare) {
+		sort_order(first, second, compare);
+		sort_order(second, third, compare);
+		sort_order(first, second, compare);
+	}
+
+
+	/**
+	 * Sort a range by insertion.
+	 * @tparam guarded Whether to check for the beginning of the range. Else
+	 * the value before the range must not go after any value in it.
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order.
+	 * @param [in,out] first First value.
+	 * @param [in,out] last Value after the last one.
+	 * @param [in] compare Order of the values.
+	 */
+	template<bool_t guarded, typename type, typename compare_type>
+	void_t sort_insertion(type *first, type *last,
+	                      const compare_type &compare) {
+		if (first == last)
+			return;
+
+		for (type *current = first + 1; current != last; current++) {
+			type *sift = current;
+			type *previous = current - 1;
+
+			if (compare(*sift, *previous)) {
+				type tempy(move(*sift));
+				do
+					*sift-- = move(*previous);
+				while ((not guarded or sift != first)
+				       and compare(tempy, *--previous));
+				*sift = move(tempy);
+			}
+		}
+	}
+
+	/**
+	 * Try to sort a range by insertion, giving up after a few moves.
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order.
+	 * @param [in,out] first First value.
+	 * @param [in,out] last Value after the last one.
+	 * @param [in] compare Order of the values.
+	 * @return True if the range got sorted, false otherwise.
+	 */
+	template<typename type, typename compare_type>
+	bool_t sort_partial_insertion(type *first, type *last,
+	                              const compare_type &compare) {
+		if (first == last)
+			return true;
+
+		size_t moves = 0ul;
+		for (type *current = first + 1; current != last; current++) {
+			type *sift = current;
+			type *previous = current - 1;
+
+			if (compare(*sift, *previous)) {
+				type tempy(move(*sift));
+				do
+					*sift-- = move(*previous);
+				while (sift != first and compare(tempy, *--previous));
+				*sift = move(tempy);
+
+				moves += static_cast<size_t>(current - sift);
+				if (moves > sort_partial_insertion_limit)
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+
+	/**
+	 * Move a value down a heap until its children do not go after it.
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order.
+	 * @param [in,out] heap First value of the heap.
+	 * @param [in] position Position of the value to move down.
+	 * @param [in] length Number of values of the heap.
+	 * @param [in] compare Order of the values.
+	 */
+	template<typename type, typename compare_type>
+	void_t sort_sift_down(type *heap, size_t position, size_t length,
+	                      const compare_type &compare) {
+		type tempy(move(heap[position]));
+
+		for (size_t child; (child = 2ul * position + 1ul) < length;
+		     position = child) {
+			if (child + 1ul < length
+			    and compare(heap[child], heap[child + 1ul]))
+				child++;
+			if (not compare(tempy, heap[child]))
+				break;
+
+			heap[position] = move(heap[child]);
+		}
+
+		heap[position] = move(tempy);
+	}
+
+	/**
+	 * Sort a range with heapsort, in O(n log n) whatever the values are.
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order.
+	 * @param [in,out] first First value.
+	 * @param [in,out] last Value after the last one.
+	 * @param [in] compare Order of the values.
+	 */
+	template<typename type, typename compare_type>
+	void_t sort_heap(type *first, type *last, const compare_type &compare) {
+		auto length = static_cast<size_t>(last - first);
+
+		for (size_t i = length / 2ul; i-- > 0ul;)
+			sort_sift_down(first, i, length, compare);
+
+		while (length-- > 1ul) {
+			sort_swap(first[0ul], first[length]);
+			sort_sift_down(first, 0ul, length, compare);
+		}
+	}
+
+
+	/**
+	 * Partition a range around its first value, the pivot. Values equal to
+	 * the pivot go to the right.
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order.
+	 * @param [in,out] first First value, the pivot, with a value after the
+	 * range not going before it.
+	 * @param [in,out] last Value after the last one.
+	 * @param [in] compare Order of the values.
+	 * @param [out] partitioned Whether the range was already partitioned.
+	 * @return Position of the pivot.
+	 */
+	template<typename type, typename compare_type>
+	type *sort_partition_right(type *first, type *last,
+	                           const compare_type &compare,
+	                           bool_t &partitioned) {
+		type pivot(move(*first));
+		type *left = first;
+		type *right = last;
+
+		// The median of 3 left a value not going before the pivot in the
+		// range, so the first scan needs no bounds check.
+		while (compare(*++left, pivot))
+			;
+		if (left - 1 == first)
+			while (left < right and not compare(*--right, pivot))
+				;
+		else
+			while (not compare(*--right, pivot))
+				;
+
+		partitioned = left >= right;
+
+		while (left < right) {
+			sort_swap(*left, *right);
+			while (compare(*++left, pivot))
+				;
+			while (not compare(*--right, pivot))
+				;
+		}
+
+		type *pivot_position = left - 1;
+		*first = move(*pivot_position);
+		*pivot_position = move(pivot);
+
+		return pivot_position;
+	}
+
+	/**
+	 * Swap the values at some offsets of two blocks.
+	 * @tparam type Type of the values.
+	 * @param [in,out] left_base Base of the left offsets.
+	 * @param [in,out] right_base Base of the right offsets, counted down.
+	 * @param [in] left_offsets Offsets of the values of the left block.
+	 * @param [in] right_offsets Offsets of the values of the right block.
+	 * @param [in] amount Number of values to swap.
+	 * @param [in] use_swaps Swap by pairs, needed when both blocks have as
+	 * many values to swap. Else values are rotated with one temporary.
+	 */
+	template<typename type>
+	void_t sort_swap_offsets(type *left_base, type *right_base,
+	                         const uchar_t *left_offsets,
+	                         const uchar_t *right_offsets, size_t amount,
+	                         bool_t use_swaps) {
+		if (use_swaps) {
+			for (size_t i = 0ul; i < amount; i++)
+				sort_swap(left_base[left_offsets[i]],
+				          *(right_base - right_offsets[i]));
+		} else if (amount > 0ul) {
+			type *left = left_base + left_offsets[0ul];
+			type *right = right_base - right_offsets[0ul];
+			type tempy(move(*left));
+			*left = move(*right);
+
+			for (size_t i = 1ul; i < amount; i++) {
+				left = left_base + left_offsets[i];
+				*right = move(*left);
+				right = right_base - right_offsets[i];
+				*left = move(*right);
+			}
+
+			*right = move(tempy);
+		}
+	}
+
+	/**
+	 * Partition a range around its first value as sort_partition_right()
+	 * does, comparing blocks of values into offset buffers first, so no
+	 * branch depends on a comparison (BlockQuicksort).
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order.
+	 * @param [in,out] first First value, the pivot, with a value after the
+	 * range not going before it.
+	 * @param [in,out] last Value after the last one.
+	 * @param [in] compare Order of the values.
+	 * @param [out] partitioned Whether the range was already partitioned.
+	 * @return Position of the pivot.
+	 */
+	template<typename type, typename compare_type>
+	type *sort_partition_right_branchless(type *first, type *last,
+	                                      const compare_type &compare,
+	                                      bool_t &partitioned) {
+		type pivot(move(*first));
+		type *left = first;
+		type *right = last;
+
+		while (compare(*++left, pivot))
+			;
+		if (left - 1 == first)
+			while (left < right and not compare(*--right, pivot))
+				;
+		else
+			while (not compare(*--right, pivot))
+				;
+
+		partitioned = left >= right;
+
+		if (not partitioned) {
+			sort_swap(*left, *right);
+			left++;
+
+			uchar_t left_offsets[sort_block_length];
+			uchar_t right_offsets[sort_block_length];
+			type *left_base = left;
+			type *right_base = right;
+			size_t left_amount = 0ul, right_amount = 0ul;
+			size_t left_start = 0ul, right_start = 0ul;
+
+			while (left < right) {
+				// Only refill the blocks that ran out of values to swap,
+				// splitting what is left when both did.
+				auto unknown = static_cast<size_t>(right - left);
+				size_t left_split = left_amount == 0ul
+				                        ? (right_amount == 0ul ? unknown / 2ul
+				                                               : unknown)
+				                        : 0ul;
+				size_t right_split
+				    = right_amount == 0ul ? unknown - left_split : 0ul;
+
+				if (left_split > sort_block_length)
+					left_split = sort_block_length;
+				for (size_t i = 0ul; i < left_split; i++) {
+					left_offsets[left_amount] = static_cast<uchar_t>(i);
+					left_amount += not compare(*left++, pivot);
+				}
+
+				if (right_split > sort_block_length)
+					right_split = sort_block_length;
+				for (size_t i = 0ul; i < right_split;) {
+					right_offsets[right_amount] = static_cast<uchar_t>(++i);
+					right_amount += compare(*--right, pivot);
+				}
+
+				size_t amount
+				    = left_amount < right_amount ? left_amount : right_amount;
+				sort_swap_offsets(left_base, right_base,
+				                  left_offsets + left_start,
+				                  right_offsets + right_start, amount,
+				                  left_amount == right_amount);
+				left_amount -= amount;
+				right_amount -= amount;
+				left_start += amount;
+				right_start += amount;
+
+				if (left_amount == 0ul) {
+					left_start = 0ul;
+					left_base = left;
+				}
+				if (right_amount == 0ul) {
+					right_start = 0ul;
+					right_base = right;
+				}
+			}
+
+			// One of the blocks may still have values on the wrong side.
+			if (left_amount != 0ul) {
+				while (left_amount-- > 0ul)
+					sort_swap(
+					    left_base[left_offsets[left_start + left_amount]],
+					    *--right);
+				left = right;
+			}
+			if (right_amount != 0ul) {
+				while (right_amount-- > 0ul)
+					sort_swap(*(right_base
+					            - right_offsets[right_start + right_amount]),
+					          *left++);
+				right = left;
+			}
+		}
+
+		type *pivot_position = left - 1;
+		*first = move(*pivot_position);
+		*pivot_position = move(pivot);
+
+		return pivot_position;
+	}
+
+	/**
+	 * Partition a range around its first value, the pivot, with the values
+	 * equal to it to the left. Used when the value before the range equals
+	 * the pivot, so the values equal to it are already in place.
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order.
+	 * @param [in,out] first First value, the pivot.
+	 * @param [in,out] last Value after the last one.
+	 * @param [in] compare Order of the values.
+	 * @return Position of the pivot.
+	 */
+	template<typename type, typename compare_type>
+	type *sort_partition_left(type *first, type *last,
+	                          const compare_type &compare) {
+		type pivot(move(*first));
+		type *left = first;
+		type *right = last;
+
+		while (compare(pivot, *--right))
+			;
+		if (right + 1 == last)
+			while (left < right and not compare(pivot, *++left))
+				;
+		else
+			while (not compare(pivot, *++left))
+				;
+
+		while (left < right) {
+			sort_swap(*left, *right);
+			while (compare(pivot, *--right))
+				;
+			while (not compare(pivot, *++left))
+				;
+		}
+
+		*first = move(*right);
+		*right = move(pivot);
+
+		return right;
+	}
+
+
+	/**
+	 * Sort a range with pattern-defeating quicksort.
+	 * @tparam branchless Whether to partition without branches.
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order.
+	 * @param [in,out] first First value.
+	 * @param [in,out] last Value after the last one.
+	 * @param [in] compare Order of the values.
+	 * @param [in] bad_allowed Unbalanced partitions left before falling
+	 * back to heapsort.
+	 * @param [in] leftmost Whether the range starts the whole input. Else
+	 * the value before it does not go after any value in it.
+	 */
+	template<bool_t branchless, typename type, typename compare_type>
+	void_t sort_loop(type *first, type *last, const compare_type &compare,
+	                 size_t bad_allowed, bool_t leftmost) {
+		while (true) {
+			auto length = static_cast<size_t>(last - first);
+
+			if (length < sort_insertion_threshold) {
+				if (leftmost)
+					sort_insertion<true>(first, last, compare);
+				else
+					sort_insertion<false>(first, last, compare);
+
+				return;
+			}
+
+			// Leave the pivot at first, and values not going before nor
+			// after it at both ends for the partitions to stop at.
+			size_t half = length / 2ul;
+			if (length > sort_ninther_threshold) {
+				sort_order(first, first + half, last - 1, compare);
+				sort_order(first + 1, first + (half - 1ul), last - 2, compare);
+				sort_order(first + 2, first + (half + 1ul), last - 3, compare);
+				sort_order(first + (half - 1ul), first + half,
+				           first + (half + 1ul), compare);
+				sort_swap(*first, first[half]);
+			} else
+				sort_order(first + half, first, last - 1, compare);
+
+			// A pivot equal to the value before the range is the smallest
+			// value of it, take all the values equal to it at once.
+			if (not leftmost and not compare(*(first - 1), *first)) {
+				first = sort_partition_left(first, last, compare) + 1;
+				continue;
+			}
+
+			bool_t partitioned;
+			type *pivot = branchless ? sort_partition_right_branchless(
+			                               first, last, compare, partitioned)
+			                         : sort_partition_right(first, last,
+			                                                compare,
+			                                                partitioned);
+
+			auto left_length = static_cast<size_t>(pivot - first);
+			auto right_length = static_cast<size_t>(last - (pivot + 1));
+
+			if (left_length < length / 8ul or right_length < length / 8ul) {
+				if (--bad_allowed == 0ul) {
+					sort_heap(first, last, compare);
+					return;
+				}
+
+				// Shuffle some values to break the pattern behind the bad
+				// pivot.
+				if (left_length >= sort_insertion_threshold) {
+					sort_swap(*first, first[left_length / 4ul]);
+					sort_swap(*(pivot - 1), *(pivot - left_length / 4ul));
+					if (left_length > sort_ninther_threshold) {
+						sort_swap(first[1ul], first[left_length / 4ul + 1ul]);
+						sort_swap(first[2ul], first[left_length / 4ul + 2ul]);
+						sort_swap(*(pivot - 2),
+						          *(pivot - (left_length / 4ul + 1ul)));
+						sort_swap(*(pivot - 3),
+						          *(pivot - (left_length / 4ul + 2ul)));
+					}
+				}
+				if (right_length >= sort_insertion_threshold) {
+					sort_swap(pivot[1ul], pivot[1ul + right_length / 4ul]);
+					sort_swap(*(last - 1), *(last - right_length / 4ul));
+					if (right_length > sort_ninther_threshold) {
+						sort_swap(pivot[2ul], pivot[2ul + right_length / 4ul]);
+						sort_swap(pivot[3ul], pivot[3ul + right_length / 4ul]);
+						sort_swap(*(last - 2),
+						          *(last - (1ul + right_length / 4ul)));
+						sort_swap(*(last - 3),
+						          *(last - (2ul + right_length / 4ul)));
+					}
+				}
+			} else if (partitioned
+			           and sort_partial_insertion(first, pivot, compare)
+			           and sort_partial_insertion(pivot + 1, last, compare))
+				// Nothing was swapped and both sides were nearly sorted,
+				// the input likely was.
+				return;
+
+			sort_loop<branchless>(first, pivot, compare, bad_allowed,
+			                      leftmost);
+			first = pivot + 1;
+			leftmost = false;
+		}
+	}
+
+
+	template<typename type, typename compare_type>
+	void_t sort(type *first, type *last, const compare_type &compare) {
+		if (last - first < 2)
+			return;
+
+		// Allow as many bad partitions as levels a balanced sort has.
+		sort_loop<sort_branchless<type, compare_type>::value>(
+		    first, last, compare,
+		    64ul
+		        - count_leading_zeros(
+		            static_cast<uint64_t>(last - first)),
+		    true);
+	}
+	template<typename type, typename compare_type>
+	void_t sort(array<type> &values, const compare_type &compare) {
+		sort(values.begin(), values.end(), compare);
+	}
+
+
+	template<typename type>
+	void_t radix_sort(type *first, type *last) {
+		static_assert(radix_key<type>::available,
+		              "radix_sort() needs a radix_key for the type.");
+		typedef typename radix_key<type>::key key_type;
+		static const size_t digits = sizeof(key_type);
+
+		auto length = static_cast<size_t>(last - first);
+		if (length < sort_radix_threshold)
+			return sort(first, last);
+
+		// Count every digit in a single read of the values.
+		size_t counts[digits][256ul] = {};
+		for (type *value = first; value != last; value++) {
+			key_type key = radix_key<type>::get(*value);
+			for (size_t digit = 0ul; digit < digits; digit++)
+				counts[digit][(key >> (digit * 8ul)) & 0xffu]++;
+		}
+
+		type *buffer = allocate_uninitialized<type>(length);
+		type *source = first;
+		type *destination = buffer;
+
+		for (size_t digit = 0ul; digit < digits; digit++) {
+			size_t shift = digit * 8ul;
+
+			// A digit every value has leaves the order as is.
+			if (counts[digit][(radix_key<type>::get(*first) >> shift) & 0xffu]
+			    == length)
+				continue;
+
+			size_t offsets[256ul];
+			for (size_t i = 0ul, offset = 0ul; i < 256ul; i++) {
+				offsets[i] = offset;
+				offset += counts[digit][i];
+			}
+
+			for (size_t i = 0ul; i < length; i++)
+				destination[offsets[(radix_key<type>::get(source[i]) >> shift)
+				                    & 0xffu]++]
+				    = source[i];
+
+			type *tempy = source;
+			source = destination;
+			destination = tempy;
+		}
+
+		if (source != first)
+			copy(source, first, length);
+
+		deallocate_raw(buffer);
+	}
+	template<typename type>
+	void_t radix_sort(array<type> &values) {
+		radix_sort(values.begin(), values.end());
+	}
+
+
+	/**
+	 * Classify a value into the bucket between the splitters around it.
+	 * @tparam type Type of the values.
+	 * @tparam compare_type Type of the order.
+	 * @param [in] tree Splitters as a complete binary search tree, the root
+	 * at 1 and the children of i at 2i and 2i + 1.
+	 * @param [in] levels Levels of the tree, log2 of the number of buckets.
+	 * @param [in] value Value to classify.
+	 * @param [in] compare Order of the values.
+	 * @return Index of the bucket.
+	 */
+	template<typename type, typename compare_type>
+	inline size_t sort_classify(const type *tree, size_t levels,
+	                            const type &value,
+	                            const compare_type &compare) {
+		size_t node = 1ul;
+		for (size_t level = 0ul; level < levels; level++)
+			node = 2ul * node + compare(tree[node], value);
+
+		return node - (1ul << levels);
+	}
+
+
+	template<typename type, typename compare_type>
+	void_t parallel_sort(type *first, type *last, const compare_type &compare,
+	                     thread_pool &pool) {
+		auto length = static_cast<size_t>(last - first);
+		size_t workers = pool.size();
+		if (workers < 2ul or length < workers * sort_parallel_threshold)
+			return sort(first, last, compare);
+
+		// A power of two of buckets, so the splitters make a complete tree.
+		size_t levels = 64ul
+		                - count_leading_zeros(static_cast<uint64_t>(
+		                    workers * sort_buckets_per_worker - 1ul));
+		if ((1ul << levels) > sort_max_buckets)
+			levels = count_trailing_zeros(sort_max_buckets);
+		size_t buckets = 1ul << levels;
+
+		// Pick the splitters from a sorted sample, spread over the input.
+		array<type> sample;
+		size_t sample_length = buckets * sort_oversampling;
+		for (size_t i = 0ul; i < sample_length; i++)
+			sample.push_back(first[i * length / sample_length]);
+		sort(sample, compare);
+
+		array<type> tree;
+		tree.push_back(sample[0ul]);
+		for (size_t node = 1ul; node < buckets; node++) {
+			// In order position of the node in a tree of levels levels.
+			size_t depth = 63ul - count_leading_zeros(
+			                          static_cast<uint64_t>(node));
+			size_t rank = ((node - (1ul << depth)) * 2ul + 1ul)
+			              << (levels - depth - 1ul);
+			tree.push_back(sample[rank * sort_oversampling - 1ul]);
+		}
+		const type *splitters = tree.begin();
+
+		// Classify every part of the input, remembering the buckets.
+		size_t parts = workers * sort_buckets_per_worker;
+		size_t part_length = (length + parts - 1ul) / parts;
+		size_t *offsets = allocate_uninitialized<size_t>(parts * buckets
+		                                                 + buckets + 1ul);
+		size_t *bucket_starts = offsets + parts * buckets;
+		clear(offsets, parts * buckets);
+		uchar_t *classes = allocate_uninitialized<uchar_t>(length);
+
+		parallel_for(
+		    0ul, parts,
+		    [&](size_t first_part, size_t last_part) {
+			    for (size_t part = first_part; part < last_part; part++) {
+				    size_t *counts = &offsets[part * buckets];
+				    size_t end = (part + 1ul) * part_length < length
+				                     ? (part + 1ul) * part_length
+				                     : length;
+				    for (size_t i = part * part_length; i < end; i++) {
+					    size_t bucket = sort_classify(splitters, levels,
+					                                  first[i], compare);
+					    classes[i] = static_cast<uchar_t>(bucket);
+					    counts[bucket]++;
+				    }
+			    }
+		    },
+		    1ul, pool);
+
+		// Buckets go one after another, and the parts of each bucket in
+		// order.
+		for (size_t bucket = 0ul, offset = 0ul; bucket < buckets; bucket++) {
+			bucket_starts[bucket] = offset;
+			for (size_t part = 0ul; part < parts; part++) {
+				size_t count = offsets[part * buckets + bucket];
+				offsets[part * buckets + bucket] = offset;
+				offset += count;
+			}
+		}
+		bucket_starts[buckets] = length;
+
+		type *buffer = allocate_uninitialized<type>(length);
+		parallel_for(
+		    0ul, parts,
+		    [&](size_t first_part, size_t last_part) {
+			    for (size_t part = first_part; part < last_part; part++) {
+				    size_t *positions = &offsets[part * buckets];
+				    size_t end = (part + 1ul) * part_length < length
+				                     ? (part + 1ul) * part_length
+				                     : length;
+				    for (size_t i = part * part_length; i < end; i++)
+					    relocate(first + i, buffer + positions[classes[i]]++,
+					             1ul);
+			    }
+		    },
+		    1ul, pool);
+		deallocate_raw(classes);
+
+		parallel_for(
+		    0ul, buckets,
+		    [&](size_t first_bucket, size_t last_bucket) {
+			    for (size_t bucket = first_bucket; bucket < last_bucket;
+			         bucket++) {
+				    size_t start = bucket_starts[bucket];
+				    size_t end = bucket_starts[bucket + 1ul];
+				    sort(buffer + start, buffer + end, compare);
+				    relocate(buffer + start, first + start, end - start);
+			    }
+		    },
+		    1ul, pool);
+		deallocate_raw(buffer);
+		deallocate_raw(offsets);
+	}
+	template<typename type, typename compare_type>
+	void_t parallel_sort(array<type> &values, const compare_type &compare,
+	                     thread_pool &pool) {
+		parallel_sort(values.begin(), values.end(), compare, pool);
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_algorithm_sort_impl_
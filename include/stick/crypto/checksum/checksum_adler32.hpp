@@ -0,0 +1,80 @@
+/**
+ * Adler-32 checksum algorithm.
+ * @brief Adler-32 checksum algorithm.
+ * @file checksum_adler32.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_crypto_checksum_adler32_)
+#	define _stick_lib_crypto_checksum_adler32_
+
+
+
+#	include "../../crypto/hash/base_hash.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Checksum some data at once with Adler-32.
+	 * @param [in] bytes Data to checksum.
+	 * @param [in] length Number of bytes to checksum.
+	 * @param [in] previous Checksum of the data preceding bytes, to continue
+	 * it. Default = 1, no preceding data.
+	 * @return Calculated checksum.
+	 */
+	uint32_t adler32(const void_t *bytes, size_t length,
+	                 uint32_t previous = 1u) noexcept;
+
+	/**
+	 * Get the checksum of two consecutive chunks from their checksums, so
+	 * chunks can be checksummed in parallel.
+	 * @param [in] first Checksum of the first chunk.
+	 * @param [in] second Checksum of the second chunk.
+	 * @param [in] second_length Number of bytes of the second chunk.
+	 * @return Checksum of both chunks one after the other.
+	 */
+	uint32_t adler32_combine(uint32_t first, uint32_t second,
+	                         size_t second_length) noexcept;
+
+
+	/**
+	 * Adler-32 checksum handler. Only produces 32 bits checksums.
+	 */
+	class checksum_adler32 final : public base_hash {
+
+		uint32_t state = 1u;   ///< Checksum of the data fed so far.
+
+		void_t process(const byte_t *bytes, size_t length) noexcept override;
+		void_t restart() noexcept override;
+		uint1024_t calculate_hash() const noexcept override;
+
+	public:
+		/**
+		 * Create an empty checksum to feed with update().
+		 */
+		checksum_adler32() noexcept;
+		/**
+		 * Create a checksum already fed with some data.
+		 * @param [in] data Data to checksum.
+		 */
+		explicit checksum_adler32(const string_view &data) noexcept;
+
+
+		using base_hash::hash;
+
+		/**
+		 * Checksum some data at once without creating a handler.
+		 * @param [in] bytes Data to checksum.
+		 * @param [in] length Number of bytes to checksum.
+		 * @return Calculated checksum.
+		 */
+		static uint64_t hash(const void_t *bytes, size_t length) noexcept;
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_crypto_checksum_adler32_
@@ -0,0 +1,82 @@
+/**
+ * CRC-32C (Castagnoli) checksum algorithm.
+ * @brief CRC-32C checksum algorithm.
+ * @file checksum_crc32c.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_crypto_checksum_crc32c_)
+#	define _stick_lib_crypto_checksum_crc32c_
+
+
+
+#	include "../../crypto/hash/base_hash.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Checksum some data at once with CRC-32C. Uses the SSE4.2 crc32
+	 * instruction over three interleaved streams when the CPU has it and
+	 * slicing-by-8 tables otherwise.
+	 * @param [in] bytes Data to checksum.
+	 * @param [in] length Number of bytes to checksum.
+	 * @param [in] previous Checksum of the data preceding bytes, to continue
+	 * it. Default = 0, no preceding data.
+	 * @return Calculated checksum.
+	 */
+	uint32_t crc32c(const void_t *bytes, size_t length,
+	                uint32_t previous = 0u) noexcept;
+
+	/**
+	 * Get the checksum of two consecutive chunks from their checksums, so
+	 * chunks can be checksummed in parallel. Takes O(log second_length).
+	 * @param [in] first Checksum of the first chunk.
+	 * @param [in] second Checksum of the second chunk.
+	 * @param [in] second_length Number of bytes of the second chunk.
+	 * @return Checksum of both chunks one after the other.
+	 */
+	uint32_t crc32c_combine(uint32_t first, uint32_t second,
+	                        size_t second_length) noexcept;
+
+
+	/**
+	 * CRC-32C checksum handler. Only produces 32 bits checksums.
+	 */
+	class checksum_crc32c final : public base_hash {
+
+		uint32_t state = 0u;   ///< Checksum of the data fed so far.
+
+		void_t process(const byte_t *bytes, size_t length) noexcept override;
+		void_t restart() noexcept override;
+		uint1024_t calculate_hash() const noexcept override;
+
+	public:
+		/**
+		 * Create an empty checksum to feed with update().
+		 */
+		checksum_crc32c() noexcept;
+		/**
+		 * Create a checksum already fed with some data.
+		 * @param [in] data Data to checksum.
+		 */
+		explicit checksum_crc32c(const string_view &data) noexcept;
+
+
+		using base_hash::hash;
+
+		/**
+		 * Checksum some data at once without creating a handler.
+		 * @param [in] bytes Data to checksum.
+		 * @param [in] length Number of bytes to checksum.
+		 * @return Calculated checksum.
+		 */
+		static uint64_t hash(const void_t *bytes, size_t length) noexcept;
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_crypto_checksum_crc32c_
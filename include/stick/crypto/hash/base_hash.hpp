@@ -11,6 +11,8 @@
 
 #	include "../../defines/types.hpp"
 #	include "../../string/string.hpp"
+#	include "../../string/string_view.hpp"
+#	include "../../templates/wide_uint.tpp"
 
 
 namespace stick {
@@ -25,6 +27,7 @@ namespace stick {
 		_32bit,
 		_64bit,
 		_128bit,
+		_160bit,
 		_256bit,
 		_512bit,
 		_1024bit
@@ -32,40 +35,93 @@ namespace stick {
 
 
 	/**
-	 * Base hash to implement all algorithms over it.
+	 * Base hash to implement all algorithms over it. Data is fed in chunks
+	 * with update() and never copied, derived classes only keep the state of
+	 * their algorithm.
 	 */
 	class base_hash {
 
-		string hash_data;   ///< String which was hashed.
-		uint64_t hash_result;   ///< The hashing result
+		uint1024_t hash_result;   ///< Cached result of the fed data.
+		bool_t result_ready = false;   ///< If the cached result is valid.
 		hash_size hash_length;   ///< The length of the implemented hash.
 
 	protected:
 		/**
 		 * Basic constructor for hash data.
+		 * @param [in] length Size of the implemented hash.
 		 */
-		base_hash(const string &data, hash_size length) noexcept;
+		explicit base_hash(hash_size length) noexcept;
 
 
 		/**
-		 * How to calculate hash. Should be implemented in all derived classes
-		 * since they are the ones to implement the specific hashing algorithm.
-		 * Must return the hash result!
+		 * Feed data to the algorithm state. Should be implemented in all
+		 * derived classes since they are the ones to implement the specific
+		 * hashing algorithm.
+		 * @param [in] bytes Data to process.
+		 * @param [in] length Number of bytes to process.
 		 */
-		virtual uint64_t calculate_hash() const noexcept = 0;
+		virtual void_t process(const byte_t *bytes, size_t length) noexcept = 0;
+
+		/**
+		 * Set the algorithm state back to its initial value.
+		 */
+		virtual void_t restart() noexcept = 0;
+
+		/**
+		 * How to calculate hash from the current state, which must be left
+		 * untouched so more data can be fed afterwards. Must return the hash
+		 * result, zero extended to 1024 bits!
+		 */
+		virtual uint1024_t calculate_hash() const noexcept = 0;
 
 	public:
 		/**
 		 * Destructor.
 		 */
-		~base_hash() noexcept;
+		virtual ~base_hash() noexcept = default;
+
+
+		/**
+		 * Feed more data to the hash.
+		 * @param [in] bytes Data to hash.
+		 * @param [in] length Number of bytes to hash.
+		 * @throw memory_error when bytes is nullptr and length is not 0.
+		 * @return Self instance.
+		 */
+		base_hash &update(const void_t *bytes, size_t length);
+		/**
+		 * Feed more data to the hash.
+		 * @param [in] data Characters to hash.
+		 * @return Self instance.
+		 */
+		base_hash &update(const string_view &data) noexcept;
+
+		/**
+		 * Get the hash of all the data fed so far. More data can still be fed
+		 * afterwards.
+		 * @return Calculated hash integer. Sizes over 64 bits give their 64
+		 * least significant bits.
+		 */
+		uint64_t finalize() noexcept;
+
+		/**
+		 * Forget all the data fed so far.
+		 * @return Self instance.
+		 */
+		base_hash &reset() noexcept;
 
 
 		/**
 		 * Get the integer hash result.
-		 * @return Calculated hash integer.
+		 * @return Calculated hash integer. Sizes over 64 bits give their 64
+		 * least significant bits.
 		 */
 		uint64_t hash() noexcept;
+		/**
+		 * Get the whole integer hash result, for any size.
+		 * @return Calculated hash integer, zero extended to 1024 bits.
+		 */
+		uint1024_t wide_hash() noexcept;
 
 		/**
 		 * Get the hash as a hexadecimal string.
@@ -76,11 +132,6 @@ namespace stick {
 		string hex_hash(bool_t prefix = false, bool_t caps = false) noexcept;
 
 
-		/**
-		 * Get the indicated hash data.
-		 * @return string with the data to be hashed.
-		 */
-		string data() const noexcept;
 		/**
 		 * Get the indicated hash size.
 		 * @return hash_size enum element indicating the size of the hash.
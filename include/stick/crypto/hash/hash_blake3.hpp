@@ -0,0 +1,124 @@
+/**
+ * BLAKE3 hash algorithm.
+ * @brief BLAKE3 hash algorithm.
+ * @file hash_blake3.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_crypto_hash_blake3_)
+#	define _stick_lib_crypto_hash_blake3_
+
+
+
+#	include "../../crypto/hash/base_hash.hpp"
+
+
+namespace stick {
+
+
+	/// Bytes of a default BLAKE3 digest.
+	static const size_t blake3_digest_length = 32ul;
+
+
+	/**
+	 * Hash some data at once with BLAKE3. Chunks are compressed many at once
+	 * with the widest vector unit available and big inputs are split in
+	 * subtrees hashed as tasks of the shared thread_pool.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @param [out] digest Where to write the digest.
+	 * @param [in] digest_length Number of bytes of the digest, any amount.
+	 * Default = 32.
+	 * @param [in] threads Most threads to hash with, 0 uses one per hardware
+	 * thread. Default = 1.
+	 */
+	void_t blake3(const void_t *bytes, size_t length, byte_t *digest,
+	              size_t digest_length = blake3_digest_length,
+	              size_t threads = 1ul) noexcept;
+
+	/**
+	 * Hash a whole file with BLAKE3, mapping it to memory instead of reading
+	 * it.
+	 * @param [in] path Path of the file.
+	 * @param [out] digest Where to write the digest.
+	 * @param [in] digest_length Number of bytes of the digest, any amount.
+	 * Default = 32.
+	 * @param [in] threads Most threads to hash with, 0 uses one per hardware
+	 * thread. Default = 0.
+	 * @throw generic_error when the file can not be opened or mapped.
+	 */
+	void_t blake3_file(const_cstring path, byte_t *digest,
+	                   size_t digest_length = blake3_digest_length,
+	                   size_t threads = 0ul);
+
+
+	/**
+	 * BLAKE3 hashing handler. Any size is produced from the extendable
+	 * output, the integer result reads the digest as a big endian number.
+	 */
+	class hash_blake3 final : public base_hash {
+
+		uint32_t chunk_state[8];   ///< Chaining state of the current chunk.
+		byte_t buffer[64];   ///< Last block of the current chunk.
+		size_t buffered = 0ul;   ///< Bytes waiting in the buffer.
+		size_t chunk_blocks = 0ul;   ///< Blocks compressed in the chunk.
+		uint64_t chunk_counter = 0ul;   ///< Index of the current chunk.
+		uint32_t stack[54][8];   ///< Chaining values of pending subtrees.
+		size_t stack_length = 0ul;   ///< Chaining values in the stack.
+		size_t threads;   ///< Most threads to hash big updates with.
+
+		void_t process(const byte_t *bytes, size_t length) noexcept override;
+		void_t restart() noexcept override;
+		uint1024_t calculate_hash() const noexcept override;
+
+		/**
+		 * Merge the chaining values of the subtrees completed before a
+		 * chunk.
+		 * @param [in] chunk Index of the chunk.
+		 */
+		void_t merge(uint64_t chunk) noexcept;
+		/**
+		 * Add a chaining value to the stack, merging first the subtrees
+		 * already completed before it.
+		 * @param [in] chaining_value Chaining value to add.
+		 * @param [in] chunk Index of its first chunk.
+		 */
+		void_t push(const uint32_t *chaining_value, uint64_t chunk) noexcept;
+
+	public:
+		/**
+		 * Create an empty hash to feed with update().
+		 * @param [in] length Size of the hash. Default = 256 bits.
+		 * @param [in] threads Most threads to hash big updates with, 0 uses
+		 * one per hardware thread. Default = 1.
+		 */
+		explicit hash_blake3(hash_size length = hash_size::_256bit,
+		                     size_t threads = 1ul) noexcept;
+		/**
+		 * Create a hash already fed with some data.
+		 * @param [in] data Data to hash.
+		 * @param [in] length Size of the hash. Default = 256 bits.
+		 * @param [in] threads Most threads to hash big updates with, 0 uses
+		 * one per hardware thread. Default = 1.
+		 */
+		explicit hash_blake3(const string_view &data,
+		                     hash_size length = hash_size::_256bit,
+		                     size_t threads = 1ul) noexcept;
+
+
+		/**
+		 * Get the digest of all the data fed so far. More data can still be
+		 * fed afterwards.
+		 * @param [out] output Where to write the digest.
+		 * @param [in] length Number of bytes of the digest, any amount.
+		 * Default = 32.
+		 */
+		void_t digest(byte_t *output,
+		              size_t length = blake3_digest_length) const noexcept;
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_crypto_hash_blake3_
@@ -20,11 +20,42 @@ namespace stick {
 	 */
 	class hash_fnv1 final : public base_hash {
 
-		uint64_t calculate_hash() const noexcept override;
+		uint1024_t state;   ///< Hash of the data fed so far.
+
+		void_t process(const byte_t *bytes, size_t length) noexcept override;
+		void_t restart() noexcept override;
+		uint1024_t calculate_hash() const noexcept override;
 
 	public:
-		explicit hash_fnv1(const string &data,
-		                   hash_size length = hash_size::_64bit);
+		/**
+		 * Create an empty hash to feed with update().
+		 * @param [in] length Size of the hash. Sizes under 32 bits use 32 bits
+		 * and 160 bits uses 256 bits. Default = 64 bits.
+		 */
+		explicit hash_fnv1(hash_size length = hash_size::_64bit) noexcept;
+		/**
+		 * Create a hash already fed with some data.
+		 * @param [in] data Data to hash.
+		 * @param [in] length Size of the hash. Sizes under 32 bits use 32 bits
+		 * and 160 bits uses 256 bits. Default = 64 bits.
+		 */
+		explicit hash_fnv1(const string_view &data,
+		                   hash_size length = hash_size::_64bit) noexcept;
+
+
+		using base_hash::hash;
+
+		/**
+		 * Hash some data at once without creating a handler.
+		 * @param [in] bytes Data to hash.
+		 * @param [in] length Number of bytes to hash.
+		 * @param [in] bits Size of the hash. Default = 64 bits.
+		 * @return Calculated hash integer. Sizes over 64 bits give their 64
+		 * least significant bits, use a handler and wide_hash() to get them
+		 * whole.
+		 */
+		static uint64_t hash(const void_t *bytes, size_t length,
+		                     hash_size bits = hash_size::_64bit) noexcept;
 	};
 
 
@@ -0,0 +1,84 @@
+/**
+ * HighwayHash keyed hash algorithm.
+ * @brief HighwayHash keyed hash algorithm.
+ * @file hash_highway.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_crypto_hash_highway_)
+#	define _stick_lib_crypto_hash_highway_
+
+
+
+#	include "../../crypto/hash/base_hash.hpp"
+
+
+namespace stick {
+
+
+	/// Bytes of a HighwayHash key.
+	static const size_t highway_key_length = 32ul;
+
+
+	/**
+	 * Hash some data at once with 64 bits HighwayHash. The four 64 bits
+	 * lanes of the state are updated at once with AVX2 when the CPU has it.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @param [in] key The 32 bytes of the key, nullptr uses hash_seed().
+	 * @return Calculated hash integer.
+	 */
+	uint64_t highwayhash_64(const void_t *bytes, size_t length,
+	                        const byte_t *key = nullptr) noexcept;
+
+
+	/**
+	 * HighwayHash hashing handler. Only produces 64 bits hashes.
+	 */
+	class hash_highway final : public base_hash {
+
+		uint64_t key[4];   ///< Key words of the hash.
+		uint64_t state[16];   ///< Lanes of v0, v1, mul0 and mul1.
+		byte_t buffer[32];   ///< Input not making a whole packet yet.
+		size_t buffered = 0ul;   ///< Bytes waiting in the buffer.
+
+		void_t process(const byte_t *bytes, size_t length) noexcept override;
+		void_t restart() noexcept override;
+		uint1024_t calculate_hash() const noexcept override;
+
+	public:
+		/**
+		 * Create an empty hash to feed with update().
+		 * @param [in] key The 32 bytes of the key, nullptr uses hash_seed().
+		 * Default = nullptr.
+		 */
+		explicit hash_highway(const byte_t *key = nullptr) noexcept;
+		/**
+		 * Create a hash already fed with some data.
+		 * @param [in] data Data to hash.
+		 * @param [in] key The 32 bytes of the key, nullptr uses hash_seed().
+		 * Default = nullptr.
+		 */
+		explicit hash_highway(const string_view &data,
+		                      const byte_t *key = nullptr) noexcept;
+
+
+		using base_hash::hash;
+
+		/**
+		 * Hash some data at once without creating a handler.
+		 * @param [in] bytes Data to hash.
+		 * @param [in] length Number of bytes to hash.
+		 * @param [in] key The 32 bytes of the key, nullptr uses hash_seed().
+		 * Default = nullptr.
+		 * @return Calculated hash integer.
+		 */
+		static uint64_t hash(const void_t *bytes, size_t length,
+		                     const byte_t *key = nullptr) noexcept;
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_crypto_hash_highway_
@@ -0,0 +1,36 @@
+/**
+ * Random seed of the keyed hashes.
+ * @brief Random seed of the keyed hashes.
+ * @file hash_seed.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_crypto_hash_seed_)
+#	define _stick_lib_crypto_hash_seed_
+
+
+
+#	include "../../defines/types.hpp"
+
+
+namespace stick {
+
+
+	/// Bytes of the process hash seed, enough to key any keyed hash.
+	static const size_t hash_seed_length = 32ul;
+
+
+	/**
+	 * Get the random bytes drawn once per process to key hashes with. Tables
+	 * keyed on untrusted data hash with it, so nobody outside the process
+	 * can know which keys collide.
+	 * @return Pointer to the hash_seed_length bytes of the seed, the same
+	 * during the whole process.
+	 */
+	const byte_t *hash_seed() noexcept;
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_crypto_hash_seed_
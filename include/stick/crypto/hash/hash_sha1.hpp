@@ -0,0 +1,78 @@
+/**
+ * SHA-1 hash algorithm.
+ * @brief SHA-1 hash algorithm.
+ * @file hash_sha1.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_crypto_hash_sha1_)
+#	define _stick_lib_crypto_hash_sha1_
+
+
+
+#	include "../../crypto/hash/base_hash.hpp"
+
+
+namespace stick {
+
+
+	/// Bytes of a SHA-1 digest.
+	static const size_t sha1_digest_length = 20ul;
+
+
+	/**
+	 * Hash some data at once with SHA-1. Uses the SHA extensions when the
+	 * CPU has them. SHA-1 is broken, only use it for legacy formats.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @param [out] digest Where to write the 20 bytes of the digest.
+	 */
+	void_t sha1(const void_t *bytes, size_t length, byte_t *digest) noexcept;
+
+
+	/**
+	 * SHA-1 hashing handler. Only produces 160 bits hashes, the integer
+	 * result reads the digest as a big endian number.
+	 */
+	class hash_sha1 final : public base_hash {
+
+		uint32_t state[5];   ///< Chaining state of the processed blocks.
+		byte_t buffer[64];   ///< Input not making a whole block yet.
+		size_t buffered = 0ul;   ///< Bytes waiting in the buffer.
+		uint64_t total_length = 0ul;   ///< Bytes fed so far.
+
+		void_t process(const byte_t *bytes, size_t length) noexcept override;
+		void_t restart() noexcept override;
+		uint1024_t calculate_hash() const noexcept override;
+
+		/**
+		 * Pad the buffered input on a copy of the state.
+		 * @param [out] result Where to write the final 5 state words.
+		 */
+		void_t finish(uint32_t *result) const noexcept;
+
+	public:
+		/**
+		 * Create an empty hash to feed with update().
+		 */
+		hash_sha1() noexcept;
+		/**
+		 * Create a hash already fed with some data.
+		 * @param [in] data Data to hash.
+		 */
+		explicit hash_sha1(const string_view &data) noexcept;
+
+
+		/**
+		 * Get the digest of all the data fed so far. More data can still be
+		 * fed afterwards.
+		 * @param [out] output Where to write the 20 bytes of the digest.
+		 */
+		void_t digest(byte_t *output) const noexcept;
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_crypto_hash_sha1_
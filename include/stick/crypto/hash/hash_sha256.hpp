@@ -0,0 +1,91 @@
+/**
+ * SHA-256 hash algorithm.
+ * @brief SHA-256 hash algorithm.
+ * @file hash_sha256.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_crypto_hash_sha256_)
+#	define _stick_lib_crypto_hash_sha256_
+
+
+
+#	include "../../crypto/hash/base_hash.hpp"
+
+
+namespace stick {
+
+
+	/// Bytes of a SHA-256 digest.
+	static const size_t sha256_digest_length = 32ul;
+
+
+	/**
+	 * Hash some data at once with SHA-256. Uses the SHA extensions when the
+	 * CPU has them.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @param [out] digest Where to write the 32 bytes of the digest.
+	 */
+	void_t sha256(const void_t *bytes, size_t length, byte_t *digest) noexcept;
+
+	/**
+	 * Hash many independent messages with SHA-256. Without SHA extensions,
+	 * up to 8 messages are hashed at once in the lanes of the AVX2 vectors
+	 * and a lane takes the next message as soon as its current one is done.
+	 * @param [in] messages Data of every message.
+	 * @param [in] lengths Number of bytes of every message.
+	 * @param [out] digests Where to write the 32 bytes digest of every
+	 * message, one after the other.
+	 * @param [in] amount Number of messages.
+	 */
+	void_t sha256_multi(const void_t *const *messages, const size_t *lengths,
+	                    byte_t *digests, size_t amount) noexcept;
+
+
+	/**
+	 * SHA-256 hashing handler. Only produces 256 bits hashes, the integer
+	 * result reads the digest as a big endian number.
+	 */
+	class hash_sha256 final : public base_hash {
+
+		uint32_t state[8];   ///< Chaining state of the processed blocks.
+		byte_t buffer[64];   ///< Input not making a whole block yet.
+		size_t buffered = 0ul;   ///< Bytes waiting in the buffer.
+		uint64_t total_length = 0ul;   ///< Bytes fed so far.
+
+		void_t process(const byte_t *bytes, size_t length) noexcept override;
+		void_t restart() noexcept override;
+		uint1024_t calculate_hash() const noexcept override;
+
+		/**
+		 * Pad the buffered input on a copy of the state.
+		 * @param [out] result Where to write the final 8 state words.
+		 */
+		void_t finish(uint32_t *result) const noexcept;
+
+	public:
+		/**
+		 * Create an empty hash to feed with update().
+		 */
+		hash_sha256() noexcept;
+		/**
+		 * Create a hash already fed with some data.
+		 * @param [in] data Data to hash.
+		 */
+		explicit hash_sha256(const string_view &data) noexcept;
+
+
+		/**
+		 * Get the digest of all the data fed so far. More data can still be
+		 * fed afterwards.
+		 * @param [out] output Where to write the 32 bytes of the digest.
+		 */
+		void_t digest(byte_t *output) const noexcept;
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_crypto_hash_sha256_
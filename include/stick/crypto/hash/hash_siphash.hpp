@@ -0,0 +1,110 @@
+/**
+ * SipHash keyed hash algorithm.
+ * @brief SipHash keyed hash algorithm.
+ * @file hash_siphash.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_crypto_hash_siphash_)
+#	define _stick_lib_crypto_hash_siphash_
+
+
+
+#	include "../../crypto/hash/base_hash.hpp"
+
+
+namespace stick {
+
+
+	/// Bytes of a SipHash key.
+	static const size_t siphash_key_length = 16ul;
+
+
+	/**
+	 * Hash some data at once with SipHash-2-4, the standard variant.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @param [in] key The 16 bytes of the key, nullptr uses the first bytes
+	 * of hash_seed().
+	 * @return Calculated hash integer.
+	 */
+	uint64_t siphash_2_4(const void_t *bytes, size_t length,
+	                     const byte_t *key = nullptr) noexcept;
+
+	/**
+	 * Hash some data at once with SipHash-1-3, the faster variant with less
+	 * rounds meant for hash tables.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @param [in] key The 16 bytes of the key, nullptr uses the first bytes
+	 * of hash_seed().
+	 * @return Calculated hash integer.
+	 */
+	uint64_t siphash_1_3(const void_t *bytes, size_t length,
+	                     const byte_t *key = nullptr) noexcept;
+
+
+	/**
+	 * SipHash hashing handler, for any number of rounds. Only produces 64
+	 * bits hashes.
+	 */
+	class hash_siphash final : public base_hash {
+
+		uint64_t key[2];   ///< Key words of the hash.
+		uint64_t state[4];   ///< Lanes of the processed words.
+		byte_t buffer[8];   ///< Input not making a whole word yet.
+		size_t buffered = 0ul;   ///< Bytes waiting in the buffer.
+		uint64_t total_length = 0ul;   ///< Bytes fed so far.
+		size_t compression_rounds;   ///< Rounds per word of input.
+		size_t finalization_rounds;   ///< Rounds at the end of the input.
+
+		void_t process(const byte_t *bytes, size_t length) noexcept override;
+		void_t restart() noexcept override;
+		uint1024_t calculate_hash() const noexcept override;
+
+	public:
+		/**
+		 * Create an empty hash to feed with update().
+		 * @param [in] key The 16 bytes of the key, nullptr uses the first
+		 * bytes of hash_seed(). Default = nullptr.
+		 * @param [in] compression_rounds Rounds per word of input. Default = 2.
+		 * @param [in] finalization_rounds Rounds at the end of the input.
+		 * Default = 4.
+		 */
+		explicit hash_siphash(const byte_t *key = nullptr,
+		                      size_t compression_rounds = 2ul,
+		                      size_t finalization_rounds = 4ul) noexcept;
+		/**
+		 * Create a hash already fed with some data.
+		 * @param [in] data Data to hash.
+		 * @param [in] key The 16 bytes of the key, nullptr uses the first
+		 * bytes of hash_seed(). Default = nullptr.
+		 * @param [in] compression_rounds Rounds per word of input. Default = 2.
+		 * @param [in] finalization_rounds Rounds at the end of the input.
+		 * Default = 4.
+		 */
+		explicit hash_siphash(const string_view &data,
+		                      const byte_t *key = nullptr,
+		                      size_t compression_rounds = 2ul,
+		                      size_t finalization_rounds = 4ul) noexcept;
+
+
+		using base_hash::hash;
+
+		/**
+		 * Hash some data at once with SipHash-2-4 without creating a handler.
+		 * @param [in] bytes Data to hash.
+		 * @param [in] length Number of bytes to hash.
+		 * @param [in] key The 16 bytes of the key, nullptr uses the first
+		 * bytes of hash_seed(). Default = nullptr.
+		 * @return Calculated hash integer.
+		 */
+		static uint64_t hash(const void_t *bytes, size_t length,
+		                     const byte_t *key = nullptr) noexcept;
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_crypto_hash_siphash_
@@ -0,0 +1,105 @@
+/**
+ * wyhash hash algorithm.
+ * @brief wyhash hash algorithm.
+ * @file hash_wyhash.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_crypto_hash_wyhash_)
+#	define _stick_lib_crypto_hash_wyhash_
+
+
+
+#	include "../../crypto/hash/base_hash.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Hash some data at once with 64 bits wyhash.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @param [in] seed Seed to derive the hash from. Default = 0.
+	 * @return Calculated hash integer.
+	 */
+	uint64_t wyhash(const void_t *bytes, size_t length,
+	                uint64_t seed = 0ul) noexcept;
+
+	/**
+	 * Hash many independent keys at once with 64 bits wyhash. Keys up to 16
+	 * bytes are hashed inline without waiting for each other, so the
+	 * multiplies of consecutive keys overlap in the pipeline.
+	 * @param [in] keys Data of every key.
+	 * @param [in] lengths Number of bytes of every key.
+	 * @param [out] hashes Where to write the hash of every key.
+	 * @param [in] amount Number of keys.
+	 * @param [in] seed Seed to derive the hashes from. Default = 0.
+	 */
+	void_t wyhash_batch(const void_t *const *keys, const size_t *lengths,
+	                    uint64_t *hashes, size_t amount,
+	                    uint64_t seed = 0ul) noexcept;
+
+
+	/**
+	 * wyhash hashing handler. Only produces 64 bits hashes.
+	 */
+	class hash_wyhash final : public base_hash {
+
+		uint64_t seed;   ///< Seed of the hash.
+		uint64_t state;   ///< Main lane of the running hash.
+		uint64_t first_lane;   ///< Second lane of the 48 bytes rounds.
+		uint64_t second_lane;   ///< Third lane of the 48 bytes rounds.
+		byte_t buffer[64];   ///< Last 16 processed bytes and pending input.
+		size_t buffered = 0ul;   ///< Bytes pending after the first 16.
+		uint64_t total_length = 0ul;   ///< Bytes fed so far.
+
+		void_t process(const byte_t *bytes, size_t length) noexcept override;
+		void_t restart() noexcept override;
+		uint1024_t calculate_hash() const noexcept override;
+
+	public:
+		/**
+		 * Create an empty hash to feed with update().
+		 * @param [in] seed Seed to derive the hash from. Default = 0.
+		 */
+		explicit hash_wyhash(uint64_t seed = 0ul) noexcept;
+		/**
+		 * Create a hash already fed with some data.
+		 * @param [in] data Data to hash.
+		 * @param [in] seed Seed to derive the hash from. Default = 0.
+		 */
+		explicit hash_wyhash(const string_view &data,
+		                     uint64_t seed = 0ul) noexcept;
+
+
+		using base_hash::hash;
+
+		/**
+		 * Hash some data at once without creating a handler.
+		 * @param [in] bytes Data to hash.
+		 * @param [in] length Number of bytes to hash.
+		 * @param [in] seed Seed to derive the hash from. Default = 0.
+		 * @return Calculated hash integer.
+		 */
+		static uint64_t hash(const void_t *bytes, size_t length,
+		                     uint64_t seed = 0ul) noexcept;
+		/**
+		 * Hash many independent keys at once without creating a handler,
+		 * see wyhash_batch().
+		 * @param [in] keys Data of every key.
+		 * @param [in] lengths Number of bytes of every key.
+		 * @param [out] hashes Where to write the hash of every key.
+		 * @param [in] amount Number of keys.
+		 * @param [in] seed Seed to derive the hashes from. Default = 0.
+		 */
+		static void_t hash_batch(const void_t *const *keys,
+		                         const size_t *lengths, uint64_t *hashes,
+		                         size_t amount, uint64_t seed = 0ul) noexcept;
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_crypto_hash_wyhash_
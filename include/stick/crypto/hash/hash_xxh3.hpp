@@ -0,0 +1,135 @@
+/**
+ * XXH3 hash algorithm, 64 and 128 bits variants.
+ * @brief XXH3 hash algorithm.
+ * @file hash_xxh3.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_crypto_hash_xxh3_)
+#	define _stick_lib_crypto_hash_xxh3_
+
+
+
+#	include "../../crypto/hash/base_hash.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Hash some data at once with 64 bits XXH3.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @param [in] seed Seed to derive the hash from. Default = 0.
+	 * @return Calculated hash integer.
+	 */
+	uint64_t xxh3_64(const void_t *bytes, size_t length,
+	                 uint64_t seed = 0ul) noexcept;
+
+	/**
+	 * Hash some data at once with 128 bits XXH3.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @param [in] seed Seed to derive the hash from. Default = 0.
+	 * @return Calculated hash integer.
+	 */
+	uint128_t xxh3_128(const void_t *bytes, size_t length,
+	                   uint64_t seed = 0ul) noexcept;
+
+	/**
+	 * Hash many independent keys at once with 64 bits XXH3. Keys up to 16
+	 * bytes are hashed inline without waiting for each other, so the
+	 * multiplies of consecutive keys overlap in the pipeline.
+	 * @param [in] keys Data of every key.
+	 * @param [in] lengths Number of bytes of every key.
+	 * @param [out] hashes Where to write the hash of every key.
+	 * @param [in] amount Number of keys.
+	 * @param [in] seed Seed to derive the hashes from. Default = 0.
+	 */
+	void_t xxh3_64_batch(const void_t *const *keys, const size_t *lengths,
+	                     uint64_t *hashes, size_t amount,
+	                     uint64_t seed = 0ul) noexcept;
+
+
+	/**
+	 * XXH3 hashing handler. Long inputs are accumulated 64 bytes stripes at a
+	 * time with the widest vector unit available.
+	 */
+	class hash_xxh3 final : public base_hash {
+
+		uint64_t accumulators[8];   ///< Long input accumulators.
+		byte_t secret[192];   ///< Secret derived from the seed.
+		byte_t buffer[256];   ///< Input not accumulated yet.
+		size_t buffered = 0ul;   ///< Bytes waiting in the buffer.
+		size_t stripes = 0ul;   ///< Stripes accumulated in the current block.
+		uint64_t total_length = 0ul;   ///< Bytes fed so far.
+		uint64_t seed;   ///< Seed of the hash.
+
+		void_t process(const byte_t *bytes, size_t length) noexcept override;
+		void_t restart() noexcept override;
+		uint1024_t calculate_hash() const noexcept override;
+
+		/**
+		 * Accumulate the buffered input tail on a copy of the accumulators.
+		 * @param [out] last_accumulators Where to copy the accumulators.
+		 */
+		void_t digest_long(uint64_t *last_accumulators) const noexcept;
+
+	public:
+		/**
+		 * Create an empty hash to feed with update().
+		 * @param [in] length Size of the hash. Sizes up to 64 bits use 64 bits
+		 * and bigger sizes use 128 bits. Default = 64 bits.
+		 * @param [in] seed Seed to derive the hash from. Default = 0.
+		 */
+		explicit hash_xxh3(hash_size length = hash_size::_64bit,
+		                   uint64_t seed = 0ul) noexcept;
+		/**
+		 * Create a hash already fed with some data.
+		 * @param [in] data Data to hash.
+		 * @param [in] length Size of the hash. Sizes up to 64 bits use 64 bits
+		 * and bigger sizes use 128 bits. Default = 64 bits.
+		 * @param [in] seed Seed to derive the hash from. Default = 0.
+		 */
+		explicit hash_xxh3(const string_view &data,
+		                   hash_size length = hash_size::_64bit,
+		                   uint64_t seed = 0ul) noexcept;
+
+
+		/**
+		 * Get the 128 bits hash of all the data fed so far.
+		 * @return Calculated 128 bits hash integer.
+		 */
+		uint128_t finalize_128() const noexcept;
+
+
+		using base_hash::hash;
+
+		/**
+		 * Hash some data at once without creating a handler.
+		 * @param [in] bytes Data to hash.
+		 * @param [in] length Number of bytes to hash.
+		 * @param [in] seed Seed to derive the hash from. Default = 0.
+		 * @return Calculated 64 bits hash integer.
+		 */
+		static uint64_t hash(const void_t *bytes, size_t length,
+		                     uint64_t seed = 0ul) noexcept;
+		/**
+		 * Hash many independent keys at once without creating a handler,
+		 * see xxh3_64_batch().
+		 * @param [in] keys Data of every key.
+		 * @param [in] lengths Number of bytes of every key.
+		 * @param [out] hashes Where to write the 64 bits hash of every key.
+		 * @param [in] amount Number of keys.
+		 * @param [in] seed Seed to derive the hashes from. Default = 0.
+		 */
+		static void_t hash_batch(const void_t *const *keys,
+		                         const size_t *lengths, uint64_t *hashes,
+		                         size_t amount, uint64_t seed = 0ul) noexcept;
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_crypto_hash_xxh3_
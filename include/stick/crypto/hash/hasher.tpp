@@ -0,0 +1,141 @@
+/**
+ * Hash function objects for containers.
+ * @brief Hash function objects for containers.
+ * @file hasher.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_crypto_hash_hasher_)
+#	define _stick_lib_crypto_hash_hasher_
+
+
+
+#	include "../../defines/types.hpp"
+#	include "../../string/string.hpp"
+#	include "../../string/string_view.hpp"
+#	include "../../string/wstring.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Hash function object for the keys of containers. Types opt in by
+	 * specializing it with a const operator() taking the key and returning
+	 * a uint64_t. The provided ones hash with SipHash-1-3 keyed by
+	 * hash_seed(), so nobody outside the process can flood a table with
+	 * colliding keys.
+	 * @tparam type Type of the keys.
+	 */
+	template<typename type>
+	struct hasher;
+
+
+	/**
+	 * Hasher of the types whose value is their bytes, like integers and
+	 * pointers.
+	 * @tparam type Type of the keys.
+	 */
+	template<typename type>
+	struct bytes_hasher {
+		/**
+		 * Hash a key.
+		 * @param [in] value Key to hash.
+		 * @return Hash of the key.
+		 */
+		uint64_t operator()(const type &value) const noexcept;
+	};
+
+	/**
+	 * Hasher of floating point numbers, both zeros hash the same.
+	 * @tparam type Type of the keys.
+	 */
+	template<typename type>
+	struct floating_hasher {
+		/**
+		 * Hash a key.
+		 * @param [in] value Key to hash.
+		 * @return Hash of the key.
+		 */
+		uint64_t operator()(type value) const noexcept;
+	};
+
+
+	template<>
+	struct hasher<bool_t> : bytes_hasher<bool_t> {};
+	template<>
+	struct hasher<char_t> : bytes_hasher<char_t> {};
+	template<>
+	struct hasher<schar_t> : bytes_hasher<schar_t> {};
+	template<>
+	struct hasher<uchar_t> : bytes_hasher<uchar_t> {};
+	template<>
+	struct hasher<wchar_t> : bytes_hasher<wchar_t> {};
+	template<>
+	struct hasher<short_t> : bytes_hasher<short_t> {};
+	template<>
+	struct hasher<ushort_t> : bytes_hasher<ushort_t> {};
+	template<>
+	struct hasher<int_t> : bytes_hasher<int_t> {};
+	template<>
+	struct hasher<uint_t> : bytes_hasher<uint_t> {};
+	template<>
+	struct hasher<long_t> : bytes_hasher<long_t> {};
+	template<>
+	struct hasher<ulong_t> : bytes_hasher<ulong_t> {};
+	template<>
+	struct hasher<llong_t> : bytes_hasher<llong_t> {};
+	template<>
+	struct hasher<ullong_t> : bytes_hasher<ullong_t> {};
+	template<>
+	struct hasher<float_t> : floating_hasher<float_t> {};
+	template<>
+	struct hasher<double_t> : floating_hasher<double_t> {};
+	template<typename type>
+	struct hasher<type *> : bytes_hasher<type *> {};
+
+
+	template<>
+	struct hasher<string_view> {
+		/**
+		 * Hash the characters of a view.
+		 * @param [in] value View to hash.
+		 * @return Hash of the characters.
+		 */
+		uint64_t operator()(const string_view &value) const noexcept;
+	};
+	template<>
+	struct hasher<string> {
+		/**
+		 * Hash the characters of a string, the same as a view of them.
+		 * @param [in] value String to hash.
+		 * @return Hash of the characters.
+		 */
+		uint64_t operator()(const string &value) const noexcept;
+		/**
+		 * Hash some characters the same as a string holding them, so string
+		 * keys can be looked up by view.
+		 * @param [in] value View to hash.
+		 * @return Hash of the characters.
+		 */
+		uint64_t operator()(const string_view &value) const noexcept;
+	};
+	template<>
+	struct hasher<wstring> {
+		/**
+		 * Hash the characters of a wide string.
+		 * @param [in] value String to hash.
+		 * @return Hash of the characters.
+		 */
+		uint64_t operator()(const wstring &value) const noexcept;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_crypto_hash_hasher_impl_
+#	include "../../crypto/hash/hasher_impl.tpp"
+#	undef _stick_lib_crypto_hash_hasher_impl_
+
+
+#endif   //_stick_lib_crypto_hash_hasher_
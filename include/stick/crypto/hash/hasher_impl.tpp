@@ -0,0 +1,59 @@
+/**
+ * Hash function objects for containers. Template implementations.
+ * @brief Hash function objects for containers implementations.
+ * @file hasher_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_crypto_hash_hasher_impl_)
+
+
+#	include "../../crypto/hash/hash_siphash.hpp"
+
+
+namespace stick {
+
+
+	template<typename type>
+	inline uint64_t
+	bytes_hasher<type>::operator()(const type &value) const noexcept {
+		return siphash_1_3(&value, sizeof(type));
+	}
+
+	template<typename type>
+	inline uint64_t
+	floating_hasher<type>::operator()(type value) const noexcept {
+		// -0 equals 0, so it must hash the same.
+		if (value == type(0))
+			value = type(0);
+
+		return siphash_1_3(&value, sizeof(type));
+	}
+
+
+	inline uint64_t
+	hasher<string_view>::operator()(const string_view &value) const noexcept {
+		return siphash_1_3(value.data(), value.length());
+	}
+
+	inline uint64_t
+	hasher<string>::operator()(const string &value) const noexcept {
+		return siphash_1_3(value.begin(), value.length());
+	}
+
+	inline uint64_t
+	hasher<string>::operator()(const string_view &value) const noexcept {
+		return siphash_1_3(value.data(), value.length());
+	}
+
+	inline uint64_t
+	hasher<wstring>::operator()(const wstring &value) const noexcept {
+		return siphash_1_3(value.begin(), value.length() * sizeof(wchar_t));
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_crypto_hash_hasher_impl_
@@ -12,7 +12,9 @@
 
 #	include "../data_structures/list_constexpr.hpp"
 #	include "../defines/types.hpp"
-#	include "../memory/scoped_pointer.tpp"
+#	include "../memory/shared_buffer.tpp"
+#	include "../memory/storage.tpp"
+#	include "../templates/traits.tpp"
 
 
 namespace stick {
@@ -21,11 +23,71 @@ namespace stick {
 	template<typename type>
 	class array {
 
-		scoped_pointer<type> data;
+		/// Uninitialized memory for a value.
+		typedef storage_aligned<sizeof(type), alignof(type)> slot_storage;
+
+		shared_buffer<slot_storage> data;
 		size_t data_start = 0ul;
 		size_t data_size = 0ul;
 		size_t front_pool = 0ul;
 		size_t back_pool = 0ul;
+		bool_t shareable = false;   ///< Whether copies share the values.
+		/// Whether a writable pointer to the values was handed out.
+		bool_t leaked = false;
+
+
+		/**
+		 * Relocate the values to new memory with the given free room around
+		 * them, or free the memory if there is nothing to keep. Values shared
+		 * with other arrays are copied instead.
+		 * @param [in] front_room Free elements before the values.
+		 * @param [in] back_room Free elements after the values.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		void_t reallocate(size_t front_room, size_t back_room);
+		/**
+		 * Open an uninitialized gap at a given position, shifting the
+		 * shortest side that has room and growing the array if none has.
+		 * @param [in] position Position of the gap, not greater than size.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Uninitialized memory where the new value must be built.
+		 */
+		type *open_gap(size_t position);
+		/**
+		 * Build a value at a given position without handing it out, so
+		 * copies can keep sharing the values.
+		 * @tparam argument_types Types of the constructor arguments.
+		 * @param [in] position Position to build the value in.
+		 * @param [in] arguments Arguments for the constructor of the value.
+		 * @throw out_of_range_error when inserting in an invalid position.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Pointer to the new value.
+		 */
+		template<typename... argument_types>
+		type *insert(size_t position, argument_types &&...arguments);
+		/**
+		 * Copy the values if other arrays share them, before writing.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		void_t own();
+		/**
+		 * Copy the values if other arrays share them and keep copies from
+		 * sharing them, before handing out a writable pointer or reference.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		void_t leak();
+		/**
+		 * Begin iterator for writes of the array itself, copying the values
+		 * first if they are shared. Unlike begin(), copies keep sharing them.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Pointer to the first element.
+		 */
+		type *owned_begin();
+		/**
+		 * Stop owning the values, destroying them if no other array shares
+		 * them.
+		 */
+		void_t release_values() noexcept;
 
 	protected:
 		/**
@@ -106,15 +168,17 @@ namespace stick {
 		 * beginning of the array.
 		 * @param [in] back_pool_length Extra element to reserve space at the
 		 * end of the array.
-		 * @throw memory_error when copying from a nullptr or allocating 0 byte.
+		 * @throw memory_error when memory cannot be allocated.
 		 */
 		explicit array(size_t size, size_t front_pool_length = 0ul,
 		               size_t back_pool_length = 0ul);
 		/**
-		 * Default copy constructor.
+		 * Copy constructor. Copies the values and the pool settings, or
+		 * shares the values if the array is shareable.
 		 * @param [in] array Array to copy from.
+		 * @throw memory_error when memory cannot be allocated.
 		 */
-		array(const array &array) noexcept = default;
+		array(const array &array);
 		/**
 		 * Move constructor.
 		 * @param [in,out] array Array to move from and clear.
@@ -132,23 +196,51 @@ namespace stick {
 		 * Begin iterator.
 		 * @return Pointer to the first element.
 		 */
-		type *begin() const noexcept;
+		const type *begin() const noexcept;
+		/**
+		 * Begin iterator, copying the values first if they are shared. Copies
+		 * stop sharing them while the pointer may be written through.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Pointer to the first element.
+		 */
+		type *begin();
 		/**
 		 * End iterator.
 		 * @return Pointer to one element after the last.
 		 */
-		type *end() const noexcept;
+		const type *end() const noexcept;
+		/**
+		 * End iterator, copying the values first if they are shared. Copies
+		 * stop sharing them while the pointer may be written through.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Pointer to one element after the last.
+		 */
+		type *end();
 
 		/**
 		 * Reverse begin iterator.
 		 * @return Pointer to the last element.
 		 */
-		type *rbegin() const noexcept;
+		const type *rbegin() const noexcept;
+		/**
+		 * Reverse begin iterator, copying the values first if they are shared.
+		 * Copies stop sharing them while the pointer may be written through.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Pointer to the last element.
+		 */
+		type *rbegin();
 		/**
 		 * Reverse end iterator.
 		 * @return Pointer to one element before the first.
 		 */
-		type *rend() const noexcept;
+		const type *rend() const noexcept;
+		/**
+		 * Reverse end iterator, copying the values first if they are shared.
+		 * Copies stop sharing them while the pointer may be written through.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Pointer to one element before the first.
+		 */
+		type *rend();
 
 
 
@@ -196,6 +288,21 @@ namespace stick {
 		 */
 		array &set_back_pool(size_t size) noexcept;
 
+		/**
+		 * Make copies of this array share its values instead of copying them.
+		 * Every array sharing the values copies them before its first write,
+		 * so copies that are only read never allocate. Once a writable pointer
+		 * or reference is taken, copies get their own values again until the
+		 * array allocates new memory.
+		 * @return Self instance.
+		 */
+		array &share() noexcept;
+		/**
+		 * Check if copies of this array share its values.
+		 * @return True if copies share the values, false otherwise.
+		 */
+		bool_t is_shareable() const noexcept;
+
 
 		/**
 		 * Expand the allocated memory to fit more values preserving the current
@@ -279,18 +386,90 @@ namespace stick {
 		 * @return Self instance.
 		 */
 		array &push(const type &value, uint32_t position);
+		/**
+		 * Move a value into a given position in the array.
+		 * @param [in,out] value Value to be moved in.
+		 * @param [in] position Position to insert the value in.
+		 * @throw out_of_range_error when inserting in an invalid position.
+		 * @return Self instance.
+		 */
+		array &push(type &&value, ssize_t position);
+		/**
+		 * Move a value into a given position in the array.
+		 * @param [in,out] value Value to be moved in.
+		 * @param [in] position Position to insert the value in.
+		 * @throw out_of_range_error when inserting in an invalid position.
+		 * @return Self instance.
+		 */
+		array &push(type &&value, size_t position);
+		/**
+		 * Move a value into a given position in the array.
+		 * @param [in,out] value Value to be moved in.
+		 * @param [in] position Position to insert the value in.
+		 * @throw out_of_range_error when inserting in an invalid position.
+		 * @return Self instance.
+		 */
+		array &push(type &&value, int32_t position);
+		/**
+		 * Move a value into a given position in the array.
+		 * @param [in,out] value Value to be moved in.
+		 * @param [in] position Position to insert the value in.
+		 * @throw out_of_range_error when inserting in an invalid position.
+		 * @return Self instance.
+		 */
+		array &push(type &&value, uint32_t position);
 		/**
 		 * Insert a value at the beginning of the array.
 		 * @param [in] value Value to be inserted.
 		 * @return Self instance.
 		 */
 		array &push_front(const type &value) noexcept;
+		/**
+		 * Move a value into the beginning of the array.
+		 * @param [in,out] value Value to be moved in.
+		 * @return Self instance.
+		 */
+		array &push_front(type &&value) noexcept;
 		/**
 		 * Insert a value at the end of the array.
 		 * @param [in] value Value to be inserted.
 		 * @return Self instance.
 		 */
 		array &push_back(const type &value) noexcept;
+		/**
+		 * Move a value into the end of the array.
+		 * @param [in,out] value Value to be moved in.
+		 * @return Self instance.
+		 */
+		array &push_back(type &&value) noexcept;
+
+		/**
+		 * Build a value in place at a given position in the array. Copies stop
+		 * sharing the values while the reference may be written through.
+		 * @tparam argument_types Types of the constructor arguments.
+		 * @param [in] position Position to build the value in.
+		 * @param [in] arguments Arguments for the constructor of the value.
+		 * @throw out_of_range_error when inserting in an invalid position.
+		 * @return Reference to the new value.
+		 */
+		template<typename... argument_types>
+		type &emplace(size_t position, argument_types &&...arguments);
+		/**
+		 * Build a value in place at the beginning of the array.
+		 * @tparam argument_types Types of the constructor arguments.
+		 * @param [in] arguments Arguments for the constructor of the value.
+		 * @return Reference to the new value.
+		 */
+		template<typename... argument_types>
+		type &emplace_front(argument_types &&...arguments);
+		/**
+		 * Build a value in place at the end of the array.
+		 * @tparam argument_types Types of the constructor arguments.
+		 * @param [in] arguments Arguments for the constructor of the value.
+		 * @return Reference to the new value.
+		 */
+		template<typename... argument_types>
+		type &emplace_back(argument_types &&...arguments);
 
 
 		/**
@@ -349,14 +528,14 @@ namespace stick {
 		 * @throw out_of_range_error when accessing a value outside the array.
 		 * @return The value stored in the given position.
 		 */
-		type &operator[](ssize_t position) const;
+		const type &operator[](ssize_t position) const;
 		/**
 		 * Get the value at a given position.
 		 * @param [in] position Position of the value to return.
 		 * @throw out_of_range_error when accessing a value outside the array.
 		 * @return The value stored in the given position.
 		 */
-		type &operator[](size_t position) const;
+		const type &operator[](size_t position) const;
 		/**
 		 * Get the value at a given position. Negative integers start from the
 		 * last allocated value. Exists for typical values.
@@ -364,14 +543,52 @@ namespace stick {
 		 * @throw out_of_range_error when accessing a value outside the array.
 		 * @return The value stored in the given position.
 		 */
-		type &operator[](int32_t position) const;
+		const type &operator[](int32_t position) const;
 		/**
 		 * Get the value at a given position. Exists for typical values.
 		 * @param [in] position Position of the value to return.
 		 * @throw out_of_range_error when accessing a value outside the array.
 		 * @return The value stored in the given position.
 		 */
-		type &operator[](uint32_t position) const;
+		const type &operator[](uint32_t position) const;
+		/**
+		 * Get the value at a given position, copying the values first if they
+		 * are shared. Copies stop sharing them while the reference may be
+		 * written through. Negative integers start from the last allocated
+		 * value.
+		 * @param [in] position Position of the value to return.
+		 * @throw out_of_range_error when accessing a value outside the array.
+		 * @return The value stored in the given position.
+		 */
+		type &operator[](ssize_t position);
+		/**
+		 * Get the value at a given position, copying the values first if they
+		 * are shared. Copies stop sharing them while the reference may be
+		 * written through.
+		 * @param [in] position Position of the value to return.
+		 * @throw out_of_range_error when accessing a value outside the array.
+		 * @return The value stored in the given position.
+		 */
+		type &operator[](size_t position);
+		/**
+		 * Get the value at a given position, copying the values first if they
+		 * are shared. Copies stop sharing them while the reference may be
+		 * written through. Negative integers start from the last allocated
+		 * value. Exists for typical values.
+		 * @param [in] position Position of the value to return.
+		 * @throw out_of_range_error when accessing a value outside the array.
+		 * @return The value stored in the given position.
+		 */
+		type &operator[](int32_t position);
+		/**
+		 * Get the value at a given position, copying the values first if they
+		 * are shared. Copies stop sharing them while the reference may be
+		 * written through. Exists for typical values.
+		 * @param [in] position Position of the value to return.
+		 * @throw out_of_range_error when accessing a value outside the array.
+		 * @return The value stored in the given position.
+		 */
+		type &operator[](uint32_t position);
 
 		/**
 		 * Replace an array copying from a constexpr list.
@@ -379,11 +596,13 @@ namespace stick {
 		 */
 		array &operator=(const list_constexpr<type> &list) noexcept;
 		/**
-		 * Default copy initializer.
+		 * Copy initializer. Copies the values and the pool settings, or
+		 * shares the values if the array is shareable.
 		 * @param [in] array Array to copy from.
+		 * @throw memory_error when memory cannot be allocated.
 		 * @return Self instance.
 		 */
-		array &operator=(const array &array) noexcept = default;
+		array &operator=(const array &array);
 		/**
 		 * Move initializer.
 		 * @param [in] array Array to move from and clear.
@@ -395,7 +614,26 @@ namespace stick {
 		 * Ability to cast the array to basic array.
 		 * @return Pointer to the array of the valid values.
 		 */
-		operator type *() const noexcept;
+		operator const type *() const noexcept;
+		/**
+		 * Ability to cast the array to basic array, copying the values first
+		 * if they are shared. Copies stop sharing them while the pointer may
+		 * be written through.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Pointer to the array of the valid values.
+		 */
+		operator type *();
+	};
+
+
+	/**
+	 * An array only owns a pointer to its values, moving its bytes is enough.
+	 * @tparam type Type of the values.
+	 */
+	template<typename type>
+	struct is_trivially_relocatable<array<type>> {
+		/// Arrays are trivially relocatable.
+		static constexpr bool_t value = true;
 	};
 
 
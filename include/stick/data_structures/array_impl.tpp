@@ -10,11 +10,97 @@
 #	include "../error/out_of_range_error.hpp"
 #	include "../memory/management.tpp"
 #	include "../templates/reference.tpp"
+#	include "../templates/traits.tpp"
 
 
 namespace stick {
 
 
+	template<typename type>
+	void_t array<type>::reallocate(size_t front_room, size_t back_room) {
+		shared_buffer<slot_storage> tempy(front_room + this->size()
+		                                  + back_room);
+		type *values = reinterpret_cast<type *>(tempy.begin()) + front_room;
+		type *current = this->allocated_begin() + this->first_position();
+
+		if (this->data.shared()) {
+			// Other arrays keep reading the values, they cannot be moved.
+			for (size_t i = 0ul; i < this->size(); i++)
+				construct_at(&values[i], current[i]);
+			this->release_values();
+		} else
+			relocate(current, values, this->size());
+
+		// Pointers handed out before point to the old memory.
+		this->data = stick::move(tempy);
+		this->data_start = front_room;
+		this->leaked = false;
+	}
+	template<typename type>
+	type *array<type>::open_gap(size_t position) {
+		switch (this->make_move_decision(position)) {
+
+		case move_decision_result::expand_and_move_back:
+			this->expand_back(this->back_pool + this->size() + 1ul);
+		case move_decision_result::move_back:
+			relocate(this->owned_begin() + position,
+			         this->owned_begin() + position + 1ul,
+			         this->size() - position);
+
+			break;
+		case move_decision_result::expand_and_move_front:
+			this->expand_front(this->front_pool + this->size() + 1ul);
+		case move_decision_result::move_front:
+			relocate(this->owned_begin(), this->owned_begin() - 1ul, position);
+			this->data_start--;
+
+			break;
+		}
+		this->data_size++;
+
+		return this->owned_begin() + position;
+	}
+	template<typename type>
+	template<typename... argument_types>
+	type *array<type>::insert(size_t position, argument_types &&...arguments) {
+		if (this->size() < position)
+			throw out_of_range_error("Push-ing a value outside the array.");
+
+		// The arguments may refer to values that open_gap() relocates.
+		type tempy(stick::forward<argument_types>(arguments)...);
+
+		return construct_at(this->open_gap(position), stick::move(tempy));
+	}
+	template<typename type>
+	void_t array<type>::own() {
+		if (this->shareable and this->data.shared())
+			this->reallocate(this->available_front_pool(),
+			                 this->available_back_pool());
+	}
+	template<typename type>
+	void_t array<type>::leak() {
+		// Leaked values are never shared again, so later calls only read the
+		// flags and threads can use the writable accessors at once.
+		if (this->shareable and not this->leaked) {
+			this->own();
+			this->leaked = true;
+		}
+	}
+	template<typename type>
+	type *array<type>::owned_begin() {
+		this->own();
+
+		return this->allocated_begin() + this->first_position();
+	}
+	template<typename type>
+	void_t array<type>::release_values() noexcept {
+		if (this->data.drop())
+			destroy_range(this->allocated_begin() + this->first_position(),
+			              this->size());
+		this->data.reset();
+	}
+
+
 	template<typename type>
 	typename array<type>::move_decision_result
 	array<type>::make_move_decision(size_t position) const noexcept {
@@ -53,37 +139,62 @@ namespace stick {
 
 	template<typename type>
 	type *array<type>::allocated_begin() const noexcept {
-		return this->data.begin();
+		return reinterpret_cast<type *>(this->data.begin());
 	}
 	template<typename type>
 	type *array<type>::allocated_end() const noexcept {
-		return this->data.end();
+		return reinterpret_cast<type *>(this->data.end());
 	}
 
 	template<typename type>
 	type *array<type>::allocated_rbegin() const noexcept {
-		return this->data.rbegin();
+		return this->allocated_end() - 1ul;
 	}
 	template<typename type>
 	type *array<type>::allocated_rend() const noexcept {
-		return this->data.rend();
+		return this->allocated_begin() - 1ul;
 	}
 
 
 	template<typename type>
-	array<type>::array(const type *array, size_t length)
-	    : data(array, length), data_size(length) { }
+	array<type>::array(const type *array, size_t length) : data(length) {
+		if (array == nullptr)
+			throw memory_error("Creating an array and trying to copy values "
+			                   "from a nullptr to it.");
+
+		for (size_t i = 0ul; i < length; i++)
+			construct_at(&this->allocated_begin()[this->data_size++], array[i]);
+	}
 	template<typename type>
 	array<type>::array(const list_constexpr<type> &array) : data(array.size()) {
 		for (const auto &e : array)
-			this->push_back(e);
+			construct_at(&this->allocated_begin()[this->data_size++], e);
 	}
 	template<typename type>
 	array<type>::array(size_t size, size_t front_pool_length,
 	                   size_t back_pool_length)
-	    : data(front_pool_length + size + back_pool_length, nullptr),
-	      front_pool(front_pool_length), back_pool(back_pool_length),
-	      data_start(front_pool_length), data_size(0ul) { }
+	    : data(front_pool_length + size + back_pool_length),
+	      data_start(front_pool_length), data_size(0ul),
+	      front_pool(front_pool_length), back_pool(back_pool_length) { }
+	template<typename type>
+	array<type>::array(const array &array)
+	    : front_pool(array.front_pool), back_pool(array.back_pool),
+	      shareable(array.shareable) {
+		// Leaked values may be written through pointers held elsewhere.
+		if (array.shareable and not array.leaked) {
+			this->data = array.data;
+			this->data_start = array.data_start;
+			this->data_size = array.data_size;
+
+			return;
+		}
+		if (array.empty())
+			return;
+
+		this->data = shared_buffer<slot_storage>(array.size());
+		for (const auto &e : array)
+			construct_at(&this->allocated_begin()[this->data_size++], e);
+	}
 	template<typename type>
 	array<type>::array(array &&array) noexcept {
 		this->data = move(array.data);
@@ -91,16 +202,20 @@ namespace stick {
 		this->data_size = array.data_size;
 		this->front_pool = array.front_pool;
 		this->back_pool = array.back_pool;
+		this->shareable = array.shareable;
+		this->leaked = array.leaked;
 
 		array.data_start = 0ul;
 		array.data_size = 0ul;
 		array.front_pool = 0ul;
 		array.back_pool = 0ul;
+		array.shareable = false;
+		array.leaked = false;
 	}
 
 	template<typename type>
 	array<type>::~array() noexcept {
-		this->data.~scoped_pointer();
+		this->release_values();
 		this->data_start = 0ul;
 		this->data_size = 0ul;
 		this->front_pool = 0ul;
@@ -109,20 +224,38 @@ namespace stick {
 
 
 	template<typename type>
-	type *array<type>::begin() const noexcept {
-		return &this->data[this->first_position()];
+	const type *array<type>::begin() const noexcept {
+		return this->allocated_begin() + this->first_position();
+	}
+	template<typename type>
+	type *array<type>::begin() {
+		this->leak();
+
+		return this->allocated_begin() + this->first_position();
+	}
+	template<typename type>
+	const type *array<type>::end() const noexcept {
+		return this->begin() + this->size();
 	}
 	template<typename type>
-	type *array<type>::end() const noexcept {
+	type *array<type>::end() {
 		return this->begin() + this->size();
 	}
 
 	template<typename type>
-	type *array<type>::rbegin() const noexcept {
+	const type *array<type>::rbegin() const noexcept {
 		return this->end() - 1ul;
 	}
 	template<typename type>
-	type *array<type>::rend() const noexcept {
+	type *array<type>::rbegin() {
+		return this->end() - 1ul;
+	}
+	template<typename type>
+	const type *array<type>::rend() const noexcept {
+		return this->begin() - 1ul;
+	}
+	template<typename type>
+	type *array<type>::rend() {
 		return this->begin() - 1ul;
 	}
 
@@ -133,10 +266,9 @@ namespace stick {
 	}
 	template<typename type>
 	size_t array<type>::allocated_size() const noexcept {
-		return this->data.allocated_elems();
+		return this->data.capacity();
 	}
 	template<typename type>
-
 	size_t array<type>::available_front_pool() const noexcept {
 		return this->first_position();
 	}
@@ -164,17 +296,23 @@ namespace stick {
 		return *this;
 	}
 
+	template<typename type>
+	array<type> &array<type>::share() noexcept {
+		this->shareable = true;
 
+		return *this;
+	}
 	template<typename type>
-	array<type> &array<type>::expand(size_t front_size,
-	                                 size_t back_size) noexcept {
-		array<type> tempy(this->allocated_size(), front_size, back_size);
+	bool_t array<type>::is_shareable() const noexcept {
+		return this->shareable;
+	}
 
-		if (not this->empty())
-			for (const type &e : *this)
-				tempy.push_back(e);
 
-		*this = move(tempy);
+	template<typename type>
+	array<type> &array<type>::expand(size_t front_size,
+	                                 size_t back_size) noexcept {
+		this->reallocate(this->available_front_pool() + front_size,
+		                 this->available_back_pool() + back_size);
 
 		return *this;
 	}
@@ -204,17 +342,7 @@ namespace stick {
 		else
 			back_size = this->available_back_pool() - back_size;
 
-		if (front_size + this->size() + back_size != 0ul) {
-			array<type> tempy(this->size(), front_size, back_size);
-			for (const auto &e : *this)
-				tempy.push_back(e);
-
-			*this = move(tempy);
-		} else {
-			this->data.~scoped_pointer();
-			this->data_start = 0ul;
-			this->data_size = 0ul;
-		}
+		this->reallocate(front_size, back_size);
 
 		return *this;
 	}
@@ -231,38 +359,13 @@ namespace stick {
 	template<typename type>
 	array<type> &array<type>::push(const type &value, ssize_t position) {
 		if (position < 0l)
-			position = this->last_position() + position + 1l;
+			position += static_cast<ssize_t>(this->size());
 
 		return this->push(value, static_cast<size_t>(position));
 	}
 	template<typename type>
 	array<type> &array<type>::push(const type &value, size_t position) {
-		if (this->size() < position)
-			throw out_of_range_error("Push-ing a value outside the array.");
-
-
-		switch (this->make_move_decision(position)) {
-
-		case move_decision_result::expand_and_move_back:
-			this->expand_back(this->back_pool + 1ul);
-		case move_decision_result::move_back:
-			move(this->begin() + position, this->begin() + position + 1ul,
-			     this->size() - position, false);
-			this->data_size++;
-			this->operator[](position) = value;
-
-			break;
-		case move_decision_result::expand_and_move_front:
-			this->expand_front(this->back_pool + 1ul);
-		case move_decision_result::move_front:
-			move(this->begin(), this->begin() - position - 1ul, position + 1ul,
-			     false);
-			this->data_start--;
-			this->data_size++;
-			this->operator[](position) = value;
-
-			break;
-		}
+		this->insert(position, value);
 
 		return *this;
 	}
@@ -275,19 +378,70 @@ namespace stick {
 		return this->push(value, static_cast<size_t>(position));
 	}
 	template<typename type>
+	array<type> &array<type>::push(type &&value, ssize_t position) {
+		if (position < 0l)
+			position += static_cast<ssize_t>(this->size());
+
+		return this->push(stick::move(value), static_cast<size_t>(position));
+	}
+	template<typename type>
+	array<type> &array<type>::push(type &&value, size_t position) {
+		this->insert(position, stick::move(value));
+
+		return *this;
+	}
+	template<typename type>
+	array<type> &array<type>::push(type &&value, int32_t position) {
+		return this->push(stick::move(value), static_cast<ssize_t>(position));
+	}
+	template<typename type>
+	array<type> &array<type>::push(type &&value, uint32_t position) {
+		return this->push(stick::move(value), static_cast<size_t>(position));
+	}
+	template<typename type>
 	array<type> &array<type>::push_front(const type &value) noexcept {
 		return this->push(value, 0ul);
 	}
 	template<typename type>
+	array<type> &array<type>::push_front(type &&value) noexcept {
+		return this->push(stick::move(value), 0ul);
+	}
+	template<typename type>
 	array<type> &array<type>::push_back(const type &value) noexcept {
 		return this->push(value, this->size());
 	}
+	template<typename type>
+	array<type> &array<type>::push_back(type &&value) noexcept {
+		return this->push(stick::move(value), this->size());
+	}
+
+	template<typename type>
+	template<typename... argument_types>
+	type &array<type>::emplace(size_t position,
+	                           argument_types &&...arguments) {
+		type *value = this->insert(
+		    position, stick::forward<argument_types>(arguments)...);
+		this->leaked = true;
+
+		return *value;
+	}
+	template<typename type>
+	template<typename... argument_types>
+	type &array<type>::emplace_front(argument_types &&...arguments) {
+		return this->emplace(0ul, stick::forward<argument_types>(arguments)...);
+	}
+	template<typename type>
+	template<typename... argument_types>
+	type &array<type>::emplace_back(argument_types &&...arguments) {
+		return this->emplace(this->size(),
+		                     stick::forward<argument_types>(arguments)...);
+	}
 
 
 	template<typename type>
 	array<type> &array<type>::pop(ssize_t position) {
 		if (position < 0l)
-			position = this->last_position() + position + 1l;
+			position += static_cast<ssize_t>(this->size());
 
 		return this->pop(static_cast<size_t>(position));
 	}
@@ -296,19 +450,16 @@ namespace stick {
 		if (this->size() <= position)
 			throw out_of_range_error("Pop-ing a value outside the array.");
 
-		switch (this->make_move_decision(position)) {
+		type *values = this->owned_begin();
+		destroy_range(values + position);
 
-		case move_decision_result::expand_and_move_back:
-		case move_decision_result::move_back:
-			move(this->begin() + position + 1ul, this->begin() + position,
-			     this->size() - position - 1ul, false);
-			break;
-		case move_decision_result::expand_and_move_front:
-		case move_decision_result::move_front:
-			move(this->begin(), this->begin() + 1ul, position, false);
+		// Close the gap shifting the shortest side.
+		if (position < this->size() - position - 1ul) {
+			relocate(values, values + 1ul, position);
 			this->data_start++;
-			break;
-		}
+		} else
+			relocate(values + position + 1ul, values + position,
+			         this->size() - position - 1ul);
 		this->data_size--;
 
 		return *this;
@@ -333,6 +484,13 @@ namespace stick {
 
 	template<typename type>
 	array<type> &array<type>::clear() noexcept {
+		// Values shared with other arrays are left to them.
+		if (this->data.shared())
+			this->release_values();
+		else
+			destroy_range(this->allocated_begin() + this->first_position(),
+			              this->size());
+
 		this->data_size = 0ul;
 		this->data_start = 0ul;
 
@@ -341,60 +499,103 @@ namespace stick {
 
 
 	template<typename type>
-	type &array<type>::operator[](ssize_t position) const {
+	const type &array<type>::operator[](ssize_t position) const {
+		if (position < 0l)
+			position += static_cast<ssize_t>(this->size());
+
+		return this->operator[](static_cast<size_t>(position));
+	}
+	template<typename type>
+	const type &array<type>::operator[](size_t position) const {
+		if (this->size() <= position)
+			throw out_of_range_error("Accessing a value outside the array.");
+
+		return this->begin()[position];
+	}
+	template<typename type>
+	const type &array<type>::operator[](int32_t position) const {
+		return this->operator[](static_cast<ssize_t>(position));
+	}
+	template<typename type>
+	const type &array<type>::operator[](uint32_t position) const {
+		return this->operator[](static_cast<size_t>(position));
+	}
+	template<typename type>
+	type &array<type>::operator[](ssize_t position) {
 		if (position < 0l)
-			position = this->last_position() + position + 1l;
+			position += static_cast<ssize_t>(this->size());
 
 		return this->operator[](static_cast<size_t>(position));
 	}
 	template<typename type>
-	type &array<type>::operator[](size_t position) const {
+	type &array<type>::operator[](size_t position) {
 		if (this->size() <= position)
 			throw out_of_range_error("Accessing a value outside the array.");
 
-		return this->data[this->first_position() + position];
+		return this->begin()[position];
 	}
 	template<typename type>
-	type &array<type>::operator[](int32_t position) const {
+	type &array<type>::operator[](int32_t position) {
 		return this->operator[](static_cast<ssize_t>(position));
 	}
 	template<typename type>
-	type &array<type>::operator[](uint32_t position) const {
+	type &array<type>::operator[](uint32_t position) {
 		return this->operator[](static_cast<size_t>(position));
 	}
 
 	template<typename type>
 	array<type> &
 	array<type>::operator=(const list_constexpr<type> &list) noexcept {
+		this->clear();
 		if (this->allocated_size() < list.size())
 			this->expand_back(list.size() - this->allocated_size());
 
-		this->clear();
 		for (const auto &e : list)
 			this->push_back(e);
 
 		return *this;
 	}
 	template<typename type>
+	array<type> &array<type>::operator=(const array &array) {
+		if (&array == this)
+			return *this;
+
+		stick::array<type> tempy(array);
+
+		return *this = stick::move(tempy);
+	}
+	template<typename type>
 	array<type> &array<type>::operator=(array &&array) noexcept {
+		if (&array == this)
+			return *this;
+
+		this->release_values();
 		this->data = move(array.data);
 		this->data_start = array.data_start;
 		this->data_size = array.data_size;
 		this->front_pool = array.front_pool;
 		this->back_pool = array.back_pool;
+		this->shareable = array.shareable;
+		this->leaked = array.leaked;
 
 		array.data_start = 0ul;
 		array.data_size = 0ul;
 		array.front_pool = 0ul;
 		array.back_pool = 0ul;
+		array.shareable = false;
+		array.leaked = false;
 
 		return *this;
 	}
 
 
 	template<typename type>
-	array<type>::operator type *() const noexcept {
-		return this->data;
+	array<type>::operator const type *() const noexcept {
+		return this->begin();
+	}
+	template<typename type>
+	array<type>::operator type *() {
+		return this->begin();
 	}
 
 
@@ -0,0 +1,283 @@
+/**
+ * Concurrent hash map template. Lock-free lookups and sharded writes.
+ * @brief Concurrent hash map template.
+ * @file concurrent_hash_map.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_data_structures_concurrent_hash_map_)
+#	define _stick_lib_data_structures_concurrent_hash_map_
+
+
+
+#	include "../data_structures/hash_table.tpp"
+#	include "../defines/types.hpp"
+#	include "../thread/atomic.tpp"
+#	include "../thread/spin_lock.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Map of unique keys to values shared by many threads. Keys are spread
+	 * over shards, each one a chained table with its own writer lock, so
+	 * writers only wait for writers of the same shard. Lookups take no lock
+	 * at all: nodes are immutable once published, writers replace them
+	 * instead of changing them and release the old ones through epoch based
+	 * reclamation. A shard grows by building a new table next to the old one
+	 * and publishing it at once, so neither readers nor the other shards
+	 * ever stop for a resize.
+	 * @tparam key_type Type of the keys.
+	 * @tparam value_type Type of the values.
+	 * @tparam hasher_type Hash function object of the keys. Default =
+	 * hasher<key_type>.
+	 * @tparam equal_type Equality function object of the keys. Default =
+	 * hash_equal<key_type>.
+	 */
+	template<typename key_type, typename value_type,
+	         typename hasher_type = hasher<key_type>,
+	         typename equal_type = hash_equal<key_type>>
+	class concurrent_hash_map {
+
+		/**
+		 * Key and value, immutable once published except for the link.
+		 */
+		struct node {
+			key_type key;   ///< Key of the node.
+			value_type value;   ///< Value of the key.
+			uint64_t hash;   ///< Hash of the key.
+			atomic<node *> next;   ///< Next node of the bucket.
+
+
+			/**
+			 * Create a node.
+			 * @param [in] key Key of the node.
+			 * @param [in] value Value of the key.
+			 * @param [in] hash Hash of the key.
+			 * @param [in] next Next node of the bucket.
+			 */
+			node(const key_type &key, const value_type &value, uint64_t hash,
+			     node *next);
+		};
+
+		/**
+		 * Buckets of a shard.
+		 */
+		struct table {
+			size_t bucket_mask;   ///< Number of buckets minus one.
+			atomic<node *> *buckets;   ///< First node of each bucket.
+		};
+
+		/**
+		 * Independent part of the map.
+		 */
+		struct shard {
+			atomic<table *> nodes;   ///< Published table, nullptr if empty.
+			atomic<size_t> elements;   ///< Number of nodes.
+			spin_lock writer;   ///< Writer lock.
+
+			/// Keeps two shards in different cache lines.
+			byte_t padding[64];
+		};
+
+		shard *shards = nullptr;   ///< The shards.
+		size_t shard_mask;   ///< Number of shards minus one.
+
+		hasher_type hasher;   ///< Hash function object.
+		equal_type equal;   ///< Equality function object.
+
+
+		/**
+		 * Release a table that no reader can reach anymore, along with the
+		 * nodes still linked in it.
+		 * @param [in] object The table.
+		 */
+		static void_t delete_table(voidptr_t object);
+		/**
+		 * Release a node that no reader can reach anymore.
+		 * @param [in] object The node.
+		 */
+		static void_t delete_node(voidptr_t object);
+
+		/**
+		 * Create a table with empty buckets.
+		 * @param [in] buckets Number of buckets, a power of 2.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return The table.
+		 */
+		static table *create_table(size_t buckets);
+		/**
+		 * Create a node.
+		 * @param [in] key Key of the node.
+		 * @param [in] value Value of the node.
+		 * @param [in] hash Hash of the key.
+		 * @param [in] next Next node of the bucket.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return The node.
+		 */
+		static node *create_node(const key_type &key, const value_type &value,
+		                         uint64_t hash, node *next);
+
+		/**
+		 * Get the shard of a hash.
+		 * @param [in] hash Hash of a key.
+		 * @return The shard.
+		 */
+		shard &shard_of(uint64_t hash) const noexcept;
+
+		/**
+		 * Find the link pointing to the node of a key.
+		 * @tparam lookup_type Type of the key.
+		 * @param [in] nodes Table to look in.
+		 * @param [in] key Key to look for.
+		 * @param [in] hash Hash of the key.
+		 * @return Link to the node, or to nullptr at the end of the bucket if
+		 * the key is not found.
+		 */
+		template<typename lookup_type>
+		atomic<node *> *find_link(table *nodes, const lookup_type &key,
+		                          uint64_t hash) const noexcept;
+		/**
+		 * Find the node of a key without the writer lock. The node found is
+		 * kept instead of reading its link again, a writer may have moved
+		 * the link to the next node meanwhile.
+		 * @tparam lookup_type Type of the key.
+		 * @param [in] nodes Table to look in.
+		 * @param [in] key Key to look for.
+		 * @param [in] hash Hash of the key.
+		 * @return The node, nullptr if the key is not found.
+		 */
+		template<typename lookup_type>
+		node *find_node(table *nodes, const lookup_type &key,
+		                uint64_t hash) const noexcept;
+
+		/**
+		 * Find the link of a key in a locked shard, creating its first table
+		 * if needed.
+		 * @param [in,out] part Locked shard.
+		 * @param [in] key Key to look for.
+		 * @param [in] hash Hash of the key.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Link to the node, or to nullptr at the end of the bucket if
+		 * the key is not found.
+		 */
+		atomic<node *> *lock_link(shard &part, const key_type &key,
+		                          uint64_t hash);
+		/**
+		 * Publish a new node in a locked shard, growing it first if needed.
+		 * @param [in,out] part Locked shard.
+		 * @param [in] link Link where the key was not found.
+		 * @param [in] key Key of the node.
+		 * @param [in] value Value of the key.
+		 * @param [in] hash Hash of the key.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		void_t link_node(shard &part, atomic<node *> *link,
+		                 const key_type &key, const value_type &value,
+		                 uint64_t hash);
+
+		/**
+		 * Publish a table with twice the buckets of a locked shard.
+		 * @param [in,out] part Locked shard.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		void_t grow(shard &part);
+
+	public:
+		/**
+		 * Create an empty map.
+		 * @param [in] shard_amount Number of independent shards, rounded up
+		 * to a power of 2. Default = 64.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		explicit concurrent_hash_map(size_t shard_amount = 64ul);
+		concurrent_hash_map(const concurrent_hash_map &) = delete;
+
+		/**
+		 * Release every node. No thread may be using the map anymore.
+		 */
+		~concurrent_hash_map() noexcept;
+
+
+		/**
+		 * Get the number of values. Only exact while no thread writes.
+		 * @return Number of values.
+		 */
+		size_t size() const noexcept;
+		/**
+		 * Check if the map is empty. Only exact while no thread writes.
+		 * @return True if there are no values, false otherwise.
+		 */
+		bool_t empty() const noexcept;
+
+
+		/**
+		 * Copy out the value of a key without locking.
+		 * @tparam lookup_type Type of the key, any the hasher and the
+		 * equality accept, like string_view for string keys.
+		 * @param [in] key Key to look for.
+		 * @param [out] value Where to copy the value to if the key is found.
+		 * @return True if the key is found, false otherwise.
+		 */
+		template<typename lookup_type>
+		bool_t find(const lookup_type &key, value_type &value) const;
+		/**
+		 * Check if a key is in the map without locking.
+		 * @tparam lookup_type Type of the key, any the hasher and the
+		 * equality accept.
+		 * @param [in] key Key to look for.
+		 * @return True if the key is found, false otherwise.
+		 */
+		template<typename lookup_type>
+		bool_t contains(const lookup_type &key) const;
+
+
+		/**
+		 * Insert a key and its value if the key is not in the map yet.
+		 * @param [in] key Key to insert.
+		 * @param [in] value Value of the key.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return True if inserted, false if the key was already there.
+		 */
+		bool_t insert(const key_type &key, const value_type &value);
+		/**
+		 * Set the value of a key, inserting the key if needed. Readers see
+		 * either the whole old value or the whole new one.
+		 * @param [in] key Key to set.
+		 * @param [in] value New value of the key.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Self instance.
+		 */
+		concurrent_hash_map &assign(const key_type &key,
+		                            const value_type &value);
+
+		/**
+		 * Remove a key and its value.
+		 * @tparam lookup_type Type of the key, any the hasher and the
+		 * equality accept.
+		 * @param [in] key Key to remove.
+		 * @return True if the key was found, false otherwise.
+		 */
+		template<typename lookup_type>
+		bool_t erase(const lookup_type &key);
+
+		/**
+		 * Remove all the values.
+		 * @return Self instance.
+		 */
+		concurrent_hash_map &clear();
+
+
+		concurrent_hash_map &operator=(const concurrent_hash_map &) = delete;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_data_structures_concurrent_hash_map_impl_
+#	include "../data_structures/concurrent_hash_map_impl.tpp"
+#	undef _stick_lib_data_structures_concurrent_hash_map_impl_
+
+
+#endif   //_stick_lib_data_structures_concurrent_hash_map_
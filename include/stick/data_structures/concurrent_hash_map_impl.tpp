@@ -0,0 +1,419 @@
+/**
+ * Concurrent hash map template. Template implementations.
+ * @brief Concurrent hash map template implementations.
+ * @file concurrent_hash_map_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_data_structures_concurrent_hash_map_impl_)
+
+
+#	include "../memory/epoch.hpp"
+#	include "../memory/management.tpp"
+
+
+namespace stick {
+
+
+	/// Buckets of the first table of a shard.
+	static const size_t concurrent_hash_map_buckets = 8ul;
+	/// Odd multiplier spreading every bit of a hash over the shard bits.
+	static const uint64_t concurrent_hash_map_shard_mix = 0x9e3779b97f4a7c15ul;
+
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	concurrent_hash_map<key_type, value_type, hasher_type, equal_type>::node::
+	    node(const key_type &key, const value_type &value, uint64_t hash,
+	         node *next)
+	    : key(key), value(value), hash(hash), next(next) { }
+
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	void_t concurrent_hash_map<key_type, value_type, hasher_type,
+	                           equal_type>::delete_table(voidptr_t object) {
+		auto nodes = static_cast<table *>(object);
+
+		for (size_t i = 0ul; i <= nodes->bucket_mask; i++)
+			for (node *current = nodes->buckets[i].load(memory_order::relaxed);
+			     current != nullptr;) {
+				node *next = current->next.load(memory_order::relaxed);
+				destroy_range(current);
+				deallocate_raw(current);
+				current = next;
+			}
+
+		deallocate(nodes->buckets);
+		destroy_range(nodes);
+		deallocate_raw(nodes);
+	}
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	void_t concurrent_hash_map<key_type, value_type, hasher_type,
+	                           equal_type>::delete_node(voidptr_t object) {
+		auto current = static_cast<node *>(object);
+
+		destroy_range(current);
+		deallocate_raw(current);
+	}
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	typename concurrent_hash_map<key_type, value_type, hasher_type,
+	                             equal_type>::table *
+	concurrent_hash_map<key_type, value_type, hasher_type,
+	                    equal_type>::create_table(size_t buckets) {
+		// Buckets start empty, atomic pointers are built as nullptr.
+		atomic<node *> *nodes = allocate<atomic<node *>>(buckets);
+		try {
+			return construct_at(allocate_uninitialized<table>(),
+			                    table { buckets - 1ul, nodes });
+		} catch (...) {
+			deallocate(nodes);
+			throw;
+		}
+	}
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	typename concurrent_hash_map<key_type, value_type, hasher_type,
+	                             equal_type>::node *
+	concurrent_hash_map<key_type, value_type, hasher_type, equal_type>::
+	    create_node(const key_type &key, const value_type &value,
+	                uint64_t hash, node *next) {
+		auto current = allocate_uninitialized<node>();
+		try {
+			return construct_at(current, key, value, hash, next);
+		} catch (...) {
+			deallocate_raw(current);
+			throw;
+		}
+	}
+
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	typename concurrent_hash_map<key_type, value_type, hasher_type,
+	                             equal_type>::shard &
+	concurrent_hash_map<key_type, value_type, hasher_type,
+	                    equal_type>::shard_of(uint64_t hash) const noexcept {
+		// The low bits pick the bucket. The shard comes from the high bits of
+		// the mixed hash, which depend on all of them, so a weak hasher that
+		// only fills the low ones still spreads keys over every shard.
+		return this->shards[static_cast<size_t>(
+		                        (hash * concurrent_hash_map_shard_mix) >> 48)
+		                    & this->shard_mask];
+	}
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	template<typename lookup_type>
+	atomic<typename concurrent_hash_map<key_type, value_type, hasher_type,
+	                                    equal_type>::node *> *
+	concurrent_hash_map<key_type, value_type, hasher_type,
+	                    equal_type>::find_link(table *nodes,
+	                                           const lookup_type &key,
+	                                           uint64_t hash) const noexcept {
+		atomic<node *> *link = &nodes->buckets[static_cast<size_t>(hash)
+		                                       & nodes->bucket_mask];
+		for (node *current = link->load(memory_order::acquire);
+		     current != nullptr; current = link->load(memory_order::acquire)) {
+			if (current->hash == hash and this->equal(current->key, key))
+				break;
+
+			link = &current->next;
+		}
+
+		return link;
+	}
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	template<typename lookup_type>
+	typename concurrent_hash_map<key_type, value_type, hasher_type,
+	                             equal_type>::node *
+	concurrent_hash_map<key_type, value_type, hasher_type,
+	                    equal_type>::find_node(table *nodes,
+	                                           const lookup_type &key,
+	                                           uint64_t hash) const noexcept {
+		node *current = nodes->buckets[static_cast<size_t>(hash)
+		                               & nodes->bucket_mask]
+		                    .load(memory_order::acquire);
+		while (current != nullptr
+		       and (current->hash != hash
+		            or not this->equal(current->key, key)))
+			current = current->next.load(memory_order::acquire);
+
+		return current;
+	}
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	void_t
+	concurrent_hash_map<key_type, value_type, hasher_type, equal_type>::grow(
+	    shard &part) {
+		table *old_nodes = part.nodes.load(memory_order::relaxed);
+		table *nodes = create_table((old_nodes->bucket_mask + 1ul) << 1);
+
+		// Readers may be walking the old nodes, so they are copied instead of
+		// relinked, and released along with the old table.
+		try {
+			for (size_t i = 0ul; i <= old_nodes->bucket_mask; i++)
+				for (node *current
+				     = old_nodes->buckets[i].load(memory_order::relaxed);
+				     current != nullptr;
+				     current = current->next.load(memory_order::relaxed)) {
+					atomic<node *> &bucket
+					    = nodes->buckets[static_cast<size_t>(current->hash)
+					                     & nodes->bucket_mask];
+					bucket.store(
+					    create_node(current->key, current->value,
+					                current->hash,
+					                bucket.load(memory_order::relaxed)),
+					    memory_order::relaxed);
+				}
+		} catch (...) {
+			delete_table(nodes);
+			throw;
+		}
+
+		part.nodes.store(nodes, memory_order::release);
+		epoch_retire(old_nodes, delete_table);
+	}
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	atomic<typename concurrent_hash_map<key_type, value_type, hasher_type,
+	                                    equal_type>::node *> *
+	concurrent_hash_map<key_type, value_type, hasher_type,
+	                    equal_type>::lock_link(shard &part,
+	                                           const key_type &key,
+	                                           uint64_t hash) {
+		table *nodes = part.nodes.load(memory_order::relaxed);
+		if (nodes == nullptr) {
+			nodes = create_table(concurrent_hash_map_buckets);
+			part.nodes.store(nodes, memory_order::release);
+		}
+
+		return this->find_link(nodes, key, hash);
+	}
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	void_t concurrent_hash_map<key_type, value_type, hasher_type,
+	                           equal_type>::link_node(shard &part,
+	                                                  atomic<node *> *link,
+	                                                  const key_type &key,
+	                                                  const value_type &value,
+	                                                  uint64_t hash) {
+		size_t elements = part.elements.load(memory_order::relaxed);
+		if (elements > part.nodes.load(memory_order::relaxed)->bucket_mask) {
+			this->grow(part);
+			link = this->find_link(part.nodes.load(memory_order::relaxed), key,
+			                       hash);
+		}
+
+		// The new node is fully built before readers can reach it.
+		link->store(create_node(key, value, hash, nullptr),
+		            memory_order::release);
+		part.elements.store(elements + 1ul, memory_order::relaxed);
+	}
+
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	concurrent_hash_map<key_type, value_type, hasher_type, equal_type>::
+	    concurrent_hash_map(size_t shard_amount) {
+		size_t amount = 1ul;
+		while (amount < shard_amount)
+			amount <<= 1;
+
+		this->shards = allocate<shard>(amount);
+		this->shard_mask = amount - 1ul;
+	}
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	concurrent_hash_map<key_type, value_type, hasher_type,
+	                    equal_type>::~concurrent_hash_map() noexcept {
+		for (size_t i = 0ul; i <= this->shard_mask; i++) {
+			table *nodes = this->shards[i].nodes.load(memory_order::relaxed);
+			if (nodes != nullptr)
+				delete_table(nodes);
+		}
+
+		deallocate(this->shards);
+	}
+
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	size_t concurrent_hash_map<key_type, value_type, hasher_type,
+	                           equal_type>::size() const noexcept {
+		size_t elements = 0ul;
+		for (size_t i = 0ul; i <= this->shard_mask; i++)
+			elements += this->shards[i].elements.load(memory_order::relaxed);
+
+		return elements;
+	}
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	bool_t concurrent_hash_map<key_type, value_type, hasher_type,
+	                           equal_type>::empty() const noexcept {
+		return this->size() == 0ul;
+	}
+
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	template<typename lookup_type>
+	bool_t
+	concurrent_hash_map<key_type, value_type, hasher_type, equal_type>::find(
+	    const lookup_type &key, value_type &value) const {
+		uint64_t hash = this->hasher(key);
+		shard &part = this->shard_of(hash);
+
+		epoch_guard guard;
+		table *nodes = part.nodes.load(memory_order::acquire);
+		if (nodes == nullptr)
+			return false;
+
+		node *current = this->find_node(nodes, key, hash);
+		if (current == nullptr)
+			return false;
+
+		value = current->value;
+
+		return true;
+	}
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	template<typename lookup_type>
+	bool_t concurrent_hash_map<key_type, value_type, hasher_type,
+	                           equal_type>::contains(
+	    const lookup_type &key) const {
+		uint64_t hash = this->hasher(key);
+		shard &part = this->shard_of(hash);
+
+		epoch_guard guard;
+		table *nodes = part.nodes.load(memory_order::acquire);
+
+		return nodes != nullptr
+		       and this->find_node(nodes, key, hash) != nullptr;
+	}
+
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	bool_t
+	concurrent_hash_map<key_type, value_type, hasher_type, equal_type>::insert(
+	    const key_type &key, const value_type &value) {
+		uint64_t hash = this->hasher(key);
+		shard &part = this->shard_of(hash);
+
+		bool_t inserted;
+		part.writer.lock();
+		try {
+			atomic<node *> *link = this->lock_link(part, key, hash);
+			inserted = link->load(memory_order::relaxed) == nullptr;
+			if (inserted)
+				this->link_node(part, link, key, value, hash);
+		} catch (...) {
+			part.writer.unlock();
+			throw;
+		}
+		part.writer.unlock();
+
+		return inserted;
+	}
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	concurrent_hash_map<key_type, value_type, hasher_type, equal_type> &
+	concurrent_hash_map<key_type, value_type, hasher_type, equal_type>::assign(
+	    const key_type &key, const value_type &value) {
+		uint64_t hash = this->hasher(key);
+		shard &part = this->shard_of(hash);
+
+		node *old_node;
+		part.writer.lock();
+		try {
+			atomic<node *> *link = this->lock_link(part, key, hash);
+			old_node = link->load(memory_order::relaxed);
+			if (old_node == nullptr)
+				this->link_node(part, link, key, value, hash);
+			else
+				link->store(
+				    create_node(key, value, hash,
+				                old_node->next.load(memory_order::relaxed)),
+				    memory_order::release);
+		} catch (...) {
+			part.writer.unlock();
+			throw;
+		}
+		part.writer.unlock();
+
+		if (old_node != nullptr)
+			epoch_retire(old_node, delete_node);
+
+		return *this;
+	}
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	template<typename lookup_type>
+	bool_t
+	concurrent_hash_map<key_type, value_type, hasher_type, equal_type>::erase(
+	    const lookup_type &key) {
+		uint64_t hash = this->hasher(key);
+		shard &part = this->shard_of(hash);
+
+		part.writer.lock();
+		table *nodes = part.nodes.load(memory_order::relaxed);
+		atomic<node *> *link
+		    = nodes == nullptr ? nullptr : this->find_link(nodes, key, hash);
+		node *old_node
+		    = link == nullptr ? nullptr : link->load(memory_order::relaxed);
+		if (old_node == nullptr) {
+			part.writer.unlock();
+
+			return false;
+		}
+
+		// Readers inside the old node still find the rest of the bucket.
+		link->store(old_node->next.load(memory_order::relaxed),
+		            memory_order::release);
+		part.elements.store(part.elements.load(memory_order::relaxed) - 1ul,
+		                    memory_order::relaxed);
+		part.writer.unlock();
+
+		epoch_retire(old_node, delete_node);
+
+		return true;
+	}
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	concurrent_hash_map<key_type, value_type, hasher_type, equal_type> &
+	concurrent_hash_map<key_type, value_type, hasher_type,
+	                    equal_type>::clear() {
+		for (size_t i = 0ul; i <= this->shard_mask; i++) {
+			shard &part = this->shards[i];
+
+			part.writer.lock();
+			table *nodes = part.nodes.load(memory_order::relaxed);
+			part.nodes.store(nullptr, memory_order::release);
+			part.elements.store(0ul, memory_order::relaxed);
+			part.writer.unlock();
+
+			if (nodes != nullptr)
+				epoch_retire(nodes, delete_table);
+		}
+
+		return *this;
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_data_structures_concurrent_hash_map_impl_
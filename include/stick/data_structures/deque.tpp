@@ -0,0 +1,290 @@
+/**
+ * Double ended queue template over a ring buffer.
+ * @brief Ring buffer double ended queue template.
+ * @file deque.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_data_structures_deque_)
+#	define _stick_lib_data_structures_deque_
+
+
+
+#	include "../defines/types.hpp"
+#	include "../templates/traits.tpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Forward iterator over the values of a deque, in queue order.
+	 * @tparam type Type of the values.
+	 */
+	template<typename type>
+	class deque_iterator {
+
+		type *slots = nullptr;   ///< First slot of the ring.
+		size_t slot_mask = 0ul;   ///< Number of slots minus one.
+		size_t position = 0ul;   ///< Unmasked position of the current value.
+
+	public:
+		/**
+		 * Create an iterator at a position of a ring.
+		 * @param [in] slots First slot of the ring.
+		 * @param [in] slot_mask Number of slots minus one.
+		 * @param [in] position Unmasked position to start at.
+		 */
+		deque_iterator(type *slots, size_t slot_mask,
+		               size_t position) noexcept;
+
+
+		/**
+		 * Get the current value.
+		 * @return The value.
+		 */
+		type &operator*() const noexcept;
+		/**
+		 * Access the current value.
+		 * @return Pointer to the value.
+		 */
+		type *operator->() const noexcept;
+
+		/**
+		 * Advance to the next value.
+		 * @return Self instance.
+		 */
+		deque_iterator &operator++() noexcept;
+
+		/**
+		 * Check if two iterators are at the same value.
+		 * @param [in] iterator Iterator to compare with.
+		 * @return True if both are at the same value, false otherwise.
+		 */
+		bool_t operator==(const deque_iterator &iterator) const noexcept;
+		/**
+		 * Check if two iterators are at different values.
+		 * @param [in] iterator Iterator to compare with.
+		 * @return True if they are at different values, false otherwise.
+		 */
+		bool_t operator!=(const deque_iterator &iterator) const noexcept;
+	};
+
+
+	/**
+	 * Double ended queue stored in a ring buffer. The capacity is always a
+	 * power of 2, so positions wrap around with a mask, and both ends push
+	 * and pop in constant time without moving any other value. Only a full
+	 * ring is reallocated, doubling its size, so every operation is O(1)
+	 * amortized.
+	 * @tparam type Type of the values.
+	 */
+	template<typename type>
+	class deque {
+
+		type *slots = nullptr;   ///< Ring memory, only live values built.
+		size_t slot_mask = 0ul;   ///< Number of slots minus one.
+		size_t head = 0ul;   ///< Unmasked position of the first value.
+		size_t tail = 0ul;   ///< Unmasked position after the last value.
+
+
+		/**
+		 * Get a slot of the ring.
+		 * @param [in] position Unmasked position of the slot.
+		 * @return The slot, uninitialized if it has no value.
+		 */
+		type &slot(size_t position) const noexcept;
+
+		/**
+		 * Move the values to a ring of a given capacity, first value at slot
+		 * 0.
+		 * @param [in] capacity New number of slots, a power of 2 not smaller
+		 * than the number of values.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		void_t reallocate(size_t capacity);
+		/**
+		 * Make room for one more value in a full ring, doubling its size.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		void_t grow();
+
+		/**
+		 * Destroy every value and free the ring.
+		 */
+		void_t release() noexcept;
+
+	public:
+		/// Iterator over the values.
+		typedef deque_iterator<type> iterator;
+
+
+		/**
+		 * Create an empty deque with room for some values.
+		 * @param [in] amount Number of values to reserve room for. Default =
+		 * 0.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		explicit deque(size_t amount = 0ul);
+		/**
+		 * Copy constructor.
+		 * @param [in] deque Deque to copy from.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		deque(const deque &deque);
+		/**
+		 * Move constructor.
+		 * @param [in,out] deque Deque to move from and leave empty.
+		 */
+		deque(deque &&deque) noexcept;
+
+		/**
+		 * Destroy every value and free the ring.
+		 */
+		~deque() noexcept;
+
+
+		/**
+		 * Begin iterator.
+		 * @return Iterator at the first value.
+		 */
+		iterator begin() const noexcept;
+		/**
+		 * End iterator.
+		 * @return Iterator after the last value.
+		 */
+		iterator end() const noexcept;
+
+
+		/**
+		 * Get the number of values.
+		 * @return Number of values.
+		 */
+		size_t size() const noexcept;
+		/**
+		 * Get the number of values that fit before reallocating.
+		 * @return Number of slots.
+		 */
+		size_t capacity() const noexcept;
+		/**
+		 * Check if the deque is empty.
+		 * @return True if there are no values, false otherwise.
+		 */
+		bool_t empty() const noexcept;
+
+
+		/**
+		 * Get the first value.
+		 * @throw out_of_range_error when the deque is empty.
+		 * @return The first value.
+		 */
+		type &front() const;
+		/**
+		 * Get the last value.
+		 * @throw out_of_range_error when the deque is empty.
+		 * @return The last value.
+		 */
+		type &back() const;
+
+
+		/**
+		 * Insert a value at the beginning.
+		 * @param [in] value Value to insert.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Self instance.
+		 */
+		deque &push_front(const type &value);
+		/**
+		 * Insert a value at the beginning.
+		 * @param [in,out] value Value to move in.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Self instance.
+		 */
+		deque &push_front(type &&value);
+		/**
+		 * Insert a value at the end.
+		 * @param [in] value Value to insert.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Self instance.
+		 */
+		deque &push_back(const type &value);
+		/**
+		 * Insert a value at the end.
+		 * @param [in,out] value Value to move in.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Self instance.
+		 */
+		deque &push_back(type &&value);
+
+
+		/**
+		 * Remove the first value.
+		 * @throw out_of_range_error when the deque is empty.
+		 * @return Self instance.
+		 */
+		deque &pop_front();
+		/**
+		 * Remove the last value.
+		 * @throw out_of_range_error when the deque is empty.
+		 * @return Self instance.
+		 */
+		deque &pop_back();
+
+
+		/**
+		 * Reserve room for some values.
+		 * @param [in] amount Number of values to make room for.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Self instance.
+		 */
+		deque &reserve(size_t amount);
+		/**
+		 * Remove all the values keeping the allocated ring.
+		 * @return Self instance.
+		 */
+		deque &clear() noexcept;
+
+
+		/**
+		 * Get the value at a given position from the front.
+		 * @param [in] position Position of the value to return.
+		 * @throw out_of_range_error when accessing a value outside the deque.
+		 * @return The value stored in the given position.
+		 */
+		type &operator[](size_t position) const;
+
+		/**
+		 * Copy assignment.
+		 * @param [in] deque Deque to copy from.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Self instance.
+		 */
+		deque &operator=(const deque &deque);
+		/**
+		 * Move assignment.
+		 * @param [in,out] deque Deque to move from and leave empty.
+		 * @return Self instance.
+		 */
+		deque &operator=(deque &&deque) noexcept;
+	};
+
+
+	/**
+	 * The ring of a deque stays where it is when the deque itself moves.
+	 * @tparam type Type of the values.
+	 */
+	template<typename type>
+	struct is_trivially_relocatable<deque<type>> {
+		/// Deques are trivially relocatable.
+		static constexpr bool_t value = true;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_data_structures_deque_impl_
+#	include "../data_structures/deque_impl.tpp"
+#	undef _stick_lib_data_structures_deque_impl_
+
+
+#endif   //_stick_lib_data_structures_deque_
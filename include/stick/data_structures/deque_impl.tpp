@@ -0,0 +1,293 @@
+/**
+ * Ring buffer double ended queue. Template implementations.
+ * @brief Ring buffer double ended queue template implementations.
+ * @file deque_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_data_structures_deque_impl_)
+
+
+#	include "../error/out_of_range_error.hpp"
+#	include "../memory/management.tpp"
+#	include "../templates/reference.tpp"
+
+
+namespace stick {
+
+
+	/// Slots of the first ring allocated by a deque.
+	static const size_t deque_minimum_capacity = 8ul;
+
+
+	template<typename type>
+	deque_iterator<type>::deque_iterator(type *slots, size_t slot_mask,
+	                                     size_t position) noexcept
+	    : slots(slots), slot_mask(slot_mask), position(position) { }
+
+
+	template<typename type>
+	type &deque_iterator<type>::operator*() const noexcept {
+		return this->slots[this->position & this->slot_mask];
+	}
+	template<typename type>
+	type *deque_iterator<type>::operator->() const noexcept {
+		return &this->slots[this->position & this->slot_mask];
+	}
+
+	template<typename type>
+	deque_iterator<type> &deque_iterator<type>::operator++() noexcept {
+		this->position++;
+
+		return *this;
+	}
+
+	template<typename type>
+	bool_t deque_iterator<type>::operator==(
+	    const deque_iterator &iterator) const noexcept {
+		return this->position == iterator.position;
+	}
+	template<typename type>
+	bool_t deque_iterator<type>::operator!=(
+	    const deque_iterator &iterator) const noexcept {
+		return this->position != iterator.position;
+	}
+
+
+	template<typename type>
+	type &deque<type>::slot(size_t position) const noexcept {
+		return this->slots[position & this->slot_mask];
+	}
+
+	template<typename type>
+	void_t deque<type>::reallocate(size_t capacity) {
+		auto slots = allocate_uninitialized<type>(capacity);
+
+		size_t elements = this->size();
+		for (size_t i = 0ul; i < elements; i++) {
+			type &value = this->slot(this->head + i);
+			construct_at(&slots[i], stick::move(value));
+			destroy_range(&value);
+		}
+
+		if (this->slots != nullptr)
+			deallocate_raw(this->slots);
+
+		this->slots = slots;
+		this->slot_mask = capacity - 1ul;
+		this->head = 0ul;
+		this->tail = elements;
+	}
+	template<typename type>
+	void_t deque<type>::grow() {
+		if (this->slots == nullptr)
+			this->reallocate(deque_minimum_capacity);
+		else
+			this->reallocate((this->slot_mask + 1ul) << 1);
+	}
+
+	template<typename type>
+	void_t deque<type>::release() noexcept {
+		if (this->slots == nullptr)
+			return;
+
+		this->clear();
+		deallocate_raw(this->slots);
+		this->slot_mask = 0ul;
+	}
+
+
+	template<typename type>
+	deque<type>::deque(size_t amount) {
+		this->reserve(amount);
+	}
+	template<typename type>
+	deque<type>::deque(const deque &deque) {
+		if (deque.empty())
+			return;
+
+		this->reserve(deque.size());
+		for (const type &e : deque)
+			construct_at(&this->slot(this->tail++), e);
+	}
+	template<typename type>
+	deque<type>::deque(deque &&deque) noexcept
+	    : slots(deque.slots), slot_mask(deque.slot_mask), head(deque.head),
+	      tail(deque.tail) {
+		deque.slots = nullptr;
+		deque.slot_mask = 0ul;
+		deque.head = 0ul;
+		deque.tail = 0ul;
+	}
+
+	template<typename type>
+	deque<type>::~deque() noexcept {
+		this->release();
+	}
+
+
+	template<typename type>
+	typename deque<type>::iterator deque<type>::begin() const noexcept {
+		return { this->slots, this->slot_mask, this->head };
+	}
+	template<typename type>
+	typename deque<type>::iterator deque<type>::end() const noexcept {
+		return { this->slots, this->slot_mask, this->tail };
+	}
+
+
+	template<typename type>
+	size_t deque<type>::size() const noexcept {
+		return this->tail - this->head;
+	}
+	template<typename type>
+	size_t deque<type>::capacity() const noexcept {
+		return this->slots == nullptr ? 0ul : this->slot_mask + 1ul;
+	}
+	template<typename type>
+	bool_t deque<type>::empty() const noexcept {
+		return this->tail == this->head;
+	}
+
+
+	template<typename type>
+	type &deque<type>::front() const {
+		if (this->empty())
+			throw out_of_range_error("Accessing the front of an empty deque.");
+
+		return this->slot(this->head);
+	}
+	template<typename type>
+	type &deque<type>::back() const {
+		if (this->empty())
+			throw out_of_range_error("Accessing the back of an empty deque.");
+
+		return this->slot(this->tail - 1ul);
+	}
+
+
+	template<typename type>
+	deque<type> &deque<type>::push_front(const type &value) {
+		// The value may live in the ring that grow() reallocates.
+		type tempy(value);
+
+		return this->push_front(stick::move(tempy));
+	}
+	template<typename type>
+	deque<type> &deque<type>::push_front(type &&value) {
+		if (this->size() == this->capacity())
+			this->grow();
+
+		construct_at(&this->slot(this->head - 1ul), stick::move(value));
+		this->head--;
+
+		return *this;
+	}
+	template<typename type>
+	deque<type> &deque<type>::push_back(const type &value) {
+		// The value may live in the ring that grow() reallocates.
+		type tempy(value);
+
+		return this->push_back(stick::move(tempy));
+	}
+	template<typename type>
+	deque<type> &deque<type>::push_back(type &&value) {
+		if (this->size() == this->capacity())
+			this->grow();
+
+		construct_at(&this->slot(this->tail), stick::move(value));
+		this->tail++;
+
+		return *this;
+	}
+
+
+	template<typename type>
+	deque<type> &deque<type>::pop_front() {
+		if (this->empty())
+			throw out_of_range_error("Pop-ing a value from an empty deque.");
+
+		destroy_range(&this->slot(this->head));
+		this->head++;
+
+		return *this;
+	}
+	template<typename type>
+	deque<type> &deque<type>::pop_back() {
+		if (this->empty())
+			throw out_of_range_error("Pop-ing a value from an empty deque.");
+
+		this->tail--;
+		destroy_range(&this->slot(this->tail));
+
+		return *this;
+	}
+
+
+	template<typename type>
+	deque<type> &deque<type>::reserve(size_t amount) {
+		size_t capacity = deque_minimum_capacity;
+		while (capacity < amount)
+			capacity <<= 1;
+
+		if (amount != 0ul and this->capacity() < capacity)
+			this->reallocate(capacity);
+
+		return *this;
+	}
+	template<typename type>
+	deque<type> &deque<type>::clear() noexcept {
+		if (not is_trivially_destructible<type>::value)
+			for (size_t i = this->head; i != this->tail; i++)
+				destroy_range(&this->slot(i));
+
+		this->head = 0ul;
+		this->tail = 0ul;
+
+		return *this;
+	}
+
+
+	template<typename type>
+	type &deque<type>::operator[](size_t position) const {
+		if (this->size() <= position)
+			throw out_of_range_error("Accessing a value outside the deque.");
+
+		return this->slot(this->head + position);
+	}
+
+	template<typename type>
+	deque<type> &deque<type>::operator=(const deque &deque) {
+		if (&deque == this)
+			return *this;
+
+		stick::deque<type> tempy(deque);
+
+		return *this = stick::move(tempy);
+	}
+	template<typename type>
+	deque<type> &deque<type>::operator=(deque &&deque) noexcept {
+		if (&deque == this)
+			return *this;
+
+		this->release();
+
+		this->slots = deque.slots;
+		this->slot_mask = deque.slot_mask;
+		this->head = deque.head;
+		this->tail = deque.tail;
+
+		deque.slots = nullptr;
+		deque.slot_mask = 0ul;
+		deque.head = 0ul;
+		deque.tail = 0ul;
+
+		return *this;
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_data_structures_deque_impl_
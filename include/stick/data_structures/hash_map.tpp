@@ -0,0 +1,131 @@
+/**
+ * Hash map template. Unordered key to value association.
+ * @brief Hash map template.
+ * @file hash_map.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_data_structures_hash_map_)
+#	define _stick_lib_data_structures_hash_map_
+
+
+
+#	include "../data_structures/hash_table.tpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Map of unique keys to values. Each key and value are stored together
+	 * in a flat pair slot of a hash_table.
+	 * @tparam key_type Type of the keys.
+	 * @tparam value_type Type of the values.
+	 * @tparam hasher_type Hash function object of the keys. Default =
+	 * hasher<key_type>.
+	 * @tparam equal_type Equality function object of the keys. Default =
+	 * hash_equal<key_type>.
+	 */
+	template<typename key_type, typename value_type,
+	         typename hasher_type = hasher<key_type>,
+	         typename equal_type = hash_equal<key_type>>
+	class hash_map : public hash_table<key_type, pair<key_type, value_type>,
+	                                   hasher_type, equal_type> {
+
+		/// Slot of a key and its value.
+		typedef pair<key_type, value_type> slot_type;
+		/// Table holding the slots.
+		typedef hash_table<key_type, slot_type, hasher_type, equal_type>
+		    table_type;
+
+	public:
+		using table_type::table_type;
+
+
+		/**
+		 * Insert a key and its value if the key is not in the map yet.
+		 * @param [in] key Key to insert.
+		 * @param [in] value Value of the key.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return True if inserted, false if the key was already there.
+		 */
+		bool_t insert(const key_type &key, const value_type &value);
+		/**
+		 * Insert a key and its value if the key is not in the map yet,
+		 * moving both into the map.
+		 * @param [in,out] key Key to insert.
+		 * @param [in,out] value Value of the key.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return True if inserted, false if the key was already there.
+		 */
+		bool_t insert(key_type &&key, value_type &&value);
+		/**
+		 * Set the value of a key, inserting the key if needed.
+		 * @param [in] key Key to set.
+		 * @param [in] value New value of the key.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Self instance.
+		 */
+		hash_map &assign(const key_type &key, const value_type &value);
+
+
+		/**
+		 * Look for the value of a key.
+		 * @tparam lookup_type Type of the key, any the hasher and the
+		 * equality accept, like string_view for string keys.
+		 * @param [in] key Key to look for.
+		 * @return Pointer to the value, nullptr if the key is not found.
+		 */
+		template<typename lookup_type>
+		value_type *find(const lookup_type &key) noexcept;
+		/**
+		 * Look for the value of a key.
+		 * @tparam lookup_type Type of the key, any the hasher and the
+		 * equality accept, like string_view for string keys.
+		 * @param [in] key Key to look for.
+		 * @return Pointer to the value, nullptr if the key is not found.
+		 */
+		template<typename lookup_type>
+		const value_type *find(const lookup_type &key) const noexcept;
+
+		/**
+		 * Get the value of a key.
+		 * @tparam lookup_type Type of the key, any the hasher and the
+		 * equality accept.
+		 * @param [in] key Key of the value.
+		 * @throw out_of_range_error when the key is not in the map.
+		 * @return The value of the key.
+		 */
+		template<typename lookup_type>
+		value_type &at(const lookup_type &key);
+		/**
+		 * Get the value of a key.
+		 * @tparam lookup_type Type of the key, any the hasher and the
+		 * equality accept.
+		 * @param [in] key Key of the value.
+		 * @throw out_of_range_error when the key is not in the map.
+		 * @return The value of the key.
+		 */
+		template<typename lookup_type>
+		const value_type &at(const lookup_type &key) const;
+
+
+		/**
+		 * Get the value of a key, inserting it with a default value if
+		 * it is not in the map.
+		 * @param [in] key Key of the value.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return The value of the key.
+		 */
+		value_type &operator[](const key_type &key);
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_data_structures_hash_map_impl_
+#	include "../data_structures/hash_map_impl.tpp"
+#	undef _stick_lib_data_structures_hash_map_impl_
+
+
+#endif   //_stick_lib_data_structures_hash_map_
@@ -0,0 +1,131 @@
+/**
+ * Hash map template. Template implementations.
+ * @brief Hash map template implementations.
+ * @file hash_map_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_data_structures_hash_map_impl_)
+
+
+#	include "../error/out_of_range_error.hpp"
+#	include "../templates/reference.tpp"
+
+#	include <new>
+
+
+namespace stick {
+
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	bool_t hash_map<key_type, value_type, hasher_type, equal_type>::insert(
+	    const key_type &key, const value_type &value) {
+		uint64_t hash = this->hash(key);
+		size_t index;
+		if (this->probe(key, hash, index))
+			return false;
+
+		index = this->prepare_insert(hash, index);
+		new (&this->slot(index)) slot_type(key, value);
+		this->finish_insert(hash, index);
+
+		return true;
+	}
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	bool_t hash_map<key_type, value_type, hasher_type, equal_type>::insert(
+	    key_type &&key, value_type &&value) {
+		uint64_t hash = this->hash(key);
+		size_t index;
+		if (this->probe(key, hash, index))
+			return false;
+
+		index = this->prepare_insert(hash, index);
+		new (&this->slot(index)) slot_type(move(key), move(value));
+		this->finish_insert(hash, index);
+
+		return true;
+	}
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	hash_map<key_type, value_type, hasher_type, equal_type> &
+	hash_map<key_type, value_type, hasher_type, equal_type>::assign(
+	    const key_type &key, const value_type &value) {
+		this->operator[](key) = value;
+
+		return *this;
+	}
+
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	template<typename lookup_type>
+	value_type *hash_map<key_type, value_type, hasher_type, equal_type>::find(
+	    const lookup_type &key) noexcept {
+		size_t index;
+		if (not this->probe(key, this->hash(key), index))
+			return nullptr;
+
+		return &this->slot(index).second();
+	}
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	template<typename lookup_type>
+	const value_type *
+	hash_map<key_type, value_type, hasher_type, equal_type>::find(
+	    const lookup_type &key) const noexcept {
+		size_t index;
+		if (not this->probe(key, this->hash(key), index))
+			return nullptr;
+
+		return &this->slot(index).second();
+	}
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	template<typename lookup_type>
+	value_type &hash_map<key_type, value_type, hasher_type, equal_type>::at(
+	    const lookup_type &key) {
+		value_type *value = this->find(key);
+		if (value == nullptr)
+			throw out_of_range_error("Accessing a key outside the map.");
+
+		return *value;
+	}
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	template<typename lookup_type>
+	const value_type &
+	hash_map<key_type, value_type, hasher_type, equal_type>::at(
+	    const lookup_type &key) const {
+		const value_type *value = this->find(key);
+		if (value == nullptr)
+			throw out_of_range_error("Accessing a key outside the map.");
+
+		return *value;
+	}
+
+
+	template<typename key_type, typename value_type, typename hasher_type,
+	         typename equal_type>
+	value_type &
+	hash_map<key_type, value_type, hasher_type, equal_type>::operator[](
+	    const key_type &key) {
+		uint64_t hash = this->hash(key);
+		size_t index;
+		if (not this->probe(key, hash, index)) {
+			index = this->prepare_insert(hash, index);
+			new (&this->slot(index)) slot_type(key, value_type());
+			this->finish_insert(hash, index);
+		}
+
+		return this->slot(index).second();
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_data_structures_hash_map_impl_
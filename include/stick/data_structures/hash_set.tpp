@@ -0,0 +1,75 @@
+/**
+ * Hash set template. Unordered collection of unique keys.
+ * @brief Hash set template.
+ * @file hash_set.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_data_structures_hash_set_)
+#	define _stick_lib_data_structures_hash_set_
+
+
+
+#	include "../data_structures/hash_table.tpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Set of unique keys, each one stored alone in a slot of a hash_table.
+	 * @tparam key_type Type of the keys.
+	 * @tparam hasher_type Hash function object of the keys. Default =
+	 * hasher<key_type>.
+	 * @tparam equal_type Equality function object of the keys. Default =
+	 * hash_equal<key_type>.
+	 */
+	template<typename key_type, typename hasher_type = hasher<key_type>,
+	         typename equal_type = hash_equal<key_type>>
+	class hash_set
+	    : public hash_table<key_type, key_type, hasher_type, equal_type> {
+
+		/// Table holding the keys.
+		typedef hash_table<key_type, key_type, hasher_type, equal_type>
+		    table_type;
+
+	public:
+		using table_type::table_type;
+
+
+		/**
+		 * Insert a key if it is not in the set yet.
+		 * @param [in] key Key to insert.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return True if inserted, false if the key was already there.
+		 */
+		bool_t insert(const key_type &key);
+		/**
+		 * Insert a key if it is not in the set yet, moving it into the set.
+		 * @param [in,out] key Key to insert.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return True if inserted, false if the key was already there.
+		 */
+		bool_t insert(key_type &&key);
+
+
+		/**
+		 * Look for a key.
+		 * @tparam lookup_type Type of the key, any the hasher and the
+		 * equality accept, like string_view for string keys.
+		 * @param [in] key Key to look for.
+		 * @return Pointer to the stored key, nullptr if it is not found.
+		 */
+		template<typename lookup_type>
+		const key_type *find(const lookup_type &key) const noexcept;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_data_structures_hash_set_impl_
+#	include "../data_structures/hash_set_impl.tpp"
+#	undef _stick_lib_data_structures_hash_set_impl_
+
+
+#endif   //_stick_lib_data_structures_hash_set_
@@ -0,0 +1,65 @@
+/**
+ * Hash set template. Template implementations.
+ * @brief Hash set template implementations.
+ * @file hash_set_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_data_structures_hash_set_impl_)
+
+
+#	include "../templates/reference.tpp"
+
+#	include <new>
+
+
+namespace stick {
+
+
+	template<typename key_type, typename hasher_type, typename equal_type>
+	bool_t hash_set<key_type, hasher_type, equal_type>::insert(
+	    const key_type &key) {
+		uint64_t hash = this->hash(key);
+		size_t index;
+		if (this->probe(key, hash, index))
+			return false;
+
+		index = this->prepare_insert(hash, index);
+		new (&this->slot(index)) key_type(key);
+		this->finish_insert(hash, index);
+
+		return true;
+	}
+	template<typename key_type, typename hasher_type, typename equal_type>
+	bool_t
+	hash_set<key_type, hasher_type, equal_type>::insert(key_type &&key) {
+		uint64_t hash = this->hash(key);
+		size_t index;
+		if (this->probe(key, hash, index))
+			return false;
+
+		index = this->prepare_insert(hash, index);
+		new (&this->slot(index)) key_type(move(key));
+		this->finish_insert(hash, index);
+
+		return true;
+	}
+
+
+	template<typename key_type, typename hasher_type, typename equal_type>
+	template<typename lookup_type>
+	const key_type *hash_set<key_type, hasher_type, equal_type>::find(
+	    const lookup_type &key) const noexcept {
+		size_t index;
+		if (not this->probe(key, this->hash(key), index))
+			return nullptr;
+
+		return &this->slot(index);
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_data_structures_hash_set_impl_
@@ -0,0 +1,418 @@
+/**
+ * Open addressing hash table core shared by hash_map and hash_set.
+ * @brief Open addressing hash table template.
+ * @file hash_table.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_data_structures_hash_table_)
+#	define _stick_lib_data_structures_hash_table_
+
+
+
+#	include "../crypto/hash/hasher.tpp"
+#	include "../data_structures/pair.tpp"
+#	include "../defines/types.hpp"
+#	include "../memory/storage.tpp"
+
+
+namespace stick {
+
+
+	/// Control bytes checked at once on each probe.
+	static const size_t hash_group_width = 16ul;
+	/// Control byte of a slot without value. Full slots store 7 hash bits.
+	static const byte_t hash_control_empty = 0x80u;
+
+
+	/**
+	 * Operations over a group of hash_group_width control bytes. Uses SSE2
+	 * on x86_64 and 8 bytes words everywhere else.
+	 */
+	struct hash_group {
+		/**
+		 * Find the control bytes of a group equal to a tag.
+		 * @param [in] control First control byte of the group.
+		 * @param [in] tag 7 bits tag to look for.
+		 * @return One bit per matching byte, bit 0 is the first byte.
+		 */
+		static inline uint_t match(const byte_t *control, byte_t tag) noexcept;
+		/**
+		 * Find the empty control bytes of a group.
+		 * @param [in] control First control byte of the group.
+		 * @return One bit per empty byte, bit 0 is the first byte.
+		 */
+		static inline uint_t match_empty(const byte_t *control) noexcept;
+	};
+
+
+	/**
+	 * Equality function object for the keys of hash containers. Lookups with
+	 * another type compare with operator== too.
+	 * @tparam type Type of the keys.
+	 */
+	template<typename type>
+	struct hash_equal {
+		/**
+		 * Compare a stored key with a looked up one.
+		 * @tparam lookup_type Type of the looked up key.
+		 * @param [in] key Stored key.
+		 * @param [in] lookup Looked up key.
+		 * @return True if both keys are equal, false otherwise.
+		 */
+		template<typename lookup_type>
+		bool_t operator()(const type &key,
+		                  const lookup_type &lookup) const noexcept;
+	};
+
+	/**
+	 * String keys compare as views, so they can be looked up by string_view
+	 * without building a string.
+	 */
+	template<>
+	struct hash_equal<string> {
+		/**
+		 * Compare a stored key with a looked up one.
+		 * @param [in] key Stored key.
+		 * @param [in] lookup Looked up characters.
+		 * @return True if both have the same characters, false otherwise.
+		 */
+		bool_t operator()(const string &key,
+		                  const string_view &lookup) const noexcept;
+	};
+
+
+	/**
+	 * Get the key of a slot. Slots are pair of key and value by default.
+	 * @tparam key_type Type of the keys.
+	 * @tparam slot_type Type of the slots.
+	 */
+	template<typename key_type, typename slot_type>
+	struct hash_slot {
+		/**
+		 * Get the key of a slot.
+		 * @param [in] slot Slot holding the key.
+		 * @return The key.
+		 */
+		static const key_type &key(const slot_type &slot) noexcept;
+	};
+
+	/**
+	 * Slots that are just a key, as the ones of sets.
+	 * @tparam key_type Type of the keys.
+	 */
+	template<typename key_type>
+	struct hash_slot<key_type, key_type> {
+		/**
+		 * Get the key of a slot.
+		 * @param [in] slot Slot holding the key.
+		 * @return The key.
+		 */
+		static const key_type &key(const key_type &slot) noexcept;
+	};
+
+
+	/**
+	 * Forward iterator over the full slots of a hash table.
+	 * @tparam slot_type Type of the slots.
+	 */
+	template<typename slot_type>
+	class hash_table_iterator {
+
+		const byte_t *control = nullptr;   ///< Control byte of the slot.
+		const byte_t *control_end = nullptr;   ///< One after the last one.
+		slot_type *slot = nullptr;   ///< Current slot.
+
+		/**
+		 * Advance to the first full slot from the current one.
+		 */
+		void_t skip_empty() noexcept;
+
+	public:
+		/**
+		 * Create an iterator at the first full slot from a given one.
+		 * @param [in] control Control byte of the slot.
+		 * @param [in] control_end One after the last control byte.
+		 * @param [in] slot Slot to start at.
+		 */
+		hash_table_iterator(const byte_t *control, const byte_t *control_end,
+		                    slot_type *slot) noexcept;
+
+
+		/**
+		 * Get the current slot.
+		 * @return The slot.
+		 */
+		slot_type &operator*() const noexcept;
+		/**
+		 * Access the current slot.
+		 * @return Pointer to the slot.
+		 */
+		slot_type *operator->() const noexcept;
+
+		/**
+		 * Advance to the next full slot.
+		 * @return Self instance.
+		 */
+		hash_table_iterator &operator++() noexcept;
+
+		/**
+		 * Check if two iterators are at the same slot.
+		 * @param [in] iterator Iterator to compare with.
+		 * @return True if both are at the same slot, false otherwise.
+		 */
+		bool_t operator==(const hash_table_iterator &iterator) const noexcept;
+		/**
+		 * Check if two iterators are at different slots.
+		 * @param [in] iterator Iterator to compare with.
+		 * @return True if they are at different slots, false otherwise.
+		 */
+		bool_t operator!=(const hash_table_iterator &iterator) const noexcept;
+	};
+
+
+	/**
+	 * Open addressing hash table in the Swiss table style. The slots are a
+	 * flat array and a parallel array of control bytes keeps 7 bits of the
+	 * hash of each full slot, so a whole group of them is checked with a
+	 * single SIMD compare before touching any key. Probing is linear, so
+	 * erasing shifts the following values back instead of leaving
+	 * tombstones, and lookups never get slower after many erases.
+	 * @tparam key_type Type of the keys.
+	 * @tparam slot_type Type of the slots.
+	 * @tparam hasher_type Hash function object of the keys.
+	 * @tparam equal_type Equality function object of the keys.
+	 */
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	class hash_table {
+
+		/// Uninitialized memory for a slot.
+		typedef storage_aligned<sizeof(slot_type), alignof(slot_type)>
+		    slot_storage;
+
+		byte_t *control = nullptr;   ///< Control bytes, with the first group
+		                             ///< cloned after the last one.
+		slot_storage *slots = nullptr;   ///< Slots memory.
+		size_t slot_mask = 0ul;   ///< Number of slots minus one.
+		size_t elements = 0ul;   ///< Number of full slots.
+		size_t growth_left = 0ul;   ///< Insertions left before growing.
+
+		hasher_type hasher;   ///< Hash function object.
+		equal_type equal;   ///< Equality function object.
+
+
+		/**
+		 * Get the maximum number of values a number of slots can hold.
+		 * @param [in] capacity Number of slots.
+		 * @return Maximum number of values, 7/8 of the slots.
+		 */
+		static size_t max_load(size_t capacity) noexcept;
+
+		/**
+		 * Set the control byte of a slot and its clone.
+		 * @param [in] index Index of the slot.
+		 * @param [in] value New control byte.
+		 */
+		void_t set_control(size_t index, byte_t value) noexcept;
+
+		/**
+		 * Find the first empty slot from the one a hash starts at.
+		 * @param [in] hash Hash of the key to place.
+		 * @return Index of the empty slot.
+		 */
+		size_t find_empty(uint64_t hash) const noexcept;
+
+		/**
+		 * Allocate empty slots, without releasing the current ones.
+		 * @param [in] capacity Number of slots, a power of 2.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		void_t allocate_slots(size_t capacity);
+		/**
+		 * Destroy the values and release all the slots.
+		 */
+		void_t release() noexcept;
+		/**
+		 * Move the values to a given number of slots.
+		 * @param [in] capacity Number of slots, a power of 2.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		void_t rehash(size_t capacity);
+
+	protected:
+		/**
+		 * Get a slot.
+		 * @param [in] index Index of the slot.
+		 * @return The slot.
+		 */
+		slot_type &slot(size_t index) const noexcept;
+
+		/**
+		 * Hash a key with the hasher of the table.
+		 * @tparam lookup_type Type of the key.
+		 * @param [in] key Key to hash.
+		 * @return Hash of the key.
+		 */
+		template<typename lookup_type>
+		uint64_t hash(const lookup_type &key) const noexcept;
+
+		/**
+		 * Look for the slot of a key.
+		 * @tparam lookup_type Type of the key, any the hasher and the
+		 * equality accept.
+		 * @param [in] key Key to look for.
+		 * @param [in] hash Hash of the key.
+		 * @param [out] index Index of the slot of the key if it is found,
+		 * otherwise of the first empty slot where it would go.
+		 * @return True if the key is found, false otherwise.
+		 */
+		template<typename lookup_type>
+		bool_t probe(const lookup_type &key, uint64_t hash,
+		             size_t &index) const noexcept;
+
+		/**
+		 * Prepare the slot where a key not in the table goes, growing the
+		 * table if it is full.
+		 * @param [in] hash Hash of the key.
+		 * @param [in] index Empty slot given by probe().
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Index of the slot to construct the value in.
+		 */
+		size_t prepare_insert(uint64_t hash, size_t index);
+		/**
+		 * Mark the slot given by prepare_insert() as full, once its value is
+		 * constructed, so a constructor throwing leaves the table as it was.
+		 * @param [in] hash Hash of the key.
+		 * @param [in] index Index of the slot.
+		 */
+		void_t finish_insert(uint64_t hash, size_t index) noexcept;
+
+		/**
+		 * Destroy the value of a slot and shift back the following values
+		 * that were displaced from their first slot.
+		 * @param [in] index Index of the full slot.
+		 */
+		void_t erase_slot(size_t index) noexcept;
+
+	public:
+		/// Iterator over the slots.
+		typedef hash_table_iterator<slot_type> iterator;
+
+
+		/**
+		 * Create an empty table without allocating.
+		 */
+		hash_table() noexcept = default;
+		/**
+		 * Create an empty table with room for some values.
+		 * @param [in] amount Number of values to reserve room for.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		explicit hash_table(size_t amount);
+		/**
+		 * Copy constructor.
+		 * @param [in] table Table to copy.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		hash_table(const hash_table &table);
+		/**
+		 * Move constructor.
+		 * @param [in,out] table Table to move from and leave empty.
+		 */
+		hash_table(hash_table &&table) noexcept;
+
+		/**
+		 * Destroy the values and release the memory.
+		 */
+		~hash_table() noexcept;
+
+
+		/**
+		 * Begin iterator.
+		 * @return Iterator at the first value.
+		 */
+		iterator begin() const noexcept;
+		/**
+		 * End iterator.
+		 * @return Iterator one after the last value.
+		 */
+		iterator end() const noexcept;
+
+
+		/**
+		 * Get the number of values.
+		 * @return Number of values.
+		 */
+		size_t size() const noexcept;
+		/**
+		 * Get the number of slots.
+		 * @return Number of allocated slots.
+		 */
+		size_t capacity() const noexcept;
+		/**
+		 * Check if the table is empty.
+		 * @return True if there are no values, false otherwise.
+		 */
+		bool_t empty() const noexcept;
+
+
+		/**
+		 * Check if a key is in the table.
+		 * @tparam lookup_type Type of the key, any the hasher and the
+		 * equality accept.
+		 * @param [in] key Key to look for.
+		 * @return True if the key is found, false otherwise.
+		 */
+		template<typename lookup_type>
+		bool_t contains(const lookup_type &key) const noexcept;
+
+		/**
+		 * Remove a key and its value.
+		 * @tparam lookup_type Type of the key, any the hasher and the
+		 * equality accept.
+		 * @param [in] key Key to remove.
+		 * @return True if the key was found, false otherwise.
+		 */
+		template<typename lookup_type>
+		bool_t erase(const lookup_type &key) noexcept;
+
+
+		/**
+		 * Make room for some values without growing on the way.
+		 * @param [in] amount Number of values to make room for.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Self instance.
+		 */
+		hash_table &reserve(size_t amount);
+		/**
+		 * Remove all the values keeping the allocated slots.
+		 * @return Self instance.
+		 */
+		hash_table &clear() noexcept;
+
+
+		/**
+		 * Copy assignment operator.
+		 * @param [in] table Table to copy.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Self instance.
+		 */
+		hash_table &operator=(const hash_table &table);
+		/**
+		 * Move assignment operator.
+		 * @param [in,out] table Table to move from and leave empty.
+		 * @return Self instance.
+		 */
+		hash_table &operator=(hash_table &&table) noexcept;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_data_structures_hash_table_impl_
+#	include "../data_structures/hash_table_impl.tpp"
+#	undef _stick_lib_data_structures_hash_table_impl_
+
+
+#endif   //_stick_lib_data_structures_hash_table_
@@ -0,0 +1,547 @@
+/**
+ * Open addressing hash table core. Template implementations.
+ * @brief Open addressing hash table template implementations.
+ * @file hash_table_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_data_structures_hash_table_impl_)
+
+
+#	include "../defines/arch.hpp"
+#	include "../memory/management.tpp"
+#	include "../string/string_view.hpp"
+#	include "../templates/bit.tpp"
+#	include "../templates/reference.tpp"
+
+#	include <new>
+
+#	if stick_IS_ARCH_x86_64
+#		include <emmintrin.h>
+#	endif
+
+
+namespace stick {
+
+
+	inline uint_t hash_group::match(const byte_t *control,
+	                                byte_t tag) noexcept {
+#	if stick_IS_ARCH_x86_64
+		__m128i group =
+		    _mm_loadu_si128(reinterpret_cast<const __m128i *>(control));
+
+		return static_cast<uint_t>(_mm_movemask_epi8(
+		    _mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char_t>(tag)))));
+#	else
+		uint_t mask = 0u;
+		for (size_t half = 0ul; half < 2ul; half++) {
+			uint64_t word = load_little_endian<uint64_t>(control + half * 8ul)
+			                ^ tag * 0x0101010101010101ull;
+			// Exact zero bytes: no carry crosses from one byte to the next.
+			uint64_t zeros = ~(((word & 0x7f7f7f7f7f7f7f7full)
+			                    + 0x7f7f7f7f7f7f7f7full)
+			                   | word | 0x7f7f7f7f7f7f7f7full);
+			// Gather the high bit of each byte in the top byte.
+			mask |= static_cast<uint_t>(
+			            ((zeros >> 7) * 0x0102040810204080ull) >> 56)
+			        << (half * 8ul);
+		}
+
+		return mask;
+#	endif
+	}
+
+	inline uint_t hash_group::match_empty(const byte_t *control) noexcept {
+#	if stick_IS_ARCH_x86_64
+		// Only empty control bytes have the high bit set.
+		return static_cast<uint_t>(_mm_movemask_epi8(
+		    _mm_loadu_si128(reinterpret_cast<const __m128i *>(control))));
+#	else
+		uint_t mask = 0u;
+		for (size_t half = 0ul; half < 2ul; half++) {
+			uint64_t empty = load_little_endian<uint64_t>(control + half * 8ul)
+			                 & 0x8080808080808080ull;
+			mask |= static_cast<uint_t>(
+			            ((empty >> 7) * 0x0102040810204080ull) >> 56)
+			        << (half * 8ul);
+		}
+
+		return mask;
+#	endif
+	}
+
+
+	template<typename type>
+	template<typename lookup_type>
+	bool_t hash_equal<type>::operator()(
+	    const type &key, const lookup_type &lookup) const noexcept {
+		return key == lookup;
+	}
+
+	inline bool_t
+	hash_equal<string>::operator()(const string &key,
+	                               const string_view &lookup) const noexcept {
+		return string_view(key) == lookup;
+	}
+
+
+	template<typename key_type, typename slot_type>
+	const key_type &
+	hash_slot<key_type, slot_type>::key(const slot_type &slot) noexcept {
+		return slot.first();
+	}
+
+	template<typename key_type>
+	const key_type &
+	hash_slot<key_type, key_type>::key(const key_type &slot) noexcept {
+		return slot;
+	}
+
+
+	template<typename slot_type>
+	void_t hash_table_iterator<slot_type>::skip_empty() noexcept {
+		for (; this->control != this->control_end
+		       and *this->control == hash_control_empty;
+		     this->control++)
+			this->slot++;
+	}
+
+	template<typename slot_type>
+	hash_table_iterator<slot_type>::hash_table_iterator(
+	    const byte_t *control, const byte_t *control_end,
+	    slot_type *slot) noexcept
+	    : control(control), control_end(control_end), slot(slot) {
+		this->skip_empty();
+	}
+
+
+	template<typename slot_type>
+	slot_type &hash_table_iterator<slot_type>::operator*() const noexcept {
+		return *this->slot;
+	}
+	template<typename slot_type>
+	slot_type *hash_table_iterator<slot_type>::operator->() const noexcept {
+		return this->slot;
+	}
+
+	template<typename slot_type>
+	hash_table_iterator<slot_type> &
+	hash_table_iterator<slot_type>::operator++() noexcept {
+		this->control++;
+		this->slot++;
+		this->skip_empty();
+
+		return *this;
+	}
+
+	template<typename slot_type>
+	bool_t hash_table_iterator<slot_type>::operator==(
+	    const hash_table_iterator &iterator) const noexcept {
+		return this->control == iterator.control;
+	}
+	template<typename slot_type>
+	bool_t hash_table_iterator<slot_type>::operator!=(
+	    const hash_table_iterator &iterator) const noexcept {
+		return this->control != iterator.control;
+	}
+
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	size_t hash_table<key_type, slot_type, hasher_type, equal_type>::max_load(
+	    size_t capacity) noexcept {
+		return capacity - capacity / 8ul;
+	}
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	void_t hash_table<key_type, slot_type, hasher_type,
+	                  equal_type>::set_control(size_t index,
+	                                           byte_t value) noexcept {
+		this->control[index] = value;
+		// The group loaded at the last slots reads the first ones again.
+		if (index < hash_group_width - 1ul)
+			this->control[this->slot_mask + 1ul + index] = value;
+	}
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	size_t hash_table<key_type, slot_type, hasher_type,
+	                  equal_type>::find_empty(uint64_t hash) const noexcept {
+		size_t position = static_cast<size_t>(hash) & this->slot_mask;
+		for (;;) {
+			uint_t empty = hash_group::match_empty(this->control + position);
+			if (empty != 0u)
+				return (position + count_trailing_zeros(empty))
+				       & this->slot_mask;
+
+			position = (position + hash_group_width) & this->slot_mask;
+		}
+	}
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	void_t hash_table<key_type, slot_type, hasher_type,
+	                  equal_type>::allocate_slots(size_t capacity) {
+		this->control = allocate<byte_t>(capacity + hash_group_width - 1ul);
+		for (size_t i = 0ul; i < capacity + hash_group_width - 1ul; i++)
+			this->control[i] = hash_control_empty;
+		this->slots = allocate<slot_storage>(capacity);
+		this->slot_mask = capacity - 1ul;
+		this->elements = 0ul;
+		this->growth_left = max_load(capacity);
+	}
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	void_t hash_table<key_type, slot_type, hasher_type,
+	                  equal_type>::release() noexcept {
+		if (this->control == nullptr)
+			return;
+
+		this->clear();
+		deallocate(this->control);
+		deallocate(this->slots);
+		this->slot_mask = 0ul;
+		this->growth_left = 0ul;
+	}
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	void_t hash_table<key_type, slot_type, hasher_type, equal_type>::rehash(
+	    size_t capacity) {
+		byte_t *old_control = this->control;
+		slot_storage *old_slots = this->slots;
+		size_t old_capacity = this->control == nullptr ? 0ul
+		                                               : this->slot_mask + 1ul;
+		size_t old_elements = this->elements;
+
+		this->allocate_slots(capacity);
+
+		if (old_control == nullptr)
+			return;
+
+		auto old = reinterpret_cast<slot_type *>(old_slots);
+		for (size_t i = 0ul; i < old_capacity; i++)
+			if (old_control[i] != hash_control_empty) {
+				uint64_t hash = this->hash(hash_slot<key_type, slot_type>::key(
+				    old[i]));
+				size_t index = this->find_empty(hash);
+
+				new (&this->slot(index)) slot_type(move(old[i]));
+				old[i].~slot_type();
+				this->set_control(index, static_cast<byte_t>(hash >> 57));
+			}
+
+		this->elements = old_elements;
+		this->growth_left -= old_elements;
+
+		deallocate(old_control);
+		deallocate(old_slots);
+	}
+
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	slot_type &hash_table<key_type, slot_type, hasher_type, equal_type>::slot(
+	    size_t index) const noexcept {
+		return reinterpret_cast<slot_type *>(this->slots)[index];
+	}
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	template<typename lookup_type>
+	uint64_t hash_table<key_type, slot_type, hasher_type, equal_type>::hash(
+	    const lookup_type &key) const noexcept {
+		return this->hasher(key);
+	}
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	template<typename lookup_type>
+	bool_t hash_table<key_type, slot_type, hasher_type, equal_type>::probe(
+	    const lookup_type &key, uint64_t hash, size_t &index) const noexcept {
+		if (this->control == nullptr) {
+			index = 0ul;
+
+			return false;
+		}
+
+		// The top 7 bits are the tag, the low bits pick the first slot.
+		auto tag = static_cast<byte_t>(hash >> 57);
+		size_t position = static_cast<size_t>(hash) & this->slot_mask;
+		for (;;) {
+			const byte_t *group = this->control + position;
+
+			for (uint_t match = hash_group::match(group, tag); match != 0u;
+			     match &= match - 1u) {
+				size_t candidate =
+				    (position + count_trailing_zeros(match)) & this->slot_mask;
+				if (this->equal(hash_slot<key_type, slot_type>::key(
+				                    this->slot(candidate)),
+				                key)) {
+					index = candidate;
+
+					return true;
+				}
+			}
+
+			// Linear probing never leaves a key after an empty slot.
+			uint_t empty = hash_group::match_empty(group);
+			if (empty != 0u) {
+				index = (position + count_trailing_zeros(empty))
+				        & this->slot_mask;
+
+				return false;
+			}
+
+			position = (position + hash_group_width) & this->slot_mask;
+		}
+	}
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	size_t hash_table<key_type, slot_type, hasher_type,
+	                  equal_type>::prepare_insert(uint64_t hash,
+	                                              size_t index) {
+		if (this->growth_left == 0ul) {
+			this->rehash(this->control == nullptr
+			                 ? hash_group_width
+			                 : (this->slot_mask + 1ul) << 1);
+			index = this->find_empty(hash);
+		}
+
+		return index;
+	}
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	void_t hash_table<key_type, slot_type, hasher_type,
+	                  equal_type>::finish_insert(uint64_t hash,
+	                                             size_t index) noexcept {
+		this->set_control(index, static_cast<byte_t>(hash >> 57));
+		this->elements++;
+		this->growth_left--;
+	}
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	void_t hash_table<key_type, slot_type, hasher_type,
+	                  equal_type>::erase_slot(size_t index) noexcept {
+		this->slot(index).~slot_type();
+
+		// Move back every following value whose first slot is not between
+		// the hole and itself, until the end of the cluster.
+		for (size_t next = (index + 1ul) & this->slot_mask;
+		     this->control[next] != hash_control_empty;
+		     next = (next + 1ul) & this->slot_mask) {
+			size_t first = static_cast<size_t>(this->hash(
+			                   hash_slot<key_type, slot_type>::key(
+			                       this->slot(next))))
+			               & this->slot_mask;
+			if (((next - first) & this->slot_mask)
+			    < ((next - index) & this->slot_mask))
+				continue;
+
+			new (&this->slot(index)) slot_type(move(this->slot(next)));
+			this->slot(next).~slot_type();
+			this->set_control(index, this->control[next]);
+			index = next;
+		}
+
+		this->set_control(index, hash_control_empty);
+		this->elements--;
+		this->growth_left++;
+	}
+
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	hash_table<key_type, slot_type, hasher_type, equal_type>::hash_table(
+	    size_t amount) {
+		this->reserve(amount);
+	}
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	hash_table<key_type, slot_type, hasher_type, equal_type>::hash_table(
+	    const hash_table &table)
+	    : hasher(table.hasher), equal(table.equal) {
+		if (table.control == nullptr)
+			return;
+
+		size_t capacity = table.slot_mask + 1ul;
+		this->allocate_slots(capacity);
+		for (size_t i = 0ul; i < capacity; i++)
+			if (table.control[i] != hash_control_empty)
+				new (&this->slot(i)) slot_type(table.slot(i));
+
+		for (size_t i = 0ul; i < capacity + hash_group_width - 1ul; i++)
+			this->control[i] = table.control[i];
+		this->elements = table.elements;
+		this->growth_left = table.growth_left;
+	}
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	hash_table<key_type, slot_type, hasher_type, equal_type>::hash_table(
+	    hash_table &&table) noexcept
+	    : control(table.control), slots(table.slots),
+	      slot_mask(table.slot_mask), elements(table.elements),
+	      growth_left(table.growth_left), hasher(table.hasher),
+	      equal(table.equal) {
+		table.control = nullptr;
+		table.slots = nullptr;
+		table.slot_mask = 0ul;
+		table.elements = 0ul;
+		table.growth_left = 0ul;
+	}
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	hash_table<key_type, slot_type, hasher_type,
+	           equal_type>::~hash_table() noexcept {
+		this->release();
+	}
+
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	typename hash_table<key_type, slot_type, hasher_type, equal_type>::iterator
+	hash_table<key_type, slot_type, hasher_type, equal_type>::begin()
+	    const noexcept {
+		return { this->control, this->control + this->capacity(),
+		         reinterpret_cast<slot_type *>(this->slots) };
+	}
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	typename hash_table<key_type, slot_type, hasher_type, equal_type>::iterator
+	hash_table<key_type, slot_type, hasher_type, equal_type>::end()
+	    const noexcept {
+		return { this->control + this->capacity(),
+		         this->control + this->capacity(),
+		         reinterpret_cast<slot_type *>(this->slots)
+		             + this->capacity() };
+	}
+
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	size_t hash_table<key_type, slot_type, hasher_type, equal_type>::size()
+	    const noexcept {
+		return this->elements;
+	}
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	size_t hash_table<key_type, slot_type, hasher_type, equal_type>::capacity()
+	    const noexcept {
+		return this->control == nullptr ? 0ul : this->slot_mask + 1ul;
+	}
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	bool_t hash_table<key_type, slot_type, hasher_type, equal_type>::empty()
+	    const noexcept {
+		return this->elements == 0ul;
+	}
+
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	template<typename lookup_type>
+	bool_t hash_table<key_type, slot_type, hasher_type, equal_type>::contains(
+	    const lookup_type &key) const noexcept {
+		size_t index;
+
+		return this->probe(key, this->hash(key), index);
+	}
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	template<typename lookup_type>
+	bool_t hash_table<key_type, slot_type, hasher_type, equal_type>::erase(
+	    const lookup_type &key) noexcept {
+		size_t index;
+		if (not this->probe(key, this->hash(key), index))
+			return false;
+
+		this->erase_slot(index);
+
+		return true;
+	}
+
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	hash_table<key_type, slot_type, hasher_type, equal_type> &
+	hash_table<key_type, slot_type, hasher_type, equal_type>::reserve(
+	    size_t amount) {
+		size_t capacity = hash_group_width;
+		while (max_load(capacity) < amount)
+			capacity <<= 1;
+
+		if (this->capacity() < capacity)
+			this->rehash(capacity);
+
+		return *this;
+	}
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	hash_table<key_type, slot_type, hasher_type, equal_type> &
+	hash_table<key_type, slot_type, hasher_type, equal_type>::clear() noexcept {
+		size_t capacity = this->capacity();
+		for (size_t i = 0ul; i < capacity; i++)
+			if (this->control[i] != hash_control_empty)
+				this->slot(i).~slot_type();
+
+		if (this->control != nullptr)
+			for (size_t i = 0ul; i < capacity + hash_group_width - 1ul; i++)
+				this->control[i] = hash_control_empty;
+		this->elements = 0ul;
+		this->growth_left = max_load(capacity);
+
+		return *this;
+	}
+
+
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	hash_table<key_type, slot_type, hasher_type, equal_type> &
+	hash_table<key_type, slot_type, hasher_type, equal_type>::operator=(
+	    const hash_table &table) {
+		if (&table == this)
+			return *this;
+
+		hash_table tempy(table);
+
+		return *this = move(tempy);
+	}
+	template<typename key_type, typename slot_type, typename hasher_type,
+	         typename equal_type>
+	hash_table<key_type, slot_type, hasher_type, equal_type> &
+	hash_table<key_type, slot_type, hasher_type, equal_type>::operator=(
+	    hash_table &&table) noexcept {
+		if (&table == this)
+			return *this;
+
+		this->release();
+
+		this->control = table.control;
+		this->slots = table.slots;
+		this->slot_mask = table.slot_mask;
+		this->elements = table.elements;
+		this->growth_left = table.growth_left;
+		this->hasher = table.hasher;
+		this->equal = table.equal;
+
+		table.control = nullptr;
+		table.slots = nullptr;
+		table.slot_mask = 0ul;
+		table.elements = 0ul;
+		table.growth_left = 0ul;
+
+		return *this;
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_data_structures_hash_table_impl_
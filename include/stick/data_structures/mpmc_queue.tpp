@@ -0,0 +1,164 @@
+/**
+ * Bounded lock-free queue for any number of producer and consumer threads.
+ * @brief Multiple producer multiple consumer queue template.
+ * @file mpmc_queue.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_data_structures_mpmc_queue_)
+#	define _stick_lib_data_structures_mpmc_queue_
+
+
+
+#	include "../defines/types.hpp"
+#	include "../templates/traits.tpp"
+#	include "../thread/atomic.tpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Bounded queue shared by any number of producer and consumer threads
+	 * without locks. Values live in a ring of a power of 2 slots, each with
+	 * a sequence number telling which lap of the ring may use it next: a
+	 * producer claims a position moving the tail when the slot sequence
+	 * equals the position, and publishes the value setting it to position +
+	 * 1; a consumer claims it moving the head when the sequence is position
+	 * + 1, and frees the slot for the next lap setting it to position +
+	 * capacity. Head and tail live in their own cache lines. Moving values
+	 * must not throw, a slot claimed but never filled stalls the queue.
+	 * @tparam type Type of the values.
+	 */
+	template<typename type>
+	class mpmc_queue {
+		static_assert(is_nothrow_movable<type>::value,
+		              "mpmc_queue needs values that move without throwing.");
+
+		/**
+		 * Slot of the ring.
+		 */
+		struct slot {
+			atomic<size_t> sequence;   ///< Position the slot is waiting for.
+			type value;   ///< Value, only built while queued.
+		};
+
+
+		slot *slots = nullptr;   ///< Ring memory.
+		size_t slot_mask = 0ul;   ///< Number of slots minus one.
+		/// Keeps the read-only ring apart from the producers line.
+		byte_t ring_padding[64];
+
+		atomic<size_t> tail;   ///< Next position to claim by producers.
+		/// Keeps the producers line apart from the consumers line.
+		byte_t tail_padding[64];
+
+		atomic<size_t> head;   ///< Next position to claim by consumers.
+		/// Keeps the consumers line apart from whatever follows.
+		byte_t head_padding[64];
+
+
+		/**
+		 * Get the slot of a position.
+		 * @param [in] position Unmasked position.
+		 * @return The slot.
+		 */
+		slot &slot_at(size_t position) const noexcept;
+
+		/**
+		 * Claim consecutive positions of one of the ends.
+		 * @param [in,out] end Tail to claim free slots, head to claim queued
+		 * values.
+		 * @param [in] lag 0 to claim free slots, 1 to claim queued values.
+		 * @param [in] amount Most positions to claim.
+		 * @param [out] position First position claimed.
+		 * @return Number of positions claimed, 0 when the queue is full or
+		 * empty.
+		 */
+		size_t claim(atomic<size_t> &end, size_t lag, size_t amount,
+		             size_t &position) noexcept;
+
+	public:
+		/**
+		 * Create an empty queue.
+		 * @param [in] capacity Values it must fit, rounded up to a power of
+		 * 2 not smaller than 2.
+		 * @throw memory_error when capacity is 0 or memory cannot be
+		 * allocated.
+		 */
+		explicit mpmc_queue(size_t capacity);
+		mpmc_queue(const mpmc_queue &) = delete;
+
+		/**
+		 * Destroy the queued values and free the ring. No thread may be
+		 * using the queue.
+		 */
+		~mpmc_queue() noexcept;
+
+
+		/**
+		 * Get the number of queued values. Only exact when no thread is
+		 * working.
+		 * @return Number of values.
+		 */
+		size_t size() const noexcept;
+		/**
+		 * Get the number of values that fit.
+		 * @return Number of slots.
+		 */
+		size_t capacity() const noexcept;
+		/**
+		 * Check if the queue is empty. Only exact when no thread is working.
+		 * @return True if there are no values, false otherwise.
+		 */
+		bool_t empty() const noexcept;
+
+
+		/**
+		 * Queue a copy of a value.
+		 * @param [in] value Value to queue.
+		 * @return True if queued, false if the queue is full.
+		 */
+		bool_t try_push(const type &value);
+		/**
+		 * Queue a value.
+		 * @param [in,out] value Value to move in, left untouched if the queue
+		 * is full.
+		 * @return True if queued, false if the queue is full.
+		 */
+		bool_t try_push(type &&value) noexcept;
+		/**
+		 * Take the first value.
+		 * @param [out] value Where to move the value.
+		 * @return True if a value was taken, false if the queue is empty.
+		 */
+		bool_t try_pop(type &value) noexcept;
+
+		/**
+		 * Queue as many values as fit in consecutive slots, claimed at once.
+		 * @param [in,out] values Values to move in, from the first.
+		 * @param [in] amount Number of values.
+		 * @return Number of values queued, the rest are left untouched.
+		 */
+		size_t push_batch(type *values, size_t amount) noexcept;
+		/**
+		 * Take up to a number of consecutive values, claimed at once.
+		 * @param [out] values Where to move the values.
+		 * @param [in] amount Most values to take.
+		 * @return Number of values taken.
+		 */
+		size_t pop_batch(type *values, size_t amount) noexcept;
+
+
+		mpmc_queue &operator=(const mpmc_queue &) = delete;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_data_structures_mpmc_queue_impl_
+#	include "../data_structures/mpmc_queue_impl.tpp"
+#	undef _stick_lib_data_structures_mpmc_queue_impl_
+
+
+#endif   //_stick_lib_data_structures_mpmc_queue_
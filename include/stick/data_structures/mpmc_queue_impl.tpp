@@ -0,0 +1,175 @@
+/**
+ * Multiple producer multiple consumer queue. Template implementations.
+ * @brief Multiple producer multiple consumer queue template
+ * implementations.
+ * @file mpmc_queue_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_data_structures_mpmc_queue_impl_)
+
+
+#	include "../error/memory_error.hpp"
+#	include "../memory/management.tpp"
+#	include "../templates/reference.tpp"
+#	include "../templates/traits.tpp"
+
+
+namespace stick {
+
+
+	template<typename type>
+	typename mpmc_queue<type>::slot &
+	mpmc_queue<type>::slot_at(size_t position) const noexcept {
+		return this->slots[position & this->slot_mask];
+	}
+
+	template<typename type>
+	size_t mpmc_queue<type>::claim(atomic<size_t> &end, size_t lag,
+	                               size_t amount, size_t &position) noexcept {
+		if (amount == 0ul)
+			return 0ul;
+
+		size_t first = end.load(memory_order::relaxed);
+
+		while (true) {
+			size_t count = 0ul;
+			while (count < amount
+			       and this->slot_at(first + count).sequence.load(
+			               memory_order::acquire)
+			               == first + count + lag)
+				count++;
+
+			if (count == 0ul) {
+				size_t sequence = this->slot_at(first).sequence.load(
+				    memory_order::acquire);
+				// Still waiting for the previous lap: full, or empty.
+				if (static_cast<ssize_t>(sequence - (first + lag)) < 0l)
+					return 0ul;
+
+				first = end.load(memory_order::relaxed);
+			} else if (end.compare_exchange_weak(first, first + count,
+			                                     memory_order::relaxed,
+			                                     memory_order::relaxed)) {
+				position = first;
+
+				return count;
+			}
+		}
+	}
+
+
+	template<typename type>
+	mpmc_queue<type>::mpmc_queue(size_t capacity) {
+		if (capacity == 0ul)
+			throw memory_error("Creating a queue with no room for values.");
+
+		size_t slots = 2ul;
+		while (slots < capacity)
+			slots <<= 1;
+
+		this->slots = allocate_uninitialized<slot>(slots);
+		this->slot_mask = slots - 1ul;
+		for (size_t i = 0ul; i < slots; i++)
+			construct_at(&this->slots[i].sequence, i);
+	}
+
+	template<typename type>
+	mpmc_queue<type>::~mpmc_queue() noexcept {
+		if (not is_trivially_destructible<type>::value)
+			for (size_t i = this->head.load(memory_order::relaxed),
+			            tail = this->tail.load(memory_order::relaxed);
+			     i != tail; i++)
+				destroy_range(&this->slot_at(i).value);
+
+		deallocate_raw(this->slots);
+	}
+
+
+	template<typename type>
+	size_t mpmc_queue<type>::size() const noexcept {
+		size_t head = this->head.load(memory_order::acquire);
+		auto size = static_cast<ssize_t>(
+		    this->tail.load(memory_order::acquire) - head);
+
+		return size < 0l ? 0ul : static_cast<size_t>(size);
+	}
+	template<typename type>
+	size_t mpmc_queue<type>::capacity() const noexcept {
+		return this->slot_mask + 1ul;
+	}
+	template<typename type>
+	bool_t mpmc_queue<type>::empty() const noexcept {
+		return this->size() == 0ul;
+	}
+
+
+	template<typename type>
+	bool_t mpmc_queue<type>::try_push(const type &value) {
+		type tempy(value);
+
+		return this->try_push(stick::move(tempy));
+	}
+	template<typename type>
+	bool_t mpmc_queue<type>::try_push(type &&value) noexcept {
+		size_t position;
+		if (this->claim(this->tail, 0ul, 1ul, position) == 0ul)
+			return false;
+
+		slot &claimed = this->slot_at(position);
+		construct_at(&claimed.value, stick::move(value));
+		claimed.sequence.store(position + 1ul, memory_order::release);
+
+		return true;
+	}
+	template<typename type>
+	bool_t mpmc_queue<type>::try_pop(type &value) noexcept {
+		size_t position;
+		if (this->claim(this->head, 1ul, 1ul, position) == 0ul)
+			return false;
+
+		slot &claimed = this->slot_at(position);
+		value = stick::move(claimed.value);
+		destroy_range(&claimed.value);
+		claimed.sequence.store(position + this->slot_mask + 1ul,
+		                       memory_order::release);
+
+		return true;
+	}
+
+
+	template<typename type>
+	size_t mpmc_queue<type>::push_batch(type *values, size_t amount) noexcept {
+		size_t position;
+		size_t pushed = this->claim(this->tail, 0ul, amount, position);
+
+		for (size_t i = 0ul; i < pushed; i++) {
+			slot &claimed = this->slot_at(position + i);
+			construct_at(&claimed.value, stick::move(values[i]));
+			claimed.sequence.store(position + i + 1ul, memory_order::release);
+		}
+
+		return pushed;
+	}
+	template<typename type>
+	size_t mpmc_queue<type>::pop_batch(type *values, size_t amount) noexcept {
+		size_t position;
+		size_t popped = this->claim(this->head, 1ul, amount, position);
+
+		for (size_t i = 0ul; i < popped; i++) {
+			slot &claimed = this->slot_at(position + i);
+			values[i] = stick::move(claimed.value);
+			destroy_range(&claimed.value);
+			claimed.sequence.store(position + i + this->slot_mask + 1ul,
+			                       memory_order::release);
+		}
+
+		return popped;
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_data_structures_mpmc_queue_impl_
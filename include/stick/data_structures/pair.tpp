@@ -10,6 +10,7 @@
 
 
 #	include "../defines/types.hpp"
+#	include "../templates/traits.tpp"
 
 
 namespace stick {
@@ -49,9 +50,9 @@ namespace stick {
 		pair(pair &&pair) noexcept;
 
 		/**
-		 * Destructor. Calls each value destructor.
+		 * Destructor. The values are destroyed with the pair.
 		 */
-		~pair() noexcept;
+		~pair() noexcept = default;
 
 
 		/**
@@ -64,6 +65,16 @@ namespace stick {
 		 * @return Second stored lvalue.
 		 */
 		second_type &second() noexcept;
+		/**
+		 * Get the first value of a constant pair.
+		 * @return First stored value.
+		 */
+		const first_type &first() const noexcept;
+		/**
+		 * Get the second value of a constant pair.
+		 * @return Second stored value.
+		 */
+		const second_type &second() const noexcept;
 
 
 		/**
@@ -81,6 +92,20 @@ namespace stick {
 	};
 
 
+	/**
+	 * A pair relocates as raw memory when both of its values do.
+	 * @tparam first_type Type of the first value.
+	 * @tparam second_type Type of the second value.
+	 */
+	template<typename first_type, typename second_type>
+	struct is_trivially_relocatable<pair<first_type, second_type>> {
+		/// True if both values are trivially relocatable.
+		static constexpr bool_t value
+		    = is_trivially_relocatable<first_type>::value
+		      and is_trivially_relocatable<second_type>::value;
+	};
+
+
 }   // namespace stick
 
 
@@ -24,15 +24,7 @@ namespace stick {
 	template<typename first_type, typename second_type>
 	pair<first_type, second_type>::pair(pair &&pair) noexcept
 	    : first_value(move(pair.first_value)),
-	      second_value(move(pair.second_value)) {
-		pair.~pair();
-	}
-
-	template<typename first_type, typename second_type>
-	pair<first_type, second_type>::~pair() noexcept {
-		this->first_value.~first_type();
-		this->second_value.~second_type();
-	}
+	      second_value(move(pair.second_value)) { }
 
 
 	template<typename first_type, typename second_type>
@@ -43,6 +35,15 @@ namespace stick {
 	second_type &pair<first_type, second_type>::second() noexcept {
 		return this->second_value;
 	}
+	template<typename first_type, typename second_type>
+	const first_type &pair<first_type, second_type>::first() const noexcept {
+		return this->first_value;
+	}
+	template<typename first_type, typename second_type>
+	const second_type &
+	pair<first_type, second_type>::second() const noexcept {
+		return this->second_value;
+	}
 
 
 	template<typename first_type, typename second_type>
@@ -59,8 +60,6 @@ namespace stick {
 		this->first_value = move(pair.first_value);
 		this->second_value = move(pair.second_value);
 
-		pair.~pair();
-
 		return *this;
 	}
 
@@ -0,0 +1,148 @@
+/**
+ * Bounded lock-free queue for one producer and one consumer thread.
+ * @brief Single producer single consumer queue template.
+ * @file spsc_queue.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_data_structures_spsc_queue_)
+#	define _stick_lib_data_structures_spsc_queue_
+
+
+
+#	include "../defines/types.hpp"
+#	include "../thread/atomic.tpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Bounded queue passing values from one producer thread to one consumer
+	 * thread without locks. Values live in a ring of a power of 2 slots,
+	 * only built while queued. The producer owns the tail and the consumer
+	 * the head, each in its own cache line along with a cached copy of the
+	 * other one, so they only read each other's line when the ring looks
+	 * full or empty.
+	 * @tparam type Type of the values.
+	 */
+	template<typename type>
+	class spsc_queue {
+
+		type *slots = nullptr;   ///< Ring memory, only queued values built.
+		size_t slot_mask = 0ul;   ///< Number of slots minus one.
+		/// Keeps the read-only ring apart from the producer line.
+		byte_t ring_padding[64];
+
+		atomic<size_t> tail;   ///< Unmasked position after the last value.
+		size_t head_cache = 0ul;   ///< Head as last seen by the producer.
+		/// Keeps the producer line apart from the consumer line.
+		byte_t tail_padding[64];
+
+		atomic<size_t> head;   ///< Unmasked position of the first value.
+		size_t tail_cache = 0ul;   ///< Tail as last seen by the consumer.
+		/// Keeps the consumer line apart from whatever follows.
+		byte_t head_padding[64];
+
+
+		/**
+		 * Get how many values the producer can push, reading the head again
+		 * only when the cached one is not enough.
+		 * @param [in] wanted Number of values to push.
+		 * @return Number of free slots, maybe less than wanted.
+		 */
+		size_t free_slots(size_t wanted) noexcept;
+		/**
+		 * Get how many values the consumer can pop, reading the tail again
+		 * only when the cached one is not enough.
+		 * @param [in] wanted Number of values to pop.
+		 * @return Number of queued values, maybe less than wanted.
+		 */
+		size_t queued_slots(size_t wanted) noexcept;
+
+	public:
+		/**
+		 * Create an empty queue.
+		 * @param [in] capacity Values it must fit, rounded up to a power of
+		 * 2.
+		 * @throw memory_error when capacity is 0 or memory cannot be
+		 * allocated.
+		 */
+		explicit spsc_queue(size_t capacity);
+		spsc_queue(const spsc_queue &) = delete;
+
+		/**
+		 * Destroy the queued values and free the ring.
+		 */
+		~spsc_queue() noexcept;
+
+
+		/**
+		 * Get the number of queued values. Only exact when neither side is
+		 * working.
+		 * @return Number of values.
+		 */
+		size_t size() const noexcept;
+		/**
+		 * Get the number of values that fit.
+		 * @return Number of slots.
+		 */
+		size_t capacity() const noexcept;
+		/**
+		 * Check if the queue is empty. Only exact when neither side is
+		 * working.
+		 * @return True if there are no values, false otherwise.
+		 */
+		bool_t empty() const noexcept;
+
+
+		/**
+		 * Queue a value. Only called by the producer.
+		 * @param [in] value Value to queue.
+		 * @return True if queued, false if the queue is full.
+		 */
+		bool_t try_push(const type &value);
+		/**
+		 * Queue a value. Only called by the producer.
+		 * @param [in,out] value Value to move in, left untouched if the queue
+		 * is full.
+		 * @return True if queued, false if the queue is full.
+		 */
+		bool_t try_push(type &&value);
+		/**
+		 * Take the first value. Only called by the consumer.
+		 * @param [out] value Where to move the value.
+		 * @return True if a value was taken, false if the queue is empty.
+		 */
+		bool_t try_pop(type &value);
+
+		/**
+		 * Queue as many values as fit, publishing them at once. Only called
+		 * by the producer.
+		 * @param [in,out] values Values to move in, from the first.
+		 * @param [in] amount Number of values.
+		 * @return Number of values queued, the rest are left untouched.
+		 */
+		size_t push_batch(type *values, size_t amount);
+		/**
+		 * Take up to a number of values at once. Only called by the
+		 * consumer.
+		 * @param [out] values Where to move the values.
+		 * @param [in] amount Most values to take.
+		 * @return Number of values taken.
+		 */
+		size_t pop_batch(type *values, size_t amount);
+
+
+		spsc_queue &operator=(const spsc_queue &) = delete;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_data_structures_spsc_queue_impl_
+#	include "../data_structures/spsc_queue_impl.tpp"
+#	undef _stick_lib_data_structures_spsc_queue_impl_
+
+
+#endif   //_stick_lib_data_structures_spsc_queue_
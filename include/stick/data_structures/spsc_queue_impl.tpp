@@ -0,0 +1,162 @@
+/**
+ * Single producer single consumer queue. Template implementations.
+ * @brief Single producer single consumer queue template implementations.
+ * @file spsc_queue_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_data_structures_spsc_queue_impl_)
+
+
+#	include "../error/memory_error.hpp"
+#	include "../memory/management.tpp"
+#	include "../templates/reference.tpp"
+#	include "../templates/traits.tpp"
+
+
+namespace stick {
+
+
+	template<typename type>
+	size_t spsc_queue<type>::free_slots(size_t wanted) noexcept {
+		size_t capacity = this->slot_mask + 1ul;
+		size_t tail = this->tail.load(memory_order::relaxed);
+		size_t available = capacity - (tail - this->head_cache);
+		if (available < wanted) {
+			this->head_cache = this->head.load(memory_order::acquire);
+			available = capacity - (tail - this->head_cache);
+		}
+
+		return available < wanted ? available : wanted;
+	}
+	template<typename type>
+	size_t spsc_queue<type>::queued_slots(size_t wanted) noexcept {
+		size_t head = this->head.load(memory_order::relaxed);
+		size_t available = this->tail_cache - head;
+		if (available < wanted) {
+			this->tail_cache = this->tail.load(memory_order::acquire);
+			available = this->tail_cache - head;
+		}
+
+		return available < wanted ? available : wanted;
+	}
+
+
+	template<typename type>
+	spsc_queue<type>::spsc_queue(size_t capacity) {
+		if (capacity == 0ul)
+			throw memory_error("Creating a queue with no room for values.");
+
+		size_t slots = 1ul;
+		while (slots < capacity)
+			slots <<= 1;
+
+		this->slots = allocate_uninitialized<type>(slots);
+		this->slot_mask = slots - 1ul;
+	}
+
+	template<typename type>
+	spsc_queue<type>::~spsc_queue() noexcept {
+		if (not is_trivially_destructible<type>::value)
+			for (size_t i = this->head.load(memory_order::relaxed),
+			            tail = this->tail.load(memory_order::relaxed);
+			     i != tail; i++)
+				destroy_range(&this->slots[i & this->slot_mask]);
+
+		deallocate_raw(this->slots);
+	}
+
+
+	template<typename type>
+	size_t spsc_queue<type>::size() const noexcept {
+		size_t head = this->head.load(memory_order::acquire);
+
+		return this->tail.load(memory_order::acquire) - head;
+	}
+	template<typename type>
+	size_t spsc_queue<type>::capacity() const noexcept {
+		return this->slot_mask + 1ul;
+	}
+	template<typename type>
+	bool_t spsc_queue<type>::empty() const noexcept {
+		return this->size() == 0ul;
+	}
+
+
+	template<typename type>
+	bool_t spsc_queue<type>::try_push(const type &value) {
+		if (this->free_slots(1ul) == 0ul)
+			return false;
+
+		size_t tail = this->tail.load(memory_order::relaxed);
+		construct_at(&this->slots[tail & this->slot_mask], value);
+		this->tail.store(tail + 1ul, memory_order::release);
+
+		return true;
+	}
+	template<typename type>
+	bool_t spsc_queue<type>::try_push(type &&value) {
+		if (this->free_slots(1ul) == 0ul)
+			return false;
+
+		size_t tail = this->tail.load(memory_order::relaxed);
+		construct_at(&this->slots[tail & this->slot_mask], stick::move(value));
+		this->tail.store(tail + 1ul, memory_order::release);
+
+		return true;
+	}
+	template<typename type>
+	bool_t spsc_queue<type>::try_pop(type &value) {
+		if (this->queued_slots(1ul) == 0ul)
+			return false;
+
+		size_t head = this->head.load(memory_order::relaxed);
+		type &slot = this->slots[head & this->slot_mask];
+		value = stick::move(slot);
+		destroy_range(&slot);
+		this->head.store(head + 1ul, memory_order::release);
+
+		return true;
+	}
+
+
+	template<typename type>
+	size_t spsc_queue<type>::push_batch(type *values, size_t amount) {
+		size_t pushed = this->free_slots(amount);
+		size_t tail = this->tail.load(memory_order::relaxed);
+
+		size_t i = 0ul;
+		try {
+			for (; i < pushed; i++)
+				construct_at(&this->slots[(tail + i) & this->slot_mask],
+				             stick::move(values[i]));
+		} catch (...) {
+			// Publish the values already built before failing.
+			this->tail.store(tail + i, memory_order::release);
+			throw;
+		}
+		this->tail.store(tail + pushed, memory_order::release);
+
+		return pushed;
+	}
+	template<typename type>
+	size_t spsc_queue<type>::pop_batch(type *values, size_t amount) {
+		size_t popped = this->queued_slots(amount);
+		size_t head = this->head.load(memory_order::relaxed);
+
+		for (size_t i = 0ul; i < popped; i++) {
+			type &slot = this->slots[(head + i) & this->slot_mask];
+			values[i] = stick::move(slot);
+			destroy_range(&slot);
+		}
+		this->head.store(head + popped, memory_order::release);
+
+		return popped;
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_data_structures_spsc_queue_impl_
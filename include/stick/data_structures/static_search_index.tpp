@@ -0,0 +1,256 @@
+/**
+ * Read-only index of sorted values, laid out for cache friendly searches.
+ * @brief Static search index template.
+ * @file static_search_index.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_data_structures_static_search_index_)
+#	define _stick_lib_data_structures_static_search_index_
+
+
+
+#	include "../data_structures/array.tpp"
+#	include "../defines/types.hpp"
+
+
+namespace stick {
+
+
+	/// Bytes of a node of an S-tree, and of what the Eytzinger layout
+	/// prefetches ahead: a cache line.
+	static const size_t search_line_bytes = 64ul;
+
+
+	/**
+	 * Order a static_search_index lays its values in.
+	 */
+	enum class search_layout : uint8_t {
+		/// Implicit binary search tree, the root at 1 and the children of i
+		/// at 2i and 2i + 1. The 16 descendants 4 levels below a node share
+		/// a cache line, fetched while going down those levels.
+		eytzinger,
+		/// Implicit B+ tree with a cache line per node. Leaves hold the
+		/// values in order, and every internal node the first value under
+		/// each of its children but the first. One cache miss per level.
+		s_tree
+	};
+
+
+	/**
+	 * Node of an S-tree, with as many keys as fit in a cache line.
+	 * Specialized for int_t, uint_t, float_t and double_t to compare a whole
+	 * node with SSE2 on x86_64.
+	 * @tparam type Type of the keys.
+	 */
+	template<typename type>
+	struct search_node {
+		/// Keys of a node.
+		static constexpr size_t keys = sizeof(type) * 2ul <= search_line_bytes
+		                                   ? search_line_bytes / sizeof(type)
+		                                   : 2ul;
+
+		/**
+		 * Count the keys of a node going before a value.
+		 * @param [in] node First key of the node, in order.
+		 * @param [in] value Value to look for.
+		 * @return Position of the first key not going before the value.
+		 */
+		static inline size_t rank(const type *node, const type &value) noexcept;
+	};
+	/**
+	 * Node of 16 signed 32 bits keys.
+	 */
+	template<>
+	struct search_node<int_t> {
+		/// Keys of a node.
+		static constexpr size_t keys = 16ul;
+
+		/**
+		 * Count the keys of a node going before a value.
+		 * @param [in] node First key of the node, in order.
+		 * @param [in] value Value to look for.
+		 * @return Position of the first key not going before the value.
+		 */
+		static inline size_t rank(const int_t *node, int_t value) noexcept;
+	};
+	/**
+	 * Node of 16 unsigned 32 bits keys.
+	 */
+	template<>
+	struct search_node<uint_t> {
+		/// Keys of a node.
+		static constexpr size_t keys = 16ul;
+
+		/**
+		 * Count the keys of a node going before a value.
+		 * @param [in] node First key of the node, in order.
+		 * @param [in] value Value to look for.
+		 * @return Position of the first key not going before the value.
+		 */
+		static inline size_t rank(const uint_t *node, uint_t value) noexcept;
+	};
+	/**
+	 * Node of 16 single precision keys.
+	 */
+	template<>
+	struct search_node<float_t> {
+		/// Keys of a node.
+		static constexpr size_t keys = 16ul;
+
+		/**
+		 * Count the keys of a node going before a value.
+		 * @param [in] node First key of the node, in order.
+		 * @param [in] value Value to look for.
+		 * @return Position of the first key not going before the value.
+		 */
+		static inline size_t rank(const float_t *node, float_t value) noexcept;
+	};
+	/**
+	 * Node of 8 double precision keys.
+	 */
+	template<>
+	struct search_node<double_t> {
+		/// Keys of a node.
+		static constexpr size_t keys = 8ul;
+
+		/**
+		 * Count the keys of a node going before a value.
+		 * @param [in] node First key of the node, in order.
+		 * @param [in] value Value to look for.
+		 * @return Position of the first key not going before the value.
+		 */
+		static inline size_t rank(const double_t *node,
+		                          double_t value) noexcept;
+	};
+
+
+	/**
+	 * Read-only copy of sorted values, laid out so searching it takes fewer
+	 * cache misses than a binary search over the sorted values: a lookup
+	 * table of ids or ranges built once and searched many times. Searches
+	 * take no branches depending on the values, and give positions in the
+	 * sorted values, so they can index arrays kept next to the index.
+	 * Values are ordered with operator<.
+	 * @tparam type Type of the values.
+	 */
+	template<typename type>
+	class static_search_index {
+
+		type *memory = nullptr;   ///< Allocated memory.
+		type *values = nullptr;   ///< Laid out values, cache line aligned.
+		size_t slots = 0ul;   ///< Number of laid out values.
+		size_t length = 0ul;   ///< Number of sorted values.
+		search_layout order;   ///< Layout of the values.
+		/// Position of every layer of an S-tree, from the leaves up.
+		array<size_t> layers;
+
+
+		/**
+		 * Allocate the laid out values, aligned to a cache line.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		void_t allocate();
+
+		/**
+		 * Get the position in the sorted values of a node of the Eytzinger
+		 * layout, as if the last level of the tree was full and then skipping
+		 * the missing leaves before it.
+		 * @param [in] node Node, from 1 to the number of values.
+		 * @return Position of its value in the sorted values.
+		 */
+		size_t eytzinger_rank(size_t node) const noexcept;
+		/**
+		 * Find the first value not going before another in the Eytzinger
+		 * layout.
+		 * @param [in] value Value to look for.
+		 * @return Node of the value found, 0 when every value goes before.
+		 */
+		size_t eytzinger_find(const type &value) const noexcept;
+		/**
+		 * Find the first value not going before another in the S-tree.
+		 * @param [in] value Value to look for.
+		 * @return Position in the sorted values of the value found, the
+		 * number of values when every value goes before.
+		 */
+		size_t s_tree_find(const type &value) const noexcept;
+
+	public:
+		/**
+		 * Lay out a copy of sorted values.
+		 * @param [in] sorted Values, sorted by operator<.
+		 * @param [in] amount Number of values.
+		 * @param [in] layout Order to lay them in. Default = eytzinger.
+		 * @throw memory_error when memory cannot be allocated or sorted is
+		 * nullptr with values.
+		 */
+		static_search_index(const type *sorted, size_t amount,
+		                    search_layout layout = search_layout::eytzinger);
+		/**
+		 * Lay out a copy of the values of a sorted array.
+		 * @param [in] sorted Array, sorted by operator<.
+		 * @param [in] layout Order to lay them in. Default = eytzinger.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		explicit static_search_index(
+		    const array<type> &sorted,
+		    search_layout layout = search_layout::eytzinger);
+		static_search_index(const static_search_index &) = delete;
+		/**
+		 * Move constructor.
+		 * @param [in,out] index Index to move from, left empty.
+		 */
+		static_search_index(static_search_index &&index) noexcept;
+
+		/**
+		 * Destroy the laid out values.
+		 */
+		~static_search_index() noexcept;
+
+
+		/**
+		 * Get the number of values.
+		 * @return Number of values.
+		 */
+		size_t size() const noexcept;
+		/**
+		 * Check if there are no values.
+		 * @return True if there are no values, false otherwise.
+		 */
+		bool_t empty() const noexcept;
+		/**
+		 * Get the order the values are laid in.
+		 * @return Layout of the values.
+		 */
+		search_layout layout() const noexcept;
+
+
+		/**
+		 * Find the first value not going before another, as a binary search
+		 * over the sorted values would.
+		 * @param [in] value Value to look for.
+		 * @return Position in the sorted values of the first value not less
+		 * than value, the number of values if there is none.
+		 */
+		size_t lower_bound(const type &value) const noexcept;
+		/**
+		 * Check if a value is in the index.
+		 * @param [in] value Value to look for.
+		 * @return True if a value neither goes before nor after it, false
+		 * otherwise.
+		 */
+		bool_t contains(const type &value) const noexcept;
+
+
+		static_search_index &operator=(const static_search_index &) = delete;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_data_structures_static_search_index_impl_
+#	include "../data_structures/static_search_index_impl.tpp"
+#	undef _stick_lib_data_structures_static_search_index_impl_
+
+
+#endif   //_stick_lib_data_structures_static_search_index_
@@ -0,0 +1,355 @@
+/**
+ * Static search index. Template implementations.
+ * @brief Static search index template implementations.
+ * @file static_search_index_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_data_structures_static_search_index_impl_)
+
+
+#	include "../defines/arch.hpp"
+#	include "../defines/compiler.hpp"
+#	include "../error/memory_error.hpp"
+#	include "../memory/management.tpp"
+#	include "../templates/bit.tpp"
+#	include "../templates/reference.tpp"
+
+#	if stick_IS_ARCH_x86_64
+#		include <emmintrin.h>
+#	endif
+
+
+namespace stick {
+
+
+	template<typename type>
+	size_t search_node<type>::rank(const type *node,
+	                               const type &value) noexcept {
+		size_t rank = 0ul;
+		for (size_t i = 0ul; i < search_node::keys; i++)
+			rank += node[i] < value;
+
+		return rank;
+	}
+
+	inline size_t search_node<int_t>::rank(const int_t *node,
+	                                       int_t value) noexcept {
+#	if stick_IS_ARCH_x86_64
+		auto keys = reinterpret_cast<const __m128i *>(node);
+		__m128i needle = _mm_set1_epi32(value);
+
+		// Narrow the 16 masks to a byte each, one bit per key.
+		__m128i low = _mm_packs_epi32(
+		    _mm_cmpgt_epi32(needle, _mm_loadu_si128(keys)),
+		    _mm_cmpgt_epi32(needle, _mm_loadu_si128(keys + 1)));
+		__m128i high = _mm_packs_epi32(
+		    _mm_cmpgt_epi32(needle, _mm_loadu_si128(keys + 2)),
+		    _mm_cmpgt_epi32(needle, _mm_loadu_si128(keys + 3)));
+
+		return pop_count(static_cast<uint_t>(
+		    _mm_movemask_epi8(_mm_packs_epi16(low, high))));
+#	else
+		size_t rank = 0ul;
+		for (size_t i = 0ul; i < search_node::keys; i++)
+			rank += node[i] < value;
+
+		return rank;
+#	endif
+	}
+
+	inline size_t search_node<uint_t>::rank(const uint_t *node,
+	                                        uint_t value) noexcept {
+#	if stick_IS_ARCH_x86_64
+		auto keys = reinterpret_cast<const __m128i *>(node);
+		// SSE2 only compares signed, flipping the sign bits keeps the order.
+		__m128i sign = _mm_set1_epi32(static_cast<int_t>(0x80000000u));
+		__m128i needle
+		    = _mm_xor_si128(_mm_set1_epi32(static_cast<int_t>(value)), sign);
+
+		__m128i low = _mm_packs_epi32(
+		    _mm_cmpgt_epi32(needle,
+		                    _mm_xor_si128(_mm_loadu_si128(keys), sign)),
+		    _mm_cmpgt_epi32(needle,
+		                    _mm_xor_si128(_mm_loadu_si128(keys + 1), sign)));
+		__m128i high = _mm_packs_epi32(
+		    _mm_cmpgt_epi32(needle,
+		                    _mm_xor_si128(_mm_loadu_si128(keys + 2), sign)),
+		    _mm_cmpgt_epi32(needle,
+		                    _mm_xor_si128(_mm_loadu_si128(keys + 3), sign)));
+
+		return pop_count(static_cast<uint_t>(
+		    _mm_movemask_epi8(_mm_packs_epi16(low, high))));
+#	else
+		size_t rank = 0ul;
+		for (size_t i = 0ul; i < search_node::keys; i++)
+			rank += node[i] < value;
+
+		return rank;
+#	endif
+	}
+
+	inline size_t search_node<float_t>::rank(const float_t *node,
+	                                         float_t value) noexcept {
+#	if stick_IS_ARCH_x86_64
+		__m128 needle = _mm_set1_ps(value);
+
+		uint_t mask = 0u;
+		for (size_t i = 0ul; i < search_node::keys; i += 4ul)
+			mask |= static_cast<uint_t>(_mm_movemask_ps(
+			            _mm_cmplt_ps(_mm_loadu_ps(node + i), needle)))
+			        << i;
+
+		return pop_count(mask);
+#	else
+		size_t rank = 0ul;
+		for (size_t i = 0ul; i < search_node::keys; i++)
+			rank += node[i] < value;
+
+		return rank;
+#	endif
+	}
+
+	inline size_t search_node<double_t>::rank(const double_t *node,
+	                                          double_t value) noexcept {
+#	if stick_IS_ARCH_x86_64
+		__m128d needle = _mm_set1_pd(value);
+
+		uint_t mask = 0u;
+		for (size_t i = 0ul; i < search_node::keys; i += 2ul)
+			mask |= static_cast<uint_t>(_mm_movemask_pd(
+			            _mm_cmplt_pd(_mm_loadu_pd(node + i), needle)))
+			        << i;
+
+		return pop_count(mask);
+#	else
+		size_t rank = 0ul;
+		for (size_t i = 0ul; i < search_node::keys; i++)
+			rank += node[i] < value;
+
+		return rank;
+#	endif
+	}
+
+
+	template<typename type>
+	void_t static_search_index<type>::allocate() {
+		// Room to move the values up to the next cache line.
+		size_t slack = sizeof(type) < search_line_bytes
+		                   ? search_line_bytes / sizeof(type)
+		                   : 1ul;
+		this->memory = allocate_uninitialized<type>(this->slots + slack);
+
+		size_t misalignment
+		    = reinterpret_cast<size_t>(this->memory) % search_line_bytes;
+		this->values = this->memory
+		               + (misalignment == 0ul
+		                      ? 0ul
+		                      : (search_line_bytes - misalignment)
+		                            / sizeof(type));
+	}
+
+	template<typename type>
+	size_t static_search_index<type>::eytzinger_rank(
+	    size_t node) const noexcept {
+		size_t levels
+		    = 64ul - count_leading_zeros(static_cast<uint64_t>(this->length));
+		size_t depth
+		    = 63ul - count_leading_zeros(static_cast<uint64_t>(node));
+
+		// Position in a full tree, where leaves take the even ones.
+		size_t rank = ((((node - (1ul << depth)) << 1) | 1ul)
+		               << (levels - depth - 1ul))
+		              - 1ul;
+		size_t last_leaves = this->length - ((1ul << (levels - 1ul)) - 1ul);
+		size_t leaves_before = (rank + 1ul) / 2ul;
+
+		return leaves_before > last_leaves
+		           ? rank - (leaves_before - last_leaves)
+		           : rank;
+	}
+
+	template<typename type>
+	size_t static_search_index<type>::eytzinger_find(
+	    const type &value) const noexcept {
+		// Nodes 4 levels below fill a cache line with 4 bytes values.
+		size_t line = sizeof(type) < search_line_bytes
+		                  ? search_line_bytes / sizeof(type)
+		                  : 1ul;
+
+		size_t node = 1ul;
+		while (node <= this->length) {
+#	if stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG
+			size_t ahead = node * line;
+			__builtin_prefetch(this->values
+			                   + (ahead <= this->length ? ahead : 0ul));
+#	endif
+			node = 2ul * node + (this->values[node] < value);
+		}
+
+		// The path went right while values went before, then left ever
+		// since the last one that did not: drop those left turns and the
+		// right turn before them.
+		return node >> (count_trailing_zeros(~node) + 1ul);
+	}
+
+	template<typename type>
+	size_t static_search_index<type>::s_tree_find(
+	    const type &value) const noexcept {
+		// Past the last value, padding keys would lead out of the tree.
+		if (this->length == 0ul or this->values[this->length - 1ul] < value)
+			return this->length;
+
+		const size_t keys = search_node<type>::keys;
+		const size_t *layer = this->layers.begin();
+
+		size_t node = 0ul;
+		for (size_t level = this->layers.size() - 1ul; level > 0ul; level--)
+			node = node * (keys + 1ul)
+			       + search_node<type>::rank(
+			           this->values + layer[level] + node * keys, value);
+
+		return node * keys
+		       + search_node<type>::rank(this->values + node * keys, value);
+	}
+
+
+	template<typename type>
+	static_search_index<type>::static_search_index(const type *sorted,
+	                                               size_t amount,
+	                                               search_layout layout)
+	    : length(amount), order(layout) {
+		if (amount == 0ul)
+			return;
+		if (sorted == nullptr)
+			throw memory_error("Creating a static_search_index and trying to "
+			                   "copy values from a nullptr to it.");
+
+		const size_t keys = search_node<type>::keys;
+		if (layout == search_layout::eytzinger)
+			this->slots = amount + 1ul;
+		else {
+			// Leaves, then a node per keys + 1 nodes below up to the root.
+			size_t nodes = (amount + keys - 1ul) / keys;
+			this->layers.push_back(0ul);
+			this->slots = nodes * keys;
+			while (nodes > 1ul) {
+				nodes = (nodes + keys) / (keys + 1ul);
+				this->layers.push_back(this->slots);
+				this->slots += nodes * keys;
+			}
+		}
+
+		this->allocate();
+
+		size_t built = 0ul;
+		try {
+			if (layout == search_layout::eytzinger) {
+				// Slot 0 is never searched, it keeps the nodes aligned.
+				construct_at(this->values, sorted[0ul]);
+				for (built = 1ul; built < this->slots; built++)
+					construct_at(this->values + built,
+					             sorted[this->eytzinger_rank(built)]);
+			} else
+				for (size_t level = 0ul; level < this->layers.size();
+				     level++) {
+					size_t end = level + 1ul < this->layers.size()
+					                 ? this->layers[level + 1ul]
+					                 : this->slots;
+
+					for (; built < end; built++) {
+						size_t position = built - this->layers[level];
+						if (level > 0ul) {
+							// First value under the child after the key.
+							size_t child = position / keys * (keys + 1ul)
+							               + position % keys + 1ul;
+							for (size_t below = level - 1ul; below > 0ul;
+							     below--)
+								child *= keys + 1ul;
+							position = child * keys;
+						}
+
+						// Missing values are padded with the last one, that
+						// no search goes past.
+						construct_at(this->values + built,
+						             sorted[position < amount ? position
+						                                      : amount - 1ul]);
+					}
+				}
+		} catch (...) {
+			destroy_range(this->values, built);
+			deallocate_raw(this->memory);
+			throw;
+		}
+	}
+	template<typename type>
+	static_search_index<type>::static_search_index(const array<type> &sorted,
+	                                               search_layout layout)
+	    : static_search_index(sorted.begin(), sorted.size(), layout) { }
+	template<typename type>
+	static_search_index<type>::static_search_index(
+	    static_search_index &&index) noexcept
+	    : memory(index.memory), values(index.values), slots(index.slots),
+	      length(index.length), order(index.order),
+	      layers(stick::move(index.layers)) {
+		index.memory = nullptr;
+		index.values = nullptr;
+		index.slots = 0ul;
+		index.length = 0ul;
+	}
+
+	template<typename type>
+	static_search_index<type>::~static_search_index() noexcept {
+		if (this->memory == nullptr)
+			return;
+
+		destroy_range(this->values, this->slots);
+		deallocate_raw(this->memory);
+	}
+
+
+	template<typename type>
+	size_t static_search_index<type>::size() const noexcept {
+		return this->length;
+	}
+	template<typename type>
+	bool_t static_search_index<type>::empty() const noexcept {
+		return this->length == 0ul;
+	}
+	template<typename type>
+	search_layout static_search_index<type>::layout() const noexcept {
+		return this->order;
+	}
+
+
+	template<typename type>
+	size_t
+	static_search_index<type>::lower_bound(const type &value) const noexcept {
+		if (this->order == search_layout::s_tree)
+			return this->s_tree_find(value);
+
+		size_t node = this->eytzinger_find(value);
+
+		return node == 0ul ? this->length : this->eytzinger_rank(node);
+	}
+	template<typename type>
+	bool_t
+	static_search_index<type>::contains(const type &value) const noexcept {
+		if (this->order == search_layout::s_tree) {
+			size_t rank = this->s_tree_find(value);
+
+			// Leaves hold the values in order.
+			return rank < this->length and not(value < this->values[rank]);
+		}
+
+		size_t node = this->eytzinger_find(value);
+
+		return node != 0ul and not(value < this->values[node]);
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_data_structures_static_search_index_impl_
@@ -38,7 +38,9 @@ namespace stick {
 	class base_error stick_STD_EXCEPTION_BASED_INHERIT_ {
 
 	protected:
-		string *description_cache;   ///< Stores the error description.
+		/// Stores the error description, shared by the copies description()
+		/// returns.
+		string *description_cache;
 
 		explicit base_error(const_cstring description) noexcept;
 		explicit base_error(const string &description) noexcept;
@@ -49,8 +51,9 @@ namespace stick {
 
 
 		/**
-		 * Get the error description.
-		 * @return Description cstring.
+		 * Get the error description. Shares the stored characters, nothing is
+		 * copied until the returned string is modified.
+		 * @return Description string.
 		 */
 		virtual string description() const noexcept;
 		/**
@@ -23,9 +23,6 @@ namespace stick {
 	public:
 		explicit cast_error(const_cstring description) noexcept;
 		explicit cast_error(const string &description) noexcept;
-
-
-		string description() const noexcept override;
 	};
 
 
@@ -23,9 +23,6 @@ namespace stick {
 	public:
 		explicit out_of_range_error(const_cstring description) noexcept;
 		explicit out_of_range_error(const string &description) noexcept;
-
-
-		string description() const noexcept override;
 	};
 
 
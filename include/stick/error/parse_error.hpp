@@ -0,0 +1,33 @@
+/**
+ * Parsing exceptions.
+ * @brief Parse error.
+ * @file parse_error.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_error_parse_)
+#	define _stick_lib_error_parse_
+
+
+
+#	include "../error/base_error.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Parsing error class.
+	 */
+	class parse_error : public base_error {
+
+	public:
+		explicit parse_error(const_cstring description) noexcept;
+		explicit parse_error(const string &description) noexcept;
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_error_parse_
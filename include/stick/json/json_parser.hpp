@@ -0,0 +1,399 @@
+/**
+ * Two stage JSON parser. Stage one indexes every structural character of the
+ * document with vectorized classification, stage two navigates that index on
+ * demand and only parses the values that are actually read.
+ * @brief JSON parser.
+ * @file json_parser.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_json_parser_)
+#	define _stick_lib_json_parser_
+
+
+
+#	include "../defines/types.hpp"
+#	include "../memory/arena.hpp"
+#	include "../string/string.hpp"
+#	include "../string/string_view.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Types a JSON value can have.
+	 */
+	enum class json_type : uint8_t {
+		null_value,
+		boolean,
+		number,
+		string,
+		array,
+		object
+	};
+
+
+	class json_document;
+	class json_iterator;
+
+
+	/**
+	 * Lazy handle to a value inside a parsed document. Nothing is converted
+	 * until one of the getters is called. Strings and numbers are read
+	 * straight from the source buffer.
+	 */
+	class json_value {
+
+		friend class json_document;
+		friend class json_iterator;
+
+		const json_document *document = nullptr;   ///< Document of the value.
+		size_t position = 0ul;   ///< Index of the value in the structurals.
+
+	protected:
+		/**
+		 * Create a handle for a value of the document.
+		 * @param [in] document Document holding the value.
+		 * @param [in] position Structural index where the value starts.
+		 */
+		json_value(const json_document *document, size_t position) noexcept;
+
+		/**
+		 * Make sure the value is of a given type.
+		 * @param [in] expected Type the value should have.
+		 * @throw parse_error when the value has another type.
+		 */
+		void_t require(json_type expected) const;
+
+	public:
+		/**
+		 * Get the type of the value.
+		 * @throw parse_error when the value is not valid JSON.
+		 * @return Type of the value.
+		 */
+		json_type type() const;
+
+		/**
+		 * Check if the value is null.
+		 * @throw parse_error when the value is not valid JSON.
+		 * @return True if the value is a valid null, false otherwise.
+		 */
+		bool_t is_null() const;
+
+
+		/**
+		 * Read a boolean value.
+		 * @throw parse_error when the value is not a valid boolean.
+		 * @return The boolean value.
+		 */
+		bool_t get_bool() const;
+		/**
+		 * Read a number as a signed integer.
+		 * @throw parse_error when the value is not a number.
+		 * @throw cast_error when the number does not fit.
+		 * @return The integer value.
+		 */
+		int64_t get_int64() const;
+		/**
+		 * Read a number as an unsigned integer.
+		 * @throw parse_error when the value is not a number.
+		 * @throw cast_error when the number does not fit.
+		 * @return The integer value.
+		 */
+		uint64_t get_uint64() const;
+		/**
+		 * Read a number as a double.
+		 * @throw parse_error when the value is not a number.
+		 * @throw cast_error when the text is not a valid number.
+		 * @return The floating point value.
+		 */
+		double64_t get_double() const;
+		/**
+		 * Read a string with its escape sequences resolved. Allocates a new
+		 * string, use raw() to avoid copying when there are no escapes.
+		 * @throw parse_error when the value is not a valid string.
+		 * @return Unescaped copy of the string.
+		 */
+		string get_string() const;
+
+
+		/**
+		 * View the source text of the value without copying. Strings are
+		 * viewed without their quotes and with the escape sequences as is,
+		 * arrays and objects are viewed from bracket to bracket.
+		 * @throw parse_error when the value is not valid JSON.
+		 * @return View into the document source.
+		 */
+		string_view raw() const;
+
+
+		/**
+		 * Get the number of elements of an array or members of an object.
+		 * Walks the container, so it is linear in its number of children.
+		 * @throw parse_error when the value is not an array or an object.
+		 * @return Number of children.
+		 */
+		size_t size() const;
+
+		/**
+		 * Check if an object has a member. Keys are compared with their
+		 * escape sequences resolved.
+		 * @param [in] key Key to look for.
+		 * @throw parse_error when the value is not an object.
+		 * @return True if the member exists, false otherwise.
+		 */
+		bool_t contains(const string_view &key) const;
+
+
+		/**
+		 * Iterator to the first child of an array or an object.
+		 * @throw parse_error when the value is not an array or an object.
+		 * @return Iterator to the first child.
+		 */
+		json_iterator begin() const;
+		/**
+		 * Iterator past the last child of an array or an object.
+		 * @throw parse_error when the value is not an array or an object.
+		 * @return Iterator past the last child.
+		 */
+		json_iterator end() const;
+
+
+		/**
+		 * Get an object member. Keys are compared with their escape sequences
+		 * resolved.
+		 * @param [in] key Key of the member.
+		 * @throw parse_error when the value is not an object.
+		 * @throw out_of_range_error when the key does not exist.
+		 * @return Value of the member.
+		 */
+		json_value operator[](const string_view &key) const;
+		/**
+		 * Get an object member. Keys are compared with their escape sequences
+		 * resolved.
+		 * @param [in] key Key of the member.
+		 * @throw parse_error when the value is not an object.
+		 * @throw out_of_range_error when the key does not exist.
+		 * @return Value of the member.
+		 */
+		json_value operator[](const_cstring key) const;
+		/**
+		 * Get an array element.
+		 * @param [in] position Position of the element.
+		 * @throw parse_error when the value is not an array.
+		 * @throw out_of_range_error when the position is outside the array.
+		 * @return Value of the element.
+		 */
+		json_value operator[](size_t position) const;
+		/**
+		 * Get an array element. Exists for typical values.
+		 * @param [in] position Position of the element.
+		 * @throw parse_error when the value is not an array.
+		 * @throw out_of_range_error when the position is outside the array.
+		 * @return Value of the element.
+		 */
+		json_value operator[](int32_t position) const;
+	};
+
+
+	/**
+	 * Forward iterator over the children of an array or an object.
+	 */
+	class json_iterator {
+
+		friend class json_value;
+
+		const json_document *document;   ///< Document being iterated.
+		size_t position;   ///< Structural index of the current child.
+		bool_t in_object;   ///< If the children are object members.
+
+	protected:
+		/**
+		 * Create an iterator.
+		 * @param [in] document Document being iterated.
+		 * @param [in] position Structural index of the current child.
+		 * @param [in] in_object If the children are object members.
+		 */
+		json_iterator(const json_document *document, size_t position,
+		              bool_t in_object) noexcept;
+
+		/**
+		 * Check if the key of the current member is some text, with its
+		 * escape sequences resolved. Keys without escapes are compared in
+		 * place.
+		 * @param [in] key Unescaped text to compare with.
+		 * @throw parse_error when the key is invalid.
+		 * @return True if the key is the text, false otherwise.
+		 */
+		bool_t key_equals(const string_view &key) const;
+
+	public:
+		/**
+		 * Get the key of the current member. Only valid for objects.
+		 * @throw parse_error when iterating an array or the key is invalid.
+		 * @return Raw view of the key.
+		 */
+		string_view key() const;
+
+		/**
+		 * Get the current child.
+		 * @throw parse_error when a member is not followed by ':'.
+		 * @return Value of the current element or member.
+		 */
+		json_value operator*() const;
+
+		/**
+		 * Advance to the next child.
+		 * @throw parse_error when children are not separated by ','.
+		 * @return Self instance.
+		 */
+		json_iterator &operator++();
+
+		/**
+		 * Check if two iterators point to the same child.
+		 * @param [in] iterator Iterator to compare with.
+		 * @return True if both point to the same child, false otherwise.
+		 */
+		bool_t operator==(const json_iterator &iterator) const noexcept;
+		/**
+		 * Check if two iterators point to different children.
+		 * @param [in] iterator Iterator to compare with.
+		 * @return True if they point to different children, false otherwise.
+		 */
+		bool_t operator!=(const json_iterator &iterator) const noexcept;
+	};
+
+
+	/**
+	 * Indexed JSON document. It does not own its source nor its index, both
+	 * must outlive it. The index lives in the json_parser that created the
+	 * document and is overwritten by its next parse.
+	 */
+	class json_document {
+
+		friend class json_parser;
+		friend class json_value;
+		friend class json_iterator;
+
+		const_cstring source = nullptr;   ///< Document text.
+		size_t source_length = 0ul;   ///< Length of the document text.
+		const uint32_t *structurals = nullptr;   ///< Structural positions.
+		const uint32_t *tape = nullptr;   ///< Matching brackets indexes.
+		size_t structurals_amount = 0ul;   ///< Number of structurals.
+
+	protected:
+		/**
+		 * Get the character of a structural.
+		 * @param [in] position Structural index.
+		 * @return Character at the structural position.
+		 */
+		char_t structural_char(size_t position) const noexcept;
+
+		/**
+		 * Get the structural that follows a whole value.
+		 * @param [in] position Structural index where the value starts.
+		 * @return Structural index right after the value.
+		 */
+		size_t skip_value(size_t position) const noexcept;
+
+		/**
+		 * View a scalar token or a string content.
+		 * @param [in] position Structural index where the token starts.
+		 * @throw parse_error when a string is not terminated.
+		 * @return View of the token text.
+		 */
+		string_view token(size_t position) const;
+
+	public:
+		/**
+		 * Create an empty document.
+		 */
+		json_document() noexcept = default;
+
+
+		/**
+		 * Get the root value of the document.
+		 * @return Root value.
+		 */
+		json_value root() const noexcept;
+
+		/**
+		 * Get the number of indexed structurals.
+		 * @return Number of structural characters and scalar starts.
+		 */
+		size_t structurals_size() const noexcept;
+	};
+
+
+	/**
+	 * JSON parser. Keeps the memory of its last parse to reuse it, so parsing
+	 * documents of similar size in a loop stops allocating.
+	 */
+	class json_parser {
+
+		arena memory;   ///< Memory for the structural index and the tape.
+
+	protected:
+		/**
+		 * Stage one. Find every structural character and every scalar start
+		 * outside strings. The index starts sized for typical documents and
+		 * grows in the arena as needed.
+		 * @param [in] json Document text.
+		 * @param [in] length Length of the document text.
+		 * @param [out] structurals Structural positions, followed by the
+		 * length of the text.
+		 * @throw parse_error when a string is not terminated.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Number of structurals found.
+		 */
+		size_t index_structurals(const_cstring json, size_t length,
+		                         uint32_t *&structurals);
+
+		/**
+		 * Match every opening bracket with its closing one.
+		 * @param [in] json Document text.
+		 * @param [in] structurals Structural positions.
+		 * @param [in] amount Number of structurals.
+		 * @param [out] tape Where to write matching indexes.
+		 * @param [in] stack Scratch memory for amount / 2 + 1 indexes.
+		 * @throw parse_error when brackets are not balanced.
+		 */
+		static void_t build_tape(const_cstring json,
+		                         const uint32_t *structurals, size_t amount,
+		                         uint32_t *tape, uint32_t *stack);
+
+	public:
+		/**
+		 * Create a parser.
+		 * @param [in] capacity Expected document length, used to size the
+		 * first allocation. Default = 0.
+		 */
+		explicit json_parser(size_t capacity = 0ul) noexcept;
+
+
+		/**
+		 * Index a document. The text is not copied and must outlive the
+		 * returned document.
+		 * @param [in] json Document text.
+		 * @param [in] length Length of the document text.
+		 * @throw parse_error when the document structure is not valid.
+		 * @throw memory_error when json is nullptr.
+		 * @return Parsed document, valid until the next parse.
+		 */
+		json_document parse(const_cstring json, size_t length);
+		/**
+		 * Index a document. The text is not copied and must outlive the
+		 * returned document.
+		 * @param [in] json Document text.
+		 * @throw parse_error when the document structure is not valid.
+		 * @return Parsed document, valid until the next parse.
+		 */
+		json_document parse(const string_view &json);
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_json_parser_
@@ -0,0 +1,137 @@
+/**
+ * Arena (bump) allocator. Hands out memory from big blocks and releases all of
+ * it at once.
+ * @brief Arena allocator.
+ * @file arena.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_memory_arena_)
+#	define _stick_lib_memory_arena_
+
+
+
+#	include "../defines/types.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Allocator that carves consecutive memory out of big blocks. Individual
+	 * allocations are never freed, the whole arena is released or reset at
+	 * once. Returned memory is not initialized.
+	 */
+	class arena {
+
+		/**
+		 * Header placed at the beginning of every allocated block.
+		 */
+		struct block {
+			block *previous;   ///< Previously allocated block.
+			size_t capacity;   ///< Usable bytes after the header.
+			size_t used;   ///< Bytes already handed out.
+		};
+
+		block *current = nullptr;   ///< Block where allocations happen.
+		size_t block_size;   ///< Minimum capacity of new blocks.
+
+	protected:
+		/**
+		 * Get the first usable byte of a block.
+		 * @param [in] memory_block Block to get the memory from.
+		 * @return Pointer to the first byte after the block header.
+		 */
+		static byte_t *block_data(block *memory_block) noexcept;
+
+		/**
+		 * Allocate a new block and make it the current one.
+		 * @param [in] minimum_capacity Bytes the new block must fit.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		void_t add_block(size_t minimum_capacity);
+
+	public:
+		/**
+		 * Create an empty arena. No memory is allocated until first used.
+		 * @param [in] block_length Minimum size in bytes of every block.
+		 * Default = 64 KiB.
+		 */
+		explicit arena(size_t block_length = 65536ul) noexcept;
+		arena(const arena &) = delete;
+		/**
+		 * Move constructor.
+		 * @param [in,out] memory Arena to take the blocks from.
+		 */
+		arena(arena &&memory) noexcept;
+
+		/**
+		 * Release every block.
+		 */
+		~arena() noexcept;
+
+
+		/**
+		 * Allocate raw bytes.
+		 * @param [in] bytes Number of bytes to allocate.
+		 * @param [in] alignment Alignment of the returned address. Must be a
+		 * power of two.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Pointer to the uninitialized memory.
+		 */
+		voidptr_t allocate_bytes(size_t bytes, size_t alignment = 16ul);
+
+		/**
+		 * Allocate uninitialized memory for consecutive elements.
+		 * @tparam type Type of the elements.
+		 * @param [in] element_amount Number of elements. Default = 1.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Pointer to the first element.
+		 */
+		template<typename type>
+		type *allocate(size_t element_amount = 1ul);
+
+
+		/**
+		 * Forget all allocations keeping only the current block, so an arena
+		 * reused for similar workloads stops allocating. Several blocks are
+		 * merged into one.
+		 * @throw memory_error when merged memory cannot be allocated.
+		 */
+		void_t reset();
+		/**
+		 * Release every block.
+		 */
+		void_t release() noexcept;
+
+
+		/**
+		 * Get the number of bytes handed out from the current block.
+		 * @return Used bytes of the current block.
+		 */
+		size_t used_bytes() const noexcept;
+		/**
+		 * Get the total number of bytes reserved by all blocks.
+		 * @return Reserved bytes.
+		 */
+		size_t reserved_bytes() const noexcept;
+
+
+		arena &operator=(const arena &) = delete;
+		/**
+		 * Move assignment.
+		 * @param [in,out] memory Arena to take the blocks from.
+		 * @return Self instance.
+		 */
+		arena &operator=(arena &&memory) noexcept;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_memory_arena_impl_
+#	include "../memory/arena_impl.tpp"
+#	undef _stick_lib_memory_arena_impl_
+
+
+#endif   //_stick_lib_memory_arena_
@@ -0,0 +1,26 @@
+/**
+ * Arena allocator. Template implementations.
+ * @brief Arena allocator template implementations.
+ * @file arena_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_memory_arena_impl_)
+
+
+
+namespace stick {
+
+
+	template<typename type>
+	type *arena::allocate(size_t element_amount) {
+		return static_cast<type *>(
+		    this->allocate_bytes(sizeof(type) * element_amount, alignof(type)));
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_memory_arena_impl_
@@ -0,0 +1,81 @@
+/**
+ * Epoch based memory reclamation. Frees memory shared with lock-free readers
+ * once no reader can still be looking at it.
+ * @brief Epoch based memory reclamation.
+ * @file epoch.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_memory_epoch_)
+#	define _stick_lib_memory_epoch_
+
+
+
+#	include "../defines/types.hpp"
+
+
+namespace stick {
+
+
+	/// Function releasing a retired object.
+	typedef void_t (*epoch_deleter)(voidptr_t);
+
+
+	/**
+	 * Critical section of a reader. While a guard lives in a thread, nothing
+	 * retired after the guard was created is released, so the thread can
+	 * follow pointers to shared objects without locking. Guards nest.
+	 */
+	class epoch_guard {
+
+	public:
+		/**
+		 * Enter the critical section announcing the current epoch.
+		 */
+		epoch_guard();
+		epoch_guard(const epoch_guard &) = delete;
+
+		/**
+		 * Leave the critical section.
+		 */
+		~epoch_guard() noexcept;
+
+
+		epoch_guard &operator=(const epoch_guard &) = delete;
+	};
+
+
+	/**
+	 * Release an object once every reader that could reach it is gone. The
+	 * object must already be unreachable for new readers.
+	 * @param [in] object Object to release.
+	 * @param [in] deleter Function releasing the object.
+	 * @throw memory_error when the retired list cannot grow.
+	 */
+	void_t epoch_retire(voidptr_t object, epoch_deleter deleter);
+	/**
+	 * Release an object allocated with new once every reader that could
+	 * reach it is gone.
+	 * @tparam type Type of the object.
+	 * @param [in] object Object to release.
+	 * @throw memory_error when the retired list cannot grow.
+	 */
+	template<typename type>
+	void_t epoch_retire(type *object);
+
+	/**
+	 * Try to advance the epoch and release what the calling thread, and
+	 * threads already ended, retired and no reader can reach anymore.
+	 * Called every few retires.
+	 */
+	void_t epoch_collect();
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_memory_epoch_impl_
+#	include "../memory/epoch_impl.tpp"
+#	undef _stick_lib_memory_epoch_impl_
+
+
+#endif   //_stick_lib_memory_epoch_
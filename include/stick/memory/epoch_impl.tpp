@@ -0,0 +1,35 @@
+/**
+ * Epoch based memory reclamation. Template implementations.
+ * @brief Epoch based memory reclamation template implementations.
+ * @file epoch_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_memory_epoch_impl_)
+
+
+
+namespace stick {
+
+
+	/**
+	 * Release an object allocated with new.
+	 * @tparam type Type of the object.
+	 * @param [in] object Object to release.
+	 */
+	template<typename type>
+	void_t epoch_delete(voidptr_t object) {
+		delete static_cast<type *>(object);
+	}
+
+	template<typename type>
+	void_t epoch_retire(type *object) {
+		epoch_retire(object, epoch_delete<type>);
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_memory_epoch_impl_
@@ -0,0 +1,112 @@
+/**
+ * Hazard pointer memory reclamation. Frees memory shared with lock-free
+ * readers once no reader announces it is using it.
+ * @brief Hazard pointer memory reclamation.
+ * @file hazard.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_memory_hazard_)
+#	define _stick_lib_memory_hazard_
+
+
+
+#	include "../defines/types.hpp"
+#	include "../thread/atomic.tpp"
+
+
+namespace stick {
+
+
+	/// Function releasing a retired object.
+	typedef void_t (*hazard_deleter)(voidptr_t);
+
+	/// Announced pointer of a reader.
+	struct hazard_slot;
+
+
+	/**
+	 * Pointer a reader announces it is using, so no thread releases the
+	 * object until the announce is cleared. Unlike epoch guards a stalled
+	 * reader only keeps alive the objects it points to, so the memory
+	 * waiting to be released stays bounded. Each hazard pointer protects one
+	 * object at a time, a reader following a list needs two.
+	 */
+	class hazard_pointer {
+
+		hazard_slot *slot;   ///< Announce owned by the hazard pointer.
+
+	public:
+		/**
+		 * Take an announce slot, with nothing announced.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		hazard_pointer();
+		hazard_pointer(const hazard_pointer &) = delete;
+
+		/**
+		 * Clear the announce and give the slot back.
+		 */
+		~hazard_pointer() noexcept;
+
+
+		/**
+		 * Read a shared pointer and announce it, reading it again until it
+		 * did not change meanwhile. The object can then be used until the
+		 * announce changes.
+		 * @tparam type Type of the object.
+		 * @param [in] source Shared pointer to read.
+		 * @return The pointer read, maybe nullptr.
+		 */
+		template<typename type>
+		type *protect(const atomic<type *> &source) noexcept;
+
+		/**
+		 * Announce a pointer already known to be reachable.
+		 * @param [in] object Object to announce.
+		 */
+		void_t reset(voidptr_t object) noexcept;
+		/**
+		 * Clear the announce.
+		 */
+		void_t clear() noexcept;
+
+
+		hazard_pointer &operator=(const hazard_pointer &) = delete;
+	};
+
+
+	/**
+	 * Release an object once no hazard pointer announces it. The object
+	 * must already be unreachable for new readers. Retired objects are kept
+	 * per thread and checked in batches against every announce.
+	 * @param [in] object Object to release.
+	 * @param [in] deleter Function releasing the object.
+	 * @throw memory_error when the retired list cannot grow.
+	 */
+	void_t hazard_retire(voidptr_t object, hazard_deleter deleter);
+	/**
+	 * Release an object allocated with new once no hazard pointer announces
+	 * it.
+	 * @tparam type Type of the object.
+	 * @param [in] object Object to release.
+	 * @throw memory_error when the retired list cannot grow.
+	 */
+	template<typename type>
+	void_t hazard_retire(type *object);
+
+	/**
+	 * Release what the calling thread retired, and what ended threads left,
+	 * that no hazard pointer announces anymore.
+	 */
+	void_t hazard_collect();
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_memory_hazard_impl_
+#	include "../memory/hazard_impl.tpp"
+#	undef _stick_lib_memory_hazard_impl_
+
+
+#endif   //_stick_lib_memory_hazard_
@@ -0,0 +1,53 @@
+/**
+ * Hazard pointer memory reclamation. Template implementations.
+ * @brief Hazard pointer memory reclamation template implementations.
+ * @file hazard_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_memory_hazard_impl_)
+
+
+
+namespace stick {
+
+
+	template<typename type>
+	type *hazard_pointer::protect(const atomic<type *> &source) noexcept {
+		type *object = source.load(memory_order::acquire);
+
+		while (true) {
+			this->reset(object);
+
+			// Still reachable after the announce was visible, so it was not
+			// retired before any collection could see the announce.
+			type *current = source.load(memory_order::seq_cst);
+			if (current == object)
+				return object;
+
+			object = current;
+		}
+	}
+
+
+	/**
+	 * Release an object allocated with new.
+	 * @tparam type Type of the object.
+	 * @param [in] object Object to release.
+	 */
+	template<typename type>
+	void_t hazard_delete(voidptr_t object) {
+		delete static_cast<type *>(object);
+	}
+
+	template<typename type>
+	void_t hazard_retire(type *object) {
+		hazard_retire(object, hazard_delete<type>);
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_memory_hazard_impl_
@@ -0,0 +1,194 @@
+/**
+ * Reference counted pointer to values carrying their own counter.
+ * @brief Pointer to values counting their owners themselves.
+ * @file intrusive_pointer.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_memory_intrusive_pointer_)
+#	define _stick_lib_memory_intrusive_pointer_
+
+
+
+#	include "../defines/types.hpp"
+#	include "../templates/traits.tpp"
+#	include "../thread/atomic.tpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Counter of owners to embed in a value, inheriting from it, so
+	 * intrusive pointers can share the value.
+	 * @tparam thread_safe Whether the owners may live in different threads,
+	 * counting with atomic operations, or all stay in one thread. Default =
+	 * true.
+	 */
+	template<bool_t thread_safe = true>
+	class intrusive_counter {
+
+		mutable atomic<size_t> references;   ///< Number of owners.
+
+	protected:
+		/**
+		 * Start with no owners.
+		 */
+		intrusive_counter() noexcept = default;
+		/**
+		 * Start with no owners, owners of a copied value do not own the new
+		 * one.
+		 */
+		intrusive_counter(const intrusive_counter &) noexcept;
+
+		/**
+		 * Nothing to release.
+		 */
+		~intrusive_counter() noexcept = default;
+
+
+		/**
+		 * Keep the owners, they still own this value.
+		 * @return Self instance.
+		 */
+		intrusive_counter &operator=(const intrusive_counter &) noexcept;
+
+	public:
+		/**
+		 * Count one more owner.
+		 */
+		void_t acquire() const noexcept;
+		/**
+		 * Count one owner less.
+		 * @return True if it was the last one, false otherwise.
+		 */
+		bool_t release() const noexcept;
+		/**
+		 * Get the number of owners. Only exact when no other thread takes or
+		 * drops ownership.
+		 * @return Number of owners.
+		 */
+		size_t use_count() const noexcept;
+	};
+
+
+	/**
+	 * Pointer to a value shared by every copy of it, released when the last
+	 * copy goes away. The value counts its owners, with acquire() and a
+	 * release() telling when the last is gone, as intrusive_counter does, so
+	 * the pointer is a single pointer and needs no allocation of its own.
+	 * Values are allocated with new.
+	 * @tparam type Type of the value.
+	 */
+	template<typename type>
+	class intrusive_pointer {
+
+		type *object = nullptr;   ///< Shared value.
+
+	public:
+		/**
+		 * Point to nothing.
+		 */
+		intrusive_pointer() noexcept = default;
+		/**
+		 * Point to nothing.
+		 */
+		intrusive_pointer(nullptr_t) noexcept;
+		/**
+		 * Own a value allocated with new.
+		 * @param [in] object Value to own, nullptr to point to nothing.
+		 */
+		explicit intrusive_pointer(type *object) noexcept;
+		/**
+		 * Share the value of another pointer.
+		 * @param [in] pointer Pointer to share with.
+		 */
+		intrusive_pointer(const intrusive_pointer &pointer) noexcept;
+		/**
+		 * Take the value of another pointer, leaving it pointing to nothing.
+		 * @param [in,out] pointer Pointer to take from.
+		 */
+		intrusive_pointer(intrusive_pointer &&pointer) noexcept;
+
+		/**
+		 * Stop owning the value, deleting it if this was the last owner.
+		 */
+		~intrusive_pointer() noexcept;
+
+
+		/**
+		 * Get the value.
+		 * @return Pointer to the value, nullptr if none.
+		 */
+		type *get() const noexcept;
+		/**
+		 * Check if is nullptr.
+		 * @return True if no value is pointed, false otherwise.
+		 */
+		bool_t is_null() const noexcept;
+
+		/**
+		 * Stop owning the value and point to nothing.
+		 */
+		void_t reset() noexcept;
+
+
+		/**
+		 * Access the value.
+		 * @return Reference to the value.
+		 */
+		type &operator*() const noexcept;
+		/**
+		 * Access the members of the value.
+		 * @return Pointer to the value.
+		 */
+		type *operator->() const noexcept;
+
+		/**
+		 * Share the value of another pointer.
+		 * @param [in] pointer Pointer to share with.
+		 * @return Self instance.
+		 */
+		intrusive_pointer &operator=(const intrusive_pointer &pointer) noexcept;
+		/**
+		 * Take the value of another pointer, leaving it pointing to nothing.
+		 * @param [in,out] pointer Pointer to take from.
+		 * @return Self instance.
+		 */
+		intrusive_pointer &operator=(intrusive_pointer &&pointer) noexcept;
+
+		/**
+		 * Check if both point to the same value.
+		 * @param [in] pointer Pointer to compare with.
+		 * @return True if they point to the same value, false otherwise.
+		 */
+		bool_t operator==(const intrusive_pointer &pointer) const noexcept;
+		/**
+		 * Check if they point to different values.
+		 * @param [in] pointer Pointer to compare with.
+		 * @return True if they point to different values, false otherwise.
+		 */
+		bool_t operator!=(const intrusive_pointer &pointer) const noexcept;
+	};
+
+
+	/**
+	 * Nothing points back to an intrusive_pointer, copying its bytes
+	 * relocates it.
+	 * @tparam type Type of the value.
+	 */
+	template<typename type>
+	struct is_trivially_relocatable<intrusive_pointer<type>> {
+		/// Intrusive pointers are trivially relocatable.
+		static constexpr bool_t value = true;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_memory_intrusive_pointer_impl_
+#	include "../memory/intrusive_pointer_impl.tpp"
+#	undef _stick_lib_memory_intrusive_pointer_impl_
+
+
+#endif   //_stick_lib_memory_intrusive_pointer_
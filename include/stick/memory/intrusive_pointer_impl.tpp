@@ -0,0 +1,149 @@
+/**
+ * Intrusive pointer. Template implementations.
+ * @brief Intrusive pointer template implementations.
+ * @file intrusive_pointer_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_memory_intrusive_pointer_impl_)
+
+
+
+namespace stick {
+
+
+	template<bool_t thread_safe>
+	intrusive_counter<thread_safe>::intrusive_counter(
+	    const intrusive_counter &) noexcept { }
+
+	template<bool_t thread_safe>
+	intrusive_counter<thread_safe> &intrusive_counter<thread_safe>::operator=(
+	    const intrusive_counter &) noexcept {
+		return *this;
+	}
+
+	template<bool_t thread_safe>
+	void_t intrusive_counter<thread_safe>::acquire() const noexcept {
+		if (thread_safe)
+			this->references.fetch_add(1ul, memory_order::relaxed);
+		else
+			this->references.store(
+			    this->references.load(memory_order::relaxed) + 1ul,
+			    memory_order::relaxed);
+	}
+	template<bool_t thread_safe>
+	bool_t intrusive_counter<thread_safe>::release() const noexcept {
+		// The last owner must see every write of the others to the value.
+		if (thread_safe)
+			return this->references.fetch_sub(1ul, memory_order::acq_rel)
+			       == 1ul;
+
+		size_t left = this->references.load(memory_order::relaxed) - 1ul;
+		this->references.store(left, memory_order::relaxed);
+
+		return left == 0ul;
+	}
+	template<bool_t thread_safe>
+	size_t intrusive_counter<thread_safe>::use_count() const noexcept {
+		return this->references.load(thread_safe ? memory_order::acquire
+		                                         : memory_order::relaxed);
+	}
+
+
+	template<typename type>
+	intrusive_pointer<type>::intrusive_pointer(nullptr_t) noexcept { }
+	template<typename type>
+	intrusive_pointer<type>::intrusive_pointer(type *object) noexcept
+	    : object(object) {
+		if (object != nullptr)
+			object->acquire();
+	}
+	template<typename type>
+	intrusive_pointer<type>::intrusive_pointer(
+	    const intrusive_pointer &pointer) noexcept
+	    : intrusive_pointer(pointer.object) { }
+	template<typename type>
+	intrusive_pointer<type>::intrusive_pointer(
+	    intrusive_pointer &&pointer) noexcept
+	    : object(pointer.object) {
+		pointer.object = nullptr;
+	}
+
+	template<typename type>
+	intrusive_pointer<type>::~intrusive_pointer() noexcept {
+		this->reset();
+	}
+
+
+	template<typename type>
+	type *intrusive_pointer<type>::get() const noexcept {
+		return this->object;
+	}
+	template<typename type>
+	bool_t intrusive_pointer<type>::is_null() const noexcept {
+		return this->object == nullptr;
+	}
+
+	template<typename type>
+	void_t intrusive_pointer<type>::reset() noexcept {
+		type *object = this->object;
+		this->object = nullptr;
+
+		if (object != nullptr and object->release())
+			delete object;
+	}
+
+
+	template<typename type>
+	type &intrusive_pointer<type>::operator*() const noexcept {
+		return *this->object;
+	}
+	template<typename type>
+	type *intrusive_pointer<type>::operator->() const noexcept {
+		return this->object;
+	}
+
+	template<typename type>
+	intrusive_pointer<type> &intrusive_pointer<type>::operator=(
+	    const intrusive_pointer &pointer) noexcept {
+		// Count the new owner first, in case both share the value or the
+		// other pointer lives inside this value.
+		type *object = pointer.object;
+		if (object != nullptr)
+			object->acquire();
+		this->reset();
+
+		this->object = object;
+
+		return *this;
+	}
+	template<typename type>
+	intrusive_pointer<type> &
+	intrusive_pointer<type>::operator=(intrusive_pointer &&pointer) noexcept {
+		if (this != &pointer) {
+			this->reset();
+
+			this->object = pointer.object;
+			pointer.object = nullptr;
+		}
+
+		return *this;
+	}
+
+	template<typename type>
+	bool_t intrusive_pointer<type>::operator==(
+	    const intrusive_pointer &pointer) const noexcept {
+		return this->object == pointer.object;
+	}
+	template<typename type>
+	bool_t intrusive_pointer<type>::operator!=(
+	    const intrusive_pointer &pointer) const noexcept {
+		return this->object != pointer.object;
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_memory_intrusive_pointer_impl_
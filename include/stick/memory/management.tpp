@@ -28,7 +28,8 @@ namespace stick {
 	inline type *allocate(size_t element_amount = 1ul);
 
 	/**
-	 * Dynamic value allocation.
+	 * Dynamic value allocation. The value is copy constructed in memory from
+	 * allocate_uninitialized and must be released like it.
 	 * @tparam type Data type to allocate. Default = byte_t.
 	 * @param [in] value To be allocated dynamically.
 	 * @return Pointer to the newly allocated value.
@@ -39,7 +40,8 @@ namespace stick {
 
 	/**
 	 * Dynamic and aligned memory allocation. Minimum 1 byte.
-	 * Maximum < 2 GigaBytes.
+	 * Maximum < 2 GigaBytes. Nothing is constructed, release it with
+	 * deallocate_raw.
 	 * @tparam type Data type to allocate. Default = byte_t.
 	 * @tparam alignment Alignment the allocated memory should have.
 	 * @param [in] element_amount Number of elements to be allocated.
@@ -60,6 +62,61 @@ namespace stick {
 	template<typename type>
 	inline void_t deallocate(type *&data);
 
+	/**
+	 * Allocate memory for values without constructing any of them. Minimum
+	 * 1 element. Maximum < 2 GigaBytes.
+	 * @tparam type Type of the values.
+	 * @param [in] element_amount Number of values to make room for.
+	 * Default = 1.
+	 * @return Pointer to the uninitialized memory.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	template<typename type>
+	inline type *allocate_uninitialized(size_t element_amount = 1ul);
+
+	/**
+	 * Deallocate memory from allocate_uninitialized or allocate_aligned
+	 * without destroying anything in it, and make pointer null.
+	 * @tparam type Type of the values the memory was allocated for.
+	 * @tparam alignment Alignment it was allocated with. Default =
+	 * alignof(type).
+	 * @param [in,out] data Pointer to deallocate and make null.
+	 * @throw memory_error when deallocating a nullptr.
+	 */
+	template<typename type, size_t alignment = alignof(type)>
+	inline void_t deallocate_raw(type *&data);
+
+	/**
+	 * Default construct a value in uninitialized memory. Trivial types are
+	 * left uninitialized, as new does.
+	 * @tparam type Type of the value.
+	 * @param [out] address Memory to build the value in.
+	 * @return Pointer to the new value.
+	 */
+	template<typename type>
+	inline type *construct_at(type *address);
+	/**
+	 * Construct a value in uninitialized memory.
+	 * @tparam type Type of the value.
+	 * @tparam argument_types Types of the constructor arguments.
+	 * @param [out] address Memory to build the value in.
+	 * @param [in] arguments Arguments for the constructor.
+	 * @return Pointer to the new value.
+	 */
+	template<typename type, typename... argument_types>
+	inline type *construct_at(type *address, argument_types &&...arguments);
+
+	/**
+	 * Destroy consecutive values leaving their memory uninitialized. Does
+	 * nothing for trivially destructible types.
+	 * @tparam type Type of the values.
+	 * @param [in,out] address First value to destroy.
+	 * @param [in] element_amount Number of values to destroy. Default = 1.
+	 */
+	template<typename type>
+	inline void_t destroy_range(type *address,
+	                            size_t element_amount = 1ul) noexcept;
+
 	/**
 	 * Set content of the given address to a specific value.
 	 * @tparam type Type of the pointer and value to copy. Default = byte_t.
@@ -96,7 +153,8 @@ namespace stick {
 	inline void_t clear(type *address, size_t element_amount = 1ul) noexcept;
 
 	/**
-	 * Copy memory data from one address to another.
+	 * Copy memory data from one address to another. Trivially copyable types
+	 * are copied as raw memory, the rest by assignment.
 	 * @tparam type Type of the data to be copied. Default = byte_t.
 	 * @param [in] source_address Pointer to the data to be copied from.
 	 * @param [in] destination_address Pointer to the data to be copied to.
@@ -110,18 +168,35 @@ namespace stick {
 
 	/**
 	 * Move memory data from one address to another and nullify source data.
+	 * Both ranges may overlap. Trivially copyable types are moved as raw
+	 * memory, the rest by move assignment.
 	 * @tparam type Type of the data to be moved. Default = byte_t.
 	 * @param [in] source_address Pointer to the data to be moved from.
 	 * @param [in] destination_address Pointer to the data to be moved to.
 	 * @param [in] element_amount Number of consecutive data elements to be
 	 * moved from the source. Default = 1.
-	 * @param [in] set_null Set memory to null when moved. Default = true.
+	 * @param [in] set_null Set memory to null when moved, only for trivially
+	 * copyable types. Default = true.
 	 */
 	template<typename type = byte_t>
 	inline void_t move(type *source_address, type *destination_address,
 	                   size_t element_amount = 1ul,
 	                   bool_t set_null = true) noexcept;
 
+	/**
+	 * Relocate values to uninitialized memory, leaving the source
+	 * uninitialized. Both ranges may overlap. Trivially relocatable types
+	 * are moved as raw memory, the rest are move constructed and destroyed
+	 * one by one.
+	 * @tparam type Type of the values.
+	 * @param [in,out] source_address First value to relocate.
+	 * @param [out] destination_address Uninitialized memory to relocate to.
+	 * @param [in] element_amount Number of consecutive values to relocate.
+	 */
+	template<typename type>
+	inline void_t relocate(type *source_address, type *destination_address,
+	                       size_t element_amount) noexcept;
+
 
 }   // namespace stick
 
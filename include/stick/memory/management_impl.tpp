@@ -9,6 +9,10 @@
 
 #	include "../error/memory_error.hpp"
 #	include "../memory/storage.tpp"
+#	include "../templates/reference.tpp"
+#	include "../templates/traits.tpp"
+
+#	include <new>
 
 
 namespace stick {
@@ -30,10 +34,7 @@ namespace stick {
 
 	template<typename type>
 	inline type *allocate_value(const type &value) {
-		auto ptr = allocate<type>(1ul);
-		*ptr = value;
-
-		return ptr;
+		return construct_at(allocate_uninitialized<type>(1ul), value);
 	}
 
 	template<typename type, size_t alignment>
@@ -48,7 +49,8 @@ namespace stick {
 			    "Allocating 2 gigabytes consecutively is prohibited, "
 			    "try allocating separated memory spaces.");
 
-		return new storage_aligned<sizeof(type), alignment>[element_amount];
+		return reinterpret_cast<type *>(
+		    new storage_aligned<sizeof(type), alignment>[element_amount]);
 	}
 
 	template<typename type>
@@ -60,6 +62,39 @@ namespace stick {
 		data = nullptr;
 	}
 
+	template<typename type>
+	inline type *allocate_uninitialized(size_t element_amount) {
+		return allocate_aligned<type, alignof(type)>(element_amount);
+	}
+
+	template<typename type, size_t alignment>
+	inline void_t deallocate_raw(type *&data) {
+		if (data == nullptr)
+			throw memory_error("Deallocating nullptr!");
+
+		delete[] reinterpret_cast<storage_aligned<sizeof(type), alignment> *>(
+		    data);
+		data = nullptr;
+	}
+
+	template<typename type>
+	inline type *construct_at(type *address) {
+		return new (static_cast<voidptr_t>(address)) type;
+	}
+	template<typename type, typename... argument_types>
+	inline type *construct_at(type *address, argument_types &&...arguments) {
+		return new (static_cast<voidptr_t>(address))
+		    type(stick::forward<argument_types>(arguments)...);
+	}
+
+	template<typename type>
+	inline void_t destroy_range(type *address,
+	                            size_t element_amount) noexcept {
+		if (not is_trivially_destructible<type>::value)
+			for (size_t i = 0ul; i < element_amount; i++)
+				address[i].~type();
+	}
+
 
 	template<typename type>
 	inline void_t set(type *address, const type &value,
@@ -99,8 +134,12 @@ namespace stick {
 			throw memory_error("Destination data will overwrite source data. "
 			                   "Consider moving instead.");
 
-		for (size_t i = 0ul; i < element_amount; i++)
-			set(&destination_address[i], source_address[i]);
+		if (is_trivially_copyable<type>::value)
+			__builtin_memcpy(static_cast<voidptr_t>(destination_address),
+			                 source_address, element_amount * sizeof(type));
+		else
+			for (size_t i = 0ul; i < element_amount; i++)
+				destination_address[i] = source_address[i];
 	}
 
 	template<typename type>
@@ -109,30 +148,59 @@ namespace stick {
 
 		if (source_address == destination_address or element_amount == 0ul)
 			return;
-		else if (source_address < destination_address) {
-			for (size_t i = element_amount - 1; i < -1ul; i--)
-				set(&destination_address[i], source_address[i]);
-
-			if (set_null) {
-				if (source_address + element_amount >= destination_address)
-					clear(source_address + element_amount,
-					      destination_address - source_address);
-				else
-					clear(source_address, element_amount);
-			}
 
-		} else {   // destination_address < source_address
-			for (size_t i = 0ul; i < element_amount; i++)
-				set(&destination_address[i], source_address[i]);
-
-			if (set_null) {
-				if (destination_address + element_amount >= source_address)
-					clear(source_address + element_amount,
-					      source_address - destination_address);
-				else
-					clear(source_address, element_amount);
-			}
+		if (not is_trivially_copyable<type>::value) {
+			if (source_address < destination_address)
+				for (size_t i = element_amount - 1ul; i < -1ul; i--)
+					destination_address[i] = stick::move(source_address[i]);
+			else
+				for (size_t i = 0ul; i < element_amount; i++)
+					destination_address[i] = stick::move(source_address[i]);
+
+			return;
 		}
+
+		__builtin_memmove(static_cast<voidptr_t>(destination_address),
+		                  source_address, element_amount * sizeof(type));
+
+		if (not set_null)
+			return;
+
+		// Only the part of the source not overwritten keeps stale data.
+		if (source_address < destination_address)
+			clear(source_address,
+			      source_address + element_amount < destination_address
+			          ? element_amount
+			          : static_cast<size_t>(destination_address
+			                                - source_address));
+		else if (source_address < destination_address + element_amount)
+			clear(destination_address + element_amount,
+			      static_cast<size_t>(source_address - destination_address));
+		else
+			clear(source_address, element_amount);
+	}
+
+	template<typename type>
+	inline void_t relocate(type *source_address, type *destination_address,
+	                       size_t element_amount) noexcept {
+		if (source_address == destination_address or element_amount == 0ul)
+			return;
+
+		if (is_trivially_relocatable<type>::value)
+			__builtin_memmove(static_cast<voidptr_t>(destination_address),
+			                  source_address, element_amount * sizeof(type));
+		else if (destination_address < source_address)
+			for (size_t i = 0ul; i < element_amount; i++) {
+				new (&destination_address[i])
+				    type(stick::move(source_address[i]));
+				source_address[i].~type();
+			}
+		else
+			for (size_t i = element_amount - 1ul; i < -1ul; i--) {
+				new (&destination_address[i])
+				    type(stick::move(source_address[i]));
+				source_address[i].~type();
+			}
 	}
 
 
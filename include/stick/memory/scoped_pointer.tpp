@@ -12,6 +12,7 @@
 
 #	include "../data_structures/list_constexpr.hpp"
 #	include "../defines/types.hpp"
+#	include "../templates/traits.tpp"
 
 
 namespace stick {
@@ -39,7 +40,8 @@ namespace stick {
 		scoped_pointer(const type &value) noexcept;
 		/**
 		 * Convert pointer to single value to scoped_pointer. Pointer will be
-		 * deallocated when scoped_pointer is called!
+		 * deallocated when scoped_pointer is called! It must come from
+		 * allocate_value or allocate_uninitialized.
 		 * @param [in] pointer Address of the value to be pointed.
 		 * @throw memory_error when copying a nullptr.
 		 * @return Self instance.
@@ -47,6 +49,7 @@ namespace stick {
 		scoped_pointer(const type *pointer);
 		/**
 		 * Allocate a copy of the value(s) referenced by the given pointer.
+		 * Values are copy constructed, the extra ones default constructed.
 		 * @param [in] pointer Address of the values to be copied.
 		 * @param [in] element_amount Number of consecutive values to be copied.
 		 * @param [in] extra_element_amount Number extra elements to be
@@ -62,7 +65,8 @@ namespace stick {
 		 */
 		scoped_pointer(const list_constexpr<type> &list) noexcept;
 		/**
-		 * Allocate elements without assigning any value.
+		 * Allocate elements without assigning any value. Trivial types are
+		 * left uninitialized, the rest default constructed.
 		 * @param [in] element_amount Number of elements to allocate.
 		 * @param [in] _ Only use to enforce this constructor when type is
 		 * size_t.
@@ -178,7 +182,8 @@ namespace stick {
 		scoped_pointer &operator=(const type &value) noexcept;
 		/**
 		 * Convert pointer to single value to scoped_pointer. Pointer will be
-		 * deallocated when scoped_pointer is called!
+		 * deallocated when scoped_pointer is called! It must come from
+		 * allocate_value or allocate_uninitialized.
 		 * @param [in] pointer Address of the data to be pointed.
 		 * @return Self instance.
 		 */
@@ -204,6 +209,18 @@ namespace stick {
 	};
 
 
+	/**
+	 * Nothing points back to a scoped_pointer, copying its bytes relocates
+	 * it.
+	 * @tparam type Type of the data.
+	 */
+	template<typename type>
+	struct is_trivially_relocatable<scoped_pointer<type>> {
+		/// Scoped pointers are trivially relocatable.
+		static constexpr bool_t value = true;
+	};
+
+
 }   // namespace stick
 
 
@@ -9,6 +9,7 @@
 
 #	include "../error/out_of_range_error.hpp"
 #	include "../memory/management.tpp"
+#	include "../templates/reference.tpp"
 
 
 namespace stick {
@@ -29,30 +30,43 @@ namespace stick {
 	scoped_pointer<type>::scoped_pointer(const type *pointer,
 	                                     size_t element_amount,
 	                                     size_t extra_element_amount)
-	    : allocated_elements(element_amount + extra_element_amount),
-	      ptr(allocate<type>(element_amount + extra_element_amount)) {
-		if (pointer == nullptr)
+	    : ptr(allocate_uninitialized<type>(element_amount
+	                                       + extra_element_amount)),
+	      allocated_elements(element_amount + extra_element_amount) {
+		if (pointer == nullptr) {
+			deallocate_raw(this->ptr);
 			throw memory_error("Creating a scoped_pointer and trying to copy "
 			                   "values from a nullptr to it.");
+		}
 
-		copy(pointer, this->ptr, element_amount);
+		for (size_t i = 0ul; i < element_amount; i++)
+			construct_at(&this->ptr[i], pointer[i]);
+		for (size_t i = element_amount; i < this->allocated_elements; i++)
+			construct_at(&this->ptr[i]);
 	}
 	template<typename type>
 	scoped_pointer<type>::scoped_pointer(
 	    const list_constexpr<type> &list) noexcept
-	    : ptr(allocate<type>(list.size())) {
+	    : ptr(allocate_uninitialized<type>(list.size())) {
 		for (const auto &e : list)
-			this->ptr[this->allocated_elements++] = e;
+			construct_at(&this->ptr[this->allocated_elements++], e);
 	}
 	template<typename type>
 	scoped_pointer<type>::scoped_pointer(size_t element_amount, nullptr_t)
-	    : allocated_elements(element_amount),
-	      ptr(allocate<type>(element_amount)) { }
+	    : ptr(allocate_uninitialized<type>(element_amount)),
+	      allocated_elements(element_amount) {
+		for (size_t i = 0ul; i < element_amount; i++)
+			construct_at(&this->ptr[i]);
+	}
 	template<typename type>
-	scoped_pointer<type>::scoped_pointer(const scoped_pointer &pointer) noexcept
-	    : allocated_elements(pointer.allocated_elements),
-	      ptr(allocate<type>(pointer.allocated_elements)) {
-		copy(pointer.ptr, this->ptr, pointer.allocated_elements);
+	scoped_pointer<type>::scoped_pointer(
+	    const scoped_pointer &pointer) noexcept {
+		if (pointer.is_null())
+			return;
+
+		this->ptr = allocate_uninitialized<type>(pointer.allocated_elements);
+		for (const auto &e : pointer)
+			construct_at(&this->ptr[this->allocated_elements++], e);
 	}
 	template<typename type>
 	scoped_pointer<type>::scoped_pointer(scoped_pointer &&pointer) noexcept
@@ -63,8 +77,10 @@ namespace stick {
 
 	template<typename type>
 	scoped_pointer<type>::~scoped_pointer() noexcept {
-		if (this->ptr != nullptr)
-			deallocate(this->ptr);
+		if (this->ptr != nullptr) {
+			destroy_range(this->ptr, this->allocated_elements);
+			deallocate_raw(this->ptr);
+		}
 
 		this->allocated_elements = 0ul;
 	}
@@ -139,9 +155,10 @@ namespace stick {
 	template<typename type>
 	scoped_pointer<type> &
 	scoped_pointer<type>::operator=(const type &value) noexcept {
-		if (this->is_null())
+		if (this->is_null()) {
 			this->ptr = allocate_value(value);
-		else
+			this->allocated_elements = 1ul;
+		} else
 			*this->ptr = value;
 
 		return *this;
@@ -149,8 +166,7 @@ namespace stick {
 	template<typename type>
 	scoped_pointer<type> &
 	scoped_pointer<type>::operator=(const type *pointer) noexcept {
-		if (this->ptr != nullptr)
-			deallocate(this->ptr);
+		this->~scoped_pointer();
 
 		this->ptr = const_cast<type *>(pointer);
 		this->allocated_elements = 1ul;
@@ -160,11 +176,9 @@ namespace stick {
 	template<typename type>
 	scoped_pointer<type> &
 	scoped_pointer<type>::operator=(const list_constexpr<type> &list) noexcept {
-		this->~scoped_pointer();
+		scoped_pointer tempy(list);
 
-		this->ptr = allocate(list.size());
-		for (const auto &e : list)
-			this->ptr[this->allocated_elements++] = e;
+		return *this = stick::move(tempy);
 	}
 	template<typename type>
 	scoped_pointer<type> &
@@ -172,18 +186,16 @@ namespace stick {
 		if (&pointer == this)
 			return *this;
 
-		if (this->ptr != nullptr)
-			deallocate(this->ptr);
+		scoped_pointer tempy(pointer);
 
-		this->ptr = allocate<type>(pointer.allocated_elements);
-		this->allocated_elements = pointer.allocated_elements;
-		copy(pointer.ptr, this->ptr, pointer.allocated_elements);
-
-		return *this;
+		return *this = stick::move(tempy);
 	}
 	template<typename type>
 	scoped_pointer<type> &
 	scoped_pointer<type>::operator=(scoped_pointer &&pointer) noexcept {
+		if (&pointer == this)
+			return *this;
+
 		this->~scoped_pointer();
 
 		this->ptr = pointer.ptr;
@@ -0,0 +1,177 @@
+/**
+ * Reference counted buffer shared by its copies until one of them writes.
+ * @brief Buffer shared between owners, for copy-on-write storage.
+ * @file shared_buffer.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_memory_shared_buffer_)
+#	define _stick_lib_memory_shared_buffer_
+
+
+
+#	include "../defines/types.hpp"
+#	include "../templates/traits.tpp"
+#	include "../thread/atomic.tpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Counter and room of a shared buffer, stored in front of its elements.
+	 */
+	struct shared_buffer_header {
+		atomic<size_t> references;   ///< Number of owners.
+		size_t capacity;   ///< Number of elements.
+	};
+
+
+	/**
+	 * Raw elements shared by every copy of the buffer, released when the
+	 * last copy goes away. Copies only count one more owner, with atomic
+	 * operations, so owners may live in different threads. The buffer does
+	 * not build nor destroy the elements, its owner does, and an owner must
+	 * not write while the buffer is shared().
+	 * @tparam type Type of the elements, trivially copyable.
+	 */
+	template<typename type>
+	class shared_buffer {
+
+		type *values = nullptr;   ///< First element, after the header.
+
+
+		/**
+		 * Number of elements the header takes.
+		 */
+		static constexpr size_t header_elements =
+		    (sizeof(shared_buffer_header) + sizeof(type) - 1ul) / sizeof(type);
+
+		/**
+		 * Get the header in front of the elements.
+		 * @return Header of the buffer.
+		 */
+		shared_buffer_header *header() const noexcept;
+
+	public:
+		/**
+		 * Own no elements.
+		 */
+		shared_buffer() noexcept = default;
+		/**
+		 * Allocate uninitialized elements.
+		 * @param [in] capacity Number of elements, 0 to own none.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		explicit shared_buffer(size_t capacity);
+		/**
+		 * Allocate a copy of some elements with room for more after them.
+		 * @param [in] values Elements to copy.
+		 * @param [in] amount Number of elements to copy.
+		 * @param [in] extra_amount Uninitialized elements after the copied
+		 * ones. Default = 0.
+		 * @throw memory_error when copying from a nullptr or memory cannot be
+		 * allocated.
+		 */
+		explicit shared_buffer(const type *values, size_t amount,
+		                       size_t extra_amount = 0ul);
+		/**
+		 * Share the elements of another buffer.
+		 * @param [in] buffer Buffer to share with.
+		 */
+		shared_buffer(const shared_buffer &buffer) noexcept;
+		/**
+		 * Take the elements of another buffer, leaving it with none.
+		 * @param [in,out] buffer Buffer to take from.
+		 */
+		shared_buffer(shared_buffer &&buffer) noexcept;
+
+		/**
+		 * Stop owning the elements, freeing them if this was the last owner.
+		 */
+		~shared_buffer() noexcept;
+
+
+		/**
+		 * Begin iterator.
+		 * @return Pointer to the first element.
+		 */
+		type *begin() const noexcept;
+		/**
+		 * End iterator.
+		 * @return Pointer to one element after the last.
+		 */
+		type *end() const noexcept;
+
+
+		/**
+		 * Get the number of elements.
+		 * @return Number of allocated elements, 0 if none.
+		 */
+		size_t capacity() const noexcept;
+		/**
+		 * Check if other buffers own the elements too. Once false it stays
+		 * so until this buffer is copied.
+		 * @return True if there are other owners, false otherwise.
+		 */
+		bool_t shared() const noexcept;
+		/**
+		 * Check if there are no elements.
+		 * @return True if no elements are owned, false otherwise.
+		 */
+		bool_t is_null() const noexcept;
+
+
+		/**
+		 * Stop owning the elements without freeing them, so the last owner
+		 * can destroy them first.
+		 * @return True if this was the last owner, then the elements are
+		 * still owned until reset(), false otherwise.
+		 */
+		bool_t drop() noexcept;
+		/**
+		 * Stop owning the elements, freeing them if this was the last owner.
+		 */
+		void_t reset() noexcept;
+
+
+		/**
+		 * Get the elements.
+		 * @return Pointer to the first element, nullptr if none.
+		 */
+		operator type *() const noexcept;
+
+		/**
+		 * Share the elements of another buffer.
+		 * @param [in] buffer Buffer to share with.
+		 * @return Self instance.
+		 */
+		shared_buffer &operator=(const shared_buffer &buffer) noexcept;
+		/**
+		 * Take the elements of another buffer, leaving it with none.
+		 * @param [in,out] buffer Buffer to take from.
+		 * @return Self instance.
+		 */
+		shared_buffer &operator=(shared_buffer &&buffer) noexcept;
+	};
+
+
+	/**
+	 * Nothing points back to a shared_buffer, copying its bytes relocates it.
+	 * @tparam type Type of the elements.
+	 */
+	template<typename type>
+	struct is_trivially_relocatable<shared_buffer<type>> {
+		/// Shared buffers are trivially relocatable.
+		static constexpr bool_t value = true;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_memory_shared_buffer_impl_
+#	include "../memory/shared_buffer_impl.tpp"
+#	undef _stick_lib_memory_shared_buffer_impl_
+
+
+#endif   //_stick_lib_memory_shared_buffer_
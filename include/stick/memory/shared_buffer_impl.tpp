@@ -0,0 +1,169 @@
+/**
+ * Shared buffer. Template implementations.
+ * @brief Shared buffer template implementations.
+ * @file shared_buffer_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_memory_shared_buffer_impl_)
+
+
+#	include "../error/memory_error.hpp"
+#	include "../memory/management.tpp"
+
+
+namespace stick {
+
+
+	template<typename type>
+	shared_buffer_header *shared_buffer<type>::header() const noexcept {
+		return reinterpret_cast<shared_buffer_header *>(
+		    this->values - shared_buffer::header_elements);
+	}
+
+
+	template<typename type>
+	shared_buffer<type>::shared_buffer(size_t capacity) {
+		if (capacity == 0ul)
+			return;
+
+		// Memory from new is aligned enough for the header, the elements
+		// after it keep their own alignment.
+		this->values = allocate_uninitialized<type>(
+		                   shared_buffer::header_elements + capacity)
+		               + shared_buffer::header_elements;
+		construct_at(&this->header()->references, 1ul);
+		this->header()->capacity = capacity;
+	}
+	template<typename type>
+	shared_buffer<type>::shared_buffer(const type *values, size_t amount,
+	                                   size_t extra_amount)
+	    : shared_buffer(values == nullptr ? 0ul : amount + extra_amount) {
+		if (values == nullptr)
+			throw memory_error("Creating a shared_buffer and trying to copy "
+			                   "values from a nullptr to it.");
+
+		copy(values, this->values, amount);
+	}
+	template<typename type>
+	shared_buffer<type>::shared_buffer(const shared_buffer &buffer) noexcept
+	    : values(buffer.values) {
+		if (this->values != nullptr)
+			this->header()->references.fetch_add(1ul, memory_order::relaxed);
+	}
+	template<typename type>
+	shared_buffer<type>::shared_buffer(shared_buffer &&buffer) noexcept
+	    : values(buffer.values) {
+		buffer.values = nullptr;
+	}
+
+	template<typename type>
+	shared_buffer<type>::~shared_buffer() noexcept {
+		this->reset();
+	}
+
+
+	template<typename type>
+	type *shared_buffer<type>::begin() const noexcept {
+		return this->values;
+	}
+	template<typename type>
+	type *shared_buffer<type>::end() const noexcept {
+		return this->values + this->capacity();
+	}
+
+
+	template<typename type>
+	size_t shared_buffer<type>::capacity() const noexcept {
+		return this->values == nullptr ? 0ul : this->header()->capacity;
+	}
+	template<typename type>
+	bool_t shared_buffer<type>::shared() const noexcept {
+		// Acquire, so a caller about to write sees the writes of the owners
+		// that just went away.
+		return this->values != nullptr
+		       and this->header()->references.load(memory_order::acquire)
+		               != 1ul;
+	}
+	template<typename type>
+	bool_t shared_buffer<type>::is_null() const noexcept {
+		return this->values == nullptr;
+	}
+
+
+	template<typename type>
+	bool_t shared_buffer<type>::drop() noexcept {
+		if (this->values == nullptr)
+			return false;
+
+		// The only owner cannot be joined by another, as that needs a copy
+		// of this one.
+		if (not this->shared())
+			return true;
+
+		// The last owner must see every write of the others to the elements.
+		if (this->header()->references.fetch_sub(1ul, memory_order::acq_rel)
+		    == 1ul) {
+			// Every other owner dropped meanwhile, count this one again for
+			// reset().
+			this->header()->references.store(1ul, memory_order::relaxed);
+
+			return true;
+		}
+
+		this->values = nullptr;
+
+		return false;
+	}
+	template<typename type>
+	void_t shared_buffer<type>::reset() noexcept {
+		if (this->values == nullptr)
+			return;
+
+		if (this->header()->references.fetch_sub(1ul, memory_order::acq_rel)
+		    == 1ul) {
+			type *first = this->values - shared_buffer::header_elements;
+			deallocate_raw(first);
+		}
+
+		this->values = nullptr;
+	}
+
+
+	template<typename type>
+	shared_buffer<type>::operator type *() const noexcept {
+		return this->values;
+	}
+
+	template<typename type>
+	shared_buffer<type> &
+	shared_buffer<type>::operator=(const shared_buffer &buffer) noexcept {
+		// Count the new owner first, in case both share the elements.
+		type *values = buffer.values;
+		if (values != nullptr)
+			buffer.header()->references.fetch_add(1ul, memory_order::relaxed);
+		this->reset();
+
+		this->values = values;
+
+		return *this;
+	}
+	template<typename type>
+	shared_buffer<type> &
+	shared_buffer<type>::operator=(shared_buffer &&buffer) noexcept {
+		if (this != &buffer) {
+			this->reset();
+
+			this->values = buffer.values;
+			buffer.values = nullptr;
+		}
+
+		return *this;
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_memory_shared_buffer_impl_
@@ -0,0 +1,195 @@
+/**
+ * Reference counted pointer sharing one value between many owners.
+ * @brief Pointer released when its last owner goes away.
+ * @file shared_pointer.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_memory_shared_pointer_)
+#	define _stick_lib_memory_shared_pointer_
+
+
+
+#	include "../defines/types.hpp"
+#	include "../templates/traits.tpp"
+#	include "../thread/atomic.tpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Control block of the values owned by shared pointers.
+	 */
+	struct shared_pointer_block {
+		atomic<size_t> references;   ///< Number of owners.
+		/// Destroy the value and free the block.
+		void_t (*release)(shared_pointer_block *block);
+	};
+
+
+	/**
+	 * Pointer to a value shared by every copy of it, released when the last
+	 * copy goes away. Copies only count one more owner, nothing is copied.
+	 * Values built with make live in the same allocation as their counter.
+	 * @tparam type Type of the value.
+	 * @tparam thread_safe Whether copies may live in different threads,
+	 * counting with atomic operations, or all stay in one thread. Default =
+	 * true.
+	 */
+	template<typename type, bool_t thread_safe = true>
+	class shared_pointer {
+
+		type *object = nullptr;   ///< Shared value.
+		shared_pointer_block *block = nullptr;   ///< Counter of the value.
+
+
+		/**
+		 * Take ownership of a value and its counter.
+		 * @param [in] object Value.
+		 * @param [in] block Counter of the value, already counting this
+		 * owner.
+		 */
+		shared_pointer(type *object, shared_pointer_block *block) noexcept;
+
+		/**
+		 * Count one more owner, if any value is pointed.
+		 */
+		void_t acquire() const noexcept;
+		/**
+		 * Count one owner less, releasing the value if it was the last.
+		 */
+		void_t release() noexcept;
+
+	public:
+		/**
+		 * Point to nothing.
+		 */
+		shared_pointer() noexcept = default;
+		/**
+		 * Point to nothing.
+		 */
+		shared_pointer(nullptr_t) noexcept;
+		/**
+		 * Own a value allocated with new. The value is deleted if the
+		 * counter cannot be allocated.
+		 * @param [in] object Value to own, nullptr to point to nothing.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		explicit shared_pointer(type *object);
+		/**
+		 * Share the value of another pointer.
+		 * @param [in] pointer Pointer to share with.
+		 */
+		shared_pointer(const shared_pointer &pointer) noexcept;
+		/**
+		 * Take the value of another pointer, leaving it pointing to nothing.
+		 * @param [in,out] pointer Pointer to take from.
+		 */
+		shared_pointer(shared_pointer &&pointer) noexcept;
+
+		/**
+		 * Stop owning the value, releasing it if this was the last owner.
+		 */
+		~shared_pointer() noexcept;
+
+
+		/**
+		 * Build a value in the same allocation as its counter.
+		 * @tparam argument_types Types of the constructor arguments.
+		 * @param [in] arguments Arguments of the value constructor.
+		 * @return Pointer owning the new value.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		template<typename... argument_types>
+		static shared_pointer make(argument_types &&...arguments);
+
+
+		/**
+		 * Get the value.
+		 * @return Pointer to the value, nullptr if none.
+		 */
+		type *get() const noexcept;
+		/**
+		 * Get the number of pointers owning the value. Only exact when no
+		 * other thread copies or drops them.
+		 * @return Number of owners, 0 if no value is pointed.
+		 */
+		size_t use_count() const noexcept;
+		/**
+		 * Check if this is the only owner of the value.
+		 * @return True if it is the only owner, false otherwise.
+		 */
+		bool_t unique() const noexcept;
+		/**
+		 * Check if is nullptr.
+		 * @return True if no value is pointed, false otherwise.
+		 */
+		bool_t is_null() const noexcept;
+
+		/**
+		 * Stop owning the value and point to nothing.
+		 */
+		void_t reset() noexcept;
+
+
+		/**
+		 * Access the value.
+		 * @return Reference to the value.
+		 */
+		type &operator*() const noexcept;
+		/**
+		 * Access the members of the value.
+		 * @return Pointer to the value.
+		 */
+		type *operator->() const noexcept;
+
+		/**
+		 * Share the value of another pointer.
+		 * @param [in] pointer Pointer to share with.
+		 * @return Self instance.
+		 */
+		shared_pointer &operator=(const shared_pointer &pointer) noexcept;
+		/**
+		 * Take the value of another pointer, leaving it pointing to nothing.
+		 * @param [in,out] pointer Pointer to take from.
+		 * @return Self instance.
+		 */
+		shared_pointer &operator=(shared_pointer &&pointer) noexcept;
+
+		/**
+		 * Check if both point to the same value.
+		 * @param [in] pointer Pointer to compare with.
+		 * @return True if they point to the same value, false otherwise.
+		 */
+		bool_t operator==(const shared_pointer &pointer) const noexcept;
+		/**
+		 * Check if they point to different values.
+		 * @param [in] pointer Pointer to compare with.
+		 * @return True if they point to different values, false otherwise.
+		 */
+		bool_t operator!=(const shared_pointer &pointer) const noexcept;
+	};
+
+
+	/**
+	 * Nothing points back to a shared_pointer, copying its bytes relocates
+	 * it.
+	 * @tparam type Type of the value.
+	 * @tparam thread_safe Whether the counter is atomic.
+	 */
+	template<typename type, bool_t thread_safe>
+	struct is_trivially_relocatable<shared_pointer<type, thread_safe>> {
+		/// Shared pointers are trivially relocatable.
+		static constexpr bool_t value = true;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_memory_shared_pointer_impl_
+#	include "../memory/shared_pointer_impl.tpp"
+#	undef _stick_lib_memory_shared_pointer_impl_
+
+
+#endif   //_stick_lib_memory_shared_pointer_
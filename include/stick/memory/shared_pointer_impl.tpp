@@ -0,0 +1,249 @@
+/**
+ * Shared pointer. Template implementations.
+ * @brief Shared pointer template implementations.
+ * @file shared_pointer_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_memory_shared_pointer_impl_)
+
+
+#	include "../memory/management.tpp"
+#	include "../templates/reference.tpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Counter and value in one allocation, as built by make.
+	 * @tparam type Type of the value.
+	 */
+	template<typename type>
+	struct shared_pointer_value_block : shared_pointer_block {
+		type value;   ///< The value.
+
+		/**
+		 * Destroy the value and free the block.
+		 * @param [in] block Block to release.
+		 */
+		static void_t release_block(shared_pointer_block *block) noexcept {
+			auto self = static_cast<shared_pointer_value_block *>(block);
+			destroy_range(&self->value);
+			deallocate_raw(self);
+		}
+	};
+
+	/**
+	 * Counter of a value allocated on its own with new.
+	 * @tparam type Type of the value.
+	 */
+	template<typename type>
+	struct shared_pointer_object_block : shared_pointer_block {
+		type *object;   ///< The value.
+
+		/**
+		 * Delete the value and free the block.
+		 * @param [in] block Block to release.
+		 */
+		static void_t release_block(shared_pointer_block *block) noexcept {
+			auto self = static_cast<shared_pointer_object_block *>(block);
+			delete self->object;
+			deallocate_raw(self);
+		}
+	};
+
+
+	template<typename type, bool_t thread_safe>
+	shared_pointer<type, thread_safe>::shared_pointer(
+	    type *object, shared_pointer_block *block) noexcept
+	    : object(object), block(block) { }
+
+	template<typename type, bool_t thread_safe>
+	void_t shared_pointer<type, thread_safe>::acquire() const noexcept {
+		if (this->block == nullptr)
+			return;
+
+		atomic<size_t> &references = this->block->references;
+		if (thread_safe)
+			references.fetch_add(1ul, memory_order::relaxed);
+		else
+			references.store(references.load(memory_order::relaxed) + 1ul,
+			                 memory_order::relaxed);
+	}
+	template<typename type, bool_t thread_safe>
+	void_t shared_pointer<type, thread_safe>::release() noexcept {
+		if (this->block == nullptr)
+			return;
+
+		atomic<size_t> &references = this->block->references;
+		size_t left;
+		// The last owner must see every write of the others to the value.
+		if (thread_safe)
+			left = references.fetch_sub(1ul, memory_order::acq_rel) - 1ul;
+		else {
+			left = references.load(memory_order::relaxed) - 1ul;
+			references.store(left, memory_order::relaxed);
+		}
+
+		if (left == 0ul)
+			this->block->release(this->block);
+
+		this->object = nullptr;
+		this->block = nullptr;
+	}
+
+
+	template<typename type, bool_t thread_safe>
+	shared_pointer<type, thread_safe>::shared_pointer(nullptr_t) noexcept { }
+	template<typename type, bool_t thread_safe>
+	shared_pointer<type, thread_safe>::shared_pointer(type *object)
+	    : object(object) {
+		if (object == nullptr)
+			return;
+
+		shared_pointer_object_block<type> *owned;
+		try {
+			owned =
+			    allocate_uninitialized<shared_pointer_object_block<type>>();
+		} catch (...) {
+			delete object;
+			throw;
+		}
+
+		construct_at(&owned->references, 1ul);
+		owned->release = shared_pointer_object_block<type>::release_block;
+		owned->object = object;
+		this->block = owned;
+	}
+	template<typename type, bool_t thread_safe>
+	shared_pointer<type, thread_safe>::shared_pointer(
+	    const shared_pointer &pointer) noexcept
+	    : object(pointer.object), block(pointer.block) {
+		this->acquire();
+	}
+	template<typename type, bool_t thread_safe>
+	shared_pointer<type, thread_safe>::shared_pointer(
+	    shared_pointer &&pointer) noexcept
+	    : object(pointer.object), block(pointer.block) {
+		pointer.object = nullptr;
+		pointer.block = nullptr;
+	}
+
+	template<typename type, bool_t thread_safe>
+	shared_pointer<type, thread_safe>::~shared_pointer() noexcept {
+		this->release();
+	}
+
+
+	template<typename type, bool_t thread_safe>
+	template<typename... argument_types>
+	shared_pointer<type, thread_safe>
+	shared_pointer<type, thread_safe>::make(argument_types &&...arguments) {
+		auto owned =
+		    allocate_uninitialized<shared_pointer_value_block<type>>();
+		try {
+			construct_at(&owned->value,
+			             stick::forward<argument_types>(arguments)...);
+		} catch (...) {
+			deallocate_raw(owned);
+			throw;
+		}
+
+		construct_at(&owned->references, 1ul);
+		owned->release = shared_pointer_value_block<type>::release_block;
+
+		return shared_pointer(&owned->value, owned);
+	}
+
+
+	template<typename type, bool_t thread_safe>
+	type *shared_pointer<type, thread_safe>::get() const noexcept {
+		return this->object;
+	}
+	template<typename type, bool_t thread_safe>
+	size_t shared_pointer<type, thread_safe>::use_count() const noexcept {
+		if (this->block == nullptr)
+			return 0ul;
+
+		return this->block->references.load(memory_order::relaxed);
+	}
+	template<typename type, bool_t thread_safe>
+	bool_t shared_pointer<type, thread_safe>::unique() const noexcept {
+		// Acquire, so a caller about to write sees the writes of the owners
+		// that just went away.
+		return this->block != nullptr
+		       and this->block->references.load(thread_safe
+		                                            ? memory_order::acquire
+		                                            : memory_order::relaxed)
+		               == 1ul;
+	}
+	template<typename type, bool_t thread_safe>
+	bool_t shared_pointer<type, thread_safe>::is_null() const noexcept {
+		return this->object == nullptr;
+	}
+
+	template<typename type, bool_t thread_safe>
+	void_t shared_pointer<type, thread_safe>::reset() noexcept {
+		this->release();
+	}
+
+
+	template<typename type, bool_t thread_safe>
+	type &shared_pointer<type, thread_safe>::operator*() const noexcept {
+		return *this->object;
+	}
+	template<typename type, bool_t thread_safe>
+	type *shared_pointer<type, thread_safe>::operator->() const noexcept {
+		return this->object;
+	}
+
+	template<typename type, bool_t thread_safe>
+	shared_pointer<type, thread_safe> &
+	shared_pointer<type, thread_safe>::operator=(
+	    const shared_pointer &pointer) noexcept {
+		// Count the new owner first, in case both share the value or the
+		// other pointer lives inside this value.
+		type *object = pointer.object;
+		shared_pointer_block *block = pointer.block;
+		pointer.acquire();
+		this->release();
+
+		this->object = object;
+		this->block = block;
+
+		return *this;
+	}
+	template<typename type, bool_t thread_safe>
+	shared_pointer<type, thread_safe> &
+	shared_pointer<type, thread_safe>::operator=(
+	    shared_pointer &&pointer) noexcept {
+		if (this != &pointer) {
+			this->release();
+
+			this->object = pointer.object;
+			this->block = pointer.block;
+			pointer.object = nullptr;
+			pointer.block = nullptr;
+		}
+
+		return *this;
+	}
+
+	template<typename type, bool_t thread_safe>
+	bool_t shared_pointer<type, thread_safe>::operator==(
+	    const shared_pointer &pointer) const noexcept {
+		return this->object == pointer.object;
+	}
+	template<typename type, bool_t thread_safe>
+	bool_t shared_pointer<type, thread_safe>::operator!=(
+	    const shared_pointer &pointer) const noexcept {
+		return this->object != pointer.object;
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_memory_shared_pointer_impl_
@@ -213,14 +213,16 @@ namespace stick {
 	 * @param [in] string String to be converted.
 	 * @param [in] length Length of the string to be converted.
 	 * @throw cast_error when casting cannot be performed to the given string.
-	 * @return double64_t value resulting from casting the string.
+	 * @return double64_t value resulting from casting the string, correctly
+	 * rounded, infinity past the largest double.
 	 */
 	double64_t str_cast_to_double64(const_cstring string, size_t length);
 	/**
 	 * Cast a string to double64_t.
 	 * @param [in] string String to be converted.
 	 * @throw cast_error when casting cannot be performed to the given string.
-	 * @return double64_t value resulting from casting the string.
+	 * @return double64_t value resulting from casting the string, correctly
+	 * rounded, infinity past the largest double.
 	 */
 	double64_t str_cast_to_double64(const_cstring string);
 
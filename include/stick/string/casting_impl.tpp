@@ -14,7 +14,7 @@ namespace stick {
 
 
 	template<>
-	const_cstring cast_to_cstr(nullptr_t value, cstring string) {
+	inline const_cstring cast_to_cstr(nullptr_t value, cstring string) {
 		if (string == nullptr)
 			return new_str("null", 4);
 		else
@@ -23,7 +23,7 @@ namespace stick {
 
 
 	template<>
-	const_cstring cast_to_cstr(bool_t value, cstring string) {
+	inline const_cstring cast_to_cstr(bool_t value, cstring string) {
 		if (value) {
 			if (string == nullptr)
 				return new_str("true", 4);
@@ -39,7 +39,7 @@ namespace stick {
 
 
 	template<>
-	const_cstring cast_to_cstr(int8_t value, cstring string) {
+	inline const_cstring cast_to_cstr(int8_t value, cstring string) {
 		bool_t is_negative = value < 0;
 		if (is_negative)
 			value = -value;
@@ -64,7 +64,7 @@ namespace stick {
 	}
 
 	template<>
-	const_cstring cast_to_cstr(int16_t value, cstring string) {
+	inline const_cstring cast_to_cstr(int16_t value, cstring string) {
 		bool_t is_negative = value < 0;
 		if (is_negative)
 			value = -value;
@@ -89,7 +89,7 @@ namespace stick {
 	}
 
 	template<>
-	const_cstring cast_to_cstr(int32_t value, cstring string) {
+	inline const_cstring cast_to_cstr(int32_t value, cstring string) {
 		bool_t is_negative = value < 0;
 		if (is_negative)
 			value = -value;
@@ -114,7 +114,7 @@ namespace stick {
 	}
 
 	template<>
-	const_cstring cast_to_cstr(int64_t value, cstring string) {
+	inline const_cstring cast_to_cstr(int64_t value, cstring string) {
 		bool_t is_negative = value < 0;
 		if (is_negative)
 			value = -value;
@@ -140,7 +140,7 @@ namespace stick {
 
 
 	template<>
-	const_cstring cast_to_cstr(uint8_t value, cstring string) {
+	inline const_cstring cast_to_cstr(uint8_t value, cstring string) {
 		size_t length = 1ul;
 		for (uint8_t i = 1u; value / i >= 10u; i *= 10u)
 			length++;
@@ -157,7 +157,7 @@ namespace stick {
 	}
 
 	template<>
-	const_cstring cast_to_cstr(uint16_t value, cstring string) {
+	inline const_cstring cast_to_cstr(uint16_t value, cstring string) {
 		size_t length = 1ul;
 		for (uint16_t i = 1u; value / i >= 10u; i *= 10u)
 			length++;
@@ -174,7 +174,7 @@ namespace stick {
 	}
 
 	template<>
-	const_cstring cast_to_cstr(uint32_t value, cstring string) {
+	inline const_cstring cast_to_cstr(uint32_t value, cstring string) {
 		size_t length = 1ul;
 		for (uint32_t i = 1u; value / i >= 10u; i *= 10u)
 			length++;
@@ -191,7 +191,7 @@ namespace stick {
 	}
 
 	template<>
-	const_cstring cast_to_cstr(uint64_t value, cstring string) {
+	inline const_cstring cast_to_cstr(uint64_t value, cstring string) {
 		size_t length = 1ul;
 		for (uint64_t i = 1u; value / i >= 10u; i *= 10u)
 			length++;
@@ -213,7 +213,7 @@ namespace stick {
 	//       bit-level algebra is not implemented.
 
 	template<>
-	const_cstring cast_to_cstr(float32_t value, cstring string) {
+	inline const_cstring cast_to_cstr(float32_t value, cstring string) {
 		auto integer_part = static_cast<int64_t>(value);
 		auto decimal_part = (value - integer_part) * 10;
 
@@ -241,7 +241,7 @@ namespace stick {
 	}
 
 	template<>
-	const_cstring cast_to_cstr(double64_t value, cstring string) {
+	inline const_cstring cast_to_cstr(double64_t value, cstring string) {
 		auto integer_part = static_cast<int64_t>(value);
 		auto decimal_part = (value - integer_part) * 10;
 
@@ -268,7 +268,7 @@ namespace stick {
 		return string;
 	}
 	template<>
-	const_cstring cast_to_cstr(double128_t value, cstring string) {
+	inline const_cstring cast_to_cstr(double128_t value, cstring string) {
 		auto integer_part = static_cast<int64_t>(value);
 		auto decimal_part = (value - integer_part) * 10;
 
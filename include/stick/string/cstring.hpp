@@ -99,12 +99,103 @@ namespace stick {
 	bool_t str_sorted(const_cstring str_1, const_cstring str_2);
 
 
+	/**
+	 * Find the first position where two strings differ. Compares a whole
+	 * vector register of characters at a time where available.
+	 * @param [in] str_1 First string to compare, may be nullptr if length
+	 * is 0.
+	 * @param [in] str_2 Second string to compare, may be nullptr if length
+	 * is 0.
+	 * @param [in] length Length to compare in the strings.
+	 * @return Position of the first different character, length if the
+	 * strings are identical.
+	 */
+	size_t str_mismatch(const_cstring str_1, const_cstring str_2,
+	                    size_t length) noexcept;
+	/**
+	 * Find the first position where two strings differ, ignoring the case of
+	 * ASCII letters.
+	 * @param [in] str_1 First string to compare, may be nullptr if length
+	 * is 0.
+	 * @param [in] str_2 Second string to compare, may be nullptr if length
+	 * is 0.
+	 * @param [in] length Length to compare in the strings.
+	 * @return Position of the first different character, length if the
+	 * strings are identical.
+	 */
+	size_t str_mismatch_ignore_case(const_cstring str_1, const_cstring str_2,
+	                                size_t length) noexcept;
+
+	/**
+	 * Compares two strings of known length, checking the lengths first.
+	 * @param [in] str_1 First string to compare, may be nullptr if length_1
+	 * is 0.
+	 * @param [in] length_1 Length of the first string.
+	 * @param [in] str_2 Second string to compare, may be nullptr if length_2
+	 * is 0.
+	 * @param [in] length_2 Length of the second string.
+	 * @return True if the strings are identical, false otherwise.
+	 */
+	bool_t str_equal(const_cstring str_1, size_t length_1, const_cstring str_2,
+	                 size_t length_2) noexcept;
+	/**
+	 * Compares two strings of known length ignoring the case of ASCII
+	 * letters, checking the lengths first.
+	 * @param [in] str_1 First string to compare, may be nullptr if length_1
+	 * is 0.
+	 * @param [in] length_1 Length of the first string.
+	 * @param [in] str_2 Second string to compare, may be nullptr if length_2
+	 * is 0.
+	 * @param [in] length_2 Length of the second string.
+	 * @return True if the strings only differ in case, false otherwise.
+	 */
+	bool_t str_equal_ignore_case(const_cstring str_1, size_t length_1,
+	                             const_cstring str_2, size_t length_2) noexcept;
+
+	/**
+	 * Orders two strings of known length by the code of their first
+	 * different character, a string going before the ones it is a prefix of.
+	 * @param [in] str_1 First string to compare, may be nullptr if length_1
+	 * is 0.
+	 * @param [in] length_1 Length of the first string.
+	 * @param [in] str_2 Second string to compare, may be nullptr if length_2
+	 * is 0.
+	 * @param [in] length_2 Length of the second string.
+	 * @return Negative if the first string goes before the second, positive
+	 * if it goes after and 0 if they are identical.
+	 */
+	int32_t str_compare(const_cstring str_1, size_t length_1,
+	                    const_cstring str_2, size_t length_2) noexcept;
+	/**
+	 * Orders two strings of known length as str_compare() does, with ASCII
+	 * letters in lower case.
+	 * @param [in] str_1 First string to compare, may be nullptr if length_1
+	 * is 0.
+	 * @param [in] length_1 Length of the first string.
+	 * @param [in] str_2 Second string to compare, may be nullptr if length_2
+	 * is 0.
+	 * @param [in] length_2 Length of the second string.
+	 * @return Negative if the first string goes before the second, positive
+	 * if it goes after and 0 if they only differ in case.
+	 */
+	int32_t str_compare_ignore_case(const_cstring str_1, size_t length_1,
+	                                const_cstring str_2,
+	                                size_t length_2) noexcept;
+
+
 	/**
 	 * Checks if the character is a number.
 	 * @param character Character to be checked.
 	 * @return True if the character is a number, false otherwise.
 	 */
 	bool_t char_is_numeric(char_t character) noexcept;
+	/**
+	 * Turns an ASCII upper case letter into lower case.
+	 * @param character Character to be turned.
+	 * @return The lower case letter, or the same character if it is not an
+	 * upper case letter.
+	 */
+	char_t char_to_lower(char_t character) noexcept;
 
 	/**
 	 * Checks if the string is made by numeric characters.
@@ -0,0 +1,350 @@
+/**
+ * String interning, storing each distinct string once and handing out small
+ * handles to it.
+ * @brief String interning pools.
+ * @file intern_pool.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_string_intern_pool_)
+#	define _stick_lib_string_intern_pool_
+
+
+
+#	include "../crypto/hash/hasher.tpp"
+#	include "../data_structures/array.tpp"
+#	include "../data_structures/concurrent_hash_map.tpp"
+#	include "../data_structures/hash_set.tpp"
+#	include "../defines/types.hpp"
+#	include "../memory/arena.hpp"
+#	include "../string/string_view.hpp"
+#	include "../thread/atomic.tpp"
+#	include "../thread/mutex.hpp"
+
+
+namespace stick {
+
+
+	/// Index of a string in its pool. Handles are given in interning order,
+	/// starting at 0, so they can index arrays.
+	typedef uint32_t intern_handle;
+
+
+	/**
+	 * Header of an interned string, followed by its characters and a null
+	 * character in the arena of its pool.
+	 */
+	struct interned_entry {
+		uint64_t hash;   ///< Hash of the characters.
+		size_t length;   ///< Number of characters.
+		intern_handle handle;   ///< Handle of the string in its pool.
+	};
+
+
+	/**
+	 * View of a string stored in an intern pool, valid as long as the pool
+	 * keeps it. Every string of a pool is stored once, so two views of the
+	 * same pool are equal only if they point to the same string, and
+	 * comparing them is a single pointer compare. Views of different pools
+	 * never compare equal. The hash is computed once, when interning.
+	 */
+	class interned_string {
+
+		const interned_entry *entry = nullptr;   ///< Stored string.
+
+
+		/**
+		 * View a stored string.
+		 * @param [in] entry Stored string.
+		 */
+		explicit interned_string(const interned_entry *entry) noexcept;
+
+		friend class intern_pool;
+		friend class concurrent_intern_pool;
+
+	public:
+		/**
+		 * View no string.
+		 */
+		interned_string() noexcept = default;
+
+
+		/**
+		 * Begin iterator.
+		 * @return Pointer to the first character.
+		 */
+		inline const_cstring begin() const noexcept;
+		/**
+		 * End iterator.
+		 * @return Pointer to one character after the last.
+		 */
+		inline const_cstring end() const noexcept;
+
+		/**
+		 * Get the characters, followed by a null character.
+		 * @return Pointer to the first character, nullptr if no string is
+		 * viewed.
+		 */
+		inline const_cstring data() const noexcept;
+		/**
+		 * Get the number of characters.
+		 * @return Number of characters, 0 if no string is viewed.
+		 */
+		inline size_t length() const noexcept;
+		/**
+		 * Check if the string has no characters.
+		 * @return True if it is empty or no string is viewed, false otherwise.
+		 */
+		inline bool_t empty() const noexcept;
+		/**
+		 * Check if no string is viewed.
+		 * @return True if no string is viewed, false otherwise.
+		 */
+		inline bool_t is_null() const noexcept;
+
+		/**
+		 * Get the handle of the string in its pool.
+		 * @return Handle of the string. Only meaningful if a string is viewed.
+		 */
+		inline intern_handle handle() const noexcept;
+		/**
+		 * Get the hash computed when the string was interned, the same
+		 * hasher<string_view> gives for its characters.
+		 * @return Hash of the characters. Only meaningful if a string is
+		 * viewed.
+		 */
+		inline uint64_t hash() const noexcept;
+
+
+		/**
+		 * Check if both view the same string.
+		 * @param [in] str View to compare with.
+		 * @return True if they view the same string, false otherwise.
+		 */
+		inline bool_t operator==(const interned_string &str) const noexcept;
+		/**
+		 * Check if they view different strings.
+		 * @param [in] str View to compare with.
+		 * @return True if they view different strings, false otherwise.
+		 */
+		inline bool_t operator!=(const interned_string &str) const noexcept;
+
+		/**
+		 * View the characters.
+		 * @return View of the characters.
+		 */
+		inline operator string_view() const noexcept;
+	};
+
+
+	/**
+	 * Interned strings hash to the hash stored with them, so they can be
+	 * keys of hash containers without hashing their characters again.
+	 */
+	template<>
+	struct hasher<interned_string> {
+		/**
+		 * Get the stored hash of an interned string.
+		 * @param [in] value Interned string.
+		 * @return Hash of the characters.
+		 */
+		inline uint64_t operator()(const interned_string &value) const noexcept;
+		/**
+		 * Hash some characters the same as an interned string holding them,
+		 * so interned strings can be looked up by view.
+		 * @param [in] value View to hash.
+		 * @return Hash of the characters.
+		 */
+		inline uint64_t operator()(const string_view &value) const noexcept;
+	};
+
+	/**
+	 * Interned strings compare by pointer, and by characters when looked up
+	 * by view.
+	 */
+	template<>
+	struct hash_equal<interned_string> {
+		/**
+		 * Compare a stored key with a looked up one.
+		 * @param [in] key Stored key.
+		 * @param [in] lookup Looked up key.
+		 * @return True if both view the same string, false otherwise.
+		 */
+		inline bool_t operator()(const interned_string &key,
+		                         const interned_string &lookup) const noexcept;
+		/**
+		 * Compare a stored key with looked up characters.
+		 * @param [in] key Stored key.
+		 * @param [in] lookup Looked up characters.
+		 * @return True if both have the same characters, false otherwise.
+		 */
+		inline bool_t operator()(const interned_string &key,
+		                         const string_view &lookup) const noexcept;
+	};
+
+
+	/**
+	 * Pool storing each distinct string once. Characters are copied into an
+	 * arena, so interned strings never move and live until the pool is
+	 * cleared or destroyed. Not thread safe, see concurrent_intern_pool.
+	 */
+	class intern_pool {
+
+		arena memory;   ///< Storage of the entries.
+		array<interned_string> strings;   ///< Interned strings by handle.
+		hash_set<interned_string> lookup;   ///< Interned strings by text.
+
+	public:
+		/**
+		 * Create an empty pool. No memory is allocated until first used.
+		 * @param [in] block_length Minimum size in bytes of every block of
+		 * the arena holding the characters. Default = 64 KiB.
+		 */
+		explicit intern_pool(size_t block_length = 65536ul) noexcept;
+		intern_pool(const intern_pool &) = delete;
+
+
+		/**
+		 * Get the number of interned strings.
+		 * @return Number of interned strings.
+		 */
+		size_t size() const noexcept;
+		/**
+		 * Get the memory reserved for the characters.
+		 * @return Bytes reserved by the arena.
+		 */
+		size_t reserved_bytes() const noexcept;
+
+
+		/**
+		 * Intern a string, storing it if it is not in the pool yet.
+		 * @param [in] text Characters of the string.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @throw out_of_range_error when every handle is taken.
+		 * @return View of the stored string.
+		 */
+		interned_string intern(const string_view &text);
+		/**
+		 * Look for a string without storing it.
+		 * @param [in] text Characters of the string.
+		 * @return View of the stored string, a null view if it is not in the
+		 * pool.
+		 */
+		interned_string find(const string_view &text) const noexcept;
+		/**
+		 * Get an interned string by its handle.
+		 * @param [in] handle Handle of the string.
+		 * @throw out_of_range_error when no string has the handle.
+		 * @return View of the stored string.
+		 */
+		interned_string get(intern_handle handle) const;
+
+		/**
+		 * Forget every string, invalidating the views and handles given so
+		 * far. The memory of the arena is kept for the next strings.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Self instance.
+		 */
+		intern_pool &clear();
+
+
+		intern_pool &operator=(const intern_pool &) = delete;
+	};
+
+
+	/// Handles of the first block of a concurrent_intern_pool, every other
+	/// block has twice as many as the one before.
+	static const size_t intern_block_handles = 256ul;
+	/// Blocks of a concurrent_intern_pool, enough for every handle.
+	static const size_t intern_blocks = 25ul;
+
+
+	/**
+	 * Pool storing each distinct string once, shared by many threads.
+	 * Looking up strings already interned takes no lock, through a
+	 * concurrent_hash_map, and handles are resolved from blocks that never
+	 * move. Only storing a new string takes the lock of the pool.
+	 */
+	class concurrent_intern_pool {
+
+		arena memory;   ///< Storage of the entries.
+		mutex writer;   ///< Lock of the threads storing new strings.
+
+		/// Interned strings by handle, in blocks allocated as needed.
+		atomic<const interned_entry **> blocks[intern_blocks];
+		atomic<size_t> count;   ///< Number of interned strings.
+
+		/// Interned strings by text.
+		concurrent_hash_map<string_view, interned_string> lookup;
+
+	public:
+		/**
+		 * Create an empty pool.
+		 * @param [in] block_length Minimum size in bytes of every block of
+		 * the arena holding the characters. Default = 64 KiB.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		explicit concurrent_intern_pool(size_t block_length = 65536ul);
+		concurrent_intern_pool(const concurrent_intern_pool &) = delete;
+
+		/**
+		 * Release every string. No thread may be using the pool anymore.
+		 */
+		~concurrent_intern_pool() noexcept;
+
+
+		/**
+		 * Get the number of interned strings.
+		 * @return Number of interned strings.
+		 */
+		size_t size() const noexcept;
+
+
+		/**
+		 * Intern a string, storing it if it is not in the pool yet.
+		 * @param [in] text Characters of the string.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @throw out_of_range_error when every handle is taken.
+		 * @return View of the stored string.
+		 */
+		interned_string intern(const string_view &text);
+		/**
+		 * Look for a string without storing it.
+		 * @param [in] text Characters of the string.
+		 * @return View of the stored string, a null view if it is not in the
+		 * pool.
+		 */
+		interned_string find(const string_view &text) const;
+		/**
+		 * Get an interned string by its handle.
+		 * @param [in] handle Handle of the string.
+		 * @throw out_of_range_error when no string has the handle.
+		 * @return View of the stored string.
+		 */
+		interned_string get(intern_handle handle) const;
+
+
+		concurrent_intern_pool &
+		operator=(const concurrent_intern_pool &) = delete;
+	};
+
+
+	/**
+	 * An interned string only holds a pointer, copying its bytes relocates
+	 * it.
+	 */
+	template<>
+	struct is_trivially_relocatable<interned_string> {
+		/// Interned strings are trivially relocatable.
+		static constexpr bool_t value = true;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_string_intern_pool_impl_
+#	include "../string/intern_pool_impl.tpp"
+#	undef _stick_lib_string_intern_pool_impl_
+
+
+#endif   //_stick_lib_string_intern_pool_
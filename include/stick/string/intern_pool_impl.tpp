@@ -0,0 +1,83 @@
+/**
+ * String interning pools. Inline implementations.
+ * @brief String interning pool inline implementations.
+ * @file intern_pool_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_string_intern_pool_impl_)
+
+
+
+namespace stick {
+
+
+	inline const_cstring interned_string::begin() const noexcept {
+		return this->data();
+	}
+	inline const_cstring interned_string::end() const noexcept {
+		return this->data() + this->length();
+	}
+
+	inline const_cstring interned_string::data() const noexcept {
+		return this->entry == nullptr
+		           ? nullptr
+		           : reinterpret_cast<const_cstring>(this->entry + 1);
+	}
+	inline size_t interned_string::length() const noexcept {
+		return this->entry == nullptr ? 0ul : this->entry->length;
+	}
+	inline bool_t interned_string::empty() const noexcept {
+		return this->length() == 0ul;
+	}
+	inline bool_t interned_string::is_null() const noexcept {
+		return this->entry == nullptr;
+	}
+
+	inline intern_handle interned_string::handle() const noexcept {
+		return this->entry->handle;
+	}
+	inline uint64_t interned_string::hash() const noexcept {
+		return this->entry->hash;
+	}
+
+
+	inline bool_t
+	interned_string::operator==(const interned_string &str) const noexcept {
+		return this->entry == str.entry;
+	}
+	inline bool_t
+	interned_string::operator!=(const interned_string &str) const noexcept {
+		return this->entry != str.entry;
+	}
+
+	inline interned_string::operator string_view() const noexcept {
+		return { this->data(), this->length() };
+	}
+
+
+	inline uint64_t hasher<interned_string>::operator()(
+	    const interned_string &value) const noexcept {
+		return value.hash();
+	}
+	inline uint64_t hasher<interned_string>::operator()(
+	    const string_view &value) const noexcept {
+		return hasher<string_view>()(value);
+	}
+
+	inline bool_t hash_equal<interned_string>::operator()(
+	    const interned_string &key,
+	    const interned_string &lookup) const noexcept {
+		return key == lookup;
+	}
+	inline bool_t hash_equal<interned_string>::operator()(
+	    const interned_string &key, const string_view &lookup) const noexcept {
+		return static_cast<string_view>(key) == lookup;
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_string_intern_pool_impl_
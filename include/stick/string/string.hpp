@@ -11,20 +11,42 @@
 
 #	include "../data_structures/array.tpp"
 #	include "../defines/types.hpp"
-#	include "../memory/scoped_pointer.tpp"
+#	include "../memory/shared_buffer.tpp"
+#	include "../templates/traits.tpp"
 
 
 namespace stick {
 
 
+	class thread_pool;
+
+
 	/**
-	 * String class to easily manage char arrays.
+	 * String class to easily manage char arrays. Shareable strings share
+	 * their characters with their copies, each one copying them before its
+	 * first write.
 	 */
 	class string {
 
-		scoped_pointer<char_t> data;
+		shared_buffer<char_t> data;
 		size_t data_size = 0ul;
 		size_t pool = 0ul;
+		bool_t shareable = false;   ///< Whether copies share the characters.
+		/// Whether a writable pointer to the characters was handed out.
+		bool_t leaked = false;
+
+
+		/**
+		 * Copy the characters if other strings share them, before writing.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		void_t own();
+		/**
+		 * Copy the characters if other strings share them and keep copies
+		 * from sharing them, before handing out a writable pointer.
+		 * @throw memory_error when memory cannot be allocated.
+		 */
+		void_t leak();
 
 	public:
 		/**
@@ -65,10 +87,10 @@ namespace stick {
 		 */
 		explicit string(size_t length, size_t pool_length = 0ul) noexcept;
 		/**
-		 * Copy constructor.
+		 * Copy constructor. Shares the characters if the string is shareable.
 		 * @param [in] str String to copy from.
 		 */
-		string(const string &str) noexcept = default;
+		string(const string &str) noexcept;
 		/**
 		 * Move constructor.
 		 * @param [in,out] str String to move from and clear.
@@ -85,23 +107,53 @@ namespace stick {
 		 * Begin iterator.
 		 * @return Pointer to the first element.
 		 */
-		char_t *begin() const noexcept;
+		const_cstring begin() const noexcept;
+		/**
+		 * Begin iterator, copying the characters first if they are shared.
+		 * Copies stop sharing them while the pointer may be written through.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Pointer to the first element.
+		 */
+		cstring begin();
 		/**
 		 * End iterator.
 		 * @return Pointer to one element after the last.
 		 */
-		char_t *end() const noexcept;
+		const_cstring end() const noexcept;
+		/**
+		 * End iterator, copying the characters first if they are shared.
+		 * Copies stop sharing them while the pointer may be written through.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Pointer to one element after the last.
+		 */
+		cstring end();
 
 		/**
 		 * Reverse begin iterator.
 		 * @return Pointer to the last element.
 		 */
-		char_t *rbegin() const noexcept;
+		const_cstring rbegin() const noexcept;
+		/**
+		 * Reverse begin iterator, copying the characters first if they are
+		 * shared. Copies stop sharing them while the pointer may be written
+		 * through.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Pointer to the last element.
+		 */
+		cstring rbegin();
 		/**
 		 * Reverse end iterator.
 		 * @return Pointer to one element before the first.
 		 */
-		char_t *rend() const noexcept;
+		const_cstring rend() const noexcept;
+		/**
+		 * Reverse end iterator, copying the characters first if they are
+		 * shared. Copies stop sharing them while the pointer may be written
+		 * through.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Pointer to one element before the first.
+		 */
+		cstring rend();
 
 
 		/**
@@ -136,6 +188,21 @@ namespace stick {
 		 */
 		string &set_pool(size_t length) noexcept;
 
+		/**
+		 * Make copies of this string share its characters instead of copying
+		 * them. Every string sharing the characters copies them before its
+		 * first write, so copies that are only read never allocate. Once a
+		 * writable pointer is taken, copies get their own characters again
+		 * until the string allocates new ones.
+		 * @return Self instance.
+		 */
+		string &share() noexcept;
+		/**
+		 * Check if copies of this string share its characters.
+		 * @return True if copies share the characters, false otherwise.
+		 */
+		bool_t is_shareable() const noexcept;
+
 
 		/**
 		 * Expand the string a specific number of characters.
@@ -355,6 +422,75 @@ namespace stick {
 		array<size_t> find(const string &pattern, size_t max_matches = -1ul,
 		                   bool_t wide_dict = true,
 		                   size_t alphabet_size = 256ul) const noexcept;
+		/**
+		 * Find where the pattern appears in the string using the threads of a
+		 * pool. The string is split in chunks searched like find, each one
+		 * overlapping the next by the pattern length - 1 so no match is lost
+		 * nor repeated. Chunks are taken in order, and once the leading ones
+		 * hold max_matches matches the rest are skipped.
+		 * @param [in] pattern Pattern to look for.
+		 * @param [in] pattern_length Length of string to look for.
+		 * @param [in] max_matches Max number of matches to look for.
+		 * @param [in] wide_dict If characters pool is varied.
+		 * @param [in] alphabet_size Max ASCII code of possible characters.
+		 * @param [in] pool Pool to search in.
+		 * @throw memory_error when text or pattern is nullptr.
+		 * @throw generic_error when a chunk could not be searched.
+		 * @return Array of the positions where the match was found, in order.
+		 */
+		array<size_t> find_parallel(const_cstring pattern,
+		                            size_t pattern_length, size_t max_matches,
+		                            bool_t wide_dict, size_t alphabet_size,
+		                            thread_pool &pool) const;
+		/**
+		 * Find where the pattern appears in the string using the threads of
+		 * the shared pool, like find_parallel with a pool.
+		 * @param [in] pattern Pattern to look for.
+		 * @param [in] pattern_length Length of string to look for.
+		 * @param [in] max_matches Max number of matches to look for.
+		 * Default = no limit.
+		 * @param [in] wide_dict If characters pool is varied. Default = true.
+		 * @param [in] alphabet_size Max ASCII code of possible characters.
+		 * Default = 256 for full ASCII.
+		 * @throw memory_error when text or pattern is nullptr.
+		 * @throw generic_error when a chunk could not be searched.
+		 * @return Array of the positions where the match was found, in order.
+		 */
+		array<size_t> find_parallel(const_cstring pattern,
+		                            size_t pattern_length,
+		                            size_t max_matches = -1ul,
+		                            bool_t wide_dict = true,
+		                            size_t alphabet_size = 256ul) const;
+		/**
+		 * Find where the pattern appears in the string using the threads of a
+		 * pool, like find_parallel with a pattern length.
+		 * @param [in] pattern Pattern to look for.
+		 * @param [in] max_matches Max number of matches to look for.
+		 * @param [in] wide_dict If characters pool is varied.
+		 * @param [in] alphabet_size Max ASCII code of possible characters.
+		 * @param [in] pool Pool to search in.
+		 * @throw generic_error when a chunk could not be searched.
+		 * @return Array of the positions where the match was found, in order.
+		 */
+		array<size_t> find_parallel(const string &pattern, size_t max_matches,
+		                            bool_t wide_dict, size_t alphabet_size,
+		                            thread_pool &pool) const;
+		/**
+		 * Find where the pattern appears in the string using the threads of
+		 * the shared pool, like find_parallel with a pattern length.
+		 * @param [in] pattern Pattern to look for.
+		 * @param [in] max_matches Max number of matches to look for.
+		 * Default = no limit.
+		 * @param [in] wide_dict If characters pool is varied. Default = true.
+		 * @param [in] alphabet_size Max ASCII code of possible characters.
+		 * Default = 256 for full ASCII.
+		 * @throw generic_error when a chunk could not be searched.
+		 * @return Array of the positions where the match was found, in order.
+		 */
+		array<size_t> find_parallel(const string &pattern,
+		                            size_t max_matches = -1ul,
+		                            bool_t wide_dict = true,
+		                            size_t alphabet_size = 256ul) const;
 
 
 		/**
@@ -403,6 +539,32 @@ namespace stick {
 		                size_t alphabet_size = 256ul) noexcept;
 
 
+		/**
+		 * Order this string against another by the code of their first
+		 * different character, a string going before the ones it is a prefix
+		 * of.
+		 * @param [in] str String to compare with.
+		 * @return Negative if this string goes before the other, positive if it
+		 * goes after and 0 if they are equal.
+		 */
+		int32_t compare(const string &str) const noexcept;
+		/**
+		 * Check if this string is equal to another ignoring the case of ASCII
+		 * letters.
+		 * @param [in] str String to compare with.
+		 * @return True if the strings only differ in case, false otherwise.
+		 */
+		bool_t equal_ignore_case(const string &str) const noexcept;
+		/**
+		 * Order this string against another as compare() does, with ASCII
+		 * letters in lower case.
+		 * @param [in] str String to compare with.
+		 * @return Negative if this string goes before the other, positive if it
+		 * goes after and 0 if they only differ in case.
+		 */
+		int32_t compare_ignore_case(const string &str) const noexcept;
+
+
 		/**
 		 * Create a new copy of this string and append other string to it.
 		 * @param [in] str String to append.
@@ -438,11 +600,12 @@ namespace stick {
 		 */
 		string &operator=(const_cstring str) noexcept;
 		/**
-		 * Copy content from other string.
+		 * Copy content from other string. Shares the characters if the string
+		 * is shareable.
 		 * @param [in] str String to copy from.
 		 * @return Self instance.
 		 */
-		string &operator=(const string &str) noexcept = default;
+		string &operator=(const string &str) noexcept;
 		/**
 		 * Move content from other string.
 		 * @param [in,out] str String to move from and clear.
@@ -464,14 +627,61 @@ namespace stick {
 		 */
 		bool_t operator!=(const string &str) const noexcept;
 
+		/**
+		 * Check if this string goes before another, see compare().
+		 * @param [in] str String to compare with.
+		 * @return True if this string goes before the other, false otherwise.
+		 */
+		bool_t operator<(const string &str) const noexcept;
+		/**
+		 * Check if this string goes before another or is equal to it.
+		 * @param [in] str String to compare with.
+		 * @return True if this string does not go after the other, false
+		 * otherwise.
+		 */
+		bool_t operator<=(const string &str) const noexcept;
+		/**
+		 * Check if this string goes after another, see compare().
+		 * @param [in] str String to compare with.
+		 * @return True if this string goes after the other, false otherwise.
+		 */
+		bool_t operator>(const string &str) const noexcept;
+		/**
+		 * Check if this string goes after another or is equal to it.
+		 * @param [in] str String to compare with.
+		 * @return True if this string does not go before the other, false
+		 * otherwise.
+		 */
+		bool_t operator>=(const string &str) const noexcept;
+
 		/**
 		 * Convert to a null-terminated string.
 		 * @return Simple c-style string.
 		 */
-		operator cstring() const noexcept;
+		operator const_cstring() const noexcept;
+		/**
+		 * Convert to a writable null-terminated string, copying the
+		 * characters first if they are shared. Copies stop sharing them while
+		 * the pointer may be written through.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Simple c-style string.
+		 */
+		operator cstring();
 	};
 
 
+	/**
+	 * The characters of a string live on the heap, so it relocates as raw
+	 * memory.
+	 */
+	template<>
+	struct is_trivially_relocatable<string> {
+		/// Strings are trivially relocatable.
+		static constexpr bool_t value = true;
+	};
+
+
+
 }   // namespace stick
 
 
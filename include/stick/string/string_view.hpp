@@ -0,0 +1,181 @@
+/**
+ * Non-owning view over a sequence of characters.
+ * @brief String view class.
+ * @file string_view.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_string_string_view_)
+#	define _stick_lib_string_string_view_
+
+
+
+#	include "../defines/types.hpp"
+
+
+namespace stick {
+
+
+	class string;
+
+
+	/**
+	 * Read-only view of characters owned by someone else. The viewed memory
+	 * must outlive the view and is not required to be null-terminated.
+	 */
+	class string_view {
+
+		const_cstring str = nullptr;   ///< Pointer to the first viewed char.
+		size_t str_length = 0ul;   ///< Number of viewed chars.
+
+	public:
+		/**
+		 * Constructor for an empty view.
+		 */
+		string_view() noexcept = default;
+		/**
+		 * Create a view of the given characters.
+		 * @param [in] str Pointer to the first char to view.
+		 * @param [in] length Number of chars to view.
+		 */
+		string_view(const_cstring str, size_t length) noexcept;
+		/**
+		 * Create a view of a null-terminated string.
+		 * @param [in] str Null-terminated string to view.
+		 * @throw memory_error when viewing a nullptr.
+		 */
+		string_view(const_cstring str);
+		/**
+		 * Create a view of a string content.
+		 * @param [in] str String to view.
+		 */
+		string_view(const string &str) noexcept;
+
+
+		/**
+		 * Begin iterator.
+		 * @return Pointer to the first char.
+		 */
+		const_cstring begin() const noexcept;
+		/**
+		 * End iterator.
+		 * @return Pointer to one char after the last.
+		 */
+		const_cstring end() const noexcept;
+
+
+		/**
+		 * Pointer to the viewed characters.
+		 * @return Pointer to the first char. Not null-terminated.
+		 */
+		const_cstring data() const noexcept;
+		/**
+		 * Get the number of viewed characters.
+		 * @return Length of the view.
+		 */
+		size_t length() const noexcept;
+		/**
+		 * Check if the view is empty.
+		 * @return True if there are no chars in the view, false otherwise.
+		 */
+		bool_t empty() const noexcept;
+
+
+		/**
+		 * Create a view over a portion of this one.
+		 * @param [in] start_position Position where the new view starts.
+		 * @param [in] max_length Max length of the new view. Default =
+		 * remaining length of this view.
+		 * @throw out_of_range_error when start_position is outside the view.
+		 * @return New view.
+		 */
+		string_view substr(size_t start_position,
+		                   size_t max_length = -1ul) const;
+
+
+		/**
+		 * Order this view against another by the code of their first
+		 * different character, a view going before the ones it is a prefix
+		 * of.
+		 * @param [in] str View to compare with.
+		 * @return Negative if this view goes before the other, positive if it
+		 * goes after and 0 if they are equal.
+		 */
+		int32_t compare(const string_view &str) const noexcept;
+		/**
+		 * Check if this view is equal to another ignoring the case of ASCII
+		 * letters.
+		 * @param [in] str View to compare with.
+		 * @return True if the views only differ in case, false otherwise.
+		 */
+		bool_t equal_ignore_case(const string_view &str) const noexcept;
+		/**
+		 * Order this view against another as compare() does, with ASCII
+		 * letters in lower case.
+		 * @param [in] str View to compare with.
+		 * @return Negative if this view goes before the other, positive if it
+		 * goes after and 0 if they only differ in case.
+		 */
+		int32_t compare_ignore_case(const string_view &str) const noexcept;
+
+
+		/**
+		 * Get the char at a given position.
+		 * @param [in] position Position of the char.
+		 * @throw out_of_range_error when accessing outside the view.
+		 * @return Char at the given position.
+		 */
+		char_t operator[](size_t position) const;
+
+		/**
+		 * Check if this view content is equal to another.
+		 * @param [in] str View to compare with.
+		 * @return True if the contents are equal, false otherwise.
+		 */
+		bool_t operator==(const string_view &str) const noexcept;
+		/**
+		 * Check if this view content is different to another.
+		 * @param [in] str View to compare with.
+		 * @return True if the contents are different, false otherwise.
+		 */
+		bool_t operator!=(const string_view &str) const noexcept;
+
+		/**
+		 * Check if this view goes before another, see compare().
+		 * @param [in] str View to compare with.
+		 * @return True if this view goes before the other, false otherwise.
+		 */
+		bool_t operator<(const string_view &str) const noexcept;
+		/**
+		 * Check if this view goes before another or is equal to it.
+		 * @param [in] str View to compare with.
+		 * @return True if this view does not go after the other, false
+		 * otherwise.
+		 */
+		bool_t operator<=(const string_view &str) const noexcept;
+		/**
+		 * Check if this view goes after another, see compare().
+		 * @param [in] str View to compare with.
+		 * @return True if this view goes after the other, false otherwise.
+		 */
+		bool_t operator>(const string_view &str) const noexcept;
+		/**
+		 * Check if this view goes after another or is equal to it.
+		 * @param [in] str View to compare with.
+		 * @return True if this view does not go before the other, false
+		 * otherwise.
+		 */
+		bool_t operator>=(const string_view &str) const noexcept;
+
+		/**
+		 * Copy the viewed characters into a new string.
+		 * @return New string with the same content.
+		 */
+		operator string() const noexcept;
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_string_string_view_
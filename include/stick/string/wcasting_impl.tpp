@@ -14,7 +14,7 @@ namespace stick {
 
 
 	template<>
-	const_wcstring cast_to_wcstr(nullptr_t value, wcstring string) {
+	inline const_wcstring cast_to_wcstr(nullptr_t value, wcstring string) {
 		if (string == nullptr)
 			return new_wstr(L"null", 4);
 		else
@@ -23,7 +23,7 @@ namespace stick {
 
 
 	template<>
-	const_wcstring cast_to_wcstr(bool_t value, wcstring string) {
+	inline const_wcstring cast_to_wcstr(bool_t value, wcstring string) {
 		if (value) {
 			if (string == nullptr)
 				return new_wstr(L"true", 4);
@@ -39,7 +39,7 @@ namespace stick {
 
 
 	template<>
-	const_wcstring cast_to_wcstr(int8_t value, wcstring string) {
+	inline const_wcstring cast_to_wcstr(int8_t value, wcstring string) {
 		bool_t is_negative = value < 0;
 		if (is_negative)
 			value = -value;
@@ -64,7 +64,7 @@ namespace stick {
 	}
 
 	template<>
-	const_wcstring cast_to_wcstr(int16_t value, wcstring string) {
+	inline const_wcstring cast_to_wcstr(int16_t value, wcstring string) {
 		bool_t is_negative = value < 0;
 		if (is_negative)
 			value = -value;
@@ -89,7 +89,7 @@ namespace stick {
 	}
 
 	template<>
-	const_wcstring cast_to_wcstr(int32_t value, wcstring string) {
+	inline const_wcstring cast_to_wcstr(int32_t value, wcstring string) {
 		bool_t is_negative = value < 0;
 		if (is_negative)
 			value = -value;
@@ -114,7 +114,7 @@ namespace stick {
 	}
 
 	template<>
-	const_wcstring cast_to_wcstr(int64_t value, wcstring string) {
+	inline const_wcstring cast_to_wcstr(int64_t value, wcstring string) {
 		bool_t is_negative = value < 0;
 		if (is_negative)
 			value = -value;
@@ -140,7 +140,7 @@ namespace stick {
 
 
 	template<>
-	const_wcstring cast_to_wcstr(uint8_t value, wcstring string) {
+	inline const_wcstring cast_to_wcstr(uint8_t value, wcstring string) {
 		size_t length = 1ul;
 		for (uint8_t i = 1u; value / i >= 10u; i *= 10u)
 			length++;
@@ -157,7 +157,7 @@ namespace stick {
 	}
 
 	template<>
-	const_wcstring cast_to_wcstr(uint16_t value, wcstring string) {
+	inline const_wcstring cast_to_wcstr(uint16_t value, wcstring string) {
 		size_t length = 1ul;
 		for (uint16_t i = 1u; value / i >= 10u; i *= 10u)
 			length++;
@@ -174,7 +174,7 @@ namespace stick {
 	}
 
 	template<>
-	const_wcstring cast_to_wcstr(uint32_t value, wcstring string) {
+	inline const_wcstring cast_to_wcstr(uint32_t value, wcstring string) {
 		size_t length = 1ul;
 		for (uint32_t i = 1u; value / i >= 10u; i *= 10u)
 			length++;
@@ -191,7 +191,7 @@ namespace stick {
 	}
 
 	template<>
-	const_wcstring cast_to_wcstr(uint64_t value, wcstring string) {
+	inline const_wcstring cast_to_wcstr(uint64_t value, wcstring string) {
 		size_t length = 1ul;
 		for (uint64_t i = 1u; value / i >= 10u; i *= 10u)
 			length++;
@@ -213,7 +213,7 @@ namespace stick {
 	//       bit-level algebra is not implemented.
 
 	template<>
-	const_wcstring cast_to_wcstr(float32_t value, wcstring string) {
+	inline const_wcstring cast_to_wcstr(float32_t value, wcstring string) {
 		auto integer_part = static_cast<int64_t>(value);
 		auto decimal_part = (value - integer_part) * 10;
 
@@ -241,7 +241,7 @@ namespace stick {
 	}
 
 	template<>
-	const_wcstring cast_to_wcstr(double64_t value, wcstring string) {
+	inline const_wcstring cast_to_wcstr(double64_t value, wcstring string) {
 		auto integer_part = static_cast<int64_t>(value);
 		auto decimal_part = (value - integer_part) * 10;
 
@@ -268,7 +268,7 @@ namespace stick {
 		return string;
 	}
 	template<>
-	const_wcstring cast_to_wcstr(double128_t value, wcstring string) {
+	inline const_wcstring cast_to_wcstr(double128_t value, wcstring string) {
 		auto integer_part = static_cast<int64_t>(value);
 		auto decimal_part = (value - integer_part) * 10;
 
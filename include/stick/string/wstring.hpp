@@ -12,6 +12,7 @@
 #	include "../data_structures/array.tpp"
 #	include "../defines/types.hpp"
 #	include "../memory/scoped_pointer.tpp"
+#	include "../templates/traits.tpp"
 
 
 namespace stick {
@@ -403,6 +404,32 @@ namespace stick {
 		                 size_t alphabet_size = 256ul) noexcept;
 
 
+		/**
+		 * Order this string against another by the code of their first
+		 * different character, a string going before the ones it is a prefix
+		 * of.
+		 * @param [in] str String to compare with.
+		 * @return Negative if this string goes before the other, positive if it
+		 * goes after and 0 if they are equal.
+		 */
+		int32_t compare(const wstring &str) const noexcept;
+		/**
+		 * Check if this string is equal to another ignoring the case of ASCII
+		 * letters.
+		 * @param [in] str String to compare with.
+		 * @return True if the strings only differ in case, false otherwise.
+		 */
+		bool_t equal_ignore_case(const wstring &str) const noexcept;
+		/**
+		 * Order this string against another as compare() does, with ASCII
+		 * letters in lower case.
+		 * @param [in] str String to compare with.
+		 * @return Negative if this string goes before the other, positive if it
+		 * goes after and 0 if they only differ in case.
+		 */
+		int32_t compare_ignore_case(const wstring &str) const noexcept;
+
+
 		/**
 		 * Create a new copy of this string and append other string to it.
 		 * @param [in] str String to append.
@@ -464,6 +491,33 @@ namespace stick {
 		 */
 		bool_t operator!=(const wstring &str) const noexcept;
 
+		/**
+		 * Check if this string goes before another, see compare().
+		 * @param [in] str String to compare with.
+		 * @return True if this string goes before the other, false otherwise.
+		 */
+		bool_t operator<(const wstring &str) const noexcept;
+		/**
+		 * Check if this string goes before another or is equal to it.
+		 * @param [in] str String to compare with.
+		 * @return True if this string does not go after the other, false
+		 * otherwise.
+		 */
+		bool_t operator<=(const wstring &str) const noexcept;
+		/**
+		 * Check if this string goes after another, see compare().
+		 * @param [in] str String to compare with.
+		 * @return True if this string goes after the other, false otherwise.
+		 */
+		bool_t operator>(const wstring &str) const noexcept;
+		/**
+		 * Check if this string goes after another or is equal to it.
+		 * @param [in] str String to compare with.
+		 * @return True if this string does not go before the other, false
+		 * otherwise.
+		 */
+		bool_t operator>=(const wstring &str) const noexcept;
+
 		/**
 		 * Convert to a null-terminated string.
 		 * @return Simple c-style string.
@@ -472,6 +526,18 @@ namespace stick {
 	};
 
 
+	/**
+	 * The characters of a wstring live on the heap, so it relocates as raw
+	 * memory.
+	 */
+	template<>
+	struct is_trivially_relocatable<wstring> {
+		/// Strings are trivially relocatable.
+		static constexpr bool_t value = true;
+	};
+
+
+
 }   // namespace stick
 
 
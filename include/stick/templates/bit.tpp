@@ -0,0 +1,133 @@
+/**
+ * Bit manipulation templates.
+ * @brief Bit manipulation templates.
+ * @file bit.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_templates_bit_)
+#	define _stick_lib_templates_bit_
+
+
+
+#	include "../defines/types.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Count the number of zero bits after the least significant set bit.
+	 * @tparam type Unsigned integer type of the value.
+	 * @param [in] value Value to inspect. Must not be 0.
+	 * @return Number of trailing zero bits.
+	 */
+	template<typename type>
+	inline size_t count_trailing_zeros(type value) noexcept;
+
+	/**
+	 * Count the number of zero bits before the most significant set bit.
+	 * @tparam type Unsigned integer type of the value.
+	 * @param [in] value Value to inspect. Must not be 0.
+	 * @return Number of leading zero bits.
+	 */
+	template<typename type>
+	inline size_t count_leading_zeros(type value) noexcept;
+
+	/**
+	 * Count the number of set bits.
+	 * @tparam type Unsigned integer type of the value.
+	 * @param [in] value Value to inspect.
+	 * @return Number of bits set to 1.
+	 */
+	template<typename type>
+	inline size_t pop_count(type value) noexcept;
+
+
+	/**
+	 * Rotate the bits of a value to the left.
+	 * @tparam type Unsigned integer type of the value.
+	 * @param [in] value Value to rotate.
+	 * @param [in] shift Number of bits to rotate.
+	 * @return Rotated value.
+	 */
+	template<typename type>
+	inline constexpr type rotate_left(type value, size_t shift) noexcept;
+
+	/**
+	 * Rotate the bits of a value to the right.
+	 * @tparam type Unsigned integer type of the value.
+	 * @param [in] value Value to rotate.
+	 * @param [in] shift Number of bits to rotate.
+	 * @return Rotated value.
+	 */
+	template<typename type>
+	inline constexpr type rotate_right(type value, size_t shift) noexcept;
+
+
+	/**
+	 * Reverse the byte order of a value.
+	 * @tparam type Unsigned integer type of the value.
+	 * @param [in] value Value to swap.
+	 * @return Value with its bytes in reverse order.
+	 */
+	template<typename type>
+	inline type byte_swap(type value) noexcept;
+
+
+	/**
+	 * Read an unaligned little endian value from memory.
+	 * @tparam type Unsigned integer type to read.
+	 * @param [in] address Pointer to the first byte of the value.
+	 * @return Value read in native byte order.
+	 */
+	template<typename type>
+	inline type load_little_endian(const void_t *address) noexcept;
+
+	/**
+	 * Read an unaligned big endian value from memory.
+	 * @tparam type Unsigned integer type to read.
+	 * @param [in] address Pointer to the first byte of the value.
+	 * @return Value read in native byte order.
+	 */
+	template<typename type>
+	inline type load_big_endian(const void_t *address) noexcept;
+
+	/**
+	 * Write a value to unaligned memory as little endian.
+	 * @tparam type Unsigned integer type to write.
+	 * @param [in] address Pointer to the first byte to write.
+	 * @param [in] value Value to write.
+	 */
+	template<typename type>
+	inline void_t store_little_endian(void_t *address, type value) noexcept;
+
+	/**
+	 * Write a value to unaligned memory as big endian.
+	 * @tparam type Unsigned integer type to write.
+	 * @param [in] address Pointer to the first byte to write.
+	 * @param [in] value Value to write.
+	 */
+	template<typename type>
+	inline void_t store_big_endian(void_t *address, type value) noexcept;
+
+
+	/**
+	 * Multiply two 64 bits values keeping the whole 128 bits product.
+	 * @param [in] left First factor.
+	 * @param [in] right Second factor.
+	 * @param [out] high Upper 64 bits of the product.
+	 * @return Lower 64 bits of the product.
+	 */
+	inline uint64_t multiply_extended(uint64_t left, uint64_t right,
+	                                  uint64_t &high) noexcept;
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_templates_bit_impl_
+#	include "../templates/bit_impl.tpp"
+#	undef _stick_lib_templates_bit_impl_
+
+
+#endif   //_stick_lib_templates_bit_
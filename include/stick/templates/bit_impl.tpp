@@ -0,0 +1,239 @@
+/**
+ * Bit manipulation templates. Template implementations.
+ * @brief Bit manipulation template implementations.
+ * @file bit_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_templates_bit_impl_)
+
+
+#	include "../defines/compiler.hpp"
+#	include "../defines/endian.hpp"
+
+#	if stick_IS_COMPILER_MSVC
+#		include <intrin.h>
+#	endif
+
+
+namespace stick {
+
+
+	template<typename type>
+	inline size_t count_trailing_zeros(type value) noexcept {
+#	if stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG
+		if (sizeof(type) <= sizeof(uint_t))
+			return static_cast<size_t>(
+			    __builtin_ctz(static_cast<uint_t>(value)));
+		else
+			return static_cast<size_t>(
+			    __builtin_ctzll(static_cast<ullong_t>(value)));
+
+#	elif stick_IS_COMPILER_MSVC && defined(_M_X64)
+		unsigned long index;
+		_BitScanForward64(&index, static_cast<ullong_t>(value));
+
+		return static_cast<size_t>(index);
+
+#	else
+		size_t zeros = 0ul;
+		for (; (value & type(1)) == type(0); value >>= 1)
+			zeros++;
+
+		return zeros;
+#	endif
+	}
+
+	template<typename type>
+	inline size_t count_leading_zeros(type value) noexcept {
+#	if stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG
+		if (sizeof(type) <= sizeof(uint_t))
+			return static_cast<size_t>(
+			           __builtin_clz(static_cast<uint_t>(value)))
+			       - (sizeof(uint_t) - sizeof(type)) * 8ul;
+		else
+			return static_cast<size_t>(
+			    __builtin_clzll(static_cast<ullong_t>(value)));
+
+#	elif stick_IS_COMPILER_MSVC && defined(_M_X64)
+		unsigned long index;
+		_BitScanReverse64(&index, static_cast<ullong_t>(value));
+
+		return 63ul - static_cast<size_t>(index) - (8ul - sizeof(type)) * 8ul;
+
+#	else
+		size_t zeros = 0ul;
+		for (type mask = type(1) << (sizeof(type) * 8ul - 1ul);
+		     (value & mask) == type(0); mask >>= 1)
+			zeros++;
+
+		return zeros;
+#	endif
+	}
+
+	template<typename type>
+	inline size_t pop_count(type value) noexcept {
+#	if stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG
+		if (sizeof(type) <= sizeof(uint_t))
+			return static_cast<size_t>(
+			    __builtin_popcount(static_cast<uint_t>(value)));
+		else
+			return static_cast<size_t>(
+			    __builtin_popcountll(static_cast<ullong_t>(value)));
+
+#	else
+		size_t bits = 0ul;
+		for (; value != type(0); value &= value - type(1))
+			bits++;
+
+		return bits;
+#	endif
+	}
+
+
+	template<typename type>
+	inline constexpr type rotate_left(type value, size_t shift) noexcept {
+		return static_cast<type>(
+		    (value << (shift & (sizeof(type) * 8ul - 1ul)))
+		    | (value >> ((sizeof(type) * 8ul - shift)
+		                 & (sizeof(type) * 8ul - 1ul))));
+	}
+
+	template<typename type>
+	inline constexpr type rotate_right(type value, size_t shift) noexcept {
+		return static_cast<type>(
+		    (value >> (shift & (sizeof(type) * 8ul - 1ul)))
+		    | (value << ((sizeof(type) * 8ul - shift)
+		                 & (sizeof(type) * 8ul - 1ul))));
+	}
+
+
+	template<typename type>
+	inline type byte_swap(type value) noexcept {
+#	if stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG
+		switch (sizeof(type)) {
+		case 2ul:
+			return static_cast<type>(
+			    __builtin_bswap16(static_cast<uint16_t>(value)));
+		case 4ul:
+			return static_cast<type>(
+			    __builtin_bswap32(static_cast<uint32_t>(value)));
+		case 8ul:
+			return static_cast<type>(
+			    __builtin_bswap64(static_cast<uint64_t>(value)));
+		default:
+			break;
+		}
+#	endif
+
+		type swapped = type(0);
+		for (size_t i = 0ul; i < sizeof(type); i++, value >>= 8)
+			swapped = static_cast<type>((swapped << 8) | (value & 0xff));
+
+		return swapped;
+	}
+
+
+	template<typename type>
+	inline type load_little_endian(const void_t *address) noexcept {
+		type value;
+#	if stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG
+		__builtin_memcpy(&value, address, sizeof(type));
+
+#		if stick_IS_ENDIAN_BIG
+		value = byte_swap(value);
+#		endif
+#	else
+		auto bytes = static_cast<const byte_t *>(address);
+
+		value = type(0);
+		for (size_t i = sizeof(type) - 1ul; i < -1ul; i--)
+			value = static_cast<type>((value << 8) | bytes[i]);
+#	endif
+
+		return value;
+	}
+
+	template<typename type>
+	inline type load_big_endian(const void_t *address) noexcept {
+		type value;
+#	if stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG
+		__builtin_memcpy(&value, address, sizeof(type));
+
+#		if stick_IS_ENDIAN_LITTLE
+		value = byte_swap(value);
+#		endif
+#	else
+		auto bytes = static_cast<const byte_t *>(address);
+
+		value = type(0);
+		for (size_t i = 0ul; i < sizeof(type); i++)
+			value = static_cast<type>((value << 8) | bytes[i]);
+#	endif
+
+		return value;
+	}
+
+	template<typename type>
+	inline void_t store_little_endian(void_t *address, type value) noexcept {
+#	if stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG
+#		if stick_IS_ENDIAN_BIG
+		value = byte_swap(value);
+#		endif
+		__builtin_memcpy(address, &value, sizeof(type));
+#	else
+		auto bytes = static_cast<byte_t *>(address);
+
+		for (size_t i = 0ul; i < sizeof(type); i++, value >>= 8)
+			bytes[i] = static_cast<byte_t>(value & 0xff);
+#	endif
+	}
+
+	template<typename type>
+	inline void_t store_big_endian(void_t *address, type value) noexcept {
+#	if stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG
+#		if stick_IS_ENDIAN_LITTLE
+		value = byte_swap(value);
+#		endif
+		__builtin_memcpy(address, &value, sizeof(type));
+#	else
+		auto bytes = static_cast<byte_t *>(address);
+
+		for (size_t i = sizeof(type) - 1ul; i < -1ul; i--, value >>= 8)
+			bytes[i] = static_cast<byte_t>(value & 0xff);
+#	endif
+	}
+
+
+	inline uint64_t multiply_extended(uint64_t left, uint64_t right,
+	                                  uint64_t &high) noexcept {
+#	if (stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG)                     \
+	    && defined(__SIZEOF_INT128__)
+		unsigned __int128 product = static_cast<unsigned __int128>(left)
+		                            * right;
+		high = static_cast<uint64_t>(product >> 64);
+
+		return static_cast<uint64_t>(product);
+
+#	elif stick_IS_COMPILER_MSVC && defined(_M_X64)
+		return _umul128(left, right, &high);
+
+#	else
+		uint64_t low_low = (left & 0xfffffffful) * (right & 0xfffffffful);
+		uint64_t high_low = (left >> 32) * (right & 0xfffffffful);
+		uint64_t low_high = (left & 0xfffffffful) * (right >> 32);
+		uint64_t high_high = (left >> 32) * (right >> 32);
+
+		uint64_t cross = (low_low >> 32) + (high_low & 0xfffffffful) + low_high;
+		high = high_high + (high_low >> 32) + (cross >> 32);
+
+		return (cross << 32) | (low_low & 0xfffffffful);
+#	endif
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_templates_bit_impl_
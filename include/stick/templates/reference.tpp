@@ -37,6 +37,14 @@ namespace stick {
 	 */
 	template<typename type>
 	constexpr dereference_t<type> &&move(type &&value) noexcept;
+	/**
+	 * Pass a value on keeping it an lvalue or an rvalue, as it was received.
+	 * @tparam type Deduced type of the forwarding reference.
+	 * @param [in,out] value Value to pass on.
+	 * @return The value with its original value category.
+	 */
+	template<typename type>
+	constexpr type &&forward(dereference_t<type> &value) noexcept;
 
 
 }   // namespace stick
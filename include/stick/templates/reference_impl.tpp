@@ -44,6 +44,10 @@ namespace stick {
 	constexpr dereference_t<type> &&move(type &&value) noexcept {
 		return static_cast<dereference_t<type> &&>(value);
 	}
+	template<typename type>
+	constexpr type &&forward(dereference_t<type> &value) noexcept {
+		return static_cast<type &&>(value);
+	}
 
 
 }   // namespace stick
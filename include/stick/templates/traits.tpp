@@ -0,0 +1,94 @@
+/**
+ * Type traits used to pick the fastest way of handling values.
+ * @brief Type traits templates.
+ * @file traits.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_templates_traits_)
+#	define _stick_lib_templates_traits_
+
+
+
+#	include "../defines/types.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Check if a type can be copied byte by byte.
+	 * @tparam type Type to check.
+	 */
+	template<typename type>
+	struct is_trivially_copyable {
+		/// True if copies need no constructor nor assignment.
+		static constexpr bool_t value = __is_trivially_copyable(type);
+	};
+
+#	if defined(__has_builtin)
+#		if __has_builtin(__is_trivially_destructible)
+#			define stick_TRIVIALLY_DESTRUCTIBLE(type)                          \
+				__is_trivially_destructible(type)
+#		endif
+#	endif
+#	if not defined(stick_TRIVIALLY_DESTRUCTIBLE)
+	// Deprecated on Clang, but the only spelling older GCC knows.
+#		define stick_TRIVIALLY_DESTRUCTIBLE(type) __has_trivial_destructor(type)
+#	endif
+
+	/**
+	 * Check if destroying a type does nothing.
+	 * @tparam type Type to check.
+	 */
+	template<typename type>
+	struct is_trivially_destructible {
+		/// True if the destructor can be skipped.
+		static constexpr bool_t value = stick_TRIVIALLY_DESTRUCTIBLE(type);
+	};
+
+#	undef stick_TRIVIALLY_DESTRUCTIBLE
+
+	/**
+	 * Check if moving a value, constructing or assigning, cannot throw.
+	 * @tparam type Type to check.
+	 */
+	template<typename type>
+	struct is_nothrow_movable {
+		/**
+		 * Stand for a value to move in unevaluated expressions, never
+		 * defined.
+		 * @return A value to move from.
+		 */
+		static type &&rvalue() noexcept;
+		/**
+		 * Stand for a value to assign to in unevaluated expressions, never
+		 * defined.
+		 * @return A value to assign to.
+		 */
+		static type &lvalue() noexcept;
+
+		/// True if the move constructor and assignment are noexcept.
+		static constexpr bool_t value
+		    = noexcept(type(rvalue())) and noexcept(lvalue() = rvalue());
+	};
+
+	/**
+	 * Check if moving a value to another address and forgetting the old one
+	 * can be done copying its bytes. True for trivially copyable types and
+	 * opt-in for the rest: specialize it for types holding no pointer to
+	 * themselves, like most containers, so arrays of them grow with a memcpy
+	 * instead of a move and a destruction per value.
+	 * @tparam type Type to check.
+	 */
+	template<typename type>
+	struct is_trivially_relocatable {
+		/// True if values can be relocated copying their bytes.
+		static constexpr bool_t value = is_trivially_copyable<type>::value;
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_templates_traits_
@@ -0,0 +1,274 @@
+/**
+ * Fixed width unsigned integers wider than the native ones.
+ * @brief Wide unsigned integer template.
+ * @file wide_uint.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_templates_wide_uint_)
+#	define _stick_lib_templates_wide_uint_
+
+
+
+#	include "../defines/types.hpp"
+#	include "../string/string.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Unsigned integer of a fixed number of bits. Arithmetic wraps around
+	 * like the native unsigned types. Words are stored least significant
+	 * first and products are built from 64x64 bits multiplications.
+	 * @tparam bits Number of bits, a multiple of 64 from 128 on.
+	 */
+	template<size_t bits>
+	class wide_uint {
+
+		static_assert(bits >= 128ul and bits % 64ul == 0ul,
+		              "Wide integers must be a multiple of 64 bits wide.");
+
+	public:
+		/// Number of 64 bits words of the integer.
+		static const size_t words_amount = bits / 64ul;
+
+	private:
+		uint64_t words[words_amount];   ///< Words, least significant first.
+
+	public:
+		/**
+		 * Create a zero value.
+		 */
+		constexpr wide_uint() noexcept;
+		/**
+		 * Create from a native integer.
+		 * @param [in] value Value of the least significant word.
+		 */
+		constexpr wide_uint(uint64_t value) noexcept;
+		/**
+		 * Create from its two least significant words.
+		 * @param [in] low Least significant word.
+		 * @param [in] high Second least significant word.
+		 */
+		constexpr wide_uint(uint64_t low, uint64_t high) noexcept;
+		/**
+		 * Create from a list of words. Missing words are set to 0 and extra
+		 * words are ignored.
+		 * @param [in] values Words, least significant first.
+		 * @param [in] amount Number of words in values.
+		 */
+		wide_uint(const uint64_t *values, size_t amount) noexcept;
+		/**
+		 * Create from an integer of another width, truncating or extending
+		 * it with zeros.
+		 * @tparam other_bits Width of the integer to convert.
+		 * @param [in] value Integer to convert.
+		 */
+		template<size_t other_bits>
+		explicit wide_uint(const wide_uint<other_bits> &value) noexcept;
+
+
+		/**
+		 * Get a word of the integer.
+		 * @param [in] position Word position, 0 is the least significant.
+		 * @return Value of the word.
+		 */
+		uint64_t word(size_t position) const noexcept;
+		/**
+		 * Get a word of the integer.
+		 * @param [in] position Word position, 0 is the least significant.
+		 * @return Reference to the word.
+		 */
+		uint64_t &word(size_t position) noexcept;
+
+
+		/**
+		 * Truncate to the least significant word.
+		 * @return The 64 least significant bits.
+		 */
+		explicit operator uint64_t() const noexcept;
+		/**
+		 * Check if the value is not zero.
+		 * @return False if all bits are 0, true otherwise.
+		 */
+		explicit operator bool_t() const noexcept;
+
+
+		/**
+		 * Add an integer.
+		 * @param [in] value Integer to add.
+		 * @return Self instance.
+		 */
+		wide_uint &operator+=(const wide_uint &value) noexcept;
+		/**
+		 * Subtract an integer.
+		 * @param [in] value Integer to subtract.
+		 * @return Self instance.
+		 */
+		wide_uint &operator-=(const wide_uint &value) noexcept;
+		/**
+		 * Multiply by an integer. Zero words of value are skipped, so sparse
+		 * factors are cheap.
+		 * @param [in] value Integer to multiply by.
+		 * @return Self instance.
+		 */
+		wide_uint &operator*=(const wide_uint &value) noexcept;
+		/**
+		 * Bitwise and with an integer.
+		 * @param [in] value Integer to operate with.
+		 * @return Self instance.
+		 */
+		wide_uint &operator&=(const wide_uint &value) noexcept;
+		/**
+		 * Bitwise or with an integer.
+		 * @param [in] value Integer to operate with.
+		 * @return Self instance.
+		 */
+		wide_uint &operator|=(const wide_uint &value) noexcept;
+		/**
+		 * Bitwise xor with an integer.
+		 * @param [in] value Integer to operate with.
+		 * @return Self instance.
+		 */
+		wide_uint &operator^=(const wide_uint &value) noexcept;
+		/**
+		 * Shift bits to the left. Shifting by bits or more gives 0.
+		 * @param [in] shift Number of bits to shift.
+		 * @return Self instance.
+		 */
+		wide_uint &operator<<=(size_t shift) noexcept;
+		/**
+		 * Shift bits to the right. Shifting by bits or more gives 0.
+		 * @param [in] shift Number of bits to shift.
+		 * @return Self instance.
+		 */
+		wide_uint &operator>>=(size_t shift) noexcept;
+
+
+		/**
+		 * Add two integers.
+		 * @param [in] value Integer to add.
+		 * @return The sum.
+		 */
+		wide_uint operator+(const wide_uint &value) const noexcept;
+		/**
+		 * Subtract two integers.
+		 * @param [in] value Integer to subtract.
+		 * @return The difference.
+		 */
+		wide_uint operator-(const wide_uint &value) const noexcept;
+		/**
+		 * Multiply two integers.
+		 * @param [in] value Integer to multiply by.
+		 * @return The product.
+		 */
+		wide_uint operator*(const wide_uint &value) const noexcept;
+		/**
+		 * Bitwise and of two integers.
+		 * @param [in] value Integer to operate with.
+		 * @return The result.
+		 */
+		wide_uint operator&(const wide_uint &value) const noexcept;
+		/**
+		 * Bitwise or of two integers.
+		 * @param [in] value Integer to operate with.
+		 * @return The result.
+		 */
+		wide_uint operator|(const wide_uint &value) const noexcept;
+		/**
+		 * Bitwise xor of two integers.
+		 * @param [in] value Integer to operate with.
+		 * @return The result.
+		 */
+		wide_uint operator^(const wide_uint &value) const noexcept;
+		/**
+		 * Shift bits to the left.
+		 * @param [in] shift Number of bits to shift.
+		 * @return The shifted value.
+		 */
+		wide_uint operator<<(size_t shift) const noexcept;
+		/**
+		 * Shift bits to the right.
+		 * @param [in] shift Number of bits to shift.
+		 * @return The shifted value.
+		 */
+		wide_uint operator>>(size_t shift) const noexcept;
+		/**
+		 * Flip all bits.
+		 * @return The complement.
+		 */
+		wide_uint operator~() const noexcept;
+
+
+		/**
+		 * Compare if two integers are equal.
+		 * @param [in] value Integer to compare with.
+		 * @return True if equal, false otherwise.
+		 */
+		bool_t operator==(const wide_uint &value) const noexcept;
+		/**
+		 * Compare if two integers are different.
+		 * @param [in] value Integer to compare with.
+		 * @return True if different, false otherwise.
+		 */
+		bool_t operator!=(const wide_uint &value) const noexcept;
+		/**
+		 * Compare if this integer is smaller.
+		 * @param [in] value Integer to compare with.
+		 * @return True if smaller, false otherwise.
+		 */
+		bool_t operator<(const wide_uint &value) const noexcept;
+		/**
+		 * Compare if this integer is bigger.
+		 * @param [in] value Integer to compare with.
+		 * @return True if bigger, false otherwise.
+		 */
+		bool_t operator>(const wide_uint &value) const noexcept;
+		/**
+		 * Compare if this integer is smaller or equal.
+		 * @param [in] value Integer to compare with.
+		 * @return True if smaller or equal, false otherwise.
+		 */
+		bool_t operator<=(const wide_uint &value) const noexcept;
+		/**
+		 * Compare if this integer is bigger or equal.
+		 * @param [in] value Integer to compare with.
+		 * @return True if bigger or equal, false otherwise.
+		 */
+		bool_t operator>=(const wide_uint &value) const noexcept;
+	};
+
+
+	/// 128 bits unsigned integer.
+	typedef wide_uint<128ul> uint128_t;
+	/// 256 bits unsigned integer.
+	typedef wide_uint<256ul> uint256_t;
+	/// 512 bits unsigned integer.
+	typedef wide_uint<512ul> uint512_t;
+	/// 1024 bits unsigned integer.
+	typedef wide_uint<1024ul> uint1024_t;
+
+
+	/**
+	 * Convert a wide integer to its hex string equivalent, most significant
+	 * digit first and padded to the whole width.
+	 * @tparam bits Width of the integer.
+	 * @param number [in] Number to convert.
+	 * @param prefix [in] If the string should have 0x prefix.
+	 * @param caps [in] If the string should be in capital letters.
+	 * @return String holding the hex conversion.
+	 */
+	template<size_t bits>
+	string to_hex(const wide_uint<bits> &number, bool_t prefix = true,
+	              bool_t caps = false);
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_templates_wide_uint_impl_
+#	include "../templates/wide_uint_impl.tpp"
+#	undef _stick_lib_templates_wide_uint_impl_
+
+
+#endif   //_stick_lib_templates_wide_uint_
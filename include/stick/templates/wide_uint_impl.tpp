@@ -0,0 +1,292 @@
+/**
+ * Fixed width unsigned integers wider than the native ones. Template
+ * implementations.
+ * @brief Wide unsigned integer template implementations.
+ * @file wide_uint_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_templates_wide_uint_impl_)
+
+
+#	include "../templates/bit.tpp"
+
+
+namespace stick {
+
+
+	template<size_t bits>
+	constexpr wide_uint<bits>::wide_uint() noexcept : words { } { }
+	template<size_t bits>
+	constexpr wide_uint<bits>::wide_uint(uint64_t value) noexcept
+	    : words { value } { }
+	template<size_t bits>
+	constexpr wide_uint<bits>::wide_uint(uint64_t low, uint64_t high) noexcept
+	    : words { low, high } { }
+	template<size_t bits>
+	wide_uint<bits>::wide_uint(const uint64_t *values, size_t amount) noexcept {
+		for (size_t i = 0ul; i < words_amount; i++)
+			this->words[i] = i < amount ? values[i] : 0ul;
+	}
+	template<size_t bits>
+	template<size_t other_bits>
+	wide_uint<bits>::wide_uint(const wide_uint<other_bits> &value) noexcept {
+		for (size_t i = 0ul; i < words_amount; i++)
+			this->words[i] = i < wide_uint<other_bits>::words_amount
+			                     ? value.word(i)
+			                     : 0ul;
+	}
+
+
+	template<size_t bits>
+	uint64_t wide_uint<bits>::word(size_t position) const noexcept {
+		return this->words[position];
+	}
+	template<size_t bits>
+	uint64_t &wide_uint<bits>::word(size_t position) noexcept {
+		return this->words[position];
+	}
+
+
+	template<size_t bits>
+	wide_uint<bits>::operator uint64_t() const noexcept {
+		return this->words[0];
+	}
+	template<size_t bits>
+	wide_uint<bits>::operator bool_t() const noexcept {
+		uint64_t any = 0ul;
+		for (size_t i = 0ul; i < words_amount; i++)
+			any |= this->words[i];
+
+		return any != 0ul;
+	}
+
+
+	template<size_t bits>
+	wide_uint<bits> &
+	wide_uint<bits>::operator+=(const wide_uint &value) noexcept {
+		uint64_t carry = 0ul;
+		for (size_t i = 0ul; i < words_amount; i++) {
+			uint64_t sum = this->words[i] + carry;
+			carry = sum < carry;
+			sum += value.words[i];
+			carry += sum < value.words[i];
+
+			this->words[i] = sum;
+		}
+
+		return *this;
+	}
+	template<size_t bits>
+	wide_uint<bits> &
+	wide_uint<bits>::operator-=(const wide_uint &value) noexcept {
+		uint64_t borrow = 0ul;
+		for (size_t i = 0ul; i < words_amount; i++) {
+			uint64_t difference = this->words[i] - value.words[i];
+			uint64_t next_borrow = this->words[i] < value.words[i];
+			next_borrow |= difference < borrow;
+
+			this->words[i] = difference - borrow;
+			borrow = next_borrow;
+		}
+
+		return *this;
+	}
+	template<size_t bits>
+	wide_uint<bits> &
+	wide_uint<bits>::operator*=(const wide_uint &value) noexcept {
+		wide_uint product;
+
+		// Schoolbook multiplication, the words beyond the width are dropped.
+		for (size_t i = 0ul; i < words_amount; i++) {
+			if (value.words[i] == 0ul)
+				continue;
+
+			uint64_t carry = 0ul;
+			for (size_t j = 0ul; i + j < words_amount; j++) {
+				uint64_t high;
+				uint64_t low = multiply_extended(value.words[i],
+				                                 this->words[j], high);
+
+				low += carry;
+				high += low < carry;
+				product.words[i + j] += low;
+				high += product.words[i + j] < low;
+
+				carry = high;
+			}
+		}
+
+		return *this = product;
+	}
+	template<size_t bits>
+	wide_uint<bits> &
+	wide_uint<bits>::operator&=(const wide_uint &value) noexcept {
+		for (size_t i = 0ul; i < words_amount; i++)
+			this->words[i] &= value.words[i];
+
+		return *this;
+	}
+	template<size_t bits>
+	wide_uint<bits> &
+	wide_uint<bits>::operator|=(const wide_uint &value) noexcept {
+		for (size_t i = 0ul; i < words_amount; i++)
+			this->words[i] |= value.words[i];
+
+		return *this;
+	}
+	template<size_t bits>
+	wide_uint<bits> &
+	wide_uint<bits>::operator^=(const wide_uint &value) noexcept {
+		for (size_t i = 0ul; i < words_amount; i++)
+			this->words[i] ^= value.words[i];
+
+		return *this;
+	}
+	template<size_t bits>
+	wide_uint<bits> &wide_uint<bits>::operator<<=(size_t shift) noexcept {
+		size_t word_shift = shift / 64ul, bit_shift = shift % 64ul;
+
+		for (size_t i = words_amount; i-- > 0ul;) {
+			uint64_t shifted = 0ul;
+			if (i >= word_shift) {
+				shifted = this->words[i - word_shift] << bit_shift;
+				if (bit_shift != 0ul and i > word_shift)
+					shifted |= this->words[i - word_shift - 1ul]
+					           >> (64ul - bit_shift);
+			}
+
+			this->words[i] = shifted;
+		}
+
+		return *this;
+	}
+	template<size_t bits>
+	wide_uint<bits> &wide_uint<bits>::operator>>=(size_t shift) noexcept {
+		size_t word_shift = shift / 64ul, bit_shift = shift % 64ul;
+
+		for (size_t i = 0ul; i < words_amount; i++) {
+			uint64_t shifted = 0ul;
+			if (word_shift < words_amount - i) {
+				shifted = this->words[i + word_shift] >> bit_shift;
+				if (bit_shift != 0ul and i + word_shift + 1ul < words_amount)
+					shifted |= this->words[i + word_shift + 1ul]
+					           << (64ul - bit_shift);
+			}
+
+			this->words[i] = shifted;
+		}
+
+		return *this;
+	}
+
+
+	template<size_t bits>
+	wide_uint<bits>
+	wide_uint<bits>::operator+(const wide_uint &value) const noexcept {
+		return wide_uint(*this) += value;
+	}
+	template<size_t bits>
+	wide_uint<bits>
+	wide_uint<bits>::operator-(const wide_uint &value) const noexcept {
+		return wide_uint(*this) -= value;
+	}
+	template<size_t bits>
+	wide_uint<bits>
+	wide_uint<bits>::operator*(const wide_uint &value) const noexcept {
+		return wide_uint(*this) *= value;
+	}
+	template<size_t bits>
+	wide_uint<bits>
+	wide_uint<bits>::operator&(const wide_uint &value) const noexcept {
+		return wide_uint(*this) &= value;
+	}
+	template<size_t bits>
+	wide_uint<bits>
+	wide_uint<bits>::operator|(const wide_uint &value) const noexcept {
+		return wide_uint(*this) |= value;
+	}
+	template<size_t bits>
+	wide_uint<bits>
+	wide_uint<bits>::operator^(const wide_uint &value) const noexcept {
+		return wide_uint(*this) ^= value;
+	}
+	template<size_t bits>
+	wide_uint<bits> wide_uint<bits>::operator<<(size_t shift) const noexcept {
+		return wide_uint(*this) <<= shift;
+	}
+	template<size_t bits>
+	wide_uint<bits> wide_uint<bits>::operator>>(size_t shift) const noexcept {
+		return wide_uint(*this) >>= shift;
+	}
+	template<size_t bits>
+	wide_uint<bits> wide_uint<bits>::operator~() const noexcept {
+		wide_uint complement;
+		for (size_t i = 0ul; i < words_amount; i++)
+			complement.words[i] = ~this->words[i];
+
+		return complement;
+	}
+
+
+	template<size_t bits>
+	bool_t wide_uint<bits>::operator==(const wide_uint &value) const noexcept {
+		uint64_t difference = 0ul;
+		for (size_t i = 0ul; i < words_amount; i++)
+			difference |= this->words[i] ^ value.words[i];
+
+		return difference == 0ul;
+	}
+	template<size_t bits>
+	bool_t wide_uint<bits>::operator!=(const wide_uint &value) const noexcept {
+		return not(*this == value);
+	}
+	template<size_t bits>
+	bool_t wide_uint<bits>::operator<(const wide_uint &value) const noexcept {
+		for (size_t i = words_amount; i-- > 0ul;)
+			if (this->words[i] != value.words[i])
+				return this->words[i] < value.words[i];
+
+		return false;
+	}
+	template<size_t bits>
+	bool_t wide_uint<bits>::operator>(const wide_uint &value) const noexcept {
+		return value < *this;
+	}
+	template<size_t bits>
+	bool_t wide_uint<bits>::operator<=(const wide_uint &value) const noexcept {
+		return not(value < *this);
+	}
+	template<size_t bits>
+	bool_t wide_uint<bits>::operator>=(const wide_uint &value) const noexcept {
+		return not(*this < value);
+	}
+
+
+	template<size_t bits>
+	string to_hex(const wide_uint<bits> &number, bool_t prefix, bool_t caps) {
+		string hex_data(bits / 4ul + (prefix ? 2ul : 0ul));
+
+		if (prefix)
+			hex_data.append("0x");
+
+		for (size_t i = wide_uint<bits>::words_amount; i-- > 0ul;)
+			for (size_t shift = 64ul; shift > 0ul;) {
+				shift -= 4ul;
+				uint8_t digit = (number.word(i) >> shift) & 0xful;
+
+				hex_data.append(static_cast<char_t>(
+				    digit < 10ul ? '0' + digit
+				    : caps       ? 'A' + digit - 10ul
+				                 : 'a' + digit - 10ul));
+			}
+
+		return hex_data;
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_templates_wide_uint_impl_
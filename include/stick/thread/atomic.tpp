@@ -0,0 +1,223 @@
+/**
+ * Atomic values over the compiler builtins, with explicit memory orders.
+ * @brief Atomic value template.
+ * @file atomic.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_thread_atomic_)
+#	define _stick_lib_thread_atomic_
+
+
+
+#	include "../defines/types.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Ordering of an atomic operation against the memory operations around
+	 * it, with the meaning of the C++11 memory model.
+	 */
+	enum class memory_order : int_t {
+		relaxed = __ATOMIC_RELAXED,   ///< Only the operation is atomic.
+		consume = __ATOMIC_CONSUME,   ///< Acquire, for dependent loads.
+		acquire = __ATOMIC_ACQUIRE,   ///< Later operations stay after.
+		release = __ATOMIC_RELEASE,   ///< Earlier operations stay before.
+		acq_rel = __ATOMIC_ACQ_REL,   ///< Both acquire and release.
+		seq_cst = __ATOMIC_SEQ_CST   ///< One total order for all of them.
+	};
+
+
+	/**
+	 * Value read and written by many threads at once. Works with the
+	 * compiler builtins, so types of 1, 2, 4 or 8 bytes are lock-free and
+	 * others may need libatomic. The type must be trivially copyable, the
+	 * arithmetic and bitwise operations need an integral type.
+	 * @tparam type Type of the value.
+	 */
+	template<typename type>
+	class atomic {
+
+		type value;   ///< The value.
+
+	public:
+		/**
+		 * Create a value initialized to zero.
+		 */
+		constexpr atomic() noexcept;
+		/**
+		 * Create a value.
+		 * @param [in] value Initial value.
+		 */
+		constexpr atomic(type value) noexcept;
+		atomic(const atomic &) = delete;
+
+
+		/**
+		 * Check if the operations on the value need no lock.
+		 * @return True if they are lock-free, false otherwise.
+		 */
+		bool_t is_lock_free() const noexcept;
+
+
+		/**
+		 * Read the value.
+		 * @param [in] order Memory order, relaxed, consume, acquire or
+		 * seq_cst. Default = seq_cst.
+		 * @return The value.
+		 */
+		type load(memory_order order = memory_order::seq_cst) const noexcept;
+		/**
+		 * Write the value.
+		 * @param [in] desired New value.
+		 * @param [in] order Memory order, relaxed, release or seq_cst.
+		 * Default = seq_cst.
+		 */
+		void_t store(type desired,
+		             memory_order order = memory_order::seq_cst) noexcept;
+		/**
+		 * Write the value returning the old one.
+		 * @param [in] desired New value.
+		 * @param [in] order Memory order. Default = seq_cst.
+		 * @return The value before the write.
+		 */
+		type exchange(type desired,
+		              memory_order order = memory_order::seq_cst) noexcept;
+
+		/**
+		 * Write the value if it equals the expected one. May fail even when
+		 * they are equal, meant to be used in a loop.
+		 * @param [in,out] expected Value it should have, set to the current
+		 * one on failure.
+		 * @param [in] desired New value.
+		 * @param [in] success Memory order when written.
+		 * @param [in] failure Memory order when not written, relaxed,
+		 * consume, acquire or seq_cst and not stronger than success.
+		 * @return True if written, false otherwise.
+		 */
+		bool_t compare_exchange_weak(type &expected, type desired,
+		                             memory_order success,
+		                             memory_order failure) noexcept;
+		/**
+		 * Write the value if it equals the expected one. May fail even when
+		 * they are equal, meant to be used in a loop.
+		 * @param [in,out] expected Value it should have, set to the current
+		 * one on failure.
+		 * @param [in] desired New value.
+		 * @param [in] order Memory order when written, the one for failure
+		 * drops its release part. Default = seq_cst.
+		 * @return True if written, false otherwise.
+		 */
+		bool_t compare_exchange_weak(
+		    type &expected, type desired,
+		    memory_order order = memory_order::seq_cst) noexcept;
+		/**
+		 * Write the value if it equals the expected one.
+		 * @param [in,out] expected Value it should have, set to the current
+		 * one on failure.
+		 * @param [in] desired New value.
+		 * @param [in] success Memory order when written.
+		 * @param [in] failure Memory order when not written, relaxed,
+		 * consume, acquire or seq_cst and not stronger than success.
+		 * @return True if written, false otherwise.
+		 */
+		bool_t compare_exchange_strong(type &expected, type desired,
+		                               memory_order success,
+		                               memory_order failure) noexcept;
+		/**
+		 * Write the value if it equals the expected one.
+		 * @param [in,out] expected Value it should have, set to the current
+		 * one on failure.
+		 * @param [in] desired New value.
+		 * @param [in] order Memory order when written, the one for failure
+		 * drops its release part. Default = seq_cst.
+		 * @return True if written, false otherwise.
+		 */
+		bool_t compare_exchange_strong(
+		    type &expected, type desired,
+		    memory_order order = memory_order::seq_cst) noexcept;
+
+
+		/**
+		 * Add to the value.
+		 * @param [in] operand Value to add.
+		 * @param [in] order Memory order. Default = seq_cst.
+		 * @return The value before the addition.
+		 */
+		type fetch_add(type operand,
+		               memory_order order = memory_order::seq_cst) noexcept;
+		/**
+		 * Subtract from the value.
+		 * @param [in] operand Value to subtract.
+		 * @param [in] order Memory order. Default = seq_cst.
+		 * @return The value before the subtraction.
+		 */
+		type fetch_sub(type operand,
+		               memory_order order = memory_order::seq_cst) noexcept;
+		/**
+		 * Bitwise and the value.
+		 * @param [in] operand Mask to and with.
+		 * @param [in] order Memory order. Default = seq_cst.
+		 * @return The value before the operation.
+		 */
+		type fetch_and(type operand,
+		               memory_order order = memory_order::seq_cst) noexcept;
+		/**
+		 * Bitwise or the value.
+		 * @param [in] operand Mask to or with.
+		 * @param [in] order Memory order. Default = seq_cst.
+		 * @return The value before the operation.
+		 */
+		type fetch_or(type operand,
+		              memory_order order = memory_order::seq_cst) noexcept;
+		/**
+		 * Bitwise xor the value.
+		 * @param [in] operand Mask to xor with.
+		 * @param [in] order Memory order. Default = seq_cst.
+		 * @return The value before the operation.
+		 */
+		type fetch_xor(type operand,
+		               memory_order order = memory_order::seq_cst) noexcept;
+
+
+		/**
+		 * Read the value with seq_cst order.
+		 * @return The value.
+		 */
+		operator type() const noexcept;
+
+		atomic &operator=(const atomic &) = delete;
+		/**
+		 * Write the value with seq_cst order.
+		 * @param [in] desired New value.
+		 * @return The value written.
+		 */
+		type operator=(type desired) noexcept;
+	};
+
+
+	/**
+	 * Order the memory operations of the calling thread without an atomic
+	 * value.
+	 * @param [in] order Memory order.
+	 */
+	inline void_t atomic_fence(memory_order order) noexcept;
+
+	/**
+	 * Hint the CPU that the thread is busy waiting, so it saves power and
+	 * leaves the core to its sibling hyperthread. Does nothing where there
+	 * is no such hint.
+	 */
+	inline void_t cpu_relax() noexcept;
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_thread_atomic_impl_
+#	include "../thread/atomic_impl.tpp"
+#	undef _stick_lib_thread_atomic_impl_
+
+
+#endif   //_stick_lib_thread_atomic_
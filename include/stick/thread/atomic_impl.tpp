@@ -0,0 +1,151 @@
+/**
+ * Atomic value template. Template implementations.
+ * @brief Atomic value template implementations.
+ * @file atomic_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_thread_atomic_impl_)
+
+
+#	include "../defines/arch.hpp"
+#	include "../defines/compiler.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Get the order of a failed compare and exchange from the one of a
+	 * successful one, dropping its release part.
+	 * @param [in] order Memory order when written.
+	 * @return Memory order when not written.
+	 */
+	constexpr memory_order atomic_failure_order(memory_order order) noexcept {
+		return order == memory_order::acq_rel
+		           ? memory_order::acquire
+		           : (order == memory_order::release ? memory_order::relaxed
+		                                             : order);
+	}
+
+
+	template<typename type>
+	constexpr atomic<type>::atomic() noexcept : value() { }
+	template<typename type>
+	constexpr atomic<type>::atomic(type value) noexcept : value(value) { }
+
+
+	template<typename type>
+	bool_t atomic<type>::is_lock_free() const noexcept {
+		return __atomic_is_lock_free(sizeof(type), &this->value);
+	}
+
+
+	template<typename type>
+	type atomic<type>::load(memory_order order) const noexcept {
+		type tempy;
+		__atomic_load(&this->value, &tempy, static_cast<int_t>(order));
+
+		return tempy;
+	}
+	template<typename type>
+	void_t atomic<type>::store(type desired, memory_order order) noexcept {
+		__atomic_store(&this->value, &desired, static_cast<int_t>(order));
+	}
+	template<typename type>
+	type atomic<type>::exchange(type desired, memory_order order) noexcept {
+		type tempy;
+		__atomic_exchange(&this->value, &desired, &tempy,
+		                  static_cast<int_t>(order));
+
+		return tempy;
+	}
+
+	template<typename type>
+	bool_t atomic<type>::compare_exchange_weak(type &expected, type desired,
+	                                           memory_order success,
+	                                           memory_order failure) noexcept {
+		return __atomic_compare_exchange(
+		    &this->value, &expected, &desired, true,
+		    static_cast<int_t>(success), static_cast<int_t>(failure));
+	}
+	template<typename type>
+	bool_t atomic<type>::compare_exchange_weak(type &expected, type desired,
+	                                           memory_order order) noexcept {
+		return this->compare_exchange_weak(expected, desired, order,
+		                                   atomic_failure_order(order));
+	}
+	template<typename type>
+	bool_t
+	atomic<type>::compare_exchange_strong(type &expected, type desired,
+	                                      memory_order success,
+	                                      memory_order failure) noexcept {
+		return __atomic_compare_exchange(
+		    &this->value, &expected, &desired, false,
+		    static_cast<int_t>(success), static_cast<int_t>(failure));
+	}
+	template<typename type>
+	bool_t atomic<type>::compare_exchange_strong(type &expected, type desired,
+	                                             memory_order order) noexcept {
+		return this->compare_exchange_strong(expected, desired, order,
+		                                     atomic_failure_order(order));
+	}
+
+
+	template<typename type>
+	type atomic<type>::fetch_add(type operand, memory_order order) noexcept {
+		return __atomic_fetch_add(&this->value, operand,
+		                          static_cast<int_t>(order));
+	}
+	template<typename type>
+	type atomic<type>::fetch_sub(type operand, memory_order order) noexcept {
+		return __atomic_fetch_sub(&this->value, operand,
+		                          static_cast<int_t>(order));
+	}
+	template<typename type>
+	type atomic<type>::fetch_and(type operand, memory_order order) noexcept {
+		return __atomic_fetch_and(&this->value, operand,
+		                          static_cast<int_t>(order));
+	}
+	template<typename type>
+	type atomic<type>::fetch_or(type operand, memory_order order) noexcept {
+		return __atomic_fetch_or(&this->value, operand,
+		                         static_cast<int_t>(order));
+	}
+	template<typename type>
+	type atomic<type>::fetch_xor(type operand, memory_order order) noexcept {
+		return __atomic_fetch_xor(&this->value, operand,
+		                          static_cast<int_t>(order));
+	}
+
+
+	template<typename type>
+	atomic<type>::operator type() const noexcept {
+		return this->load();
+	}
+
+	template<typename type>
+	type atomic<type>::operator=(type desired) noexcept {
+		this->store(desired);
+
+		return desired;
+	}
+
+
+	inline void_t atomic_fence(memory_order order) noexcept {
+		__atomic_thread_fence(static_cast<int_t>(order));
+	}
+
+	inline void_t cpu_relax() noexcept {
+#	if stick_IS_ARCH_x86_64                                                    \
+	    and (stick_IS_COMPILER_GCC or stick_IS_COMPILER_CLANG)
+		__builtin_ia32_pause();
+#	endif
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_thread_atomic_impl_
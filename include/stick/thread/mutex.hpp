@@ -0,0 +1,103 @@
+/**
+ * Sleeping locks and condition variables over the Linux futex.
+ * @brief Mutex and condition variable.
+ * @file mutex.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_thread_mutex_)
+#	define _stick_lib_thread_mutex_
+
+
+
+#	include "../defines/types.hpp"
+#	include "../thread/atomic.tpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Lock that puts waiting threads to sleep. The whole lock is a 32 bits
+	 * word: 0 when free, 1 when held, 2 when held and some thread may be
+	 * sleeping on it. Taking and releasing a free lock is a single atomic
+	 * operation, the kernel is only called to sleep and to wake a sleeper.
+	 * Before sleeping a thread spins a while, the holder of a short
+	 * critical section may release it soon. Sleeps with a futex on Linux,
+	 * other systems yield the CPU instead.
+	 */
+	class mutex {
+
+		atomic<uint32_t> state;   ///< Free, held or held with sleepers.
+
+	public:
+		/**
+		 * Create a released lock.
+		 */
+		mutex() noexcept = default;
+		mutex(const mutex &) = delete;
+
+
+		/**
+		 * Take the lock, waiting for it.
+		 */
+		void_t lock() noexcept;
+		/**
+		 * Take the lock if it is free.
+		 * @return True if taken, false otherwise.
+		 */
+		bool_t try_lock() noexcept;
+		/**
+		 * Release the lock, waking a sleeping thread if any. Only called by
+		 * the holder.
+		 */
+		void_t unlock() noexcept;
+
+
+		mutex &operator=(const mutex &) = delete;
+	};
+
+
+	/**
+	 * Condition variable to wait, holding a mutex, until another thread
+	 * changes something. Waiters sleep on a 32 bits sequence bumped by
+	 * every notification, so one sent between releasing the mutex and
+	 * sleeping is not lost. Waits may end without a notification, callers
+	 * check their condition in a loop.
+	 */
+	class condition {
+
+		atomic<uint32_t> sequence;   ///< Notifications sent, wrapping.
+		atomic<uint32_t> waiters;   ///< Threads waiting.
+
+	public:
+		/**
+		 * Create a condition nobody waits for.
+		 */
+		condition() noexcept = default;
+		condition(const condition &) = delete;
+
+
+		/**
+		 * Release a mutex, sleep until notified and take it again.
+		 * @param [in,out] lock Mutex held by the calling thread.
+		 */
+		void_t wait(mutex &lock) noexcept;
+		/**
+		 * Wake one waiting thread, if any.
+		 */
+		void_t notify_one() noexcept;
+		/**
+		 * Wake every waiting thread.
+		 */
+		void_t notify_all() noexcept;
+
+
+		condition &operator=(const condition &) = delete;
+	};
+
+
+}   // namespace stick
+
+
+
+#endif   //_stick_lib_thread_mutex_
@@ -0,0 +1,122 @@
+/**
+ * Parallel loops and reductions over index ranges and arrays, run as
+ * fork/join tasks in a thread pool.
+ * @brief Parallel algorithms.
+ * @file parallel.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_thread_parallel_)
+#	define _stick_lib_thread_parallel_
+
+
+
+#	include "../data_structures/array.tpp"
+#	include "../defines/types.hpp"
+#	include "../thread/thread_pool.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Call a function over a range of indexes in parallel. The range is
+	 * split in halves until the parts are not bigger than the grain, each
+	 * half a task, so idle workers steal the biggest parts left.
+	 * @tparam function_type Type of the function, called as function(first,
+	 * last) for every part [first, last).
+	 * @param [in] first First index.
+	 * @param [in] last Index after the last one.
+	 * @param [in] function Function to call, concurrently.
+	 * @param [in] grain Most indexes per call, 0 to pick it from the number
+	 * of workers. Default = 0.
+	 * @param [in] pool Pool to run in. Default = shared pool.
+	 * @throw generic_error when a call threw.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	template<typename function_type>
+	void_t parallel_for(size_t first, size_t last,
+	                    const function_type &function, size_t grain = 0ul,
+	                    thread_pool &pool = thread_pool::shared());
+	/**
+	 * Call a function for every value of an array in parallel.
+	 * @tparam type Type of the values.
+	 * @tparam function_type Type of the function, called as function(value).
+	 * @param [in,out] values Values to call the function for.
+	 * @param [in] function Function to call, concurrently.
+	 * @param [in] grain Most values per task, 0 to pick it from the number
+	 * of workers. Default = 0.
+	 * @param [in] pool Pool to run in. Default = shared pool.
+	 * @throw generic_error when a call threw.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	template<typename type, typename function_type>
+	void_t parallel_for(array<type> &values, const function_type &function,
+	                    size_t grain = 0ul,
+	                    thread_pool &pool = thread_pool::shared());
+
+	/**
+	 * Reduce a range of indexes in parallel. Parts are reduced as in
+	 * parallel_for and their results combined in index order, so combine
+	 * only needs to be associative.
+	 * @tparam result_type Type of the result.
+	 * @tparam map_type Type of the part reducer, called as map(first, last)
+	 * and returning the result of the part [first, last).
+	 * @tparam combine_type Type of the combiner, called as combine(left,
+	 * right) and returning the result of both.
+	 * @param [in] first First index.
+	 * @param [in] last Index after the last one.
+	 * @param [in] identity Result of an empty range.
+	 * @param [in] map Part reducer, called concurrently.
+	 * @param [in] combine Combiner, called concurrently.
+	 * @param [in] grain Most indexes per part, 0 to pick it from the number
+	 * of workers. Default = 0.
+	 * @param [in] pool Pool to run in. Default = shared pool.
+	 * @throw generic_error when a call threw.
+	 * @throw memory_error when memory cannot be allocated.
+	 * @return The result of the whole range.
+	 */
+	template<typename result_type, typename map_type, typename combine_type>
+	result_type parallel_reduce(size_t first, size_t last,
+	                            const result_type &identity,
+	                            const map_type &map,
+	                            const combine_type &combine,
+	                            size_t grain = 0ul,
+	                            thread_pool &pool = thread_pool::shared());
+	/**
+	 * Reduce the values of an array in parallel.
+	 * @tparam type Type of the values.
+	 * @tparam result_type Type of the result.
+	 * @tparam map_type Type of the value mapper, called as map(value) and
+	 * returning its result.
+	 * @tparam combine_type Type of the combiner, called as combine(left,
+	 * right) and returning the result of both.
+	 * @param [in] values Values to reduce.
+	 * @param [in] identity Result of an empty array.
+	 * @param [in] map Value mapper, called concurrently.
+	 * @param [in] combine Combiner, called concurrently.
+	 * @param [in] grain Most values per part, 0 to pick it from the number
+	 * of workers. Default = 0.
+	 * @param [in] pool Pool to run in. Default = shared pool.
+	 * @throw generic_error when a call threw.
+	 * @throw memory_error when memory cannot be allocated.
+	 * @return The result of the whole array.
+	 */
+	template<typename type, typename result_type, typename map_type,
+	         typename combine_type>
+	result_type parallel_reduce(const array<type> &values,
+	                            const result_type &identity,
+	                            const map_type &map,
+	                            const combine_type &combine,
+	                            size_t grain = 0ul,
+	                            thread_pool &pool = thread_pool::shared());
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_thread_parallel_impl_
+#	include "../thread/parallel_impl.tpp"
+#	undef _stick_lib_thread_parallel_impl_
+
+
+#endif   //_stick_lib_thread_parallel_
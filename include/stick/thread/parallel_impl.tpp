@@ -0,0 +1,168 @@
+/**
+ * Parallel algorithms. Template implementations.
+ * @brief Parallel algorithms template implementations.
+ * @file parallel_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_thread_parallel_impl_)
+
+
+
+namespace stick {
+
+
+	/// Parts per worker a range is split in when no grain is given.
+	static const size_t parallel_parts_per_worker = 8ul;
+
+
+	/**
+	 * Get the grain to split a range with.
+	 * @param [in] length Length of the range.
+	 * @param [in] grain Requested grain, 0 to pick one.
+	 * @param [in] pool Pool the range runs in.
+	 * @return Most indexes per part, at least 1.
+	 */
+	inline size_t parallel_grain(size_t length, size_t grain,
+	                             const thread_pool &pool) noexcept {
+		if (grain == 0ul)
+			grain = length / (pool.size() * parallel_parts_per_worker);
+
+		return grain == 0ul ? 1ul : grain;
+	}
+
+	/**
+	 * Split a range in halves, queueing the upper ones as tasks, and call
+	 * the function for the lowest part.
+	 * @tparam function_type Type of the function.
+	 * @param [in,out] group Group the tasks run in.
+	 * @param [in] first First index.
+	 * @param [in] last Index after the last one.
+	 * @param [in] grain Most indexes per call.
+	 * @param [in] function Function to call.
+	 */
+	template<typename function_type>
+	void_t parallel_for_split(task_group &group, size_t first, size_t last,
+	                          size_t grain, const function_type &function) {
+		while (last - first > grain) {
+			size_t middle = first + (last - first) / 2ul;
+			group.run([&group, &function, middle, last, grain]() {
+				parallel_for_split(group, middle, last, grain, function);
+			});
+			last = middle;
+		}
+
+		function(first, last);
+	}
+
+	/**
+	 * Reduce a range, the upper half in a task and the lower one in the
+	 * calling thread, while it is bigger than the grain.
+	 * @tparam result_type Type of the result.
+	 * @tparam map_type Type of the part reducer.
+	 * @tparam combine_type Type of the combiner.
+	 * @param [in,out] pool Pool to run in.
+	 * @param [in] first First index.
+	 * @param [in] last Index after the last one.
+	 * @param [in] grain Most indexes per part.
+	 * @param [in] identity Result of an empty range.
+	 * @param [in] map Part reducer.
+	 * @param [in] combine Combiner.
+	 * @return The result of the range.
+	 */
+	template<typename result_type, typename map_type, typename combine_type>
+	result_type parallel_reduce_split(thread_pool &pool, size_t first,
+	                                  size_t last, size_t grain,
+	                                  const result_type &identity,
+	                                  const map_type &map,
+	                                  const combine_type &combine) {
+		if (last - first <= grain)
+			return map(first, last);
+
+		size_t middle = first + (last - first) / 2ul;
+		result_type right = identity;
+
+		task_group group(pool);
+		group.run([&]() {
+			right = parallel_reduce_split(pool, middle, last, grain, identity,
+			                              map, combine);
+		});
+		result_type left = parallel_reduce_split(pool, first, middle, grain,
+		                                         identity, map, combine);
+		group.wait();
+
+		return combine(left, right);
+	}
+
+
+	template<typename function_type>
+	void_t parallel_for(size_t first, size_t last,
+	                    const function_type &function, size_t grain,
+	                    thread_pool &pool) {
+		if (first >= last)
+			return;
+
+		grain = parallel_grain(last - first, grain, pool);
+		if (last - first <= grain)
+			return function(first, last);
+
+		task_group group(pool);
+		parallel_for_split(group, first, last, grain, function);
+		group.wait();
+	}
+	template<typename type, typename function_type>
+	void_t parallel_for(array<type> &values, const function_type &function,
+	                    size_t grain, thread_pool &pool) {
+		type *data = values.begin();
+
+		parallel_for(
+		    0ul, values.size(),
+		    [data, &function](size_t first, size_t last) {
+			    for (size_t i = first; i < last; i++)
+				    function(data[i]);
+		    },
+		    grain, pool);
+	}
+
+
+	template<typename result_type, typename map_type, typename combine_type>
+	result_type parallel_reduce(size_t first, size_t last,
+	                            const result_type &identity,
+	                            const map_type &map,
+	                            const combine_type &combine, size_t grain,
+	                            thread_pool &pool) {
+		if (first >= last)
+			return identity;
+
+		return parallel_reduce_split(
+		    pool, first, last, parallel_grain(last - first, grain, pool),
+		    identity, map, combine);
+	}
+	template<typename type, typename result_type, typename map_type,
+	         typename combine_type>
+	result_type parallel_reduce(const array<type> &values,
+	                            const result_type &identity,
+	                            const map_type &map,
+	                            const combine_type &combine, size_t grain,
+	                            thread_pool &pool) {
+		const type *data = values.begin();
+
+		return parallel_reduce(
+		    0ul, values.size(), identity,
+		    [data, &identity, &map, &combine](size_t first, size_t last)
+		        -> result_type {
+			    result_type result = identity;
+			    for (size_t i = first; i < last; i++)
+				    result = combine(result, map(data[i]));
+
+			    return result;
+		    },
+		    combine, grain, pool);
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_thread_parallel_impl_
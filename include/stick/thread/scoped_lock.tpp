@@ -0,0 +1,54 @@
+/**
+ * Lock held for the lifetime of a scope.
+ * @brief Scoped lock template.
+ * @file scoped_lock.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_thread_scoped_lock_)
+#	define _stick_lib_thread_scoped_lock_
+
+
+
+#	include "../defines/types.hpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Take a lock when created and release it when destroyed, so it is
+	 * released however the scope is left.
+	 * @tparam lock_type Type of the lock, with lock and unlock methods.
+	 */
+	template<typename lock_type>
+	class scoped_lock {
+
+		lock_type &held;   ///< Lock taken.
+
+	public:
+		/**
+		 * Take a lock.
+		 * @param [in,out] lock Lock to take.
+		 */
+		explicit scoped_lock(lock_type &lock) noexcept;
+		scoped_lock(const scoped_lock &) = delete;
+
+		/**
+		 * Release the lock.
+		 */
+		~scoped_lock() noexcept;
+
+
+		scoped_lock &operator=(const scoped_lock &) = delete;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_thread_scoped_lock_impl_
+#	include "../thread/scoped_lock_impl.tpp"
+#	undef _stick_lib_thread_scoped_lock_impl_
+
+
+#endif   //_stick_lib_thread_scoped_lock_
@@ -0,0 +1,31 @@
+/**
+ * Scoped lock template. Template implementations.
+ * @brief Scoped lock template implementations.
+ * @file scoped_lock_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_thread_scoped_lock_impl_)
+
+
+
+namespace stick {
+
+
+	template<typename lock_type>
+	scoped_lock<lock_type>::scoped_lock(lock_type &lock) noexcept
+	    : held(lock) {
+		this->held.lock();
+	}
+
+	template<typename lock_type>
+	scoped_lock<lock_type>::~scoped_lock() noexcept {
+		this->held.unlock();
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_thread_scoped_lock_impl_
@@ -0,0 +1,137 @@
+/**
+ * Busy waiting locks for short critical sections.
+ * @brief Spin and ticket locks.
+ * @file spin_lock.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_thread_spin_lock_)
+#	define _stick_lib_thread_spin_lock_
+
+
+
+#	include "../defines/types.hpp"
+#	include "../thread/atomic.tpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Give the rest of the time slice of the calling thread to another
+	 * thread ready to run.
+	 */
+	void_t thread_yield() noexcept;
+
+
+	/**
+	 * Exponential backoff of a busy waiting thread. Each wait pauses the CPU
+	 * twice as long as the one before, so contending threads spread out
+	 * instead of hammering the same cache line, and once the pauses get too
+	 * long it yields the CPU so the thread it waits for can run.
+	 */
+	class spin_backoff {
+
+		uint32_t pauses = 1u;   ///< Pauses of the next wait.
+
+	public:
+		/**
+		 * Wait a bit longer than the last time.
+		 */
+		inline void_t pause() noexcept;
+		/**
+		 * Start again from the shortest wait.
+		 */
+		inline void_t reset() noexcept;
+	};
+
+
+	/**
+	 * Test and test and set lock. Waiting threads spin reading the lock, so
+	 * it stays shared in their caches until released, with exponential
+	 * backoff. Not fair, a thread may take it over and over. Meant for
+	 * critical sections of a few instructions.
+	 */
+	class spin_lock {
+
+		atomic<bool_t> locked;   ///< Whether a thread holds the lock.
+
+	public:
+		/**
+		 * Create a released lock.
+		 */
+		spin_lock() noexcept = default;
+		spin_lock(const spin_lock &) = delete;
+
+
+		/**
+		 * Take the lock, waiting for it.
+		 */
+		inline void_t lock() noexcept;
+		/**
+		 * Take the lock if it is free.
+		 * @return True if taken, false otherwise.
+		 */
+		inline bool_t try_lock() noexcept;
+		/**
+		 * Release the lock. Only called by the holder.
+		 */
+		inline void_t unlock() noexcept;
+
+
+		spin_lock &operator=(const spin_lock &) = delete;
+	};
+
+
+	/**
+	 * Fair spin lock. Every thread takes a ticket and waits until it is
+	 * served, so threads get the lock in arrival order. Waiting threads
+	 * pause proportionally to the tickets ahead of them. The counters live
+	 * in their own cache lines. Bad when there are more waiting threads than
+	 * CPUs, the next one in the line may not be running.
+	 */
+	class ticket_lock {
+
+		atomic<uint32_t> next;   ///< Next ticket to hand out.
+		/// Keeps the ticket counter apart from the served one.
+		byte_t next_padding[64];
+
+		atomic<uint32_t> serving;   ///< Ticket holding the lock.
+		/// Keeps the served counter apart from whatever follows.
+		byte_t serving_padding[64];
+
+	public:
+		/**
+		 * Create a released lock.
+		 */
+		ticket_lock() noexcept = default;
+		ticket_lock(const ticket_lock &) = delete;
+
+
+		/**
+		 * Take the lock, waiting for the threads that came before.
+		 */
+		inline void_t lock() noexcept;
+		/**
+		 * Take the lock if no thread holds or waits for it.
+		 * @return True if taken, false otherwise.
+		 */
+		inline bool_t try_lock() noexcept;
+		/**
+		 * Release the lock to the next thread. Only called by the holder.
+		 */
+		inline void_t unlock() noexcept;
+
+
+		ticket_lock &operator=(const ticket_lock &) = delete;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_thread_spin_lock_impl_
+#	include "../thread/spin_lock_impl.tpp"
+#	undef _stick_lib_thread_spin_lock_impl_
+
+
+#endif   //_stick_lib_thread_spin_lock_
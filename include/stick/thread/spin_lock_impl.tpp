@@ -0,0 +1,91 @@
+/**
+ * Spin and ticket locks. Inline implementations.
+ * @brief Spin and ticket lock inline implementations.
+ * @file spin_lock_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_thread_spin_lock_impl_)
+
+
+
+namespace stick {
+
+
+	/// Longest wait of a backoff in pauses, it yields the CPU after.
+	static const uint32_t spin_backoff_pauses = 64u;
+	/// Pauses of a ticket lock waiter per ticket ahead of it.
+	static const uint32_t ticket_lock_pauses = 16u;
+	/// Waits of a ticket lock waiter before it starts yielding the CPU.
+	static const uint32_t ticket_lock_waits = 64u;
+
+
+	inline void_t spin_backoff::pause() noexcept {
+		if (this->pauses > spin_backoff_pauses) {
+			thread_yield();
+			return;
+		}
+
+		for (uint32_t i = 0u; i < this->pauses; i++)
+			cpu_relax();
+		this->pauses <<= 1;
+	}
+	inline void_t spin_backoff::reset() noexcept {
+		this->pauses = 1u;
+	}
+
+
+	inline void_t spin_lock::lock() noexcept {
+		if (not this->locked.exchange(true, memory_order::acquire))
+			return;
+
+		spin_backoff backoff;
+		do {
+			// Wait reading, so the cache line is not bounced by writes.
+			while (this->locked.load(memory_order::relaxed))
+				backoff.pause();
+		} while (this->locked.exchange(true, memory_order::acquire));
+	}
+	inline bool_t spin_lock::try_lock() noexcept {
+		return not this->locked.load(memory_order::relaxed)
+		       and not this->locked.exchange(true, memory_order::acquire);
+	}
+	inline void_t spin_lock::unlock() noexcept {
+		this->locked.store(false, memory_order::release);
+	}
+
+
+	inline void_t ticket_lock::lock() noexcept {
+		uint32_t ticket = this->next.fetch_add(1u, memory_order::relaxed);
+
+		for (uint32_t waits = 0u;; waits++) {
+			uint32_t ahead =
+			    ticket - this->serving.load(memory_order::acquire);
+			if (ahead == 0u)
+				return;
+
+			if (waits < ticket_lock_waits)
+				for (uint32_t i = 0u; i < ahead * ticket_lock_pauses; i++)
+					cpu_relax();
+			else
+				thread_yield();
+		}
+	}
+	inline bool_t ticket_lock::try_lock() noexcept {
+		uint32_t ticket = this->serving.load(memory_order::acquire);
+
+		return this->next.compare_exchange_strong(ticket, ticket + 1u,
+		                                          memory_order::acquire,
+		                                          memory_order::relaxed);
+	}
+	inline void_t ticket_lock::unlock() noexcept {
+		this->serving.store(this->serving.load(memory_order::relaxed) + 1u,
+		                    memory_order::release);
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_thread_spin_lock_impl_
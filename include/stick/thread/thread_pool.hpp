@@ -0,0 +1,194 @@
+/**
+ * Work stealing thread pool and fork/join task groups.
+ * @brief Work stealing thread pool.
+ * @file thread_pool.hpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if not defined(_stick_lib_thread_thread_pool_)
+#	define _stick_lib_thread_thread_pool_
+
+
+
+#	include "../data_structures/array.tpp"
+#	include "../defines/types.hpp"
+#	include "../thread/atomic.tpp"
+
+
+namespace stick {
+
+
+	class task_group;
+
+
+	/**
+	 * Work queued in a thread pool. Tasks release themselves once run.
+	 */
+	struct thread_pool_task {
+		/// Run the task, release it and tell its group.
+		void_t (*run)(thread_pool_task *task);
+		task_group *group;   ///< Group waiting for the task.
+	};
+
+	/// Workers, queues and sleeping state of a pool.
+	struct thread_pool_state;
+
+
+	/**
+	 * Pool of worker threads running tasks. Each worker has its own
+	 * Chase-Lev deque: it pushes and takes tasks at the bottom, newest
+	 * first, while idle workers steal the oldest ones from the top, so
+	 * recursive fork/join work spreads without a shared queue. Tasks
+	 * submitted from threads outside the pool go to a shared queue. Idle
+	 * workers spin a while and then sleep until more work arrives.
+	 */
+	class thread_pool {
+
+		thread_pool_state *state = nullptr;   ///< Everything the workers share.
+
+	public:
+		/**
+		 * Start a pool.
+		 * @param [in] threads Number of workers, 0 for one per hardware
+		 * thread. Default = 0.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @throw generic_error when a worker thread cannot be started.
+		 */
+		explicit thread_pool(size_t threads = 0ul);
+		/**
+		 * Start a pool pinning its workers to CPUs. Worker i runs only on
+		 * CPU cpus[i % cpus.size()], no pinning is done if cpus is empty or
+		 * the system cannot pin threads.
+		 * @param [in] threads Number of workers, 0 for one per hardware
+		 * thread.
+		 * @param [in] cpus CPUs to pin the workers to, in order.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @throw generic_error when a worker thread cannot be started.
+		 */
+		thread_pool(size_t threads, const array<size_t> &cpus);
+		thread_pool(const thread_pool &) = delete;
+
+		/**
+		 * Run every queued task and stop the workers.
+		 */
+		~thread_pool() noexcept;
+
+
+		/**
+		 * Get the number of workers.
+		 * @return Number of workers.
+		 */
+		size_t size() const noexcept;
+
+		/**
+		 * Queue a task. From a worker of this pool the task goes to the
+		 * worker own deque, from any other thread to the shared queue.
+		 * @param [in] task Task to run.
+		 * @throw memory_error when a queue cannot grow.
+		 */
+		void_t submit(thread_pool_task *task);
+		/**
+		 * Run one queued task in the calling thread, if there is any. Used by
+		 * threads waiting for tasks, so they help instead of blocking.
+		 * @return True if a task was run, false otherwise.
+		 */
+		bool_t help();
+
+
+		thread_pool &operator=(const thread_pool &) = delete;
+
+
+		/**
+		 * Get the number of threads the hardware runs at once.
+		 * @return Number of hardware threads, at least 1.
+		 */
+		static size_t hardware_threads() noexcept;
+
+		/**
+		 * Get the pool shared by the whole library, with one worker per
+		 * hardware thread. Started on first use.
+		 * @return The shared pool.
+		 */
+		static thread_pool &shared();
+	};
+
+
+	/**
+	 * Set of tasks run in a pool that can be waited for together. Tasks may
+	 * run more tasks in the same group or in new ones, waiting threads run
+	 * queued tasks meanwhile, so nesting does not block workers.
+	 */
+	class task_group {
+
+		thread_pool &pool;   ///< Pool running the tasks.
+		atomic<size_t> pending;   ///< Tasks not finished yet.
+		atomic<bool_t> failed;   ///< Whether a task threw.
+
+
+		/**
+		 * Task holding a function to call.
+		 * @tparam function_type Type of the function.
+		 */
+		template<typename function_type>
+		struct function_task : thread_pool_task {
+			function_type function;   ///< Function to call.
+		};
+
+		/**
+		 * Call the function of a task, release the task and tell its group.
+		 * @tparam function_type Type of the function.
+		 * @param [in] task Task to run.
+		 */
+		template<typename function_type>
+		static void_t run_task(thread_pool_task *task) noexcept;
+
+		/**
+		 * Mark a task as finished.
+		 * @param [in] failed Whether the task threw.
+		 */
+		void_t finish(bool_t failed) noexcept;
+
+	public:
+		/**
+		 * Create an empty group.
+		 * @param [in] pool Pool to run the tasks in. Default = shared pool.
+		 */
+		explicit task_group(thread_pool &pool = thread_pool::shared());
+		task_group(const task_group &) = delete;
+
+		/**
+		 * Wait for every task, ignoring whether any threw.
+		 */
+		~task_group() noexcept;
+
+
+		/**
+		 * Run a function in the pool.
+		 * @tparam function_type Type of the function, called with no
+		 * arguments.
+		 * @param [in] function Function to run.
+		 * @throw memory_error when memory cannot be allocated.
+		 * @return Self instance.
+		 */
+		template<typename function_type>
+		task_group &run(function_type &&function);
+
+		/**
+		 * Wait for every task, running queued tasks meanwhile.
+		 * @throw generic_error when a task threw.
+		 */
+		void_t wait();
+
+
+		task_group &operator=(const task_group &) = delete;
+	};
+
+
+}   // namespace stick
+
+
+#	define _stick_lib_thread_thread_pool_impl_
+#	include "../thread/thread_pool_impl.tpp"
+#	undef _stick_lib_thread_thread_pool_impl_
+
+
+#endif   //_stick_lib_thread_thread_pool_
@@ -0,0 +1,70 @@
+/**
+ * Work stealing thread pool. Template implementations.
+ * @brief Work stealing thread pool template implementations.
+ * @file thread_pool_impl.tpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#if defined(_stick_lib_thread_thread_pool_impl_)
+
+
+#	include "../memory/management.tpp"
+#	include "../templates/reference.tpp"
+
+
+namespace stick {
+
+
+	template<typename function_type>
+	void_t task_group::run_task(thread_pool_task *task) noexcept {
+		auto self = static_cast<function_task<function_type> *>(task);
+		task_group *group = self->group;
+
+		bool_t failed = false;
+		try {
+			self->function();
+		} catch (...) {
+			failed = true;
+		}
+
+		destroy_range(&self->function);
+		deallocate_raw(self);
+
+		group->finish(failed);
+	}
+
+
+	template<typename function_type>
+	task_group &task_group::run(function_type &&function) {
+		typedef dereference_t<function_type> stored_type;
+
+		auto task = allocate_uninitialized<function_task<stored_type>>();
+		try {
+			construct_at(&task->function,
+			             stick::forward<function_type>(function));
+		} catch (...) {
+			deallocate_raw(task);
+			throw;
+		}
+		task->run = run_task<stored_type>;
+		task->group = this;
+
+		this->pending.fetch_add(1ul, memory_order::relaxed);
+		try {
+			this->pool.submit(task);
+		} catch (...) {
+			destroy_range(&task->function);
+			deallocate_raw(task);
+			this->pending.fetch_sub(1ul, memory_order::release);
+			throw;
+		}
+
+		return *this;
+	}
+
+
+}   // namespace stick
+
+
+#else
+#	warning This file is included automatically and should not be used on its own!
+#endif   //_stick_lib_thread_thread_pool_impl_
@@ -0,0 +1,213 @@
+/**
+ * Sorting algorithms implementation.
+ * @brief Sorting algorithms implementation.
+ * @file sort.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../include/stick/algorithm/sort.hpp"
+
+#if defined(_stick_lib_algorithm_sort_)
+
+
+#	include "../../../include/stick/memory/management.tpp"
+#	include "../../../include/stick/string/cstring.hpp"
+
+
+namespace stick {
+
+
+	/// Strings of parts shorter than this are compared whole.
+	static const size_t sort_string_insertion_threshold = 16ul;
+
+
+	/**
+	 * String being sorted, its characters and where it was.
+	 */
+	struct sort_string_entry {
+		const_cstring chars;   ///< Characters of the string.
+		size_t length;   ///< Number of characters.
+		size_t index;   ///< Position of the string before sorting.
+	};
+
+
+	/**
+	 * Get a character of a string being sorted.
+	 * @param [in] entry String being sorted.
+	 * @param [in] depth Position of the character.
+	 * @return Character as unsigned, -1 after the end of the string.
+	 */
+	static inline int32_t sort_string_char(const sort_string_entry &entry,
+	                                       size_t depth) noexcept {
+		return depth < entry.length
+		           ? static_cast<int32_t>(static_cast<uchar_t>(
+		               entry.chars[depth]))
+		           : -1;
+	}
+
+	/**
+	 * Swap two strings being sorted.
+	 * @param [in,out] left First string.
+	 * @param [in,out] right Second string.
+	 */
+	static inline void_t sort_string_swap(sort_string_entry &left,
+	                                      sort_string_entry &right) noexcept {
+		sort_string_entry tempy = left;
+		left = right;
+		right = tempy;
+	}
+
+	/**
+	 * Sort strings sharing their first characters by insertion.
+	 * @param [in,out] first First string.
+	 * @param [in] length Number of strings.
+	 * @param [in] depth Number of characters every string shares.
+	 */
+	static void_t sort_string_insertion(sort_string_entry *first,
+	                                    size_t length, size_t depth) noexcept {
+		for (size_t i = 1ul; i < length; i++) {
+			sort_string_entry tempy = first[i];
+			size_t j = i;
+
+			for (; j > 0ul; j--) {
+				const sort_string_entry &previous = first[j - 1ul];
+				// Lengths are at least depth, as every string shares the
+				// first depth characters.
+				if (str_compare(previous.chars + depth,
+				                previous.length - depth, tempy.chars + depth,
+				                tempy.length - depth)
+				    <= 0)
+					break;
+
+				first[j] = previous;
+			}
+
+			first[j] = tempy;
+		}
+	}
+
+	/**
+	 * Sort strings sharing their first characters with multikey quicksort:
+	 * split them by the character after those into less, equal and greater
+	 * than a pivot character, and go on with the next character for the
+	 * equal ones.
+	 * @param [in,out] first First string.
+	 * @param [in] length Number of strings.
+	 * @param [in] depth Number of characters every string shares.
+	 */
+	static void_t sort_string_multikey(sort_string_entry *first, size_t length,
+	                                   size_t depth) noexcept {
+		while (length >= sort_string_insertion_threshold) {
+			// Median of three characters as the pivot.
+			int32_t low = sort_string_char(first[0ul], depth);
+			int32_t middle = sort_string_char(first[length / 2ul], depth);
+			int32_t high = sort_string_char(first[length - 1ul], depth);
+			int32_t pivot;
+			if (low < middle)
+				pivot = middle < high ? middle : (low < high ? high : low);
+			else
+				pivot = low < high ? low : (middle < high ? high : middle);
+
+			// Less than the pivot go to [0, less), equal to [less, greater)
+			// and greater to [greater, length).
+			size_t less = 0ul, current = 0ul, greater = length;
+			while (current < greater) {
+				int32_t character = sort_string_char(first[current], depth);
+
+				if (character < pivot)
+					sort_string_swap(first[less++], first[current++]);
+				else if (character > pivot)
+					sort_string_swap(first[current], first[--greater]);
+				else
+					current++;
+			}
+
+			sort_string_multikey(first, less, depth);
+			sort_string_multikey(first + greater, length - greater, depth);
+
+			// Strings that ended are equal, else go on with the next
+			// character.
+			if (pivot < 0)
+				return;
+
+			first += less;
+			length = greater - less;
+			depth++;
+		}
+
+		sort_string_insertion(first, length, depth);
+	}
+
+
+	/**
+	 * Sort strings by their characters, moving each string once.
+	 * @tparam type Type of the strings, string or string_view.
+	 * @param [in,out] first First string.
+	 * @param [in,out] last String after the last one.
+	 * @param [in] chars Get the characters of a string.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	template<typename type>
+	static void_t sort_strings(type *first, type *last,
+	                           const_cstring (*chars)(const type &)) {
+		auto amount = static_cast<size_t>(last - first);
+		if (amount < 2ul)
+			return;
+
+		auto entries = allocate_uninitialized<sort_string_entry>(amount);
+		for (size_t i = 0ul; i < amount; i++)
+			entries[i] = {chars(first[i]), first[i].length(), i};
+
+		sort_string_multikey(entries, amount, 0ul);
+
+		type *buffer;
+		try {
+			buffer = allocate_uninitialized<type>(amount);
+		} catch (...) {
+			deallocate_raw(entries);
+			throw;
+		}
+
+		for (size_t i = 0ul; i < amount; i++)
+			relocate(first + entries[i].index, buffer + i, 1ul);
+		relocate(buffer, first, amount);
+
+		deallocate_raw(buffer);
+		deallocate_raw(entries);
+	}
+
+	/**
+	 * Get the characters of a string.
+	 * @param [in] str String.
+	 * @return Pointer to the first character.
+	 */
+	static const_cstring sort_string_chars(const string &str) noexcept {
+		return static_cast<const_cstring>(str);
+	}
+	/**
+	 * Get the characters of a view.
+	 * @param [in] str View.
+	 * @return Pointer to the first character.
+	 */
+	static const_cstring sort_string_chars(const string_view &str) noexcept {
+		return str.data();
+	}
+
+
+	void_t sort(string *first, string *last) {
+		sort_strings<string>(first, last, sort_string_chars);
+	}
+	void_t sort(array<string> &values) {
+		sort(values.begin(), values.end());
+	}
+	void_t sort(string_view *first, string_view *last) {
+		sort_strings<string_view>(first, last, sort_string_chars);
+	}
+	void_t sort(array<string_view> &values) {
+		sort(values.begin(), values.end());
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_algorithm_sort_
@@ -0,0 +1,101 @@
+/**
+ * Adler-32 checksum algorithm. Implementation
+ * @brief Adler-32 checksum algorithm implementation.
+ * @file checksum_adler32.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../../include/stick/crypto/checksum/checksum_adler32.hpp"
+
+#if defined(_stick_lib_crypto_checksum_adler32_)
+
+
+namespace stick {
+
+
+	/// Biggest prime under 2^16, modulo of both sums.
+	static const uint32_t adler32_modulo = 65521u;
+	/// Most bytes that can be added before the 32 bits sums may overflow.
+	static const size_t adler32_block_length = 5552ul;
+
+
+
+	uint32_t adler32(const void_t *bytes, size_t length,
+	                 uint32_t previous) noexcept {
+		auto data = static_cast<const byte_t *>(bytes);
+		uint32_t low = previous & 0xffffu, high = previous >> 16;
+
+		while (length != 0ul) {
+			size_t block = length < adler32_block_length ? length
+			                                             : adler32_block_length;
+			length -= block;
+
+			// The modulo is only applied once per block.
+			for (; 16ul <= block; data += 16ul, block -= 16ul)
+				for (size_t i = 0ul; i < 16ul; i++) {
+					low += data[i];
+					high += low;
+				}
+			for (; block != 0ul; data++, block--) {
+				low += *data;
+				high += low;
+			}
+
+			low %= adler32_modulo;
+			high %= adler32_modulo;
+		}
+
+		return high << 16 | low;
+	}
+
+	uint32_t adler32_combine(uint32_t first, uint32_t second,
+	                         size_t second_length) noexcept {
+		auto remainder = static_cast<uint32_t>(second_length
+		                                       % adler32_modulo);
+
+		// The first chunk low sum is added once per byte of the second one.
+		uint32_t low = (first & 0xffffu) + (second & 0xffffu)
+		               + adler32_modulo - 1u;
+		uint64_t high = static_cast<uint64_t>(remainder) * (first & 0xffffu)
+		                % adler32_modulo;
+		high += (first >> 16) + (second >> 16) + adler32_modulo - remainder;
+
+		low %= adler32_modulo;
+		high %= adler32_modulo;
+
+		return static_cast<uint32_t>(high) << 16 | low;
+	}
+
+
+
+	void_t checksum_adler32::process(const byte_t *bytes,
+	                                 size_t length) noexcept {
+		this->state = adler32(bytes, length, this->state);
+	}
+
+	void_t checksum_adler32::restart() noexcept {
+		this->state = 1u;
+	}
+
+	uint1024_t checksum_adler32::calculate_hash() const noexcept {
+		return this->state;
+	}
+
+
+	checksum_adler32::checksum_adler32() noexcept
+	    : base_hash(hash_size::_32bit) { }
+	checksum_adler32::checksum_adler32(const string_view &data) noexcept
+	    : checksum_adler32() {
+		this->update(data);
+	}
+
+
+	uint64_t checksum_adler32::hash(const void_t *bytes,
+	                                size_t length) noexcept {
+		return adler32(bytes, length);
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_crypto_checksum_adler32_
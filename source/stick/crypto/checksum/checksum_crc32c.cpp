@@ -0,0 +1,301 @@
+/**
+ * CRC-32C (Castagnoli) checksum algorithm. Implementation
+ * @brief CRC-32C checksum algorithm implementation.
+ * @file checksum_crc32c.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../../include/stick/crypto/checksum/checksum_crc32c.hpp"
+
+#if defined(_stick_lib_crypto_checksum_crc32c_)
+
+
+#	include "../../../../include/stick/defines/arch.hpp"
+#	include "../../../../include/stick/defines/compiler.hpp"
+#	include "../../../../include/stick/templates/bit.tpp"
+
+#	if stick_IS_ARCH_x86_64                                                   \
+	    && (stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG)
+#		include <nmmintrin.h>
+#		define stick_CRC32C_SSE42 1
+#	endif
+
+
+namespace stick {
+
+
+	/// CRC-32C polynomial, bit reflected.
+	static const uint32_t crc32c_polynomial = 0x82f63b78u;
+
+	/// Bytes of every stream in the long interleaved rounds.
+	static const size_t crc32c_long_length = 8192ul;
+	/// Bytes of every stream in the short interleaved rounds.
+	static const size_t crc32c_short_length = 256ul;
+
+
+	/**
+	 * Multiply two polynomials modulo the CRC-32C polynomial, both bit
+	 * reflected.
+	 * @param [in] left First factor.
+	 * @param [in] right Second factor.
+	 * @return The product.
+	 */
+	static uint32_t crc32c_multiply(uint32_t left, uint32_t right) noexcept {
+		uint32_t product = 0u;
+		for (uint32_t mask = 0x80000000u; mask != 0u; mask >>= 1) {
+			if ((left & mask) != 0u)
+				product ^= right;
+			right = (right & 1u) != 0u ? (right >> 1) ^ crc32c_polynomial
+			                           : right >> 1;
+		}
+
+		return product;
+	}
+
+	/**
+	 * Get the polynomial that appends zero bytes to a CRC when multiplied by
+	 * it, x^(8 * bytes) modulo the CRC-32C polynomial.
+	 * @param [in] bytes Number of zero bytes.
+	 * @return The bit reflected polynomial.
+	 */
+	static uint32_t crc32c_zeros_operator(size_t bytes) noexcept {
+		uint32_t power = 0x80000000u, square = 0x00800000u;
+		for (; bytes != 0ul; bytes >>= 1) {
+			if ((bytes & 1ul) != 0ul)
+				power = crc32c_multiply(square, power);
+			square = crc32c_multiply(square, square);
+		}
+
+		return power;
+	}
+
+
+	/**
+	 * Lookup tables of the software and the interleaved implementations.
+	 */
+	struct crc32c_tables {
+		uint32_t slices[8][256];   ///< Slicing-by-8 tables.
+		uint32_t long_zeros[4][256];   ///< Append a long round of zeros.
+		uint32_t short_zeros[4][256];   ///< Append a short round of zeros.
+
+		/**
+		 * Compute all the tables.
+		 */
+		crc32c_tables() noexcept {
+			for (uint32_t i = 0u; i < 256u; i++) {
+				uint32_t crc = i;
+				for (size_t bit = 0ul; bit < 8ul; bit++)
+					crc = (crc & 1u) != 0u ? (crc >> 1) ^ crc32c_polynomial
+					                       : crc >> 1;
+
+				this->slices[0][i] = crc;
+			}
+			for (size_t slice = 1ul; slice < 8ul; slice++)
+				for (size_t i = 0ul; i < 256ul; i++) {
+					uint32_t crc = this->slices[slice - 1ul][i];
+					this->slices[slice][i] = (crc >> 8)
+					                         ^ this->slices[0][crc & 0xffu];
+				}
+
+			uint32_t long_operator = crc32c_zeros_operator(crc32c_long_length);
+			uint32_t short_operator = crc32c_zeros_operator(
+			    crc32c_short_length);
+			for (size_t octet = 0ul; octet < 4ul; octet++)
+				for (uint32_t i = 0u; i < 256u; i++) {
+					this->long_zeros[octet][i] = crc32c_multiply(
+					    long_operator, i << (8ul * octet));
+					this->short_zeros[octet][i] = crc32c_multiply(
+					    short_operator, i << (8ul * octet));
+				}
+		}
+	};
+
+	/**
+	 * Get the lookup tables, computing them the first time.
+	 * @return The lookup tables.
+	 */
+	static const crc32c_tables &crc32c_get_tables() noexcept {
+		static const crc32c_tables tables;
+
+		return tables;
+	}
+
+
+	/**
+	 * Append zero bytes to a CRC register with a zeros table.
+	 * @param [in] zeros Table of the number of zero bytes to append.
+	 * @param [in] crc CRC register.
+	 * @return CRC register after the zero bytes.
+	 */
+	static inline uint32_t crc32c_shift(const uint32_t (*zeros)[256],
+	                                    uint32_t crc) noexcept {
+		return zeros[0][crc & 0xffu] ^ zeros[1][(crc >> 8) & 0xffu]
+		       ^ zeros[2][(crc >> 16) & 0xffu] ^ zeros[3][crc >> 24];
+	}
+
+
+	/**
+	 * Continue a CRC register with slicing-by-8 tables.
+	 * @param [in] crc CRC register, the inverted checksum.
+	 * @param [in] bytes Data to checksum.
+	 * @param [in] length Number of bytes to checksum.
+	 * @return CRC register after the data.
+	 */
+	static uint32_t crc32c_software(uint32_t crc, const byte_t *bytes,
+	                                size_t length) noexcept {
+		const uint32_t(*slices)[256] = crc32c_get_tables().slices;
+
+		for (; 8ul <= length; bytes += 8ul, length -= 8ul) {
+			uint32_t low = crc ^ load_little_endian<uint32_t>(bytes);
+			uint32_t high = load_little_endian<uint32_t>(bytes + 4ul);
+
+			crc = slices[7][low & 0xffu] ^ slices[6][(low >> 8) & 0xffu]
+			      ^ slices[5][(low >> 16) & 0xffu] ^ slices[4][low >> 24]
+			      ^ slices[3][high & 0xffu] ^ slices[2][(high >> 8) & 0xffu]
+			      ^ slices[1][(high >> 16) & 0xffu] ^ slices[0][high >> 24];
+		}
+		for (; length != 0ul; bytes++, length--)
+			crc = (crc >> 8) ^ slices[0][(crc ^ *bytes) & 0xffu];
+
+		return crc;
+	}
+
+#	if stick_CRC32C_SSE42
+	/**
+	 * Continue a CRC register with the crc32 instruction. It has a latency
+	 * of 3 cycles and a throughput of 1, so big inputs are split in three
+	 * streams computed at once and merged with the zeros tables.
+	 * @param [in] crc CRC register, the inverted checksum.
+	 * @param [in] bytes Data to checksum.
+	 * @param [in] length Number of bytes to checksum.
+	 * @return CRC register after the data.
+	 */
+	__attribute__((target("sse4.2"))) static uint32_t
+	crc32c_sse42(uint32_t crc, const byte_t *bytes, size_t length) noexcept {
+		const crc32c_tables &tables = crc32c_get_tables();
+		uint64_t crc_first = crc;
+
+		for (; 3ul * crc32c_long_length <= length;
+		     bytes += 3ul * crc32c_long_length,
+		     length -= 3ul * crc32c_long_length) {
+			uint64_t crc_second = 0ul, crc_third = 0ul;
+			for (size_t i = 0ul; i < crc32c_long_length; i += 8ul) {
+				crc_first = _mm_crc32_u64(
+				    crc_first, load_little_endian<uint64_t>(bytes + i));
+				crc_second = _mm_crc32_u64(
+				    crc_second, load_little_endian<uint64_t>(
+				                    bytes + crc32c_long_length + i));
+				crc_third = _mm_crc32_u64(
+				    crc_third, load_little_endian<uint64_t>(
+				                   bytes + 2ul * crc32c_long_length + i));
+			}
+
+			crc_first = crc32c_shift(tables.long_zeros,
+			                         static_cast<uint32_t>(crc_first))
+			            ^ crc_second;
+			crc_first = crc32c_shift(tables.long_zeros,
+			                         static_cast<uint32_t>(crc_first))
+			            ^ crc_third;
+		}
+
+		for (; 3ul * crc32c_short_length <= length;
+		     bytes += 3ul * crc32c_short_length,
+		     length -= 3ul * crc32c_short_length) {
+			uint64_t crc_second = 0ul, crc_third = 0ul;
+			for (size_t i = 0ul; i < crc32c_short_length; i += 8ul) {
+				crc_first = _mm_crc32_u64(
+				    crc_first, load_little_endian<uint64_t>(bytes + i));
+				crc_second = _mm_crc32_u64(
+				    crc_second, load_little_endian<uint64_t>(
+				                    bytes + crc32c_short_length + i));
+				crc_third = _mm_crc32_u64(
+				    crc_third, load_little_endian<uint64_t>(
+				                   bytes + 2ul * crc32c_short_length + i));
+			}
+
+			crc_first = crc32c_shift(tables.short_zeros,
+			                         static_cast<uint32_t>(crc_first))
+			            ^ crc_second;
+			crc_first = crc32c_shift(tables.short_zeros,
+			                         static_cast<uint32_t>(crc_first))
+			            ^ crc_third;
+		}
+
+		for (; 8ul <= length; bytes += 8ul, length -= 8ul)
+			crc_first = _mm_crc32_u64(crc_first,
+			                          load_little_endian<uint64_t>(bytes));
+
+		auto result = static_cast<uint32_t>(crc_first);
+		for (; length != 0ul; bytes++, length--)
+			result = _mm_crc32_u8(result, *bytes);
+
+		return result;
+	}
+#	endif
+
+
+	/// Signature of the CRC register kernels.
+	typedef uint32_t (*crc32c_function)(uint32_t, const byte_t *, size_t);
+
+	/**
+	 * Choose the fastest kernel for the running CPU, only checked once.
+	 * @return The kernel to use.
+	 */
+	static crc32c_function crc32c_select_kernel() noexcept {
+		static const crc32c_function kernel =
+#	if stick_CRC32C_SSE42
+		    __builtin_cpu_supports("sse4.2") ? crc32c_sse42 : crc32c_software;
+#	else
+		    crc32c_software;
+#	endif
+
+		return kernel;
+	}
+
+
+
+	uint32_t crc32c(const void_t *bytes, size_t length,
+	                uint32_t previous) noexcept {
+		return ~crc32c_select_kernel()(
+		    ~previous, static_cast<const byte_t *>(bytes), length);
+	}
+
+	uint32_t crc32c_combine(uint32_t first, uint32_t second,
+	                        size_t second_length) noexcept {
+		return crc32c_multiply(crc32c_zeros_operator(second_length), first)
+		       ^ second;
+	}
+
+
+
+	void_t checksum_crc32c::process(const byte_t *bytes,
+	                                size_t length) noexcept {
+		this->state = crc32c(bytes, length, this->state);
+	}
+
+	void_t checksum_crc32c::restart() noexcept {
+		this->state = 0u;
+	}
+
+	uint1024_t checksum_crc32c::calculate_hash() const noexcept {
+		return this->state;
+	}
+
+
+	checksum_crc32c::checksum_crc32c() noexcept
+	    : base_hash(hash_size::_32bit) { }
+	checksum_crc32c::checksum_crc32c(const string_view &data) noexcept
+	    : checksum_crc32c() {
+		this->update(data);
+	}
+
+
+	uint64_t checksum_crc32c::hash(const void_t *bytes,
+	                               size_t length) noexcept {
+		return crc32c(bytes, length);
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_crypto_checksum_crc32c_
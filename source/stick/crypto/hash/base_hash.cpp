@@ -9,51 +9,102 @@
 #if defined(_stick_lib_crypto_hash_base_)
 
 
+#	include "../../../../include/stick/error/memory_error.hpp"
 #	include "../../../../include/stick/templates/numeric.tpp"
 
 
 namespace stick {
 
 
-	base_hash::base_hash(const string &data, hash_size length) noexcept
-	    : hash_data(data), hash_length(length), hash_result(0ul) { }
+	base_hash::base_hash(hash_size length) noexcept : hash_length(length) { }
 
-	base_hash::~base_hash() noexcept {
-		this->hash_data.~string();
-		this->hash_result = 0ul;
+
+
+	base_hash &base_hash::update(const void_t *bytes, size_t length) {
+		if (length == 0ul)
+			return *this;
+
+		if (bytes == nullptr)
+			throw memory_error("Hashing data from a nullptr.");
+
+		this->process(static_cast<const byte_t *>(bytes), length);
+		this->result_ready = false;
+
+		return *this;
 	}
+	base_hash &base_hash::update(const string_view &data) noexcept {
+		if (data.empty())
+			return *this;
 
+		this->process(reinterpret_cast<const byte_t *>(data.data()),
+		              data.length());
+		this->result_ready = false;
 
+		return *this;
+	}
 
-	uint64_t base_hash::hash() noexcept {
-		if (this->hash_result == 0ul)
+	uint64_t base_hash::finalize() noexcept {
+		if (not this->result_ready) {
 			this->hash_result = this->calculate_hash();
+			this->result_ready = true;
+		}
+
+		return static_cast<uint64_t>(this->hash_result);
+	}
+
+	base_hash &base_hash::reset() noexcept {
+		this->restart();
+		this->result_ready = false;
+
+		return *this;
+	}
+
+
+
+	uint64_t base_hash::hash() noexcept {
+		return this->finalize();
+	}
+	uint1024_t base_hash::wide_hash() noexcept {
+		this->finalize();
 
 		return this->hash_result;
 	}
 
 	string base_hash::hex_hash(bool_t prefix, bool_t caps) noexcept {
-		if (this->hash_result == 0ul)
-			this->hash_result = this->calculate_hash();
+		uint64_t result = this->finalize();
 
 		string hex_hash;
 		switch (this->size()) {
 		case hash_size::_8bit:
-			hex_hash = to_hex<uint8_t>(this->hash_result, prefix, caps);
+			hex_hash = to_hex<uint8_t>(result, prefix, caps);
 			break;
 		case hash_size::_16bit:
-			hex_hash = to_hex<uint16_t>(this->hash_result, prefix, caps);
+			hex_hash = to_hex<uint16_t>(result, prefix, caps);
 			break;
 		case hash_size::_32bit:
-			hex_hash = to_hex<uint32_t>(this->hash_result, prefix, caps);
+			hex_hash = to_hex<uint32_t>(result, prefix, caps);
+			break;
+		case hash_size::_64bit:
+			hex_hash = to_hex<uint64_t>(result, prefix, caps);
 			break;
 		case hash_size::_128bit:
+			hex_hash = to_hex(uint128_t(this->hash_result), prefix, caps);
+			break;
+		case hash_size::_160bit:
+			hex_hash = to_hex<uint32_t>(
+			               static_cast<uint64_t>(this->hash_result >> 128ul),
+			               prefix, caps)
+			               .append(to_hex(uint128_t(this->hash_result), false,
+			                              caps));
+			break;
 		case hash_size::_256bit:
+			hex_hash = to_hex(uint256_t(this->hash_result), prefix, caps);
+			break;
 		case hash_size::_512bit:
+			hex_hash = to_hex(uint512_t(this->hash_result), prefix, caps);
+			break;
 		case hash_size::_1024bit:
-			// TODO: Pending to do data types able to hold this lengths.
-		case hash_size::_64bit:
-			hex_hash = to_hex<uint64_t>(this->hash_result, prefix, caps);
+			hex_hash = to_hex(this->hash_result, prefix, caps);
 			break;
 		}
 
@@ -61,10 +112,6 @@ namespace stick {
 	}
 
 
-	string base_hash::data() const noexcept {
-		return this->hash_data;
-	}
-
 	hash_size base_hash::size() const noexcept {
 		return this->hash_length;
 	}
@@ -73,4 +120,4 @@ namespace stick {
 }   // namespace stick
 
 
-#endif   //_stick_lib_error_base_
+#endif   //_stick_lib_crypto_hash_base_
@@ -0,0 +1,1288 @@
+/**
+ * BLAKE3 hash algorithm. Implementation
+ * @brief BLAKE3 hash algorithm implementation.
+ * @file hash_blake3.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../../include/stick/crypto/hash/hash_blake3.hpp"
+
+#if defined(_stick_lib_crypto_hash_blake3_)
+
+
+#	include "../../../../include/stick/defines/arch.hpp"
+#	include "../../../../include/stick/defines/compiler.hpp"
+#	include "../../../../include/stick/defines/os.hpp"
+#	include "../../../../include/stick/error/generic_error.hpp"
+#	include "../../../../include/stick/templates/bit.tpp"
+#	include "../../../../include/stick/thread/thread_pool.hpp"
+
+
+#	if stick_OS_ID == stick_OS_ID_WINDOWS
+#		include <windows.h>
+#	else
+#		include <fcntl.h>
+#		include <sys/mman.h>
+#		include <sys/stat.h>
+#		include <unistd.h>
+#	endif
+
+#	if stick_IS_ARCH_x86_64                                                   \
+	    && (stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG)
+#		include <immintrin.h>
+#		define stick_BLAKE3_X86 1
+#	endif
+
+
+namespace stick {
+
+
+	/// Initial chaining value, the same as SHA-256.
+	static const uint32_t blake3_initial_state[8] = {
+		0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au,
+		0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u
+	};
+
+	/// Order of the message words used by every round.
+	static const uint8_t blake3_schedule[7][16] = {
+		{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+		{ 2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8 },
+		{ 3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1 },
+		{ 10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6 },
+		{ 12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4 },
+		{ 9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7 },
+		{ 11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13 }
+	};
+
+	/// Bytes of a block.
+	static const size_t blake3_block_length = 64ul;
+	/// Bytes of a chunk, the leaves of the tree.
+	static const size_t blake3_chunk_length = 1024ul;
+	/// Bytes of a chaining value.
+	static const size_t blake3_value_length = 32ul;
+
+	/// Flag of the first block of a chunk.
+	static const uint8_t blake3_flag_chunk_start = 1u;
+	/// Flag of the last block of a chunk.
+	static const uint8_t blake3_flag_chunk_end = 2u;
+	/// Flag of the parent nodes.
+	static const uint8_t blake3_flag_parent = 4u;
+	/// Flag of the root node.
+	static const uint8_t blake3_flag_root = 8u;
+
+	/// Fewest chunks of a tree worth hashing its subtrees in different
+	/// tasks of the pool.
+	static const size_t blake3_parallel_chunks = 128ul;
+
+
+	/**
+	 * Node of the tree waiting for its last compression, which depends on
+	 * it being the root or not.
+	 */
+	struct blake3_node {
+		uint32_t chaining_value[8];   ///< Input chaining value.
+		byte_t block[64];   ///< Last block, zero padded.
+		size_t block_length;   ///< Bytes of the block that hold data.
+		uint64_t counter;   ///< Index of the chunk, 0 for parents.
+		uint8_t flags;   ///< Flags of the node.
+	};
+
+
+	/**
+	 * Mix two message words into four state words.
+	 * @param [in,out] state State words.
+	 * @param [in] a Index of the first state word.
+	 * @param [in] b Index of the second state word.
+	 * @param [in] c Index of the third state word.
+	 * @param [in] d Index of the fourth state word.
+	 * @param [in] first First message word.
+	 * @param [in] second Second message word.
+	 */
+	static inline void_t blake3_mix(uint32_t *state, size_t a, size_t b,
+	                                size_t c, size_t d, uint32_t first,
+	                                uint32_t second) noexcept {
+		state[a] += state[b] + first;
+		state[d] = rotate_right(state[d] ^ state[a], 16ul);
+		state[c] += state[d];
+		state[b] = rotate_right(state[b] ^ state[c], 12ul);
+		state[a] += state[b] + second;
+		state[d] = rotate_right(state[d] ^ state[a], 8ul);
+		state[c] += state[d];
+		state[b] = rotate_right(state[b] ^ state[c], 7ul);
+	}
+
+	/**
+	 * Compress a block, the core of every node.
+	 * @param [out] output Where to write the 16 output words, the first 8
+	 * being the next chaining value. Can be the chaining value itself.
+	 * @param [in] chaining_value Input chaining value.
+	 * @param [in] block Block to compress, zero padded to 64 bytes.
+	 * @param [in] block_length Bytes of the block that hold data.
+	 * @param [in] counter Index of the chunk, or of the output block of the
+	 * root.
+	 * @param [in] flags Flags of the block.
+	 */
+	static void_t blake3_compress(uint32_t *output,
+	                              const uint32_t *chaining_value,
+	                              const byte_t *block, size_t block_length,
+	                              uint64_t counter, uint8_t flags) noexcept {
+		uint32_t message[16], state[16];
+		for (size_t i = 0ul; i < 16ul; i++)
+			message[i] = load_little_endian<uint32_t>(block + 4ul * i);
+
+		for (size_t i = 0ul; i < 8ul; i++)
+			state[i] = chaining_value[i];
+		for (size_t i = 0ul; i < 4ul; i++)
+			state[8ul + i] = blake3_initial_state[i];
+		state[12] = static_cast<uint32_t>(counter);
+		state[13] = static_cast<uint32_t>(counter >> 32);
+		state[14] = static_cast<uint32_t>(block_length);
+		state[15] = flags;
+
+		for (size_t round = 0ul; round < 7ul; round++) {
+			const uint8_t *order = blake3_schedule[round];
+			blake3_mix(state, 0, 4, 8, 12, message[order[0]],
+			           message[order[1]]);
+			blake3_mix(state, 1, 5, 9, 13, message[order[2]],
+			           message[order[3]]);
+			blake3_mix(state, 2, 6, 10, 14, message[order[4]],
+			           message[order[5]]);
+			blake3_mix(state, 3, 7, 11, 15, message[order[6]],
+			           message[order[7]]);
+			blake3_mix(state, 0, 5, 10, 15, message[order[8]],
+			           message[order[9]]);
+			blake3_mix(state, 1, 6, 11, 12, message[order[10]],
+			           message[order[11]]);
+			blake3_mix(state, 2, 7, 8, 13, message[order[12]],
+			           message[order[13]]);
+			blake3_mix(state, 3, 4, 9, 14, message[order[14]],
+			           message[order[15]]);
+		}
+
+		for (size_t i = 0ul; i < 8ul; i++) {
+			output[8ul + i] = state[8ul + i] ^ chaining_value[i];
+			output[i] = state[i] ^ state[8ul + i];
+		}
+	}
+
+
+	/**
+	 * Build a node from its last block.
+	 * @param [in] chaining_value Input chaining value.
+	 * @param [in] block Data of the last block.
+	 * @param [in] block_length Bytes of data, up to 64.
+	 * @param [in] counter Index of the chunk, 0 for parents.
+	 * @param [in] flags Flags of the node.
+	 * @return The node.
+	 */
+	static blake3_node blake3_make_node(const uint32_t *chaining_value,
+	                                    const byte_t *block,
+	                                    size_t block_length, uint64_t counter,
+	                                    uint8_t flags) noexcept {
+		blake3_node node;
+		for (size_t i = 0ul; i < 8ul; i++)
+			node.chaining_value[i] = chaining_value[i];
+		for (size_t i = 0ul; i < block_length; i++)
+			node.block[i] = block[i];
+		for (size_t i = block_length; i < blake3_block_length; i++)
+			node.block[i] = 0u;
+
+		node.block_length = block_length;
+		node.counter = counter;
+		node.flags = flags;
+
+		return node;
+	}
+
+	/**
+	 * Build the parent node of two subtrees.
+	 * @param [in] left Chaining value of the left subtree.
+	 * @param [in] right Chaining value of the right subtree.
+	 * @return The node.
+	 */
+	static blake3_node blake3_parent(const uint32_t *left,
+	                                 const uint32_t *right) noexcept {
+		byte_t block[64];
+		for (size_t i = 0ul; i < 8ul; i++) {
+			store_little_endian(block + 4ul * i, left[i]);
+			store_little_endian(block + 32ul + 4ul * i, right[i]);
+		}
+
+		return blake3_make_node(blake3_initial_state, block,
+		                        blake3_block_length, 0ul, blake3_flag_parent);
+	}
+
+	/**
+	 * Compress all but the last block of a chunk.
+	 * @param [in] bytes Data of the chunk.
+	 * @param [in] length Bytes of the chunk, up to 1024. Only the empty input
+	 * has an empty chunk.
+	 * @param [in] counter Index of the chunk.
+	 * @return The node of the chunk.
+	 */
+	static blake3_node blake3_chunk(const byte_t *bytes, size_t length,
+	                                uint64_t counter) noexcept {
+		uint32_t state[16];
+		for (size_t i = 0ul; i < 8ul; i++)
+			state[i] = blake3_initial_state[i];
+
+		size_t blocks = length == 0ul ? 0ul
+		                              : (length - 1ul) / blake3_block_length;
+		for (size_t block = 0ul; block < blocks; block++)
+			blake3_compress(state, state, bytes + block * blake3_block_length,
+			                blake3_block_length, counter,
+			                block == 0ul ? blake3_flag_chunk_start : 0u);
+
+		return blake3_make_node(
+		    state, bytes + blocks * blake3_block_length,
+		    length - blocks * blake3_block_length, counter,
+		    (blocks == 0ul ? blake3_flag_chunk_start : 0u)
+		        | blake3_flag_chunk_end);
+	}
+
+	/**
+	 * Get the chaining value of a node that is not the root.
+	 * @param [in] node Node to finish.
+	 * @param [out] chaining_value Where to write the chaining value.
+	 */
+	static void_t blake3_chaining_value(const blake3_node &node,
+	                                    uint32_t *chaining_value) noexcept {
+		uint32_t output[16];
+		blake3_compress(output, node.chaining_value, node.block,
+		                node.block_length, node.counter, node.flags);
+
+		for (size_t i = 0ul; i < 8ul; i++)
+			chaining_value[i] = output[i];
+	}
+
+	/**
+	 * Get the extendable output of the root node.
+	 * @param [in] node Root node.
+	 * @param [out] digest Where to write the output.
+	 * @param [in] length Bytes of output.
+	 */
+	static void_t blake3_output(const blake3_node &node, byte_t *digest,
+	                            size_t length) noexcept {
+		for (uint64_t counter = 0ul; length != 0ul; counter++) {
+			uint32_t output[16];
+			blake3_compress(output, node.chaining_value, node.block,
+			                node.block_length, counter,
+			                node.flags | blake3_flag_root);
+
+			byte_t bytes[64];
+			for (size_t i = 0ul; i < 16ul; i++)
+				store_little_endian(bytes + 4ul * i, output[i]);
+
+			size_t amount = length < blake3_block_length ? length
+			                                             : blake3_block_length;
+			for (size_t i = 0ul; i < amount; i++)
+				digest[i] = bytes[i];
+
+			digest += amount;
+			length -= amount;
+		}
+	}
+
+
+	/**
+	 * Get the flags of a block in a lane.
+	 * @param [in] block Index of the block.
+	 * @param [in] blocks Blocks of the lane.
+	 * @param [in] chunks If the lanes hold chunks or parents.
+	 * @return The flags.
+	 */
+	static inline uint8_t blake3_lane_flags(size_t block, size_t blocks,
+	                                        bool_t chunks) noexcept {
+		if (not chunks)
+			return blake3_flag_parent;
+
+		return static_cast<uint8_t>(
+		    (block == 0ul ? blake3_flag_chunk_start : 0u)
+		    | (block + 1ul == blocks ? blake3_flag_chunk_end : 0u));
+	}
+
+	/**
+	 * Hash one chunk, or parent, into its chaining value.
+	 * @param [in] inputs Data of the input.
+	 * @param [in] blocks Blocks of the input.
+	 * @param [in] counter Index of the chunk.
+	 * @param [in] chunks If the input is a chunk or a parent.
+	 * @param [out] output Where to write the chaining value.
+	 */
+	static void_t blake3_hash_x1(const byte_t *const *inputs, size_t blocks,
+	                             uint64_t counter, bool_t chunks,
+	                             byte_t *output) noexcept {
+		uint32_t state[16];
+		for (size_t i = 0ul; i < 8ul; i++)
+			state[i] = blake3_initial_state[i];
+
+		for (size_t block = 0ul; block < blocks; block++)
+			blake3_compress(state, state,
+			                inputs[0] + block * blake3_block_length,
+			                blake3_block_length, chunks ? counter : 0ul,
+			                blake3_lane_flags(block, blocks, chunks));
+
+		for (size_t i = 0ul; i < 8ul; i++)
+			store_little_endian(output + 4ul * i, state[i]);
+	}
+
+
+#	if stick_BLAKE3_X86
+	/**
+	 * Get the counter words of every lane.
+	 * @param [out] low Where to write the low words.
+	 * @param [out] high Where to write the high words.
+	 * @param [in] lanes Number of lanes.
+	 * @param [in] counter Index of the chunk of the first lane.
+	 * @param [in] chunks If the lanes hold chunks, parents use 0.
+	 */
+	static inline void_t blake3_lane_counters(uint32_t *low, uint32_t *high,
+	                                          size_t lanes, uint64_t counter,
+	                                          bool_t chunks) noexcept {
+		for (size_t lane = 0ul; lane < lanes; lane++) {
+			uint64_t value = chunks ? counter + lane : 0ul;
+			low[lane] = static_cast<uint32_t>(value);
+			high[lane] = static_cast<uint32_t>(value >> 32);
+		}
+	}
+
+	/**
+	 * Write the chaining values of every lane.
+	 * @param [out] output Where to write the chaining values.
+	 * @param [in] words Chaining values word by word, each word holding all
+	 * the lanes.
+	 * @param [in] lanes Number of lanes.
+	 */
+	static inline void_t blake3_store_lanes(byte_t *output,
+	                                        const uint32_t *words,
+	                                        size_t lanes) noexcept {
+		for (size_t lane = 0ul; lane < lanes; lane++)
+			for (size_t i = 0ul; i < 8ul; i++)
+				store_little_endian(output + blake3_value_length * lane
+				                        + 4ul * i,
+				                    words[i * lanes + lane]);
+	}
+
+
+	/**
+	 * Mix two message vectors into four state vectors of 4 lanes.
+	 * @param [in,out] state State vectors.
+	 * @param [in] a Index of the first state vector.
+	 * @param [in] b Index of the second state vector.
+	 * @param [in] c Index of the third state vector.
+	 * @param [in] d Index of the fourth state vector.
+	 * @param [in] first First message vector.
+	 * @param [in] second Second message vector.
+	 */
+	__attribute__((target("sse4.1"))) static inline void_t
+	blake3_mix_x4(__m128i *state, size_t a, size_t b, size_t c, size_t d,
+	              __m128i first, __m128i second) noexcept {
+		const __m128i rotate_16 = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10,
+		                                        11, 8, 9, 14, 15, 12, 13);
+		const __m128i rotate_8 = _mm_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10,
+		                                       11, 8, 13, 14, 15, 12);
+
+		state[a] = _mm_add_epi32(_mm_add_epi32(state[a], state[b]), first);
+		state[d] = _mm_shuffle_epi8(_mm_xor_si128(state[d], state[a]),
+		                            rotate_16);
+		state[c] = _mm_add_epi32(state[c], state[d]);
+		state[b] = _mm_xor_si128(state[b], state[c]);
+		state[b] = _mm_or_si128(_mm_srli_epi32(state[b], 12),
+		                        _mm_slli_epi32(state[b], 20));
+		state[a] = _mm_add_epi32(_mm_add_epi32(state[a], state[b]), second);
+		state[d] = _mm_shuffle_epi8(_mm_xor_si128(state[d], state[a]),
+		                            rotate_8);
+		state[c] = _mm_add_epi32(state[c], state[d]);
+		state[b] = _mm_xor_si128(state[b], state[c]);
+		state[b] = _mm_or_si128(_mm_srli_epi32(state[b], 7),
+		                        _mm_slli_epi32(state[b], 25));
+	}
+
+	/**
+	 * Hash 4 chunks, or parents, at once, one per 32 bits lane.
+	 * @param [in] inputs Data of every input.
+	 * @param [in] blocks Blocks of every input.
+	 * @param [in] counter Index of the first chunk.
+	 * @param [in] chunks If the inputs are chunks or parents.
+	 * @param [out] output Where to write the chaining values.
+	 */
+	__attribute__((target("sse4.1"))) static void_t
+	blake3_hash_x4(const byte_t *const *inputs, size_t blocks,
+	               uint64_t counter, bool_t chunks, byte_t *output) noexcept {
+		uint32_t counter_low[4], counter_high[4];
+		blake3_lane_counters(counter_low, counter_high, 4ul, counter, chunks);
+
+		__m128i words[8];
+		for (size_t i = 0ul; i < 8ul; i++)
+			words[i] = _mm_set1_epi32(
+			    static_cast<int_t>(blake3_initial_state[i]));
+
+		for (size_t block = 0ul; block < blocks; block++) {
+			// Transpose the blocks, so each vector holds a word of all lanes.
+			__m128i message[16];
+			for (size_t quarter = 0ul; quarter < 4ul; quarter++) {
+				__m128i rows[4];
+				for (size_t lane = 0ul; lane < 4ul; lane++)
+					rows[lane] = _mm_loadu_si128(
+					    reinterpret_cast<const __m128i *>(
+					        inputs[lane] + block * blake3_block_length)
+					    + quarter);
+
+				__m128i pairs[4];
+				pairs[0] = _mm_unpacklo_epi32(rows[0], rows[1]);
+				pairs[1] = _mm_unpackhi_epi32(rows[0], rows[1]);
+				pairs[2] = _mm_unpacklo_epi32(rows[2], rows[3]);
+				pairs[3] = _mm_unpackhi_epi32(rows[2], rows[3]);
+
+				message[4ul * quarter] = _mm_unpacklo_epi64(pairs[0],
+				                                            pairs[2]);
+				message[4ul * quarter + 1ul] = _mm_unpackhi_epi64(pairs[0],
+				                                                  pairs[2]);
+				message[4ul * quarter + 2ul] = _mm_unpacklo_epi64(pairs[1],
+				                                                  pairs[3]);
+				message[4ul * quarter + 3ul] = _mm_unpackhi_epi64(pairs[1],
+				                                                  pairs[3]);
+			}
+
+			__m128i state[16];
+			for (size_t i = 0ul; i < 8ul; i++)
+				state[i] = words[i];
+			for (size_t i = 0ul; i < 4ul; i++)
+				state[8ul + i] = _mm_set1_epi32(
+				    static_cast<int_t>(blake3_initial_state[i]));
+			state[12] = _mm_loadu_si128(
+			    reinterpret_cast<const __m128i *>(counter_low));
+			state[13] = _mm_loadu_si128(
+			    reinterpret_cast<const __m128i *>(counter_high));
+			state[14] = _mm_set1_epi32(
+			    static_cast<int_t>(blake3_block_length));
+			state[15] = _mm_set1_epi32(
+			    blake3_lane_flags(block, blocks, chunks));
+
+			for (size_t round = 0ul; round < 7ul; round++) {
+				const uint8_t *order = blake3_schedule[round];
+				blake3_mix_x4(state, 0, 4, 8, 12, message[order[0]],
+				              message[order[1]]);
+				blake3_mix_x4(state, 1, 5, 9, 13, message[order[2]],
+				              message[order[3]]);
+				blake3_mix_x4(state, 2, 6, 10, 14, message[order[4]],
+				              message[order[5]]);
+				blake3_mix_x4(state, 3, 7, 11, 15, message[order[6]],
+				              message[order[7]]);
+				blake3_mix_x4(state, 0, 5, 10, 15, message[order[8]],
+				              message[order[9]]);
+				blake3_mix_x4(state, 1, 6, 11, 12, message[order[10]],
+				              message[order[11]]);
+				blake3_mix_x4(state, 2, 7, 8, 13, message[order[12]],
+				              message[order[13]]);
+				blake3_mix_x4(state, 3, 4, 9, 14, message[order[14]],
+				              message[order[15]]);
+			}
+
+			for (size_t i = 0ul; i < 8ul; i++)
+				words[i] = _mm_xor_si128(state[i], state[8ul + i]);
+		}
+
+		uint32_t result[8][4];
+		for (size_t i = 0ul; i < 8ul; i++)
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result[i]), words[i]);
+		blake3_store_lanes(output, result[0], 4ul);
+	}
+
+
+	/**
+	 * Mix two message vectors into four state vectors of 8 lanes.
+	 * @param [in,out] state State vectors.
+	 * @param [in] a Index of the first state vector.
+	 * @param [in] b Index of the second state vector.
+	 * @param [in] c Index of the third state vector.
+	 * @param [in] d Index of the fourth state vector.
+	 * @param [in] first First message vector.
+	 * @param [in] second Second message vector.
+	 */
+	__attribute__((target("avx2"))) static inline void_t
+	blake3_mix_x8(__m256i *state, size_t a, size_t b, size_t c, size_t d,
+	              __m256i first, __m256i second) noexcept {
+		const __m256i rotate_16 = _mm256_setr_epi8(
+		    2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13, 2, 3, 0, 1,
+		    6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+		const __m256i rotate_8 = _mm256_setr_epi8(
+		    1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12, 1, 2, 3, 0,
+		    5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+
+		state[a] = _mm256_add_epi32(_mm256_add_epi32(state[a], state[b]),
+		                            first);
+		state[d] = _mm256_shuffle_epi8(_mm256_xor_si256(state[d], state[a]),
+		                               rotate_16);
+		state[c] = _mm256_add_epi32(state[c], state[d]);
+		state[b] = _mm256_xor_si256(state[b], state[c]);
+		state[b] = _mm256_or_si256(_mm256_srli_epi32(state[b], 12),
+		                           _mm256_slli_epi32(state[b], 20));
+		state[a] = _mm256_add_epi32(_mm256_add_epi32(state[a], state[b]),
+		                            second);
+		state[d] = _mm256_shuffle_epi8(_mm256_xor_si256(state[d], state[a]),
+		                               rotate_8);
+		state[c] = _mm256_add_epi32(state[c], state[d]);
+		state[b] = _mm256_xor_si256(state[b], state[c]);
+		state[b] = _mm256_or_si256(_mm256_srli_epi32(state[b], 7),
+		                           _mm256_slli_epi32(state[b], 25));
+	}
+
+	/**
+	 * Hash 8 chunks, or parents, at once, one per 32 bits lane.
+	 * @param [in] inputs Data of every input.
+	 * @param [in] blocks Blocks of every input.
+	 * @param [in] counter Index of the first chunk.
+	 * @param [in] chunks If the inputs are chunks or parents.
+	 * @param [out] output Where to write the chaining values.
+	 */
+	__attribute__((target("avx2"))) static void_t
+	blake3_hash_x8(const byte_t *const *inputs, size_t blocks,
+	               uint64_t counter, bool_t chunks, byte_t *output) noexcept {
+		uint32_t counter_low[8], counter_high[8];
+		blake3_lane_counters(counter_low, counter_high, 8ul, counter, chunks);
+
+		__m256i words[8];
+		for (size_t i = 0ul; i < 8ul; i++)
+			words[i] = _mm256_set1_epi32(
+			    static_cast<int_t>(blake3_initial_state[i]));
+
+		for (size_t block = 0ul; block < blocks; block++) {
+			// Transpose the blocks, so each vector holds a word of all lanes.
+			__m256i message[16];
+			for (size_t half = 0ul; half < 2ul; half++) {
+				__m256i rows[8];
+				for (size_t lane = 0ul; lane < 8ul; lane++)
+					rows[lane] = _mm256_loadu_si256(
+					    reinterpret_cast<const __m256i *>(
+					        inputs[lane] + block * blake3_block_length)
+					    + half);
+
+				__m256i pairs[8], quads[8];
+				for (size_t i = 0ul; i < 8ul; i += 2ul) {
+					pairs[i] = _mm256_unpacklo_epi32(rows[i], rows[i + 1ul]);
+					pairs[i + 1ul] = _mm256_unpackhi_epi32(rows[i],
+					                                       rows[i + 1ul]);
+				}
+				for (size_t i = 0ul; i < 8ul; i += 4ul) {
+					quads[i] = _mm256_unpacklo_epi64(pairs[i], pairs[i + 2ul]);
+					quads[i + 1ul] = _mm256_unpackhi_epi64(pairs[i],
+					                                       pairs[i + 2ul]);
+					quads[i + 2ul] = _mm256_unpacklo_epi64(pairs[i + 1ul],
+					                                       pairs[i + 3ul]);
+					quads[i + 3ul] = _mm256_unpackhi_epi64(pairs[i + 1ul],
+					                                       pairs[i + 3ul]);
+				}
+				for (size_t i = 0ul; i < 4ul; i++) {
+					message[8ul * half + i] = _mm256_permute2x128_si256(
+					    quads[i], quads[i + 4ul], 0x20);
+					message[8ul * half + i + 4ul] = _mm256_permute2x128_si256(
+					    quads[i], quads[i + 4ul], 0x31);
+				}
+			}
+
+			__m256i state[16];
+			for (size_t i = 0ul; i < 8ul; i++)
+				state[i] = words[i];
+			for (size_t i = 0ul; i < 4ul; i++)
+				state[8ul + i] = _mm256_set1_epi32(
+				    static_cast<int_t>(blake3_initial_state[i]));
+			state[12] = _mm256_loadu_si256(
+			    reinterpret_cast<const __m256i *>(counter_low));
+			state[13] = _mm256_loadu_si256(
+			    reinterpret_cast<const __m256i *>(counter_high));
+			state[14] = _mm256_set1_epi32(
+			    static_cast<int_t>(blake3_block_length));
+			state[15] = _mm256_set1_epi32(
+			    blake3_lane_flags(block, blocks, chunks));
+
+			for (size_t round = 0ul; round < 7ul; round++) {
+				const uint8_t *order = blake3_schedule[round];
+				blake3_mix_x8(state, 0, 4, 8, 12, message[order[0]],
+				              message[order[1]]);
+				blake3_mix_x8(state, 1, 5, 9, 13, message[order[2]],
+				              message[order[3]]);
+				blake3_mix_x8(state, 2, 6, 10, 14, message[order[4]],
+				              message[order[5]]);
+				blake3_mix_x8(state, 3, 7, 11, 15, message[order[6]],
+				              message[order[7]]);
+				blake3_mix_x8(state, 0, 5, 10, 15, message[order[8]],
+				              message[order[9]]);
+				blake3_mix_x8(state, 1, 6, 11, 12, message[order[10]],
+				              message[order[11]]);
+				blake3_mix_x8(state, 2, 7, 8, 13, message[order[12]],
+				              message[order[13]]);
+				blake3_mix_x8(state, 3, 4, 9, 14, message[order[14]],
+				              message[order[15]]);
+			}
+
+			for (size_t i = 0ul; i < 8ul; i++)
+				words[i] = _mm256_xor_si256(state[i], state[8ul + i]);
+		}
+
+		uint32_t result[8][8];
+		for (size_t i = 0ul; i < 8ul; i++)
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(result[i]),
+			                    words[i]);
+		blake3_store_lanes(output, result[0], 8ul);
+	}
+
+
+	/// Every lane of a vector of 16 words. The unmasked AVX-512 intrinsics
+	/// start from _mm512_undefined_epi32(), which GCC 12 reports as used
+	/// uninitialized, so the kernel uses the zero masked ones with every lane
+	/// set: the same instructions.
+	static const uint16_t blake3_all_lanes = 0xffffu;
+	/// Every lane of a vector of 8 double words.
+	static const uint8_t blake3_all_pairs = 0xffu;
+
+	/**
+	 * Mix two message vectors into four state vectors of 16 lanes.
+	 * @param [in,out] state State vectors.
+	 * @param [in] a Index of the first state vector.
+	 * @param [in] b Index of the second state vector.
+	 * @param [in] c Index of the third state vector.
+	 * @param [in] d Index of the fourth state vector.
+	 * @param [in] first First message vector.
+	 * @param [in] second Second message vector.
+	 */
+	__attribute__((target("avx512f"))) static inline void_t
+	blake3_mix_x16(__m512i *state, size_t a, size_t b, size_t c, size_t d,
+	               __m512i first, __m512i second) noexcept {
+		state[a] = _mm512_add_epi32(_mm512_add_epi32(state[a], state[b]),
+		                            first);
+		state[d] = _mm512_maskz_ror_epi32(
+		    blake3_all_lanes, _mm512_xor_si512(state[d], state[a]), 16);
+		state[c] = _mm512_add_epi32(state[c], state[d]);
+		state[b] = _mm512_maskz_ror_epi32(
+		    blake3_all_lanes, _mm512_xor_si512(state[b], state[c]), 12);
+		state[a] = _mm512_add_epi32(_mm512_add_epi32(state[a], state[b]),
+		                            second);
+		state[d] = _mm512_maskz_ror_epi32(
+		    blake3_all_lanes, _mm512_xor_si512(state[d], state[a]), 8);
+		state[c] = _mm512_add_epi32(state[c], state[d]);
+		state[b] = _mm512_maskz_ror_epi32(
+		    blake3_all_lanes, _mm512_xor_si512(state[b], state[c]), 7);
+	}
+
+	/**
+	 * Hash 16 chunks, or parents, at once, one per 32 bits lane.
+	 * @param [in] inputs Data of every input.
+	 * @param [in] blocks Blocks of every input.
+	 * @param [in] counter Index of the first chunk.
+	 * @param [in] chunks If the inputs are chunks or parents.
+	 * @param [out] output Where to write the chaining values.
+	 */
+	__attribute__((target("avx512f"))) static void_t
+	blake3_hash_x16(const byte_t *const *inputs, size_t blocks,
+	                uint64_t counter, bool_t chunks, byte_t *output) noexcept {
+		uint32_t counter_low[16], counter_high[16];
+		blake3_lane_counters(counter_low, counter_high, 16ul, counter,
+		                     chunks);
+
+		__m512i words[8];
+		for (size_t i = 0ul; i < 8ul; i++)
+			words[i] = _mm512_set1_epi32(
+			    static_cast<int_t>(blake3_initial_state[i]));
+
+		for (size_t block = 0ul; block < blocks; block++) {
+			// Transpose the blocks, so each vector holds a word of all lanes.
+			__m512i rows[16];
+			for (size_t lane = 0ul; lane < 16ul; lane++)
+				rows[lane] = _mm512_loadu_si512(inputs[lane]
+				                                + block * blake3_block_length);
+
+			// Transpose every 4 x 4 square of words first.
+			__m512i pairs[16], quads[16];
+			for (size_t i = 0ul; i < 16ul; i += 2ul) {
+				pairs[i] = _mm512_maskz_unpacklo_epi32(blake3_all_lanes,
+				                                       rows[i], rows[i + 1ul]);
+				pairs[i + 1ul] = _mm512_maskz_unpackhi_epi32(
+				    blake3_all_lanes, rows[i], rows[i + 1ul]);
+			}
+			for (size_t i = 0ul; i < 16ul; i += 4ul) {
+				quads[i] = _mm512_maskz_unpacklo_epi64(
+				    blake3_all_pairs, pairs[i], pairs[i + 2ul]);
+				quads[i + 1ul] = _mm512_maskz_unpackhi_epi64(
+				    blake3_all_pairs, pairs[i], pairs[i + 2ul]);
+				quads[i + 2ul] = _mm512_maskz_unpacklo_epi64(
+				    blake3_all_pairs, pairs[i + 1ul], pairs[i + 3ul]);
+				quads[i + 3ul] = _mm512_maskz_unpackhi_epi64(
+				    blake3_all_pairs, pairs[i + 1ul], pairs[i + 3ul]);
+			}
+
+			// And then the 4 x 4 squares themselves.
+			__m512i message[16];
+			for (size_t i = 0ul; i < 4ul; i++) {
+				__m512i low_first = _mm512_maskz_shuffle_i32x4(
+				    blake3_all_lanes, quads[i], quads[4ul + i], 0x44);
+				__m512i high_first = _mm512_maskz_shuffle_i32x4(
+				    blake3_all_lanes, quads[i], quads[4ul + i], 0xee);
+				__m512i low_second = _mm512_maskz_shuffle_i32x4(
+				    blake3_all_lanes, quads[8ul + i], quads[12ul + i], 0x44);
+				__m512i high_second = _mm512_maskz_shuffle_i32x4(
+				    blake3_all_lanes, quads[8ul + i], quads[12ul + i], 0xee);
+
+				message[i] = _mm512_maskz_shuffle_i32x4(
+				    blake3_all_lanes, low_first, low_second, 0x88);
+				message[4ul + i] = _mm512_maskz_shuffle_i32x4(
+				    blake3_all_lanes, low_first, low_second, 0xdd);
+				message[8ul + i] = _mm512_maskz_shuffle_i32x4(
+				    blake3_all_lanes, high_first, high_second, 0x88);
+				message[12ul + i] = _mm512_maskz_shuffle_i32x4(
+				    blake3_all_lanes, high_first, high_second, 0xdd);
+			}
+
+			__m512i state[16];
+			for (size_t i = 0ul; i < 8ul; i++)
+				state[i] = words[i];
+			for (size_t i = 0ul; i < 4ul; i++)
+				state[8ul + i] = _mm512_set1_epi32(
+				    static_cast<int_t>(blake3_initial_state[i]));
+			state[12] = _mm512_loadu_si512(counter_low);
+			state[13] = _mm512_loadu_si512(counter_high);
+			state[14] = _mm512_set1_epi32(
+			    static_cast<int_t>(blake3_block_length));
+			state[15] = _mm512_set1_epi32(
+			    blake3_lane_flags(block, blocks, chunks));
+
+			for (size_t round = 0ul; round < 7ul; round++) {
+				const uint8_t *order = blake3_schedule[round];
+				blake3_mix_x16(state, 0, 4, 8, 12, message[order[0]],
+				               message[order[1]]);
+				blake3_mix_x16(state, 1, 5, 9, 13, message[order[2]],
+				               message[order[3]]);
+				blake3_mix_x16(state, 2, 6, 10, 14, message[order[4]],
+				               message[order[5]]);
+				blake3_mix_x16(state, 3, 7, 11, 15, message[order[6]],
+				               message[order[7]]);
+				blake3_mix_x16(state, 0, 5, 10, 15, message[order[8]],
+				               message[order[9]]);
+				blake3_mix_x16(state, 1, 6, 11, 12, message[order[10]],
+				               message[order[11]]);
+				blake3_mix_x16(state, 2, 7, 8, 13, message[order[12]],
+				               message[order[13]]);
+				blake3_mix_x16(state, 3, 4, 9, 14, message[order[14]],
+				               message[order[15]]);
+			}
+
+			for (size_t i = 0ul; i < 8ul; i++)
+				words[i] = _mm512_xor_si512(state[i], state[8ul + i]);
+		}
+
+		uint32_t result[8][16];
+		for (size_t i = 0ul; i < 8ul; i++)
+			_mm512_storeu_si512(result[i], words[i]);
+		blake3_store_lanes(output, result[0], 16ul);
+	}
+#	endif
+
+
+	/**
+	 * Choose the widest kernel for the running CPU, only checked once.
+	 * @return Lanes of the widest kernel, 16, 8, 4 or 1.
+	 */
+	static size_t blake3_select_lanes() noexcept {
+		static const size_t lanes =
+#	if stick_BLAKE3_X86
+		    __builtin_cpu_supports("avx512f") ? 16ul
+		    : __builtin_cpu_supports("avx2")  ? 8ul
+		    : __builtin_cpu_supports("sse4.1") ? 4ul
+		                                       : 1ul;
+#	else
+		    1ul;
+#	endif
+
+		return lanes;
+	}
+
+	/**
+	 * Hash many chunks, or parents, with the widest kernels that they fill.
+	 * @param [in] inputs Data of every input.
+	 * @param [in] amount Number of inputs.
+	 * @param [in] blocks Blocks of every input.
+	 * @param [in] counter Index of the first chunk.
+	 * @param [in] chunks If the inputs are chunks or parents.
+	 * @param [out] output Where to write the chaining values.
+	 */
+	static void_t blake3_hash_many(const byte_t *const *inputs, size_t amount,
+	                               size_t blocks, uint64_t counter,
+	                               bool_t chunks, byte_t *output) noexcept {
+		size_t lanes = blake3_select_lanes();
+
+		while (amount != 0ul) {
+			size_t step = 1ul;
+#	if stick_BLAKE3_X86
+			if (16ul <= lanes and 16ul <= amount) {
+				blake3_hash_x16(inputs, blocks, counter, chunks, output);
+				step = 16ul;
+			} else if (8ul <= lanes and 8ul <= amount) {
+				blake3_hash_x8(inputs, blocks, counter, chunks, output);
+				step = 8ul;
+			} else if (4ul <= lanes and 4ul <= amount) {
+				blake3_hash_x4(inputs, blocks, counter, chunks, output);
+				step = 4ul;
+			} else
+#	endif
+				blake3_hash_x1(inputs, blocks, counter, chunks, output);
+
+			inputs += step;
+			amount -= step;
+			counter += step;
+			output += step * blake3_value_length;
+		}
+	}
+
+
+	/**
+	 * Get the length of the left subtree, the most chunks that are a power
+	 * of two and leave some data for the right one.
+	 * @param [in] length Bytes of the tree, over a chunk.
+	 * @return Bytes of the left subtree.
+	 */
+	static size_t blake3_left_length(size_t length) noexcept {
+		size_t chunks = (length - 1ul) / blake3_chunk_length;
+
+		return blake3_chunk_length
+		       << (8ul * sizeof(size_t) - 1ul - count_leading_zeros(chunks));
+	}
+
+	/**
+	 * Compress the chunks of a tree that fit the lanes all at once and merge
+	 * them level by level.
+	 * @param [out] values Where to write the chaining values left.
+	 * @param [in] bytes Data of the tree.
+	 * @param [in] length Bytes of the tree, up to a chunk per lane.
+	 * @param [in] counter Index of its first chunk.
+	 * @param [in] keep Chaining values to stop at, 1 for a subtree or 2 for
+	 * the children of a tree.
+	 */
+	static void_t blake3_leaves(byte_t (*values)[32], const byte_t *bytes,
+	                            size_t length, uint64_t counter,
+	                            size_t keep) noexcept {
+		const byte_t *inputs[16];
+		size_t whole_chunks = length / blake3_chunk_length;
+		for (size_t i = 0ul; i < whole_chunks; i++)
+			inputs[i] = bytes + i * blake3_chunk_length;
+		blake3_hash_many(inputs, whole_chunks,
+		                 blake3_chunk_length / blake3_block_length, counter,
+		                 true, values[0]);
+
+		size_t amount = whole_chunks;
+		if (length % blake3_chunk_length != 0ul) {
+			uint32_t last[8];
+			blake3_chaining_value(
+			    blake3_chunk(bytes + whole_chunks * blake3_chunk_length,
+			                 length % blake3_chunk_length,
+			                 counter + whole_chunks),
+			    last);
+			for (size_t i = 0ul; i < 8ul; i++)
+				store_little_endian(values[amount] + 4ul * i, last[i]);
+
+			amount++;
+		}
+
+		// An odd one goes up a level as it is, which keeps the left
+		// subtrees complete. Every kernel reads its parents before
+		// overwriting them.
+		while (keep < amount) {
+			size_t parents = amount / 2ul;
+			for (size_t i = 0ul; i < parents; i++)
+				inputs[i] = values[2ul * i];
+			blake3_hash_many(inputs, parents, 1ul, 0ul, false, values[0]);
+
+			if (amount % 2ul != 0ul)
+				for (size_t i = 0ul; i < blake3_value_length; i++)
+					values[parents][i] = values[amount - 1ul][i];
+
+			amount = parents + amount % 2ul;
+		}
+	}
+
+	/**
+	 * Load a chaining value written as bytes.
+	 * @param [out] chaining_value Where to write the chaining value.
+	 * @param [in] bytes Bytes of the chaining value.
+	 */
+	static inline void_t blake3_load_value(uint32_t *chaining_value,
+	                                       const byte_t *bytes) noexcept {
+		for (size_t i = 0ul; i < 8ul; i++)
+			chaining_value[i] = load_little_endian<uint32_t>(bytes + 4ul * i);
+	}
+
+	static void_t blake3_children(uint32_t *left, uint32_t *right,
+	                              const byte_t *bytes, size_t length,
+	                              uint64_t counter, size_t threads) noexcept;
+
+	/**
+	 * Get the chaining value of a subtree that is not the root.
+	 * @param [out] chaining_value Where to write the chaining value.
+	 * @param [in] bytes Data of the subtree.
+	 * @param [in] length Bytes of the subtree, a power of two chunks unless
+	 * it is the last subtree.
+	 * @param [in] counter Index of its first chunk.
+	 * @param [in] threads Most threads to hash with.
+	 */
+	static void_t blake3_subtree(uint32_t *chaining_value, const byte_t *bytes,
+	                             size_t length, uint64_t counter,
+	                             size_t threads) noexcept {
+		if (length <= blake3_select_lanes() * blake3_chunk_length) {
+			byte_t values[16][32];
+			blake3_leaves(values, bytes, length, counter, 1ul);
+
+			return blake3_load_value(chaining_value, values[0]);
+		}
+
+		uint32_t left[8], right[8];
+		blake3_children(left, right, bytes, length, counter, threads);
+
+		blake3_chaining_value(blake3_parent(left, right), chaining_value);
+	}
+
+	/**
+	 * Get the chaining values of both children of a tree, splitting the
+	 * threads between them.
+	 * @param [out] left Where to write the chaining value of the left
+	 * subtree.
+	 * @param [out] right Where to write the chaining value of the right
+	 * subtree.
+	 * @param [in] bytes Data of the tree.
+	 * @param [in] length Bytes of the tree, over a chunk.
+	 * @param [in] counter Index of its first chunk.
+	 * @param [in] threads Most threads to hash with.
+	 */
+	static void_t blake3_children(uint32_t *left, uint32_t *right,
+	                              const byte_t *bytes, size_t length,
+	                              uint64_t counter, size_t threads) noexcept {
+		if (length <= blake3_select_lanes() * blake3_chunk_length) {
+			byte_t values[16][32];
+			blake3_leaves(values, bytes, length, counter, 2ul);
+
+			blake3_load_value(left, values[0]);
+			return blake3_load_value(right, values[1]);
+		}
+
+		size_t left_length = blake3_left_length(length);
+		const byte_t *right_bytes = bytes + left_length;
+		size_t right_length = length - left_length;
+		uint64_t right_counter = counter + left_length / blake3_chunk_length;
+
+		if (threads < 2ul or length < blake3_parallel_chunks
+		                                  * blake3_chunk_length) {
+			blake3_subtree(left, bytes, left_length, counter, 1ul);
+			blake3_subtree(right, right_bytes, right_length, right_counter,
+			               1ul);
+
+			return;
+		}
+
+		// The left subtree is the biggest one, so it takes the extra thread.
+		size_t left_threads = threads - threads / 2ul;
+		try {
+			task_group group(thread_pool::shared());
+			group.run([=]() {
+				blake3_subtree(left, bytes, left_length, counter,
+				               left_threads);
+			});
+
+			blake3_subtree(right, right_bytes, right_length, right_counter,
+			               threads / 2ul);
+
+			group.wait();
+		} catch (...) {
+			// No memory for the task, the subtrees never throw.
+			blake3_subtree(left, bytes, left_length, counter, 1ul);
+			blake3_subtree(right, right_bytes, right_length, right_counter,
+			               1ul);
+		}
+	}
+
+
+	/**
+	 * Get the threads to use when asked for one per hardware thread.
+	 * @param [in] threads Requested threads, 0 for one per hardware thread.
+	 * @return Threads to use.
+	 */
+	static size_t blake3_threads(size_t threads) noexcept {
+		if (threads != 0ul)
+			return threads;
+
+		return thread_pool::hardware_threads();
+	}
+
+	/**
+	 * Get the bytes of a hash size.
+	 * @param [in] length Size of the hash.
+	 * @return Bytes of the hash.
+	 */
+	static size_t blake3_size_bytes(hash_size length) noexcept {
+		switch (length) {
+		case hash_size::_8bit:
+			return 1ul;
+		case hash_size::_16bit:
+			return 2ul;
+		case hash_size::_32bit:
+			return 4ul;
+		case hash_size::_64bit:
+			return 8ul;
+		case hash_size::_128bit:
+			return 16ul;
+		case hash_size::_160bit:
+			return 20ul;
+		case hash_size::_256bit:
+			return 32ul;
+		case hash_size::_512bit:
+			return 64ul;
+		default:
+			return 128ul;
+		}
+	}
+
+
+
+	void_t blake3(const void_t *bytes, size_t length, byte_t *digest,
+	              size_t digest_length, size_t threads) noexcept {
+		auto input = static_cast<const byte_t *>(bytes);
+
+		if (length <= blake3_chunk_length)
+			return blake3_output(blake3_chunk(input, length, 0ul), digest,
+			                     digest_length);
+
+		uint32_t left[8], right[8];
+		blake3_children(left, right, input, length, 0ul,
+		                blake3_threads(threads));
+
+		blake3_output(blake3_parent(left, right), digest, digest_length);
+	}
+
+	void_t blake3_file(const_cstring path, byte_t *digest,
+	                   size_t digest_length, size_t threads) {
+#	if stick_OS_ID == stick_OS_ID_WINDOWS
+		HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+		                          OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+		                          nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			throw generic_error("Could not open the file to hash.");
+
+		LARGE_INTEGER length;
+		if (GetFileSizeEx(file, &length) == 0) {
+			CloseHandle(file);
+			throw generic_error("Could not get the size of the file to hash.");
+		}
+		if (length.QuadPart == 0) {
+			CloseHandle(file);
+			return blake3(nullptr, 0ul, digest, digest_length, threads);
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0,
+		                                    nullptr);
+		CloseHandle(file);
+		if (mapping == nullptr)
+			throw generic_error("Could not map the file to hash.");
+
+		const void_t *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+		if (view == nullptr)
+			throw generic_error("Could not map the file to hash.");
+
+		blake3(view, static_cast<size_t>(length.QuadPart), digest,
+		       digest_length, threads);
+		UnmapViewOfFile(view);
+#	else
+		int_t file = open(path, O_RDONLY);
+		if (file < 0)
+			throw generic_error("Could not open the file to hash.");
+
+		struct stat status;
+		if (fstat(file, &status) != 0) {
+			close(file);
+			throw generic_error("Could not get the size of the file to hash.");
+		}
+		auto length = static_cast<size_t>(status.st_size);
+		if (length == 0ul) {
+			close(file);
+			return blake3(nullptr, 0ul, digest, digest_length, threads);
+		}
+
+		// The mapping stays valid after closing the file.
+		void_t *view = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file, 0);
+		close(file);
+		if (view == MAP_FAILED)
+			throw generic_error("Could not map the file to hash.");
+
+		blake3(view, length, digest, digest_length, threads);
+		munmap(view, length);
+#	endif
+	}
+
+
+
+	void_t hash_blake3::process(const byte_t *bytes, size_t length) noexcept {
+		while (length != 0ul) {
+			size_t chunk_fed = this->chunk_blocks * blake3_block_length
+			                   + this->buffered;
+
+			// The chunk is only finished once more data follows it.
+			if (chunk_fed == blake3_chunk_length) {
+				uint32_t output[16];
+				blake3_compress(output, this->chunk_state, this->buffer,
+				                blake3_block_length, this->chunk_counter,
+				                blake3_flag_chunk_end);
+				this->push(output, this->chunk_counter);
+
+				for (size_t i = 0ul; i < 8ul; i++)
+					this->chunk_state[i] = blake3_initial_state[i];
+				this->chunk_blocks = 0ul;
+				this->buffered = 0ul;
+				this->chunk_counter++;
+				chunk_fed = 0ul;
+			}
+
+			// Whole subtrees are hashed at once, pushing both children in
+			// case it ends up being the root.
+			if (chunk_fed == 0ul and blake3_chunk_length < length) {
+				size_t subtree_chunks = 1ul
+				                        << (8ul * sizeof(size_t) - 1ul
+				                            - count_leading_zeros(
+				                                length / blake3_chunk_length));
+				while ((this->chunk_counter & (subtree_chunks - 1ul)) != 0ul)
+					subtree_chunks >>= 1;
+				size_t subtree_length = subtree_chunks * blake3_chunk_length;
+
+				if (subtree_chunks == 1ul) {
+					uint32_t chaining_value[8];
+					blake3_subtree(chaining_value, bytes, subtree_length,
+					               this->chunk_counter, 1ul);
+					this->push(chaining_value, this->chunk_counter);
+				} else {
+					uint32_t left[8], right[8];
+					blake3_children(left, right, bytes, subtree_length,
+					                this->chunk_counter, this->threads);
+					this->push(left, this->chunk_counter);
+					this->push(right,
+					           this->chunk_counter + subtree_chunks / 2ul);
+				}
+
+				this->chunk_counter += subtree_chunks;
+				bytes += subtree_length;
+				length -= subtree_length;
+				continue;
+			}
+
+			// The last block of the chunk waits in the buffer for more data.
+			if (this->buffered == blake3_block_length) {
+				blake3_compress(this->chunk_state, this->chunk_state,
+				                this->buffer, blake3_block_length,
+				                this->chunk_counter,
+				                this->chunk_blocks == 0ul
+				                    ? blake3_flag_chunk_start
+				                    : 0u);
+				this->chunk_blocks++;
+				this->buffered = 0ul;
+			}
+
+			size_t taken = blake3_block_length - this->buffered;
+			if (length < taken)
+				taken = length;
+			for (size_t i = 0ul; i < taken; i++)
+				this->buffer[this->buffered + i] = bytes[i];
+
+			this->buffered += taken;
+			bytes += taken;
+			length -= taken;
+		}
+
+		// Data follows the pending subtrees, so none of them is the root.
+		if (this->chunk_blocks != 0ul or this->buffered != 0ul)
+			this->merge(this->chunk_counter);
+	}
+
+	void_t hash_blake3::restart() noexcept {
+		for (size_t i = 0ul; i < 8ul; i++)
+			this->chunk_state[i] = blake3_initial_state[i];
+
+		this->buffered = 0ul;
+		this->chunk_blocks = 0ul;
+		this->chunk_counter = 0ul;
+		this->stack_length = 0ul;
+	}
+
+	uint1024_t hash_blake3::calculate_hash() const noexcept {
+		byte_t output[128];
+		size_t length = blake3_size_bytes(this->size());
+		this->digest(output, length);
+
+		uint1024_t value;
+		for (size_t i = 0ul; i < length; i++)
+			(value <<= 8ul) |= output[i];
+
+		return value;
+	}
+
+	void_t hash_blake3::merge(uint64_t chunk) noexcept {
+		// Only a subtree per bit set in the chunk index is left pending.
+		size_t pending = pop_count(chunk);
+		while (pending < this->stack_length) {
+			this->stack_length--;
+			uint32_t *left = this->stack[this->stack_length - 1ul];
+			blake3_chaining_value(
+			    blake3_parent(left, this->stack[this->stack_length]), left);
+		}
+	}
+
+	void_t hash_blake3::push(const uint32_t *chaining_value,
+	                         uint64_t chunk) noexcept {
+		this->merge(chunk);
+
+		for (size_t i = 0ul; i < 8ul; i++)
+			this->stack[this->stack_length][i] = chaining_value[i];
+		this->stack_length++;
+	}
+
+
+	hash_blake3::hash_blake3(hash_size length, size_t threads) noexcept
+	    : base_hash(length), threads(blake3_threads(threads)) {
+		this->restart();
+	}
+	hash_blake3::hash_blake3(const string_view &data, hash_size length,
+	                         size_t threads) noexcept
+	    : hash_blake3(length, threads) {
+		this->update(data);
+	}
+
+
+	void_t hash_blake3::digest(byte_t *output, size_t length) const noexcept {
+		size_t pending = this->stack_length;
+
+		// The node of the current chunk, unless it is empty after a whole
+		// subtree that is then the last one.
+		blake3_node node;
+		if (this->chunk_blocks != 0ul or this->buffered != 0ul
+		    or pending == 0ul) {
+			node = blake3_make_node(this->chunk_state, this->buffer,
+			                        this->buffered, this->chunk_counter,
+			                        (this->chunk_blocks == 0ul
+			                             ? blake3_flag_chunk_start
+			                             : 0u)
+			                            | blake3_flag_chunk_end);
+		} else {
+			pending -= 2ul;
+			node = blake3_parent(this->stack[pending],
+			                     this->stack[pending + 1ul]);
+		}
+
+		while (pending != 0ul) {
+			pending--;
+
+			uint32_t chaining_value[8];
+			blake3_chaining_value(node, chaining_value);
+			node = blake3_parent(this->stack[pending], chaining_value);
+		}
+
+		blake3_output(node, output, length);
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_crypto_hash_blake3_
@@ -1,5 +1,5 @@
 /**
- *Fowler–Noll–Vo(FNV) 1 hash algorithm. Implementation
+ * Fowler–Noll–Vo(FNV) 1 hash algorithm. Implementation
  * @brief FNV-1 hash algorithm implementation.
  * @file hash_fnv1.cpp
  * @author Julio C. Galindo (stickM4N)
@@ -12,43 +12,205 @@
 namespace stick {
 
 
-	uint64_t hash_fnv1::calculate_hash() const noexcept {
+	/**
+	 * Continue a 32 bits FNV-1 hash.
+	 * @param [in] result Hash of the previous data.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @return Hash including the new data.
+	 */
+	static inline uint32_t fnv1_32(uint32_t result, const byte_t *bytes,
+	                                 size_t length) noexcept {
+		for (size_t i = 0ul; i < length; i++)
+			(result *= 0x01000193u) ^= bytes[i];
 
-		switch (this->size()) {
-		case hash_size::_8bit:
-		case hash_size::_16bit:
-			// These are not supported, they fall back to the smallest supported
-			// size.
-		case hash_size::_32bit: {
-			uint32_t result = 0x811c9dc5;
-			for (const auto &c : this->data())
-				(result *= 0x01000193) ^= c;
+		return result;
+	}
+
+	/**
+	 * Continue a 64 bits FNV-1 hash.
+	 * @param [in] result Hash of the previous data.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @return Hash including the new data.
+	 */
+	static inline uint64_t fnv1_64(uint64_t result, const byte_t *bytes,
+	                                 size_t length) noexcept {
+		for (size_t i = 0ul; i < length; i++)
+			(result *= 0x00000100000001b3ul) ^= bytes[i];
 
-			return result;
+		return result;
+	}
+
+
+	/// 32 bits FNV offset basis.
+	static const uint32_t fnv1_32_basis = 0x811c9dc5u;
+	/// 64 bits FNV offset basis.
+	static const uint64_t fnv1_64_basis = 0xcbf29ce484222325ul;
+	/// 128 bits FNV offset basis, least significant word first.
+	static const uint64_t fnv1_128_basis[] = {
+		0x62b821756295c58dul, 0x6c62272e07bb0142ul
+	};
+	/// 256 bits FNV offset basis, least significant word first.
+	static const uint64_t fnv1_256_basis[] = {
+		0x1023b4c8caee0535ul, 0xc8b1536847b6bbb3ul, 0x2d98c384c4e576ccul,
+		0xdd268dbcaac55036ul
+	};
+	/// 512 bits FNV offset basis, least significant word first.
+	static const uint64_t fnv1_512_basis[] = {
+		0xac982aac4afe9fd9ul, 0x182036415f56e34bul, 0x2ea79bc942dbe7ceul,
+		0xe948f68a34c192f6ul, 0x0000000000000d21ul, 0xac87d059c9000000ul,
+		0xdca1e50f309990acul, 0xb86db0b1171f4416ul
+	};
+	/// 1024 bits FNV offset basis, least significant word first.
+	static const uint64_t fnv1_1024_basis[] = {
+		0xaff4b16c71ee90b3ul, 0x6bde8cc9c6a93b21ul, 0x555f256cc005ae55ul,
+		0xeb6e73802734510aul, 0x000000000004c6d7ul, 0x0000000000000000ul,
+		0x0000000000000000ul, 0x0000000000000000ul, 0x0000000000000000ul,
+		0x0000000000000000ul, 0x9a21d90000000000ul, 0x6c3bf34eda3674daul,
+		0x4b29fc4223fdada1ul, 0x32e56d5a591028b7ul, 0x005f7a76758ecc4dul,
+		0x0000000000000000ul
+	};
+
+
+	/**
+	 * Continue a wide FNV-1 hash.
+	 * @tparam bits Size of the hash.
+	 * @param [in] result Hash of the previous data.
+	 * @param [in] prime FNV prime of the size.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @return Hash including the new data.
+	 */
+	template<size_t bits>
+	static inline wide_uint<bits> fnv1_wide(wide_uint<bits> result,
+	                                        const wide_uint<bits> &prime,
+	                                        const byte_t *bytes,
+	                                        size_t length) noexcept {
+		for (size_t i = 0ul; i < length; i++) {
+			result *= prime;
+			result.word(0) ^= bytes[i];
 		}
+
+		return result;
+	}
+
+
+	/**
+	 * Continue a FNV-1 hash of any size. The primes are 2^k + c, so the
+	 * multiplications only touch two words of them.
+	 * @param [in] bits Size of the hash.
+	 * @param [in] result Hash of the previous data.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @return Hash including the new data.
+	 */
+	static uint1024_t fnv1_continue(hash_size bits, const uint1024_t &result,
+	                                const byte_t *bytes,
+	                                size_t length) noexcept {
+		switch (bits) {
+		case hash_size::_8bit:
+		case hash_size::_16bit:
+		case hash_size::_32bit:
+			return fnv1_32(static_cast<uint32_t>(static_cast<uint64_t>(result)),
+			               bytes, length);
+		case hash_size::_64bit:
+			return fnv1_64(static_cast<uint64_t>(result), bytes, length);
 		case hash_size::_128bit:
+			return uint1024_t(fnv1_wide(uint128_t(result),
+			                            uint128_t(1ul) << 88ul | 0x13bul,
+			                            bytes, length));
+		case hash_size::_160bit:
+			// Not supported, falls back to the next supported size.
 		case hash_size::_256bit:
+			return uint1024_t(fnv1_wide(uint256_t(result),
+			                            uint256_t(1ul) << 168ul | 0x163ul,
+			                            bytes, length));
 		case hash_size::_512bit:
+			return uint1024_t(fnv1_wide(uint512_t(result),
+			                            uint512_t(1ul) << 344ul | 0x157ul,
+			                            bytes, length));
 		case hash_size::_1024bit:
-			// TODO: Implement after being able to handle bigger integers.
-			// These are not supported (yet), they fall back to the biggest
-			// supported size.
-		case hash_size::_64bit: {
-			uint64_t result = 0xcbf29ce484222325;
-			for (const auto &c : this->data())
-				(result *= 0x00000100000001B3) ^= c;
-
-			return result;
+			return fnv1_wide(result, uint1024_t(1ul) << 680ul | 0x18dul, bytes,
+			                 length);
 		}
+
+		return result;
+	}
+
+	/**
+	 * Get the FNV offset basis of any size.
+	 * @param [in] bits Size of the hash.
+	 * @return Hash of no data.
+	 */
+	static uint1024_t fnv1_basis(hash_size bits) noexcept {
+		switch (bits) {
+		case hash_size::_8bit:
+		case hash_size::_16bit:
+		case hash_size::_32bit:
+			return fnv1_32_basis;
+		case hash_size::_64bit:
+			return fnv1_64_basis;
+		case hash_size::_128bit:
+			return uint1024_t(fnv1_128_basis, 2ul);
+		case hash_size::_160bit:
+			// Not supported, falls back to the next supported size.
+		case hash_size::_256bit:
+			return uint1024_t(fnv1_256_basis, 4ul);
+		case hash_size::_512bit:
+			return uint1024_t(fnv1_512_basis, 8ul);
+		case hash_size::_1024bit:
+			return uint1024_t(fnv1_1024_basis, 16ul);
 		}
 
-		return 0ul;
+		return fnv1_64_basis;
+	}
+
+
+
+	void_t hash_fnv1::process(const byte_t *bytes, size_t length) noexcept {
+		this->state = fnv1_continue(this->size(), this->state, bytes, length);
+	}
+
+	void_t hash_fnv1::restart() noexcept {
+		this->state = fnv1_basis(this->size());
+	}
+
+	uint1024_t hash_fnv1::calculate_hash() const noexcept {
+		return this->state;
 	}
 
 
-	hash_fnv1::hash_fnv1(const string &data, hash_size length)
-	    : base_hash(data, length <= hash_size::_32bit ? hash_size::_32bit
-	                                                  : hash_size::_64bit) { }
+	hash_fnv1::hash_fnv1(hash_size length) noexcept
+	    : base_hash(length <= hash_size::_32bit    ? hash_size::_32bit
+	                : length == hash_size::_160bit ? hash_size::_256bit
+	                                               : length) {
+		this->restart();
+	}
+	hash_fnv1::hash_fnv1(const string_view &data, hash_size length) noexcept
+	    : hash_fnv1(length) {
+		this->update(data);
+	}
+
+
+	uint64_t hash_fnv1::hash(const void_t *bytes, size_t length,
+	                         hash_size bits) noexcept {
+		auto data = static_cast<const byte_t *>(bytes);
+
+		switch (bits) {
+		case hash_size::_8bit:
+		case hash_size::_16bit:
+			// These are not supported, they fall back to the smallest supported
+			// size.
+		case hash_size::_32bit:
+			return fnv1_32(fnv1_32_basis, data, length);
+		case hash_size::_64bit:
+			return fnv1_64(fnv1_64_basis, data, length);
+		default:
+			return static_cast<uint64_t>(
+			    fnv1_continue(bits, fnv1_basis(bits), data, length));
+		}
+	}
 
 
 }   // namespace stick
@@ -9,49 +9,381 @@
 #if defined(_stick_lib_crypto_hash_fnv1a_)
 
 
+#	include "../../../../include/stick/defines/arch.hpp"
+#	include "../../../../include/stick/defines/compiler.hpp"
+#	include "../../../../include/stick/templates/bit.tpp"
+
+#	if stick_IS_ARCH_x86_64                                                   \
+	    && (stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG)
+#		include <immintrin.h>
+#		define stick_FNV1A_AVX2 1
+#	endif
+
+
 namespace stick {
 
 
-	uint64_t hash_fnv1a::calculate_hash() const noexcept {
+	/// 32 bits FNV prime.
+	static const uint32_t fnv1a_32_prime = 0x01000193u;
+	/// 64 bits FNV prime.
+	static const uint64_t fnv1a_64_prime = 0x00000100000001b3ul;
 
-		switch (this->size()) {
-		case hash_size::_8bit:
-		case hash_size::_16bit:
-			// These are not supported, they fall back to the smallest supported
-			// size.
-		case hash_size::_32bit: {
-			uint32_t result = 0x811c9dc5;
-			for (const auto &c : this->data())
-				(result ^= c) *= 0x01000193;
 
-			return result;
+	/**
+	 * Continue a 32 bits FNV-1a hash.
+	 * @param [in] result Hash of the previous data.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @return Hash including the new data.
+	 */
+	static inline uint32_t fnv1a_32(uint32_t result, const byte_t *bytes,
+	                                size_t length) noexcept {
+		for (size_t i = 0ul; i < length; i++)
+			(result ^= bytes[i]) *= fnv1a_32_prime;
+
+		return result;
+	}
+
+	/**
+	 * Continue a 64 bits FNV-1a hash.
+	 * @param [in] result Hash of the previous data.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @return Hash including the new data.
+	 */
+	static inline uint64_t fnv1a_64(uint64_t result, const byte_t *bytes,
+	                                size_t length) noexcept {
+		for (size_t i = 0ul; i < length; i++)
+			(result ^= bytes[i]) *= fnv1a_64_prime;
+
+		return result;
+	}
+
+
+	/// 32 bits FNV offset basis.
+	static const uint32_t fnv1a_32_basis = 0x811c9dc5u;
+	/// 64 bits FNV offset basis.
+	static const uint64_t fnv1a_64_basis = 0xcbf29ce484222325ul;
+	/// 128 bits FNV offset basis, least significant word first.
+	static const uint64_t fnv1a_128_basis[] = {
+		0x62b821756295c58dul, 0x6c62272e07bb0142ul
+	};
+	/// 256 bits FNV offset basis, least significant word first.
+	static const uint64_t fnv1a_256_basis[] = {
+		0x1023b4c8caee0535ul, 0xc8b1536847b6bbb3ul, 0x2d98c384c4e576ccul,
+		0xdd268dbcaac55036ul
+	};
+	/// 512 bits FNV offset basis, least significant word first.
+	static const uint64_t fnv1a_512_basis[] = {
+		0xac982aac4afe9fd9ul, 0x182036415f56e34bul, 0x2ea79bc942dbe7ceul,
+		0xe948f68a34c192f6ul, 0x0000000000000d21ul, 0xac87d059c9000000ul,
+		0xdca1e50f309990acul, 0xb86db0b1171f4416ul
+	};
+	/// 1024 bits FNV offset basis, least significant word first.
+	static const uint64_t fnv1a_1024_basis[] = {
+		0xaff4b16c71ee90b3ul, 0x6bde8cc9c6a93b21ul, 0x555f256cc005ae55ul,
+		0xeb6e73802734510aul, 0x000000000004c6d7ul, 0x0000000000000000ul,
+		0x0000000000000000ul, 0x0000000000000000ul, 0x0000000000000000ul,
+		0x0000000000000000ul, 0x9a21d90000000000ul, 0x6c3bf34eda3674daul,
+		0x4b29fc4223fdada1ul, 0x32e56d5a591028b7ul, 0x005f7a76758ecc4dul,
+		0x0000000000000000ul
+	};
+
+
+	/**
+	 * Continue a wide FNV-1a hash.
+	 * @tparam bits Size of the hash.
+	 * @param [in] result Hash of the previous data.
+	 * @param [in] prime FNV prime of the size.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @return Hash including the new data.
+	 */
+	template<size_t bits>
+	static inline wide_uint<bits> fnv1a_wide(wide_uint<bits> result,
+	                                         const wide_uint<bits> &prime,
+	                                         const byte_t *bytes,
+	                                         size_t length) noexcept {
+		for (size_t i = 0ul; i < length; i++) {
+			result.word(0) ^= bytes[i];
+			result *= prime;
 		}
+
+		return result;
+	}
+
+
+	/**
+	 * Continue a FNV-1a hash of any size. The primes are 2^k + c, so the
+	 * multiplications only touch two words of them.
+	 * @param [in] bits Size of the hash.
+	 * @param [in] result Hash of the previous data.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @return Hash including the new data.
+	 */
+	static uint1024_t fnv1a_continue(hash_size bits, const uint1024_t &result,
+	                                 const byte_t *bytes,
+	                                 size_t length) noexcept {
+		switch (bits) {
+		case hash_size::_8bit:
+		case hash_size::_16bit:
+		case hash_size::_32bit:
+			return fnv1a_32(
+			    static_cast<uint32_t>(static_cast<uint64_t>(result)), bytes,
+			    length);
+		case hash_size::_64bit:
+			return fnv1a_64(static_cast<uint64_t>(result), bytes, length);
 		case hash_size::_128bit:
+			return uint1024_t(fnv1a_wide(uint128_t(result),
+			                             uint128_t(1ul) << 88ul | 0x13bul,
+			                             bytes, length));
+		case hash_size::_160bit:
+			// Not supported, falls back to the next supported size.
 		case hash_size::_256bit:
+			return uint1024_t(fnv1a_wide(uint256_t(result),
+			                             uint256_t(1ul) << 168ul | 0x163ul,
+			                             bytes, length));
 		case hash_size::_512bit:
+			return uint1024_t(fnv1a_wide(uint512_t(result),
+			                             uint512_t(1ul) << 344ul | 0x157ul,
+			                             bytes, length));
 		case hash_size::_1024bit:
-			// TODO implement after being able to handle bigger integers.
-			// These are not supported (yet), they fall back to the biggest
-			// supported size.
-		case hash_size::_64bit: {
-			uint64_t result = 0xcbf29ce484222325;
-			for (const auto &c : this->data())
-				(result ^= c) *= 0x00000100000001B3;
+			return fnv1a_wide(result, uint1024_t(1ul) << 680ul | 0x18dul,
+			                  bytes, length);
+		}
 
-			return result;
+		return result;
+	}
+
+	/**
+	 * Get the FNV offset basis of any size.
+	 * @param [in] bits Size of the hash.
+	 * @return Hash of no data.
+	 */
+	static uint1024_t fnv1a_basis(hash_size bits) noexcept {
+		switch (bits) {
+		case hash_size::_8bit:
+		case hash_size::_16bit:
+		case hash_size::_32bit:
+			return fnv1a_32_basis;
+		case hash_size::_64bit:
+			return fnv1a_64_basis;
+		case hash_size::_128bit:
+			return uint1024_t(fnv1a_128_basis, 2ul);
+		case hash_size::_160bit:
+			// Not supported, falls back to the next supported size.
+		case hash_size::_256bit:
+			return uint1024_t(fnv1a_256_basis, 4ul);
+		case hash_size::_512bit:
+			return uint1024_t(fnv1a_512_basis, 8ul);
+		case hash_size::_1024bit:
+			return uint1024_t(fnv1a_1024_basis, 16ul);
 		}
+
+		return fnv1a_64_basis;
+	}
+
+
+
+	/// Keys hashed at once by the batches, enough independent multiplies to
+	/// hide their latency.
+	static const size_t fnv1a_batch_lanes = 8ul;
+
+
+#	if stick_FNV1A_AVX2
+	/**
+	 * Hash the bytes that all the keys of a group have, one key per 32 bits
+	 * lane of the AVX2 vectors.
+	 * @param [in] keys Data of every key.
+	 * @param [in] shortest Number of bytes of the shortest key.
+	 * @param [in,out] states Hash of every key.
+	 * @return Number of bytes hashed of every key.
+	 */
+	__attribute__((target("avx2"))) static size_t
+	fnv1a_32_avx2(const byte_t *const *keys, size_t shortest,
+	              uint32_t *states) noexcept {
+		const __m256i prime = _mm256_set1_epi32(
+		    static_cast<int_t>(fnv1a_32_prime));
+		const __m256i low_byte = _mm256_set1_epi32(0xff);
+		__m256i result = _mm256_loadu_si256(
+		    reinterpret_cast<const __m256i *>(states));
+
+		size_t position = 0ul;
+		for (; position + 4ul <= shortest; position += 4ul) {
+			int_t words[8];
+			for (size_t lane = 0ul; lane < 8ul; lane++)
+				words[lane] = static_cast<int_t>(
+				    load_little_endian<uint32_t>(keys[lane] + position));
+			__m256i bytes = _mm256_loadu_si256(
+			    reinterpret_cast<const __m256i *>(words));
+
+			for (size_t i = 0ul; i < 4ul; i++) {
+				result = _mm256_mullo_epi32(
+				    _mm256_xor_si256(result,
+				                     _mm256_and_si256(bytes, low_byte)),
+				    prime);
+				bytes = _mm256_srli_epi32(bytes, 8);
+			}
 		}
 
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(states), result);
+
+		return position;
+	}
+#	endif
+
+	/**
+	 * Hash the bytes that all the keys of a group have with the vector unit,
+	 * when it has enough lanes of the hash size.
+	 * @param [in] keys Data of every key.
+	 * @param [in] shortest Number of bytes of the shortest key.
+	 * @param [in,out] states Hash of every key.
+	 * @return Number of bytes hashed of every key.
+	 */
+	static inline size_t fnv1a_prefix(const byte_t *const *keys,
+	                                  size_t shortest,
+	                                  uint32_t *states) noexcept {
+#	if stick_FNV1A_AVX2
+		static const bool_t use_avx2 = __builtin_cpu_supports("avx2");
+		if (use_avx2)
+			return fnv1a_32_avx2(keys, shortest, states);
+#	endif
+
 		return 0ul;
 	}
+	/**
+	 * Hash the bytes that all the keys of a group have with the vector unit,
+	 * when it has enough lanes of the hash size.
+	 * @return Number of bytes hashed of every key, none for 64 bits.
+	 */
+	static inline size_t fnv1a_prefix(const byte_t *const *, size_t,
+	                                  uint64_t *) noexcept {
+		return 0ul;
+	}
+
+	/**
+	 * Hash many keys, a group of them at once with their states interleaved
+	 * byte by byte along the length they all have.
+	 * @tparam type Integer type of the hash size.
+	 * @param [in] keys Data of every key.
+	 * @param [in] lengths Number of bytes of every key.
+	 * @param [out] hashes Where to write the hash of every key.
+	 * @param [in] amount Number of keys.
+	 * @param [in] basis FNV offset basis of the size.
+	 * @param [in] prime FNV prime of the size.
+	 */
+	template<typename type>
+	static void_t fnv1a_batch(const void_t *const *keys, const size_t *lengths,
+	                          uint64_t *hashes, size_t amount, type basis,
+	                          type prime) noexcept {
+		size_t first = 0ul;
+		for (; first + fnv1a_batch_lanes <= amount;
+		     first += fnv1a_batch_lanes) {
+			const byte_t *group[fnv1a_batch_lanes];
+			type states[fnv1a_batch_lanes];
+			size_t shortest = lengths[first];
+			for (size_t lane = 0ul; lane < fnv1a_batch_lanes; lane++) {
+				group[lane] = static_cast<const byte_t *>(keys[first + lane]);
+				states[lane] = basis;
+
+				size_t length = lengths[first + lane];
+				shortest = length < shortest ? length : shortest;
+			}
+
+			size_t position = fnv1a_prefix(group, shortest, states);
+			for (; position < shortest; position++)
+				for (size_t lane = 0ul; lane < fnv1a_batch_lanes; lane++)
+					(states[lane] ^= group[lane][position]) *= prime;
+
+			// The rest of every key is independent from the others, so the
+			// pipeline still overlaps them.
+			for (size_t lane = 0ul; lane < fnv1a_batch_lanes; lane++)
+				for (size_t i = position; i < lengths[first + lane]; i++)
+					(states[lane] ^= group[lane][i]) *= prime;
+
+			for (size_t lane = 0ul; lane < fnv1a_batch_lanes; lane++)
+				hashes[first + lane] = states[lane];
+		}
 
+		for (; first < amount; first++) {
+			auto bytes = static_cast<const byte_t *>(keys[first]);
+			type state = basis;
+			for (size_t i = 0ul; i < lengths[first]; i++)
+				(state ^= bytes[i]) *= prime;
 
-	hash_fnv1a::hash_fnv1a(const string &data, hash_size length)
-	    : base_hash(data, length <= hash_size::_32bit ? hash_size::_32bit
-	                                                  : hash_size::_64bit) { }
+			hashes[first] = state;
+		}
+	}
+
+
+
+	void_t hash_fnv1a::process(const byte_t *bytes, size_t length) noexcept {
+		this->state = fnv1a_continue(this->size(), this->state, bytes, length);
+	}
+
+	void_t hash_fnv1a::restart() noexcept {
+		this->state = fnv1a_basis(this->size());
+	}
+
+	uint1024_t hash_fnv1a::calculate_hash() const noexcept {
+		return this->state;
+	}
+
+
+	hash_fnv1a::hash_fnv1a(hash_size length) noexcept
+	    : base_hash(length <= hash_size::_32bit    ? hash_size::_32bit
+	                : length == hash_size::_160bit ? hash_size::_256bit
+	                                               : length) {
+		this->restart();
+	}
+	hash_fnv1a::hash_fnv1a(const string_view &data, hash_size length) noexcept
+	    : hash_fnv1a(length) {
+		this->update(data);
+	}
+
+
+	uint64_t hash_fnv1a::hash(const void_t *bytes, size_t length,
+	                          hash_size bits) noexcept {
+		auto data = static_cast<const byte_t *>(bytes);
+
+		switch (bits) {
+		case hash_size::_8bit:
+		case hash_size::_16bit:
+			// These are not supported, they fall back to the smallest supported
+			// size.
+		case hash_size::_32bit:
+			return fnv1a_32(fnv1a_32_basis, data, length);
+		case hash_size::_64bit:
+			return fnv1a_64(fnv1a_64_basis, data, length);
+		default:
+			return static_cast<uint64_t>(
+			    fnv1a_continue(bits, fnv1a_basis(bits), data, length));
+		}
+	}
+
+	void_t hash_fnv1a::hash_batch(const void_t *const *keys,
+	                              const size_t *lengths, uint64_t *hashes,
+	                              size_t amount, hash_size bits) noexcept {
+		switch (bits) {
+		case hash_size::_8bit:
+		case hash_size::_16bit:
+			// These are not supported, they fall back to the smallest supported
+			// size.
+		case hash_size::_32bit:
+			return fnv1a_batch(keys, lengths, hashes, amount, fnv1a_32_basis,
+			                   fnv1a_32_prime);
+		case hash_size::_64bit:
+			return fnv1a_batch(keys, lengths, hashes, amount, fnv1a_64_basis,
+			                   fnv1a_64_prime);
+		default:
+			for (size_t i = 0ul; i < amount; i++)
+				hashes[i] = hash_fnv1a::hash(keys[i], lengths[i], bits);
+		}
+	}
 
 
 }   // namespace stick
 
 
-#endif   //_stick_lib_crypto_hash_fnv1a_
+#endif   //_stick_lib_crypto_hash_fnv1aa_
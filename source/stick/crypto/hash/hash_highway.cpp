@@ -0,0 +1,530 @@
+/**
+ * HighwayHash keyed hash algorithm. Implementation
+ * @brief HighwayHash keyed hash algorithm implementation.
+ * @file hash_highway.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../../include/stick/crypto/hash/hash_highway.hpp"
+
+#if defined(_stick_lib_crypto_hash_highway_)
+
+
+#	include "../../../../include/stick/crypto/hash/hash_seed.hpp"
+#	include "../../../../include/stick/defines/arch.hpp"
+#	include "../../../../include/stick/defines/compiler.hpp"
+#	include "../../../../include/stick/templates/bit.tpp"
+
+#	if stick_IS_ARCH_x86_64                                                   \
+	    && (stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG)
+#		include <immintrin.h>
+#		define stick_HIGHWAY_AVX2 1
+#	endif
+
+
+namespace stick {
+
+
+	/// Initial value of the mul0 lanes.
+	static const uint64_t highway_initial_mul0[4] = {
+		0xdbe6d5d5fe4cce2ful, 0xa4093822299f31d0ul, 0x13198a2e03707344ul,
+		0x243f6a8885a308d3ul
+	};
+	/// Initial value of the mul1 lanes.
+	static const uint64_t highway_initial_mul1[4] = {
+		0x3bd39e10cb0ef593ul, 0xc0acf169b5f18a8cul, 0xbe5466cf34e90c6cul,
+		0x452821e638d01377ul
+	};
+
+	/// Bytes of every packet of input.
+	static const size_t highway_packet_length = 32ul;
+
+
+
+	/**
+	 * Swap the 32 bits halves of a word.
+	 * @param [in] word Word to swap.
+	 * @return Swapped word.
+	 */
+	static inline uint64_t highway_swap_halves(uint64_t word) noexcept {
+		return word >> 32 | word << 32;
+	}
+
+	/**
+	 * Scatter the bytes of a pair of lanes into another pair, placing the
+	 * best mixed bytes of the multiplies where the next multiplies read.
+	 * @param [in] low First lane of the source pair.
+	 * @param [in] high Second lane of the source pair.
+	 * @param [in,out] add_low Lane to add the first merged word to.
+	 * @param [in,out] add_high Lane to add the second merged word to.
+	 */
+	static inline void_t highway_zipper_merge(uint64_t low, uint64_t high,
+	                                          uint64_t &add_low,
+	                                          uint64_t &add_high) noexcept {
+		add_low += ((low & 0xff000000ul) | (high & 0xff00000000ul)) >> 24
+		           | ((low & 0xff0000000000ul) | (high & 0xff000000000000ul))
+		                 >> 16
+		           | (low & 0xff0000ul) | (low & 0xff00ul) << 32
+		           | (high & 0xff00000000000000ul) >> 8 | low << 56;
+		add_high += ((high & 0xff000000ul) | (low & 0xff00000000ul)) >> 24
+		            | (high & 0xff0000ul) | (high & 0xff0000000000ul) >> 16
+		            | (high & 0xff00ul) << 24
+		            | (low & 0xff000000000000ul) >> 8 | (high & 0xfful) << 48
+		            | (low & 0xff00000000000000ul);
+	}
+
+	/**
+	 * Set the state to its initial value for a key.
+	 * @param [out] state Lanes of v0, v1, mul0 and mul1.
+	 * @param [in] key The 4 key words.
+	 */
+	static void_t highway_start(uint64_t *state, const uint64_t *key) noexcept {
+		for (size_t i = 0ul; i < 4ul; i++) {
+			state[8ul + i] = highway_initial_mul0[i];
+			state[12ul + i] = highway_initial_mul1[i];
+			state[i] = highway_initial_mul0[i] ^ key[i];
+			state[4ul + i] = highway_initial_mul1[i]
+			                 ^ highway_swap_halves(key[i]);
+		}
+	}
+
+	/**
+	 * Read the key words of a hash.
+	 * @param [in] key The 32 bytes of the key, nullptr for the process seed.
+	 * @param [out] words Where to write the 4 key words.
+	 */
+	static void_t highway_load_key(const byte_t *key,
+	                               uint64_t *words) noexcept {
+		if (key == nullptr)
+			key = hash_seed();
+
+		for (size_t i = 0ul; i < 4ul; i++)
+			words[i] = load_little_endian<uint64_t>(key + i * 8ul);
+	}
+
+	/**
+	 * Update the state with a packet, one lane after the other.
+	 * @param [in,out] state Lanes of v0, v1, mul0 and mul1.
+	 * @param [in] lanes The 4 words of the packet.
+	 */
+	static inline void_t highway_round(uint64_t *state,
+	                                   const uint64_t *lanes) noexcept {
+		uint64_t *v0 = state, *v1 = state + 4, *mul0 = state + 8,
+		         *mul1 = state + 12;
+
+		for (size_t i = 0ul; i < 4ul; i++) {
+			v1[i] += mul0[i] + lanes[i];
+			mul0[i] ^= (v1[i] & 0xfffffffful) * (v0[i] >> 32);
+			v0[i] += mul1[i];
+			mul1[i] ^= (v0[i] & 0xfffffffful) * (v1[i] >> 32);
+		}
+
+		highway_zipper_merge(v1[0], v1[1], v0[0], v0[1]);
+		highway_zipper_merge(v1[2], v1[3], v0[2], v0[3]);
+		highway_zipper_merge(v0[0], v0[1], v1[0], v1[1]);
+		highway_zipper_merge(v0[2], v0[3], v1[2], v1[3]);
+	}
+
+	/**
+	 * Pad the last bytes of an input to a whole packet.
+	 * @param [in] tail Last bytes of the input.
+	 * @param [in] length Number of bytes of the tail, 1 to 31.
+	 * @param [out] packet Where to write the packet.
+	 */
+	static inline void_t highway_tail_packet(const byte_t *tail, size_t length,
+	                                         byte_t *packet) noexcept {
+		size_t whole_length = length & ~3ul, rest = length & 3ul;
+		for (size_t i = 0ul; i < highway_packet_length; i += 4ul)
+			store_little_endian(packet + i,
+			                    i < whole_length
+			                        ? load_little_endian<uint32_t>(tail + i)
+			                        : 0u);
+
+		// The last 1 to 3 bytes, or the 4 before the end for long tails,
+		// go where the whole words do not reach.
+		const byte_t *last = tail + whole_length;
+		if ((length & 16ul) != 0ul)
+			for (size_t i = 0ul; i < 4ul; i++)
+				packet[28ul + i] = last[i + rest - 4ul];
+		else if (rest != 0ul) {
+			packet[16] = last[0];
+			packet[17] = last[rest >> 1];
+			packet[18] = last[rest - 1ul];
+		}
+	}
+
+	/**
+	 * Update the state with some packets.
+	 * @param [in,out] state Lanes of v0, v1, mul0 and mul1.
+	 * @param [in] packets Packets to process.
+	 * @param [in] amount Number of packets.
+	 */
+	static void_t highway_update_portable(uint64_t *state,
+	                                      const byte_t *packets,
+	                                      size_t amount) noexcept {
+		for (; amount != 0ul; amount--, packets += highway_packet_length) {
+			uint64_t lanes[4];
+			for (size_t i = 0ul; i < 4ul; i++)
+				lanes[i] = load_little_endian<uint64_t>(packets + i * 8ul);
+
+			highway_round(state, lanes);
+		}
+	}
+
+	/**
+	 * Update the state with the last bytes of an input and finish the hash.
+	 * @param [in,out] state Lanes of v0, v1, mul0 and mul1.
+	 * @param [in] tail Last bytes of the input.
+	 * @param [in] length Number of bytes of the tail, 0 to 31.
+	 * @return Calculated hash integer.
+	 */
+	static uint64_t highway_finish_portable(uint64_t *state,
+	                                        const byte_t *tail,
+	                                        size_t length) noexcept {
+		if (length != 0ul) {
+			for (size_t i = 0ul; i < 4ul; i++) {
+				state[i] += static_cast<uint64_t>(length) << 32 | length;
+
+				auto low = static_cast<uint32_t>(state[4ul + i]);
+				auto high = static_cast<uint32_t>(state[4ul + i] >> 32);
+				state[4ul + i] =
+				    rotate_left(low, length)
+				    | static_cast<uint64_t>(rotate_left(high, length)) << 32;
+			}
+
+			byte_t packet[highway_packet_length];
+			highway_tail_packet(tail, length, packet);
+			highway_update_portable(state, packet, 1ul);
+		}
+
+		for (size_t round = 0ul; round < 4ul; round++) {
+			uint64_t lanes[4] = { highway_swap_halves(state[2]),
+			                      highway_swap_halves(state[3]),
+			                      highway_swap_halves(state[0]),
+			                      highway_swap_halves(state[1]) };
+			highway_round(state, lanes);
+		}
+
+		return state[0] + state[4] + state[8] + state[12];
+	}
+
+	/**
+	 * Hash some data at once.
+	 * @param [in] key The 4 key words.
+	 * @param [in] input Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @return Calculated hash integer.
+	 */
+	static uint64_t highway_hash_portable(const uint64_t *key,
+	                                      const byte_t *input,
+	                                      size_t length) noexcept {
+		uint64_t state[16];
+		highway_start(state, key);
+
+		size_t packets = length / highway_packet_length;
+		highway_update_portable(state, input, packets);
+
+		return highway_finish_portable(
+		    state, input + packets * highway_packet_length,
+		    length - packets * highway_packet_length);
+	}
+
+#	if stick_HIGHWAY_AVX2
+	/**
+	 * Update the state with a packet, all the lanes at once.
+	 * @param [in,out] v0 The v0 lanes.
+	 * @param [in,out] v1 The v1 lanes.
+	 * @param [in,out] mul0 The mul0 lanes.
+	 * @param [in,out] mul1 The mul1 lanes.
+	 * @param [in] packet The 4 words of the packet.
+	 */
+	__attribute__((target("avx2"))) static inline void_t
+	highway_round_avx2(__m256i &v0, __m256i &v1, __m256i &mul0, __m256i &mul1,
+	                   __m256i packet) noexcept {
+		// The zipper merge of highway_zipper_merge() as a byte shuffle.
+		const __m256i zipper = _mm256_setr_epi8(
+		    3, 12, 2, 5, 14, 1, 15, 0, 11, 4, 10, 13, 9, 6, 8, 7, 3, 12, 2, 5,
+		    14, 1, 15, 0, 11, 4, 10, 13, 9, 6, 8, 7);
+
+		v1 = _mm256_add_epi64(v1, _mm256_add_epi64(mul0, packet));
+		mul0 = _mm256_xor_si256(
+		    mul0, _mm256_mul_epu32(v1, _mm256_srli_epi64(v0, 32)));
+		v0 = _mm256_add_epi64(v0, mul1);
+		mul1 = _mm256_xor_si256(
+		    mul1, _mm256_mul_epu32(v0, _mm256_srli_epi64(v1, 32)));
+		v0 = _mm256_add_epi64(v0, _mm256_shuffle_epi8(v1, zipper));
+		v1 = _mm256_add_epi64(v1, _mm256_shuffle_epi8(v0, zipper));
+	}
+
+	/**
+	 * Update the state with some packets, all the lanes at once in an AVX2
+	 * vector.
+	 * @param [in,out] state Lanes of v0, v1, mul0 and mul1.
+	 * @param [in] packets Packets to process.
+	 * @param [in] amount Number of packets.
+	 */
+	__attribute__((target("avx2"))) static void_t
+	highway_update_avx2(uint64_t *state, const byte_t *packets,
+	                    size_t amount) noexcept {
+		auto lanes = reinterpret_cast<__m256i *>(state);
+		__m256i v0 = _mm256_loadu_si256(lanes);
+		__m256i v1 = _mm256_loadu_si256(lanes + 1);
+		__m256i mul0 = _mm256_loadu_si256(lanes + 2);
+		__m256i mul1 = _mm256_loadu_si256(lanes + 3);
+
+		for (; amount != 0ul; amount--, packets += highway_packet_length)
+			highway_round_avx2(v0, v1, mul0, mul1,
+			                   _mm256_loadu_si256(
+			                       reinterpret_cast<const __m256i *>(packets)));
+
+		_mm256_storeu_si256(lanes, v0);
+		_mm256_storeu_si256(lanes + 1, v1);
+		_mm256_storeu_si256(lanes + 2, mul0);
+		_mm256_storeu_si256(lanes + 3, mul1);
+	}
+
+	/**
+	 * Pad the last bytes of an input to a whole packet, without going
+	 * through memory.
+	 * @param [in] tail Last bytes of the input.
+	 * @param [in] length Number of bytes of the tail, 1 to 31.
+	 * @return The packet.
+	 */
+	__attribute__((target("avx2"))) static inline __m256i
+	highway_tail_avx2(const byte_t *tail, size_t length) noexcept {
+		size_t whole_length = length & ~3ul, rest = length & 3ul;
+		__m256i mask = _mm256_cmpgt_epi32(
+		    _mm256_set1_epi32(static_cast<int_t>(whole_length >> 2)),
+		    _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+		__m256i packet = _mm256_maskload_epi32(
+		    reinterpret_cast<const int_t *>(tail), mask);
+
+		// The same bytes highway_tail_packet() places after the words.
+		const byte_t *last = tail + whole_length;
+		if ((length & 16ul) != 0ul)
+			packet = _mm256_insert_epi32(
+			    packet,
+			    static_cast<int_t>(
+			        load_little_endian<uint32_t>(last + rest - 4ul)),
+			    7);
+		else if (rest != 0ul)
+			packet = _mm256_insert_epi32(
+			    packet,
+			    static_cast<int_t>(last[0] | last[rest >> 1] << 8
+			                       | last[rest - 1ul] << 16),
+			    4);
+
+		return packet;
+	}
+
+	/**
+	 * Update the lanes with the last bytes of an input and finish the hash.
+	 * @param [in] v0 The v0 lanes.
+	 * @param [in] v1 The v1 lanes.
+	 * @param [in] mul0 The mul0 lanes.
+	 * @param [in] mul1 The mul1 lanes.
+	 * @param [in] tail Last bytes of the input.
+	 * @param [in] length Number of bytes of the tail, 0 to 31.
+	 * @return Calculated hash integer.
+	 */
+	__attribute__((target("avx2"))) static inline uint64_t
+	highway_end_avx2(__m256i v0, __m256i v1, __m256i mul0, __m256i mul1,
+	                 const byte_t *tail, size_t length) noexcept {
+		if (length != 0ul) {
+			v0 = _mm256_add_epi64(
+			    v0, _mm256_set1_epi64x(static_cast<llong_t>(
+			            static_cast<uint64_t>(length) << 32 | length)));
+			v1 = _mm256_or_si256(
+			    _mm256_sll_epi32(v1, _mm_cvtsi64_si128(
+			                             static_cast<llong_t>(length))),
+			    _mm256_srl_epi32(v1, _mm_cvtsi64_si128(
+			                             static_cast<llong_t>(32ul - length))));
+
+			highway_round_avx2(v0, v1, mul0, mul1,
+			                   highway_tail_avx2(tail, length));
+		}
+
+		// Swap the halves of the words of v0 and rotate them two words.
+		const __m256i permutation = _mm256_setr_epi32(5, 4, 7, 6, 1, 0, 3, 2);
+		for (size_t round = 0ul; round < 4ul; round++)
+			highway_round_avx2(v0, v1, mul0, mul1,
+			                   _mm256_permutevar8x32_epi32(v0, permutation));
+
+		__m256i sum = _mm256_add_epi64(_mm256_add_epi64(v0, v1),
+		                               _mm256_add_epi64(mul0, mul1));
+
+		return static_cast<uint64_t>(
+		    _mm_cvtsi128_si64(_mm256_castsi256_si128(sum)));
+	}
+
+	/**
+	 * Update the state with the last bytes of an input and finish the hash,
+	 * keeping the lanes in AVX2 vectors.
+	 * @param [in] state Lanes of v0, v1, mul0 and mul1.
+	 * @param [in] tail Last bytes of the input.
+	 * @param [in] length Number of bytes of the tail, 0 to 31.
+	 * @return Calculated hash integer.
+	 */
+	__attribute__((target("avx2"))) static uint64_t
+	highway_finish_avx2(uint64_t *state, const byte_t *tail,
+	                    size_t length) noexcept {
+		auto lanes = reinterpret_cast<const __m256i *>(state);
+
+		return highway_end_avx2(
+		    _mm256_loadu_si256(lanes), _mm256_loadu_si256(lanes + 1),
+		    _mm256_loadu_si256(lanes + 2), _mm256_loadu_si256(lanes + 3),
+		    tail, length);
+	}
+
+	/**
+	 * Hash some data at once, keeping the lanes in AVX2 vectors from the
+	 * key to the result.
+	 * @param [in] key The 4 key words.
+	 * @param [in] input Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @return Calculated hash integer.
+	 */
+	__attribute__((target("avx2"))) static uint64_t
+	highway_hash_avx2(const uint64_t *key, const byte_t *input,
+	                  size_t length) noexcept {
+		__m256i key_lanes = _mm256_loadu_si256(
+		    reinterpret_cast<const __m256i *>(key));
+		__m256i mul0 = _mm256_loadu_si256(
+		    reinterpret_cast<const __m256i *>(highway_initial_mul0));
+		__m256i mul1 = _mm256_loadu_si256(
+		    reinterpret_cast<const __m256i *>(highway_initial_mul1));
+		__m256i v0 = _mm256_xor_si256(mul0, key_lanes);
+		__m256i v1 = _mm256_xor_si256(
+		    mul1, _mm256_shuffle_epi32(key_lanes, _MM_SHUFFLE(2, 3, 0, 1)));
+
+		for (; highway_packet_length <= length;
+		     length -= highway_packet_length, input += highway_packet_length)
+			highway_round_avx2(v0, v1, mul0, mul1,
+			                   _mm256_loadu_si256(
+			                       reinterpret_cast<const __m256i *>(input)));
+
+		return highway_end_avx2(v0, v1, mul0, mul1, input, length);
+	}
+#	endif
+
+
+	/// Signature of the packet update kernels.
+	typedef void_t (*highway_update_function)(uint64_t *, const byte_t *,
+	                                          size_t);
+	/// Signature of the tail and finalization kernels.
+	typedef uint64_t (*highway_finish_function)(uint64_t *, const byte_t *,
+	                                            size_t);
+	/// Signature of the whole input kernels.
+	typedef uint64_t (*highway_hash_function)(const uint64_t *,
+	                                          const byte_t *, size_t);
+
+	/**
+	 * Kernels of a vector unit.
+	 */
+	struct highway_kernels {
+		highway_update_function update;   ///< Whole packets update.
+		highway_finish_function finish;   ///< Tail and finalization.
+		highway_hash_function hash;   ///< Whole inputs at once.
+	};
+
+	/**
+	 * Pick the widest kernels the running CPU supports. Checked only once.
+	 * @return Kernels to use.
+	 */
+	static const highway_kernels &highway_select_kernels() noexcept {
+		static const highway_kernels kernels =
+#	if stick_HIGHWAY_AVX2
+		    __builtin_cpu_supports("avx2")
+		        ? highway_kernels { highway_update_avx2, highway_finish_avx2,
+		                            highway_hash_avx2 }
+		        : highway_kernels { highway_update_portable,
+		                            highway_finish_portable,
+		                            highway_hash_portable };
+#	else
+		    highway_kernels { highway_update_portable, highway_finish_portable,
+		                      highway_hash_portable };
+#	endif
+
+		return kernels;
+	}
+
+
+	uint64_t highwayhash_64(const void_t *bytes, size_t length,
+	                        const byte_t *key) noexcept {
+		uint64_t words[4];
+		highway_load_key(key, words);
+
+		return highway_select_kernels().hash(
+		    words, static_cast<const byte_t *>(bytes), length);
+	}
+
+
+
+	void_t hash_highway::process(const byte_t *bytes, size_t length) noexcept {
+		highway_update_function update = highway_select_kernels().update;
+
+		if (this->buffered != 0ul) {
+			size_t missing = highway_packet_length - this->buffered;
+			if (length < missing) {
+				for (size_t i = 0ul; i < length; i++)
+					this->buffer[this->buffered + i] = bytes[i];
+				this->buffered += length;
+
+				return;
+			}
+
+			for (size_t i = 0ul; i < missing; i++)
+				this->buffer[this->buffered + i] = bytes[i];
+			update(this->state, this->buffer, 1ul);
+
+			bytes += missing;
+			length -= missing;
+			this->buffered = 0ul;
+		}
+
+		size_t packets = length / highway_packet_length;
+		update(this->state, bytes, packets);
+
+		bytes += packets * highway_packet_length;
+		length -= packets * highway_packet_length;
+		for (size_t i = 0ul; i < length; i++)
+			this->buffer[i] = bytes[i];
+		this->buffered = length;
+	}
+
+	void_t hash_highway::restart() noexcept {
+		highway_start(this->state, this->key);
+		this->buffered = 0ul;
+	}
+
+	uint1024_t hash_highway::calculate_hash() const noexcept {
+		uint64_t state[16];
+		for (size_t i = 0ul; i < 16ul; i++)
+			state[i] = this->state[i];
+
+		return highway_select_kernels().finish(state, this->buffer,
+		                                       this->buffered);
+	}
+
+
+	hash_highway::hash_highway(const byte_t *key) noexcept
+	    : base_hash(hash_size::_64bit) {
+		highway_load_key(key, this->key);
+		this->restart();
+	}
+	hash_highway::hash_highway(const string_view &data,
+	                           const byte_t *key) noexcept
+	    : hash_highway(key) {
+		this->update(data);
+	}
+
+
+	uint64_t hash_highway::hash(const void_t *bytes, size_t length,
+	                            const byte_t *key) noexcept {
+		return highwayhash_64(bytes, length, key);
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_crypto_hash_highway_
@@ -0,0 +1,111 @@
+/**
+ * Random seed of the keyed hashes. Implementation
+ * @brief Random seed of the keyed hashes implementation.
+ * @file hash_seed.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../../include/stick/crypto/hash/hash_seed.hpp"
+
+#if defined(_stick_lib_crypto_hash_seed_)
+
+
+#	include "../../../../include/stick/defines/os.hpp"
+#	include "../../../../include/stick/templates/bit.tpp"
+
+#	include <ctime>
+
+#	if stick_OS_ID == stick_OS_ID_WINDOWS
+#		include <windows.h>
+#		include <ntsecapi.h>
+#	else
+#		include <fcntl.h>
+#		include <unistd.h>
+#	endif
+
+
+namespace stick {
+
+
+	/**
+	 * Seed bytes, wrapped to be returned from a function-local static.
+	 */
+	struct hash_seed_bytes {
+		byte_t bytes[hash_seed_length];   ///< Random bytes of the seed.
+	};
+
+
+	/**
+	 * Fill some bytes from the random source of the operating system.
+	 * @param [out] bytes Where to write the random bytes.
+	 * @param [in] length Number of bytes to write.
+	 * @return True if all the bytes were written, false otherwise.
+	 */
+	static bool_t hash_seed_system(byte_t *bytes, size_t length) noexcept {
+#	if stick_OS_ID == stick_OS_ID_WINDOWS
+		return RtlGenRandom(bytes, static_cast<ULONG>(length)) != FALSE;
+
+#	else
+		int_t file = open("/dev/urandom", O_RDONLY);
+		if (file < 0)
+			return false;
+
+		while (0ul < length) {
+			ssize_t bytes_read = read(file, bytes, length);
+			if (bytes_read <= 0)
+				break;
+
+			bytes += bytes_read;
+			length -= static_cast<size_t>(bytes_read);
+		}
+		close(file);
+
+		return length == 0ul;
+#	endif
+	}
+
+	/**
+	 * Fill the seed with the little entropy available without a random
+	 * source, the time and the addresses of the process layout.
+	 * @param [out] bytes Where to write the seed.
+	 */
+	static void_t hash_seed_fallback(byte_t *bytes) noexcept {
+		uint64_t entropy = static_cast<uint64_t>(time(nullptr)) << 32
+		                   ^ static_cast<uint64_t>(clock())
+		                   ^ reinterpret_cast<size_t>(bytes)
+		                   ^ reinterpret_cast<size_t>(&hash_seed) << 16;
+
+		// splitmix64 spreads it over all the words of the seed.
+		for (size_t i = 0ul; i < hash_seed_length; i += 8ul) {
+			entropy += 0x9e3779b97f4a7c15ul;
+			uint64_t word = entropy;
+			word = (word ^ word >> 30) * 0xbf58476d1ce4e5b9ul;
+			word = (word ^ word >> 27) * 0x94d049bb133111ebul;
+			store_little_endian(bytes + i, word ^ word >> 31);
+		}
+	}
+
+	/**
+	 * Draw a new seed.
+	 * @return Random seed bytes.
+	 */
+	static hash_seed_bytes hash_seed_draw() noexcept {
+		hash_seed_bytes seed;
+		if (not hash_seed_system(seed.bytes, hash_seed_length))
+			hash_seed_fallback(seed.bytes);
+
+		return seed;
+	}
+
+
+
+	const byte_t *hash_seed() noexcept {
+		static const hash_seed_bytes seed = hash_seed_draw();
+
+		return seed.bytes;
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_crypto_hash_seed_
@@ -0,0 +1,425 @@
+/**
+ * SHA-1 hash algorithm. Implementation
+ * @brief SHA-1 hash algorithm implementation.
+ * @file hash_sha1.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../../include/stick/crypto/hash/hash_sha1.hpp"
+
+#if defined(_stick_lib_crypto_hash_sha1_)
+
+
+#	include "../../../../include/stick/defines/arch.hpp"
+#	include "../../../../include/stick/defines/compiler.hpp"
+#	include "../../../../include/stick/templates/bit.tpp"
+
+#	if stick_IS_ARCH_x86_64                                                   \
+	    && (stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG)
+#		include <cpuid.h>
+#		include <immintrin.h>
+#		define stick_SHA1_X86 1
+#	elif stick_IS_ARCH_ARM && defined(__ARM_FEATURE_SHA2)
+#		include <arm_neon.h>
+#		define stick_SHA1_ARM 1
+#	endif
+
+
+namespace stick {
+
+
+	/// Round constants, one per 20 rounds.
+	static const uint32_t sha1_constants[4] = { 0x5a827999u, 0x6ed9eba1u,
+		                                        0x8f1bbcdcu, 0xca62c1d6u };
+
+	/// Initial chaining state.
+	static const uint32_t sha1_initial_state[5] = {
+		0x67452301u, 0xefcdab89u, 0x98badcfeu, 0x10325476u, 0xc3d2e1f0u
+	};
+
+	/// Bytes of a block.
+	static const size_t sha1_block_length = 64ul;
+
+
+	/**
+	 * Build the padded last blocks of a message.
+	 * @param [out] tail Where to write the blocks, 128 bytes.
+	 * @param [in] bytes Message bytes not making a whole block.
+	 * @param [in] length Number of bytes in bytes, under 64.
+	 * @param [in] total_length Number of bytes of the whole message.
+	 * @return Number of blocks written, 1 or 2.
+	 */
+	static size_t sha1_pad(byte_t *tail, const byte_t *bytes, size_t length,
+	                       uint64_t total_length) noexcept {
+		size_t blocks = length < 56ul ? 1ul : 2ul;
+
+		for (size_t i = 0ul; i < length; i++)
+			tail[i] = bytes[i];
+		tail[length] = 0x80u;
+		for (size_t i = length + 1ul; i < blocks * 64ul - 8ul; i++)
+			tail[i] = 0u;
+		store_big_endian(tail + blocks * 64ul - 8ul, total_length << 3);
+
+		return blocks;
+	}
+
+
+	/**
+	 * Compress blocks into the chaining state.
+	 * @param [in,out] state Chaining state.
+	 * @param [in] blocks Blocks to compress.
+	 * @param [in] amount Number of blocks.
+	 */
+	static void_t sha1_compress_portable(uint32_t *state, const byte_t *blocks,
+	                                     size_t amount) noexcept {
+		for (; amount != 0ul; blocks += sha1_block_length, amount--) {
+			uint32_t schedule[16];
+			for (size_t i = 0ul; i < 16ul; i++)
+				schedule[i] = load_big_endian<uint32_t>(blocks + 4ul * i);
+
+			uint32_t a = state[0], b = state[1], c = state[2], d = state[3],
+			         e = state[4];
+			for (size_t i = 0ul; i < 80ul; i++) {
+				uint32_t &word = schedule[i & 15ul];
+				if (16ul <= i)
+					word = rotate_left(schedule[(i + 13ul) & 15ul]
+					                       ^ schedule[(i + 8ul) & 15ul]
+					                       ^ schedule[(i + 2ul) & 15ul] ^ word,
+					                   1);
+
+				uint32_t function = i < 20ul   ? (b & c) | (~b & d)
+				                    : i < 40ul ? b ^ c ^ d
+				                    : i < 60ul ? (b & c) | (d & (b | c))
+				                               : b ^ c ^ d;
+				uint32_t temporary = rotate_left(a, 5) + function + e
+				                     + sha1_constants[i / 20ul] + word;
+
+				e = d;
+				d = c;
+				c = rotate_left(b, 30);
+				b = a;
+				a = temporary;
+			}
+
+			state[0] += a;
+			state[1] += b;
+			state[2] += c;
+			state[3] += d;
+			state[4] += e;
+		}
+	}
+
+
+#	if stick_SHA1_X86
+	/**
+	 * Four rounds with the SHA extensions, scheduling the message words of
+	 * later rounds on the way.
+	 * @tparam function Round function, one per 20 rounds.
+	 * @param [in,out] words_abcd State words a, b, c and d.
+	 * @param [in,out] word_e State word e of these rounds.
+	 * @param [out] next_e Gets the source of word e of the next rounds.
+	 * @param [in] current Message words of these rounds.
+	 * @param [in,out] previous Message words 4 rounds before, get their
+	 * first schedule step if schedule_previous.
+	 * @param [in,out] opposite Message words 8 rounds before, get xor-ed
+	 * if schedule_opposite.
+	 * @param [in,out] next Message words 12 rounds before, get their last
+	 * schedule step if schedule_next.
+	 * @param [in] first If these are the very first rounds.
+	 * @param [in] schedule_previous If previous should be scheduled.
+	 * @param [in] schedule_opposite If opposite should be scheduled.
+	 * @param [in] schedule_next If next should be scheduled.
+	 */
+	template<int function>
+	__attribute__((target("sha,sse4.1"))) static inline void_t
+	sha1_shani_rounds(__m128i &words_abcd, __m128i &word_e, __m128i &next_e,
+	                  const __m128i &current, __m128i &previous,
+	                  __m128i &opposite, __m128i &next, bool_t first,
+	                  bool_t schedule_previous, bool_t schedule_opposite,
+	                  bool_t schedule_next) noexcept {
+		word_e = first ? _mm_add_epi32(word_e, current)
+		               : _mm_sha1nexte_epu32(word_e, current);
+		next_e = words_abcd;
+
+		if (schedule_next)
+			next = _mm_sha1msg2_epu32(next, current);
+		words_abcd = _mm_sha1rnds4_epu32(words_abcd, word_e, function);
+		if (schedule_previous)
+			previous = _mm_sha1msg1_epu32(previous, current);
+		if (schedule_opposite)
+			opposite = _mm_xor_si128(opposite, current);
+	}
+
+	/**
+	 * Compress blocks into the chaining state with the SHA extensions.
+	 * @param [in,out] state Chaining state.
+	 * @param [in] blocks Blocks to compress.
+	 * @param [in] amount Number of blocks.
+	 */
+	__attribute__((target("sha,sse4.1"))) static void_t
+	sha1_compress_shani(uint32_t *state, const byte_t *blocks,
+	                    size_t amount) noexcept {
+		const __m128i byte_order = _mm_set_epi64x(0x0001020304050607l,
+		                                          0x08090a0b0c0d0e0fl);
+
+		__m128i words_abcd = _mm_shuffle_epi32(
+		    _mm_loadu_si128(reinterpret_cast<const __m128i *>(state)), 0x1b);
+		__m128i word_e = _mm_set_epi32(static_cast<int32_t>(state[4]), 0, 0,
+		                               0);
+
+		for (; amount != 0ul; blocks += sha1_block_length, amount--) {
+			__m128i saved_abcd = words_abcd, saved_e = word_e, other_e;
+
+			__m128i m[4];
+			for (size_t i = 0ul; i < 4ul; i++)
+				m[i] = _mm_shuffle_epi8(
+				    _mm_loadu_si128(
+				        reinterpret_cast<const __m128i *>(blocks) + i),
+				    byte_order);
+
+			// Rounds 4 * i use m[i % 4], the words of 16 rounds later are
+			// built from it and the three following groups meanwhile.
+			sha1_shani_rounds<0>(words_abcd, word_e, other_e, m[0], m[3],
+			                     m[2], m[1], true, false, false, false);
+			sha1_shani_rounds<0>(words_abcd, other_e, word_e, m[1], m[0],
+			                     m[3], m[2], false, true, false, false);
+			sha1_shani_rounds<0>(words_abcd, word_e, other_e, m[2], m[1],
+			                     m[0], m[3], false, true, true, false);
+			sha1_shani_rounds<0>(words_abcd, other_e, word_e, m[3], m[2],
+			                     m[1], m[0], false, true, true, true);
+			sha1_shani_rounds<0>(words_abcd, word_e, other_e, m[0], m[3],
+			                     m[2], m[1], false, true, true, true);
+			sha1_shani_rounds<1>(words_abcd, other_e, word_e, m[1], m[0],
+			                     m[3], m[2], false, true, true, true);
+			sha1_shani_rounds<1>(words_abcd, word_e, other_e, m[2], m[1],
+			                     m[0], m[3], false, true, true, true);
+			sha1_shani_rounds<1>(words_abcd, other_e, word_e, m[3], m[2],
+			                     m[1], m[0], false, true, true, true);
+			sha1_shani_rounds<1>(words_abcd, word_e, other_e, m[0], m[3],
+			                     m[2], m[1], false, true, true, true);
+			sha1_shani_rounds<1>(words_abcd, other_e, word_e, m[1], m[0],
+			                     m[3], m[2], false, true, true, true);
+			sha1_shani_rounds<2>(words_abcd, word_e, other_e, m[2], m[1],
+			                     m[0], m[3], false, true, true, true);
+			sha1_shani_rounds<2>(words_abcd, other_e, word_e, m[3], m[2],
+			                     m[1], m[0], false, true, true, true);
+			sha1_shani_rounds<2>(words_abcd, word_e, other_e, m[0], m[3],
+			                     m[2], m[1], false, true, true, true);
+			sha1_shani_rounds<2>(words_abcd, other_e, word_e, m[1], m[0],
+			                     m[3], m[2], false, true, true, true);
+			sha1_shani_rounds<2>(words_abcd, word_e, other_e, m[2], m[1],
+			                     m[0], m[3], false, true, true, true);
+			sha1_shani_rounds<3>(words_abcd, other_e, word_e, m[3], m[2],
+			                     m[1], m[0], false, true, true, true);
+			sha1_shani_rounds<3>(words_abcd, word_e, other_e, m[0], m[3],
+			                     m[2], m[1], false, true, true, true);
+			sha1_shani_rounds<3>(words_abcd, other_e, word_e, m[1], m[0],
+			                     m[3], m[2], false, false, true, true);
+			sha1_shani_rounds<3>(words_abcd, word_e, other_e, m[2], m[1],
+			                     m[0], m[3], false, false, false, true);
+			sha1_shani_rounds<3>(words_abcd, other_e, word_e, m[3], m[2],
+			                     m[1], m[0], false, false, false, false);
+
+			word_e = _mm_sha1nexte_epu32(word_e, saved_e);
+			words_abcd = _mm_add_epi32(words_abcd, saved_abcd);
+		}
+
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(state),
+		                 _mm_shuffle_epi32(words_abcd, 0x1b));
+		state[4] = static_cast<uint32_t>(_mm_extract_epi32(word_e, 3));
+	}
+
+
+	/**
+	 * Check if the CPU has the SHA extensions.
+	 * @return True if the SHA extensions are available, false otherwise.
+	 */
+	static bool_t sha1_has_extensions() noexcept {
+		unsigned int eax, ebx, ecx, edx;
+
+		return __get_cpuid_count(7u, 0u, &eax, &ebx, &ecx, &edx) != 0
+		       and (ebx & bit_SHA) != 0u and __builtin_cpu_supports("sse4.1");
+	}
+
+
+#	elif stick_SHA1_ARM
+	/**
+	 * Compress blocks into the chaining state with the ARMv8 cryptography
+	 * extensions.
+	 * @param [in,out] state Chaining state.
+	 * @param [in] blocks Blocks to compress.
+	 * @param [in] amount Number of blocks.
+	 */
+	static void_t sha1_compress_arm(uint32_t *state, const byte_t *blocks,
+	                                size_t amount) noexcept {
+		uint32x4_t words_abcd = vld1q_u32(state);
+		uint32_t word_e = state[4];
+
+		for (; amount != 0ul; blocks += sha1_block_length, amount--) {
+			uint32x4_t saved_abcd = words_abcd;
+			uint32_t saved_e = word_e;
+
+			uint32x4_t message[4];
+			for (size_t i = 0ul; i < 4ul; i++)
+				message[i] = vreinterpretq_u32_u8(
+				    vrev32q_u8(vld1q_u8(blocks + 16ul * i)));
+
+			for (size_t group = 0ul; group < 20ul; group++) {
+				uint32x4_t &current = message[group & 3ul];
+				uint32x4_t words = vaddq_u32(
+				    current, vdupq_n_u32(sha1_constants[group / 5ul]));
+				uint32_t next_e = vsha1h_u32(vgetq_lane_u32(words_abcd, 0));
+
+				if (group < 5ul)
+					words_abcd = vsha1cq_u32(words_abcd, word_e, words);
+				else if (group < 10ul or 15ul <= group)
+					words_abcd = vsha1pq_u32(words_abcd, word_e, words);
+				else
+					words_abcd = vsha1mq_u32(words_abcd, word_e, words);
+				word_e = next_e;
+
+				// Words of the rounds 16 later replace the current ones.
+				if (group < 16ul)
+					current = vsha1su1q_u32(
+					    vsha1su0q_u32(current, message[(group + 1ul) & 3ul],
+					                  message[(group + 2ul) & 3ul]),
+					    message[(group + 3ul) & 3ul]);
+			}
+
+			words_abcd = vaddq_u32(words_abcd, saved_abcd);
+			word_e += saved_e;
+		}
+
+		vst1q_u32(state, words_abcd);
+		state[4] = word_e;
+	}
+#	endif
+
+
+	/// Signature of the block compression kernels.
+	typedef void_t (*sha1_function)(uint32_t *, const byte_t *, size_t);
+
+	/**
+	 * Choose the fastest compression for the running CPU, only checked
+	 * once.
+	 * @return The kernel to use.
+	 */
+	static sha1_function sha1_select_kernel() noexcept {
+		static const sha1_function kernel =
+#	if stick_SHA1_X86
+		    sha1_has_extensions() ? sha1_compress_shani
+		                          : sha1_compress_portable;
+#	elif stick_SHA1_ARM
+		    sha1_compress_arm;
+#	else
+		    sha1_compress_portable;
+#	endif
+
+		return kernel;
+	}
+
+
+
+	void_t sha1(const void_t *bytes, size_t length, byte_t *digest) noexcept {
+		auto input = static_cast<const byte_t *>(bytes);
+		sha1_function compress = sha1_select_kernel();
+
+		uint32_t state[5];
+		for (size_t i = 0ul; i < 5ul; i++)
+			state[i] = sha1_initial_state[i];
+
+		size_t whole_blocks = length / sha1_block_length;
+		compress(state, input, whole_blocks);
+
+		byte_t tail[128];
+		compress(state, tail,
+		         sha1_pad(tail, input + whole_blocks * sha1_block_length,
+		                  length % sha1_block_length, length));
+
+		for (size_t i = 0ul; i < 5ul; i++)
+			store_big_endian(digest + 4ul * i, state[i]);
+	}
+
+
+
+	void_t hash_sha1::process(const byte_t *bytes, size_t length) noexcept {
+		this->total_length += length;
+
+		if (this->buffered != 0ul) {
+			size_t missing = sha1_block_length - this->buffered;
+			if (length < missing) {
+				for (size_t i = 0ul; i < length; i++)
+					this->buffer[this->buffered + i] = bytes[i];
+				this->buffered += length;
+
+				return;
+			}
+
+			for (size_t i = 0ul; i < missing; i++)
+				this->buffer[this->buffered + i] = bytes[i];
+			sha1_select_kernel()(this->state, this->buffer, 1ul);
+
+			bytes += missing;
+			length -= missing;
+			this->buffered = 0ul;
+		}
+
+		size_t whole_blocks = length / sha1_block_length;
+		sha1_select_kernel()(this->state, bytes, whole_blocks);
+
+		bytes += whole_blocks * sha1_block_length;
+		this->buffered = length % sha1_block_length;
+		for (size_t i = 0ul; i < this->buffered; i++)
+			this->buffer[i] = bytes[i];
+	}
+
+	void_t hash_sha1::restart() noexcept {
+		for (size_t i = 0ul; i < 5ul; i++)
+			this->state[i] = sha1_initial_state[i];
+
+		this->buffered = 0ul;
+		this->total_length = 0ul;
+	}
+
+	uint1024_t hash_sha1::calculate_hash() const noexcept {
+		uint32_t result[5];
+		this->finish(result);
+
+		uint1024_t value;
+		for (size_t i = 0ul; i < 5ul; i++)
+			(value <<= 32ul) |= result[i];
+
+		return value;
+	}
+
+	void_t hash_sha1::finish(uint32_t *result) const noexcept {
+		for (size_t i = 0ul; i < 5ul; i++)
+			result[i] = this->state[i];
+
+		byte_t tail[128];
+		sha1_select_kernel()(result, tail,
+		                     sha1_pad(tail, this->buffer, this->buffered,
+		                              this->total_length));
+	}
+
+
+	hash_sha1::hash_sha1() noexcept : base_hash(hash_size::_160bit) {
+		this->restart();
+	}
+	hash_sha1::hash_sha1(const string_view &data) noexcept : hash_sha1() {
+		this->update(data);
+	}
+
+
+	void_t hash_sha1::digest(byte_t *output) const noexcept {
+		uint32_t result[5];
+		this->finish(result);
+
+		for (size_t i = 0ul; i < 5ul; i++)
+			store_big_endian(output + 4ul * i, result[i]);
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_crypto_hash_sha1_
@@ -0,0 +1,683 @@
+/**
+ * SHA-256 hash algorithm. Implementation
+ * @brief SHA-256 hash algorithm implementation.
+ * @file hash_sha256.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../../include/stick/crypto/hash/hash_sha256.hpp"
+
+#if defined(_stick_lib_crypto_hash_sha256_)
+
+
+#	include "../../../../include/stick/defines/arch.hpp"
+#	include "../../../../include/stick/defines/compiler.hpp"
+#	include "../../../../include/stick/templates/bit.tpp"
+
+#	if stick_IS_ARCH_x86_64                                                   \
+	    && (stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG)
+#		include <cpuid.h>
+#		include <immintrin.h>
+#		define stick_SHA256_X86 1
+#	elif stick_IS_ARCH_ARM && defined(__ARM_FEATURE_SHA2)
+#		include <arm_neon.h>
+#		define stick_SHA256_ARM 1
+#	endif
+
+
+namespace stick {
+
+
+	/// Round constants.
+	alignas(16) static const uint32_t sha256_constants[64] = {
+		0x428a2f98u, 0x71374491u, 0xb5c0fbcfu, 0xe9b5dba5u, 0x3956c25bu,
+		0x59f111f1u, 0x923f82a4u, 0xab1c5ed5u, 0xd807aa98u, 0x12835b01u,
+		0x243185beu, 0x550c7dc3u, 0x72be5d74u, 0x80deb1feu, 0x9bdc06a7u,
+		0xc19bf174u, 0xe49b69c1u, 0xefbe4786u, 0x0fc19dc6u, 0x240ca1ccu,
+		0x2de92c6fu, 0x4a7484aau, 0x5cb0a9dcu, 0x76f988dau, 0x983e5152u,
+		0xa831c66du, 0xb00327c8u, 0xbf597fc7u, 0xc6e00bf3u, 0xd5a79147u,
+		0x06ca6351u, 0x14292967u, 0x27b70a85u, 0x2e1b2138u, 0x4d2c6dfcu,
+		0x53380d13u, 0x650a7354u, 0x766a0abbu, 0x81c2c92eu, 0x92722c85u,
+		0xa2bfe8a1u, 0xa81a664bu, 0xc24b8b70u, 0xc76c51a3u, 0xd192e819u,
+		0xd6990624u, 0xf40e3585u, 0x106aa070u, 0x19a4c116u, 0x1e376c08u,
+		0x2748774cu, 0x34b0bcb5u, 0x391c0cb3u, 0x4ed8aa4au, 0x5b9cca4fu,
+		0x682e6ff3u, 0x748f82eeu, 0x78a5636fu, 0x84c87814u, 0x8cc70208u,
+		0x90befffau, 0xa4506cebu, 0xbef9a3f7u, 0xc67178f2u
+	};
+
+	/// Initial chaining state.
+	static const uint32_t sha256_initial_state[8] = {
+		0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au,
+		0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u
+	};
+
+	/// Bytes of a block.
+	static const size_t sha256_block_length = 64ul;
+
+
+	/**
+	 * Build the padded last blocks of a message.
+	 * @param [out] tail Where to write the blocks, 128 bytes.
+	 * @param [in] bytes Message bytes not making a whole block.
+	 * @param [in] length Number of bytes in bytes, under 64.
+	 * @param [in] total_length Number of bytes of the whole message.
+	 * @return Number of blocks written, 1 or 2.
+	 */
+	static size_t sha256_pad(byte_t *tail, const byte_t *bytes, size_t length,
+	                         uint64_t total_length) noexcept {
+		size_t blocks = length < 56ul ? 1ul : 2ul;
+
+		for (size_t i = 0ul; i < length; i++)
+			tail[i] = bytes[i];
+		tail[length] = 0x80u;
+		for (size_t i = length + 1ul; i < blocks * 64ul - 8ul; i++)
+			tail[i] = 0u;
+		store_big_endian(tail + blocks * 64ul - 8ul, total_length << 3);
+
+		return blocks;
+	}
+
+	/**
+	 * Write a chaining state as a digest.
+	 * @param [out] digest Where to write the 32 bytes.
+	 * @param [in] state Chaining state.
+	 */
+	static inline void_t sha256_store(byte_t *digest,
+	                                  const uint32_t *state) noexcept {
+		for (size_t i = 0ul; i < 8ul; i++)
+			store_big_endian(digest + 4ul * i, state[i]);
+	}
+
+
+	/**
+	 * Compress blocks into the chaining state.
+	 * @param [in,out] state Chaining state.
+	 * @param [in] blocks Blocks to compress.
+	 * @param [in] amount Number of blocks.
+	 */
+	static void_t sha256_compress_portable(uint32_t *state,
+	                                       const byte_t *blocks,
+	                                       size_t amount) noexcept {
+		for (; amount != 0ul; blocks += sha256_block_length, amount--) {
+			uint32_t schedule[64];
+			for (size_t i = 0ul; i < 16ul; i++)
+				schedule[i] = load_big_endian<uint32_t>(blocks + 4ul * i);
+			for (size_t i = 16ul; i < 64ul; i++) {
+				uint32_t w15 = schedule[i - 15ul], w2 = schedule[i - 2ul];
+				schedule[i] = schedule[i - 16ul] + schedule[i - 7ul]
+				              + (rotate_right(w15, 7) ^ rotate_right(w15, 18)
+				                 ^ (w15 >> 3))
+				              + (rotate_right(w2, 17) ^ rotate_right(w2, 19)
+				                 ^ (w2 >> 10));
+			}
+
+			uint32_t a = state[0], b = state[1], c = state[2], d = state[3],
+			         e = state[4], f = state[5], g = state[6], h = state[7];
+			for (size_t i = 0ul; i < 64ul; i++) {
+				uint32_t temporary_first
+				    = h
+				      + (rotate_right(e, 6) ^ rotate_right(e, 11)
+				         ^ rotate_right(e, 25))
+				      + ((e & f) ^ (~e & g)) + sha256_constants[i]
+				      + schedule[i];
+				uint32_t temporary_second
+				    = (rotate_right(a, 2) ^ rotate_right(a, 13)
+				       ^ rotate_right(a, 22))
+				      + ((a & b) ^ (a & c) ^ (b & c));
+
+				h = g;
+				g = f;
+				f = e;
+				e = d + temporary_first;
+				d = c;
+				c = b;
+				b = a;
+				a = temporary_first + temporary_second;
+			}
+
+			state[0] += a;
+			state[1] += b;
+			state[2] += c;
+			state[3] += d;
+			state[4] += e;
+			state[5] += f;
+			state[6] += g;
+			state[7] += h;
+		}
+	}
+
+
+#	if stick_SHA256_X86
+	/**
+	 * Four rounds with the SHA extensions, scheduling the message words of
+	 * later rounds on the way.
+	 * @param [in,out] state_abef State words a, b, e and f.
+	 * @param [in,out] state_cdgh State words c, d, g and h.
+	 * @param [in] current Message words of these rounds.
+	 * @param [in,out] previous Message words of the previous rounds, get
+	 * their first schedule step if schedule_previous.
+	 * @param [in,out] next Message words of the next rounds, get their
+	 * second schedule step if schedule_next.
+	 * @param [in] round First round.
+	 * @param [in] schedule_previous If previous should be scheduled.
+	 * @param [in] schedule_next If next should be scheduled.
+	 */
+	__attribute__((target("sha,ssse3"))) static inline void_t
+	sha256_shani_rounds(__m128i &state_abef, __m128i &state_cdgh,
+	                    const __m128i &current, __m128i &previous,
+	                    __m128i &next, size_t round, bool_t schedule_previous,
+	                    bool_t schedule_next) noexcept {
+		__m128i message = _mm_add_epi32(
+		    current, _mm_load_si128(reinterpret_cast<const __m128i *>(
+		                 sha256_constants + round)));
+		state_cdgh = _mm_sha256rnds2_epu32(state_cdgh, state_abef, message);
+
+		if (schedule_next)
+			next = _mm_sha256msg2_epu32(
+			    _mm_add_epi32(next, _mm_alignr_epi8(current, previous, 4)),
+			    current);
+
+		message = _mm_shuffle_epi32(message, 0x0e);
+		state_abef = _mm_sha256rnds2_epu32(state_abef, state_cdgh, message);
+
+		if (schedule_previous)
+			previous = _mm_sha256msg1_epu32(previous, current);
+	}
+
+	/**
+	 * Compress blocks into the chaining state with the SHA extensions.
+	 * @param [in,out] state Chaining state.
+	 * @param [in] blocks Blocks to compress.
+	 * @param [in] amount Number of blocks.
+	 */
+	__attribute__((target("sha,sse4.1"))) static void_t
+	sha256_compress_shani(uint32_t *state, const byte_t *blocks,
+	                      size_t amount) noexcept {
+		const __m128i byte_order = _mm_set_epi64x(0x0c0d0e0f08090a0bl,
+		                                          0x0405060700010203l);
+
+		__m128i words_abcd = _mm_shuffle_epi32(
+		    _mm_loadu_si128(reinterpret_cast<const __m128i *>(state)), 0xb1);
+		__m128i state_cdgh = _mm_shuffle_epi32(
+		    _mm_loadu_si128(reinterpret_cast<const __m128i *>(state + 4)),
+		    0x1b);
+		__m128i state_abef = _mm_alignr_epi8(words_abcd, state_cdgh, 8);
+		state_cdgh = _mm_blend_epi16(state_cdgh, words_abcd, 0xf0);
+
+		for (; amount != 0ul; blocks += sha256_block_length, amount--) {
+			__m128i saved_abef = state_abef, saved_cdgh = state_cdgh;
+
+			__m128i message[4];
+			for (size_t i = 0ul; i < 4ul; i++)
+				message[i] = _mm_shuffle_epi8(
+				    _mm_loadu_si128(
+				        reinterpret_cast<const __m128i *>(blocks) + i),
+				    byte_order);
+
+			// Rounds 4 * i use message[i % 4], the words of 4 rounds later
+			// are scheduled from it meanwhile.
+			sha256_shani_rounds(state_abef, state_cdgh, message[0],
+			                    message[3], message[1], 0ul, false, false);
+			sha256_shani_rounds(state_abef, state_cdgh, message[1],
+			                    message[0], message[2], 4ul, true, false);
+			sha256_shani_rounds(state_abef, state_cdgh, message[2],
+			                    message[1], message[3], 8ul, true, false);
+			for (size_t round = 12ul; round < 48ul; round += 16ul) {
+				sha256_shani_rounds(state_abef, state_cdgh, message[3],
+				                    message[2], message[0], round, true,
+				                    true);
+				sha256_shani_rounds(state_abef, state_cdgh, message[0],
+				                    message[3], message[1], round + 4ul, true,
+				                    true);
+				sha256_shani_rounds(state_abef, state_cdgh, message[1],
+				                    message[0], message[2], round + 8ul, true,
+				                    true);
+				sha256_shani_rounds(state_abef, state_cdgh, message[2],
+				                    message[1], message[3], round + 12ul,
+				                    true, true);
+			}
+			sha256_shani_rounds(state_abef, state_cdgh, message[3],
+			                    message[2], message[0], 60ul, false, false);
+
+			state_abef = _mm_add_epi32(state_abef, saved_abef);
+			state_cdgh = _mm_add_epi32(state_cdgh, saved_cdgh);
+		}
+
+		words_abcd = _mm_shuffle_epi32(state_abef, 0x1b);
+		state_cdgh = _mm_shuffle_epi32(state_cdgh, 0xb1);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(state),
+		                 _mm_blend_epi16(words_abcd, state_cdgh, 0xf0));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4),
+		                 _mm_alignr_epi8(state_cdgh, words_abcd, 8));
+	}
+
+
+	/**
+	 * Rotate the 32 bits lanes of a vector to the right.
+	 * @tparam shift Number of bits to rotate.
+	 * @param [in] value Vector to rotate.
+	 * @return Rotated vector.
+	 */
+	template<int shift>
+	__attribute__((target("avx2"))) static inline __m256i
+	sha256_rotate_x8(__m256i value) noexcept {
+		return _mm256_or_si256(_mm256_srli_epi32(value, shift),
+		                       _mm256_slli_epi32(value, 32 - shift));
+	}
+
+	/**
+	 * Compress one block of 8 messages at once, one per 32 bits lane.
+	 * @param [in,out] states Chaining states, word by word, each word
+	 * holding the 8 lanes.
+	 * @param [in] blocks Block of every lane.
+	 */
+	__attribute__((target("avx2"))) static void_t
+	sha256_compress_x8(uint32_t (*states)[8],
+	                   const byte_t *const *blocks) noexcept {
+		const __m256i byte_order = _mm256_setr_epi8(
+		    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7,
+		    6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+		// Transpose the blocks, so each vector holds a word of all lanes.
+		__m256i schedule[16];
+		for (size_t half = 0ul; half < 2ul; half++) {
+			__m256i rows[8];
+			for (size_t lane = 0ul; lane < 8ul; lane++)
+				rows[lane] = _mm256_loadu_si256(
+				    reinterpret_cast<const __m256i *>(blocks[lane]) + half);
+
+			__m256i pairs[8], quads[8];
+			for (size_t i = 0ul; i < 8ul; i += 2ul) {
+				pairs[i] = _mm256_unpacklo_epi32(rows[i], rows[i + 1ul]);
+				pairs[i + 1ul] = _mm256_unpackhi_epi32(rows[i], rows[i + 1ul]);
+			}
+			for (size_t i = 0ul; i < 8ul; i += 4ul) {
+				quads[i] = _mm256_unpacklo_epi64(pairs[i], pairs[i + 2ul]);
+				quads[i + 1ul] = _mm256_unpackhi_epi64(pairs[i],
+				                                       pairs[i + 2ul]);
+				quads[i + 2ul] = _mm256_unpacklo_epi64(pairs[i + 1ul],
+				                                       pairs[i + 3ul]);
+				quads[i + 3ul] = _mm256_unpackhi_epi64(pairs[i + 1ul],
+				                                       pairs[i + 3ul]);
+			}
+			for (size_t i = 0ul; i < 4ul; i++) {
+				schedule[8ul * half + i] = _mm256_shuffle_epi8(
+				    _mm256_permute2x128_si256(quads[i], quads[i + 4ul], 0x20),
+				    byte_order);
+				schedule[8ul * half + i + 4ul] = _mm256_shuffle_epi8(
+				    _mm256_permute2x128_si256(quads[i], quads[i + 4ul], 0x31),
+				    byte_order);
+			}
+		}
+
+		__m256i words[8];
+		for (size_t i = 0ul; i < 8ul; i++)
+			words[i] = _mm256_loadu_si256(
+			    reinterpret_cast<const __m256i *>(states[i]));
+
+		for (size_t round = 0ul; round < 64ul; round++) {
+			__m256i &message = schedule[round & 15ul];
+			if (16ul <= round) {
+				__m256i w15 = schedule[(round - 15ul) & 15ul];
+				__m256i w2 = schedule[(round - 2ul) & 15ul];
+				__m256i sigma_first = _mm256_xor_si256(
+				    _mm256_xor_si256(sha256_rotate_x8<7>(w15),
+				                     sha256_rotate_x8<18>(w15)),
+				    _mm256_srli_epi32(w15, 3));
+				__m256i sigma_second = _mm256_xor_si256(
+				    _mm256_xor_si256(sha256_rotate_x8<17>(w2),
+				                     sha256_rotate_x8<19>(w2)),
+				    _mm256_srli_epi32(w2, 10));
+
+				message = _mm256_add_epi32(
+				    _mm256_add_epi32(message,
+				                     schedule[(round - 7ul) & 15ul]),
+				    _mm256_add_epi32(sigma_first, sigma_second));
+			}
+
+			__m256i &a = words[(0ul - round) & 7ul];
+			__m256i &b = words[(1ul - round) & 7ul];
+			__m256i &c = words[(2ul - round) & 7ul];
+			__m256i &d = words[(3ul - round) & 7ul];
+			__m256i &e = words[(4ul - round) & 7ul];
+			__m256i &f = words[(5ul - round) & 7ul];
+			__m256i &g = words[(6ul - round) & 7ul];
+			__m256i &h = words[(7ul - round) & 7ul];
+
+			__m256i temporary_first = _mm256_add_epi32(
+			    _mm256_add_epi32(
+			        h, _mm256_xor_si256(
+			               _mm256_xor_si256(sha256_rotate_x8<6>(e),
+			                                sha256_rotate_x8<11>(e)),
+			               sha256_rotate_x8<25>(e))),
+			    _mm256_add_epi32(
+			        _mm256_xor_si256(_mm256_and_si256(e, f),
+			                         _mm256_andnot_si256(e, g)),
+			        _mm256_add_epi32(
+			            message,
+			            _mm256_set1_epi32(static_cast<int32_t>(
+			                sha256_constants[round])))));
+			__m256i temporary_second = _mm256_add_epi32(
+			    _mm256_xor_si256(_mm256_xor_si256(sha256_rotate_x8<2>(a),
+			                                      sha256_rotate_x8<13>(a)),
+			                     sha256_rotate_x8<22>(a)),
+			    _mm256_or_si256(_mm256_and_si256(a, b),
+			                    _mm256_and_si256(c, _mm256_or_si256(a, b))));
+
+			// The words rotate by renaming, h becomes the new a.
+			d = _mm256_add_epi32(d, temporary_first);
+			h = _mm256_add_epi32(temporary_first, temporary_second);
+		}
+
+		for (size_t i = 0ul; i < 8ul; i++) {
+			auto lanes = reinterpret_cast<__m256i *>(states[i]);
+			_mm256_storeu_si256(lanes,
+			                    _mm256_add_epi32(_mm256_loadu_si256(lanes),
+			                                     words[i]));
+		}
+	}
+
+
+	/**
+	 * Check if the CPU has the SHA extensions.
+	 * @return True if the SHA extensions are available, false otherwise.
+	 */
+	static bool_t sha256_has_extensions() noexcept {
+		unsigned int eax, ebx, ecx, edx;
+
+		return __get_cpuid_count(7u, 0u, &eax, &ebx, &ecx, &edx) != 0
+		       and (ebx & bit_SHA) != 0u and __builtin_cpu_supports("sse4.1");
+	}
+
+
+#	elif stick_SHA256_ARM
+	/**
+	 * Compress blocks into the chaining state with the ARMv8 cryptography
+	 * extensions.
+	 * @param [in,out] state Chaining state.
+	 * @param [in] blocks Blocks to compress.
+	 * @param [in] amount Number of blocks.
+	 */
+	static void_t sha256_compress_arm(uint32_t *state, const byte_t *blocks,
+	                                  size_t amount) noexcept {
+		uint32x4_t state_abcd = vld1q_u32(state);
+		uint32x4_t state_efgh = vld1q_u32(state + 4);
+
+		for (; amount != 0ul; blocks += sha256_block_length, amount--) {
+			uint32x4_t saved_abcd = state_abcd, saved_efgh = state_efgh;
+
+			uint32x4_t message[4];
+			for (size_t i = 0ul; i < 4ul; i++)
+				message[i] = vreinterpretq_u32_u8(
+				    vrev32q_u8(vld1q_u8(blocks + 16ul * i)));
+
+			for (size_t round = 0ul; round < 64ul; round += 4ul) {
+				uint32x4_t &current = message[(round / 4ul) & 3ul];
+				uint32x4_t words = vaddq_u32(
+				    current, vld1q_u32(sha256_constants + round));
+				uint32x4_t previous_abcd = state_abcd;
+
+				state_abcd = vsha256hq_u32(state_abcd, state_efgh, words);
+				state_efgh = vsha256h2q_u32(state_efgh, previous_abcd, words);
+
+				// Words of the rounds 16 later replace the current ones.
+				if (round < 48ul)
+					current = vsha256su1q_u32(
+					    vsha256su0q_u32(current,
+					                    message[(round / 4ul + 1ul) & 3ul]),
+					    message[(round / 4ul + 2ul) & 3ul],
+					    message[(round / 4ul + 3ul) & 3ul]);
+			}
+
+			state_abcd = vaddq_u32(state_abcd, saved_abcd);
+			state_efgh = vaddq_u32(state_efgh, saved_efgh);
+		}
+
+		vst1q_u32(state, state_abcd);
+		vst1q_u32(state + 4, state_efgh);
+	}
+#	endif
+
+
+	/// Signature of the block compression kernels.
+	typedef void_t (*sha256_function)(uint32_t *, const byte_t *, size_t);
+
+	/**
+	 * Choose the fastest compression for the running CPU, only checked
+	 * once.
+	 * @return The kernel to use.
+	 */
+	static sha256_function sha256_select_kernel() noexcept {
+		static const sha256_function kernel =
+#	if stick_SHA256_X86
+		    sha256_has_extensions() ? sha256_compress_shani
+		                            : sha256_compress_portable;
+#	elif stick_SHA256_ARM
+		    sha256_compress_arm;
+#	else
+		    sha256_compress_portable;
+#	endif
+
+		return kernel;
+	}
+
+
+#	if stick_SHA256_X86
+	/**
+	 * State of a lane of the multi-buffer hashing.
+	 */
+	struct sha256_lane {
+		const byte_t *blocks;   ///< Next whole block of the message.
+		size_t whole_blocks;   ///< Whole blocks left.
+		size_t tail_blocks;   ///< Padded blocks left.
+		size_t tail_position;   ///< Next padded block.
+		size_t message;   ///< Index of the message.
+		byte_t tail[128];   ///< Padded last blocks.
+	};
+
+	/**
+	 * Hash many messages in the lanes of the AVX2 vectors.
+	 * @param [in] messages Data of every message.
+	 * @param [in] lengths Number of bytes of every message.
+	 * @param [out] digests Where to write the digests.
+	 * @param [in] amount Number of messages.
+	 */
+	static void_t sha256_multi_avx2(const void_t *const *messages,
+	                                const size_t *lengths, byte_t *digests,
+	                                size_t amount) noexcept {
+		static const byte_t idle_block[sha256_block_length] = { };
+
+		sha256_lane lanes[8];
+		uint32_t states[8][8];
+		const byte_t *blocks[8];
+		size_t next_message = 0ul, busy_lanes = 0ul;
+
+		// Give a lane the next message, or leave it idle if there are none.
+		auto assign = [&](size_t lane) noexcept {
+			sha256_lane &current = lanes[lane];
+			if (amount <= next_message) {
+				current.message = amount;
+				return;
+			}
+
+			current.message = next_message++;
+			auto bytes = static_cast<const byte_t *>(
+			    messages[current.message]);
+			size_t length = lengths[current.message];
+
+			current.blocks = bytes;
+			current.whole_blocks = length / sha256_block_length;
+			current.tail_position = 0ul;
+			current.tail_blocks = sha256_pad(
+			    current.tail,
+			    bytes + current.whole_blocks * sha256_block_length,
+			    length % sha256_block_length, length);
+			for (size_t i = 0ul; i < 8ul; i++)
+				states[i][lane] = sha256_initial_state[i];
+
+			busy_lanes++;
+		};
+
+		for (size_t lane = 0ul; lane < 8ul; lane++)
+			assign(lane);
+
+		while (busy_lanes != 0ul) {
+			for (size_t lane = 0ul; lane < 8ul; lane++) {
+				sha256_lane &current = lanes[lane];
+				if (current.message == amount)
+					blocks[lane] = idle_block;
+				else if (current.whole_blocks != 0ul)
+					blocks[lane] = current.blocks;
+				else
+					blocks[lane] = current.tail + current.tail_position;
+			}
+
+			sha256_compress_x8(states, blocks);
+
+			for (size_t lane = 0ul; lane < 8ul; lane++) {
+				sha256_lane &current = lanes[lane];
+				if (current.message == amount)
+					continue;
+
+				if (current.whole_blocks != 0ul) {
+					current.blocks += sha256_block_length;
+					current.whole_blocks--;
+					continue;
+				}
+
+				current.tail_position += sha256_block_length;
+				if (--current.tail_blocks != 0ul)
+					continue;
+
+				uint32_t state[8];
+				for (size_t i = 0ul; i < 8ul; i++)
+					state[i] = states[i][lane];
+				sha256_store(digests + current.message * sha256_digest_length,
+				             state);
+
+				busy_lanes--;
+				assign(lane);
+			}
+		}
+	}
+#	endif
+
+
+
+	void_t sha256(const void_t *bytes, size_t length, byte_t *digest) noexcept {
+		auto input = static_cast<const byte_t *>(bytes);
+		sha256_function compress = sha256_select_kernel();
+
+		uint32_t state[8];
+		for (size_t i = 0ul; i < 8ul; i++)
+			state[i] = sha256_initial_state[i];
+
+		size_t whole_blocks = length / sha256_block_length;
+		compress(state, input, whole_blocks);
+
+		byte_t tail[128];
+		compress(state, tail,
+		         sha256_pad(tail, input + whole_blocks * sha256_block_length,
+		                    length % sha256_block_length, length));
+
+		sha256_store(digest, state);
+	}
+
+	void_t sha256_multi(const void_t *const *messages, const size_t *lengths,
+	                    byte_t *digests, size_t amount) noexcept {
+#	if stick_SHA256_X86
+		// A single lane of the extensions beats 8 lanes of AVX2.
+		static const bool_t use_lanes = not sha256_has_extensions()
+		                                and __builtin_cpu_supports("avx2");
+		if (use_lanes and 1ul < amount)
+			return sha256_multi_avx2(messages, lengths, digests, amount);
+#	endif
+
+		for (size_t i = 0ul; i < amount; i++)
+			sha256(messages[i], lengths[i],
+			       digests + i * sha256_digest_length);
+	}
+
+
+
+	void_t hash_sha256::process(const byte_t *bytes, size_t length) noexcept {
+		this->total_length += length;
+
+		if (this->buffered != 0ul) {
+			size_t missing = sha256_block_length - this->buffered;
+			if (length < missing) {
+				for (size_t i = 0ul; i < length; i++)
+					this->buffer[this->buffered + i] = bytes[i];
+				this->buffered += length;
+
+				return;
+			}
+
+			for (size_t i = 0ul; i < missing; i++)
+				this->buffer[this->buffered + i] = bytes[i];
+			sha256_select_kernel()(this->state, this->buffer, 1ul);
+
+			bytes += missing;
+			length -= missing;
+			this->buffered = 0ul;
+		}
+
+		size_t whole_blocks = length / sha256_block_length;
+		sha256_select_kernel()(this->state, bytes, whole_blocks);
+
+		bytes += whole_blocks * sha256_block_length;
+		this->buffered = length % sha256_block_length;
+		for (size_t i = 0ul; i < this->buffered; i++)
+			this->buffer[i] = bytes[i];
+	}
+
+	void_t hash_sha256::restart() noexcept {
+		for (size_t i = 0ul; i < 8ul; i++)
+			this->state[i] = sha256_initial_state[i];
+
+		this->buffered = 0ul;
+		this->total_length = 0ul;
+	}
+
+	uint1024_t hash_sha256::calculate_hash() const noexcept {
+		uint32_t result[8];
+		this->finish(result);
+
+		uint1024_t value;
+		for (size_t i = 0ul; i < 8ul; i++)
+			(value <<= 32ul) |= result[i];
+
+		return value;
+	}
+
+	void_t hash_sha256::finish(uint32_t *result) const noexcept {
+		for (size_t i = 0ul; i < 8ul; i++)
+			result[i] = this->state[i];
+
+		byte_t tail[128];
+		sha256_select_kernel()(result, tail,
+		                       sha256_pad(tail, this->buffer, this->buffered,
+		                                  this->total_length));
+	}
+
+
+	hash_sha256::hash_sha256() noexcept : base_hash(hash_size::_256bit) {
+		this->restart();
+	}
+	hash_sha256::hash_sha256(const string_view &data) noexcept
+	    : hash_sha256() {
+		this->update(data);
+	}
+
+
+	void_t hash_sha256::digest(byte_t *output) const noexcept {
+		uint32_t result[8];
+		this->finish(result);
+
+		sha256_store(output, result);
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_crypto_hash_sha256_
@@ -0,0 +1,225 @@
+/**
+ * SipHash keyed hash algorithm. Implementation
+ * @brief SipHash keyed hash algorithm implementation.
+ * @file hash_siphash.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../../include/stick/crypto/hash/hash_siphash.hpp"
+
+#if defined(_stick_lib_crypto_hash_siphash_)
+
+
+#	include "../../../../include/stick/crypto/hash/hash_seed.hpp"
+#	include "../../../../include/stick/templates/bit.tpp"
+
+
+namespace stick {
+
+
+	/**
+	 * Read the key words of a hash.
+	 * @param [in] key The 16 bytes of the key, nullptr for the process seed.
+	 * @param [out] words Where to write the 2 key words.
+	 */
+	static inline void_t siphash_load_key(const byte_t *key,
+	                                      uint64_t *words) noexcept {
+		if (key == nullptr)
+			key = hash_seed();
+
+		words[0] = load_little_endian<uint64_t>(key);
+		words[1] = load_little_endian<uint64_t>(key + 8);
+	}
+
+	/**
+	 * Set the lanes to their initial value for a key.
+	 * @param [out] state The 4 lanes.
+	 * @param [in] key The 2 key words.
+	 */
+	static inline void_t siphash_start(uint64_t *state,
+	                                   const uint64_t *key) noexcept {
+		state[0] = key[0] ^ 0x736f6d6570736575ul;
+		state[1] = key[1] ^ 0x646f72616e646f6dul;
+		state[2] = key[0] ^ 0x6c7967656e657261ul;
+		state[3] = key[1] ^ 0x7465646279746573ul;
+	}
+
+	/**
+	 * Mix the lanes some SipRounds.
+	 * @param [in,out] state The 4 lanes.
+	 * @param [in] rounds Number of rounds.
+	 */
+	static inline void_t siphash_rounds(uint64_t *state,
+	                                    size_t rounds) noexcept {
+		uint64_t v0 = state[0], v1 = state[1], v2 = state[2], v3 = state[3];
+		for (size_t i = 0ul; i < rounds; i++) {
+			v0 += v1;
+			v1 = rotate_left(v1, 13ul) ^ v0;
+			v0 = rotate_left(v0, 32ul);
+			v2 += v3;
+			v3 = rotate_left(v3, 16ul) ^ v2;
+			v0 += v3;
+			v3 = rotate_left(v3, 21ul) ^ v0;
+			v2 += v1;
+			v1 = rotate_left(v1, 17ul) ^ v2;
+			v2 = rotate_left(v2, 32ul);
+		}
+
+		state[0] = v0;
+		state[1] = v1;
+		state[2] = v2;
+		state[3] = v3;
+	}
+
+	/**
+	 * Compress a word of input into the lanes.
+	 * @param [in,out] state The 4 lanes.
+	 * @param [in] word Word of input.
+	 * @param [in] rounds Rounds per word.
+	 */
+	static inline void_t siphash_compress(uint64_t *state, uint64_t word,
+	                                      size_t rounds) noexcept {
+		state[3] ^= word;
+		siphash_rounds(state, rounds);
+		state[0] ^= word;
+	}
+
+	/**
+	 * Compress the last bytes of an input and finish the hash.
+	 * @param [in,out] state The 4 lanes.
+	 * @param [in] tail Last bytes of the input, less than a word.
+	 * @param [in] tail_length Number of bytes of the tail.
+	 * @param [in] length Length of the whole input.
+	 * @param [in] compression_rounds Rounds per word.
+	 * @param [in] finalization_rounds Rounds at the end.
+	 * @return Calculated hash integer.
+	 */
+	static inline uint64_t siphash_finish(uint64_t *state, const byte_t *tail,
+	                                      size_t tail_length, uint64_t length,
+	                                      size_t compression_rounds,
+	                                      size_t finalization_rounds) noexcept {
+		uint64_t word = length << 56;
+		for (size_t i = 0ul; i < tail_length; i++)
+			word |= static_cast<uint64_t>(tail[i]) << (i << 3);
+
+		siphash_compress(state, word, compression_rounds);
+		state[2] ^= 0xfful;
+		siphash_rounds(state, finalization_rounds);
+
+		return state[0] ^ state[1] ^ state[2] ^ state[3];
+	}
+
+	/**
+	 * Hash some data at once.
+	 * @param [in] bytes Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @param [in] key The 16 bytes of the key, nullptr for the process seed.
+	 * @param [in] compression_rounds Rounds per word.
+	 * @param [in] finalization_rounds Rounds at the end.
+	 * @return Calculated hash integer.
+	 */
+	static inline uint64_t siphash(const void_t *bytes, size_t length,
+	                               const byte_t *key,
+	                               size_t compression_rounds,
+	                               size_t finalization_rounds) noexcept {
+		auto input = static_cast<const byte_t *>(bytes);
+		uint64_t words[2], state[4];
+		siphash_load_key(key, words);
+		siphash_start(state, words);
+
+		size_t whole_length = length & ~7ul;
+		for (size_t i = 0ul; i < whole_length; i += 8ul)
+			siphash_compress(state, load_little_endian<uint64_t>(input + i),
+			                 compression_rounds);
+
+		return siphash_finish(state, input + whole_length,
+		                      length - whole_length, length,
+		                      compression_rounds, finalization_rounds);
+	}
+
+
+	uint64_t siphash_2_4(const void_t *bytes, size_t length,
+	                     const byte_t *key) noexcept {
+		return siphash(bytes, length, key, 2ul, 4ul);
+	}
+
+	uint64_t siphash_1_3(const void_t *bytes, size_t length,
+	                     const byte_t *key) noexcept {
+		return siphash(bytes, length, key, 1ul, 3ul);
+	}
+
+
+
+	void_t hash_siphash::process(const byte_t *bytes, size_t length) noexcept {
+		this->total_length += length;
+
+		if (this->buffered != 0ul) {
+			size_t missing = 8ul - this->buffered;
+			if (length < missing) {
+				for (size_t i = 0ul; i < length; i++)
+					this->buffer[this->buffered + i] = bytes[i];
+				this->buffered += length;
+
+				return;
+			}
+
+			for (size_t i = 0ul; i < missing; i++)
+				this->buffer[this->buffered + i] = bytes[i];
+			siphash_compress(this->state,
+			                 load_little_endian<uint64_t>(this->buffer),
+			                 this->compression_rounds);
+
+			bytes += missing;
+			length -= missing;
+			this->buffered = 0ul;
+		}
+
+		for (; 8ul <= length; bytes += 8, length -= 8ul)
+			siphash_compress(this->state, load_little_endian<uint64_t>(bytes),
+			                 this->compression_rounds);
+
+		for (size_t i = 0ul; i < length; i++)
+			this->buffer[i] = bytes[i];
+		this->buffered = length;
+	}
+
+	void_t hash_siphash::restart() noexcept {
+		siphash_start(this->state, this->key);
+		this->buffered = 0ul;
+		this->total_length = 0ul;
+	}
+
+	uint1024_t hash_siphash::calculate_hash() const noexcept {
+		uint64_t state[4] = { this->state[0], this->state[1], this->state[2],
+		                      this->state[3] };
+
+		return siphash_finish(state, this->buffer, this->buffered,
+		                      this->total_length, this->compression_rounds,
+		                      this->finalization_rounds);
+	}
+
+
+	hash_siphash::hash_siphash(const byte_t *key, size_t compression_rounds,
+	                           size_t finalization_rounds) noexcept
+	    : base_hash(hash_size::_64bit), compression_rounds(compression_rounds),
+	      finalization_rounds(finalization_rounds) {
+		siphash_load_key(key, this->key);
+		this->restart();
+	}
+	hash_siphash::hash_siphash(const string_view &data, const byte_t *key,
+	                           size_t compression_rounds,
+	                           size_t finalization_rounds) noexcept
+	    : hash_siphash(key, compression_rounds, finalization_rounds) {
+		this->update(data);
+	}
+
+
+	uint64_t hash_siphash::hash(const void_t *bytes, size_t length,
+	                            const byte_t *key) noexcept {
+		return siphash_2_4(bytes, length, key);
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_crypto_hash_siphash_
@@ -0,0 +1,212 @@
+/**
+ * wyhash hash algorithm. Implementation
+ * @brief wyhash hash algorithm implementation.
+ * @file hash_wyhash.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../../include/stick/crypto/hash/hash_wyhash.hpp"
+
+#if defined(_stick_lib_crypto_hash_wyhash_)
+
+
+#	include "../../../../include/stick/templates/bit.tpp"
+
+
+namespace stick {
+
+
+	/// Default secret of the algorithm.
+	static const uint64_t wyhash_secret[4]
+	    = { 0x2d358dccaa6c78a5ul, 0x8bb84b93962eacc9ul, 0x4b33a62ed433d4a3ul,
+		    0x4d5a2da51de1aa47ul };
+
+	/// Bytes consumed by every round of the main loop.
+	static const size_t wyhash_round_length = 48ul;
+
+
+
+	static inline uint64_t wyhash_mix(uint64_t left, uint64_t right) noexcept {
+		uint64_t high;
+		uint64_t low = multiply_extended(left, right, high);
+
+		return low ^ high;
+	}
+
+	static inline uint64_t wyhash_read64(const byte_t *address) noexcept {
+		return load_little_endian<uint64_t>(address);
+	}
+	static inline uint64_t wyhash_read32(const byte_t *address) noexcept {
+		return load_little_endian<uint32_t>(address);
+	}
+
+	static inline uint64_t wyhash_seed(uint64_t seed) noexcept {
+		return seed ^ wyhash_mix(seed ^ wyhash_secret[0], wyhash_secret[1]);
+	}
+
+	/**
+	 * Process a 48 bytes round.
+	 * @param [in] input Round data.
+	 * @param [in,out] state Main lane.
+	 * @param [in,out] first_lane Second lane.
+	 * @param [in,out] second_lane Third lane.
+	 */
+	static inline void_t wyhash_round(const byte_t *input, uint64_t &state,
+	                                  uint64_t &first_lane,
+	                                  uint64_t &second_lane) noexcept {
+		state = wyhash_mix(wyhash_read64(input) ^ wyhash_secret[1],
+		                   wyhash_read64(input + 8) ^ state);
+		first_lane = wyhash_mix(wyhash_read64(input + 16) ^ wyhash_secret[2],
+		                        wyhash_read64(input + 24) ^ first_lane);
+		second_lane = wyhash_mix(wyhash_read64(input + 32) ^ wyhash_secret[3],
+		                         wyhash_read64(input + 40) ^ second_lane);
+	}
+
+	/**
+	 * Hash the last bytes of an input.
+	 * @param [in] input Data left after the 48 bytes rounds. When the whole
+	 * input is longer than 16 bytes, the 16 bytes before it must be readable.
+	 * @param [in] remaining Number of bytes left.
+	 * @param [in] length Length of the whole input.
+	 * @param [in] state Main lane, already merged with the other lanes.
+	 * @return Calculated hash integer.
+	 */
+	static uint64_t wyhash_finish(const byte_t *input, size_t remaining,
+	                              uint64_t length, uint64_t state) noexcept {
+		uint64_t low, high;
+
+		if (length <= 16ul) {
+			if (4ul <= length) {
+				size_t middle = (length >> 3) << 2;
+				low = wyhash_read32(input) << 32
+				      | wyhash_read32(input + middle);
+				high = wyhash_read32(input + length - 4ul) << 32
+				       | wyhash_read32(input + length - 4ul - middle);
+			} else if (0ul < length) {
+				low = static_cast<uint64_t>(input[0]) << 16
+				      | static_cast<uint64_t>(input[length >> 1]) << 8
+				      | input[length - 1ul];
+				high = 0ul;
+			} else
+				low = high = 0ul;
+		} else {
+			for (; 16ul < remaining; remaining -= 16ul, input += 16)
+				state = wyhash_mix(wyhash_read64(input) ^ wyhash_secret[1],
+				                   wyhash_read64(input + 8) ^ state);
+
+			low = wyhash_read64(input + remaining - 16ul);
+			high = wyhash_read64(input + remaining - 8ul);
+		}
+
+		low = multiply_extended(low ^ wyhash_secret[1], high ^ state, high);
+
+		return wyhash_mix(low ^ wyhash_secret[0] ^ length,
+		                  high ^ wyhash_secret[1]);
+	}
+
+
+	uint64_t wyhash(const void_t *bytes, size_t length,
+	                uint64_t seed) noexcept {
+		auto input = static_cast<const byte_t *>(bytes);
+		uint64_t state = wyhash_seed(seed);
+		size_t remaining = length;
+
+		if (wyhash_round_length <= length) {
+			uint64_t first_lane = state, second_lane = state;
+			do {
+				wyhash_round(input, state, first_lane, second_lane);
+				input += wyhash_round_length;
+				remaining -= wyhash_round_length;
+			} while (wyhash_round_length <= remaining);
+
+			state ^= first_lane ^ second_lane;
+		}
+
+		return wyhash_finish(input, remaining, length, state);
+	}
+
+	void_t wyhash_batch(const void_t *const *keys, const size_t *lengths,
+	                    uint64_t *hashes, size_t amount,
+	                    uint64_t seed) noexcept {
+		uint64_t state = wyhash_seed(seed);
+
+		// Short keys are finished inline from the seed mixed once, so the
+		// keys do not wait for each other behind a call and their multiplies
+		// overlap in the pipeline.
+		for (size_t i = 0ul; i < amount; i++)
+			hashes[i] = lengths[i] <= 16ul
+			                ? wyhash_finish(
+			                      static_cast<const byte_t *>(keys[i]),
+			                      lengths[i], lengths[i], state)
+			                : wyhash(keys[i], lengths[i], seed);
+	}
+
+
+
+	void_t hash_wyhash::process(const byte_t *bytes, size_t length) noexcept {
+		this->total_length += length;
+
+		while (length != 0ul) {
+			size_t taken = wyhash_round_length - this->buffered;
+			if (length < taken)
+				taken = length;
+
+			for (size_t i = 0ul; i < taken; i++)
+				this->buffer[16ul + this->buffered + i] = bytes[i];
+			this->buffered += taken;
+			bytes += taken;
+			length -= taken;
+
+			if (this->buffered == wyhash_round_length) {
+				wyhash_round(this->buffer + 16, this->state, this->first_lane,
+				             this->second_lane);
+
+				// Keep the round tail, the last read may look back into it.
+				for (size_t i = 0ul; i < 16ul; i++)
+					this->buffer[i] = this->buffer[wyhash_round_length + i];
+				this->buffered = 0ul;
+			}
+		}
+	}
+
+	void_t hash_wyhash::restart() noexcept {
+		this->state = this->first_lane = this->second_lane
+		    = wyhash_seed(this->seed);
+		this->buffered = 0ul;
+		this->total_length = 0ul;
+	}
+
+	uint1024_t hash_wyhash::calculate_hash() const noexcept {
+		uint64_t state = this->state;
+		if (wyhash_round_length <= this->total_length)
+			state ^= this->first_lane ^ this->second_lane;
+
+		return wyhash_finish(this->buffer + 16, this->buffered,
+		                     this->total_length, state);
+	}
+
+
+	hash_wyhash::hash_wyhash(uint64_t seed) noexcept
+	    : base_hash(hash_size::_64bit), seed(seed) {
+		this->restart();
+	}
+	hash_wyhash::hash_wyhash(const string_view &data, uint64_t seed) noexcept
+	    : hash_wyhash(seed) {
+		this->update(data);
+	}
+
+
+	uint64_t hash_wyhash::hash(const void_t *bytes, size_t length,
+	                           uint64_t seed) noexcept {
+		return wyhash(bytes, length, seed);
+	}
+	void_t hash_wyhash::hash_batch(const void_t *const *keys,
+	                               const size_t *lengths, uint64_t *hashes,
+	                               size_t amount, uint64_t seed) noexcept {
+		wyhash_batch(keys, lengths, hashes, amount, seed);
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_crypto_hash_wyhash_
@@ -0,0 +1,910 @@
+/**
+ * XXH3 hash algorithm, 64 and 128 bits variants. Implementation
+ * @brief XXH3 hash algorithm implementation.
+ * @file hash_xxh3.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../../include/stick/crypto/hash/hash_xxh3.hpp"
+
+#if defined(_stick_lib_crypto_hash_xxh3_)
+
+
+#	include "../../../../include/stick/defines/arch.hpp"
+#	include "../../../../include/stick/defines/compiler.hpp"
+#	include "../../../../include/stick/templates/bit.tpp"
+
+#	if stick_IS_ARCH_x86_64
+#		include <emmintrin.h>
+#		if stick_IS_COMPILER_GCC || stick_IS_COMPILER_CLANG
+#			include <immintrin.h>
+#			define stick_XXH3_AVX2 1
+#		endif
+#	endif
+
+
+namespace stick {
+
+
+	static const uint32_t xxh3_prime32_1 = 0x9e3779b1u;
+	static const uint32_t xxh3_prime32_2 = 0x85ebca77u;
+	static const uint32_t xxh3_prime32_3 = 0xc2b2ae3du;
+	static const uint64_t xxh3_prime64_1 = 0x9e3779b185ebca87ul;
+	static const uint64_t xxh3_prime64_2 = 0xc2b2ae3d27d4eb4ful;
+	static const uint64_t xxh3_prime64_3 = 0x165667b19e3779f9ul;
+	static const uint64_t xxh3_prime64_4 = 0x85ebca77c2b2ae63ul;
+	static const uint64_t xxh3_prime64_5 = 0x27d4eb2f165667c5ul;
+
+	/// Bytes of input consumed by every accumulation step.
+	static const size_t xxh3_stripe_length = 64ul;
+	/// Secret bytes advanced between consecutive stripes.
+	static const size_t xxh3_secret_consume_rate = 8ul;
+	/// Size of the default secret.
+	static const size_t xxh3_secret_size = 192ul;
+	/// Smallest secret the short input paths read from.
+	static const size_t xxh3_secret_size_min = 136ul;
+	/// Secret offset used to merge the accumulators.
+	static const size_t xxh3_secret_merge_start = 11ul;
+	/// Secret offset used for the last stripe.
+	static const size_t xxh3_secret_last_start = 7ul;
+	/// Longest input hashed without accumulators.
+	static const size_t xxh3_mid_size_max = 240ul;
+	/// Stripes accumulated before scrambling.
+	static const size_t xxh3_stripes_per_block
+	    = (xxh3_secret_size - xxh3_stripe_length) / xxh3_secret_consume_rate;
+	/// Bytes accumulated before scrambling.
+	static const size_t xxh3_block_length = xxh3_stripe_length
+	                                        * xxh3_stripes_per_block;
+
+	/// Default secret, from the XXH3 specification.
+	static const byte_t xxh3_default_secret[xxh3_secret_size] = {
+		0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c,
+		0xf7, 0x21, 0xad, 0x1c, 0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb,
+		0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f, 0xcb, 0x79, 0xe6, 0x4e,
+		0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+		0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6,
+		0x81, 0x3a, 0x26, 0x4c, 0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb,
+		0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3, 0x71, 0x64, 0x48, 0x97,
+		0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+		0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7,
+		0xc7, 0x0b, 0x4f, 0x1d, 0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31,
+		0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64, 0xea, 0xc5, 0xac, 0x83,
+		0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+		0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26,
+		0x29, 0xd4, 0x68, 0x9e, 0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc,
+		0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce, 0x45, 0xcb, 0x3a, 0x8f,
+		0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+	};
+
+
+
+	static inline uint64_t xxh3_read64(const byte_t *address) noexcept {
+		return load_little_endian<uint64_t>(address);
+	}
+	static inline uint32_t xxh3_read32(const byte_t *address) noexcept {
+		return load_little_endian<uint32_t>(address);
+	}
+
+	static inline uint64_t xxh3_fold64(uint64_t left, uint64_t right) noexcept {
+		uint64_t high;
+		uint64_t low = multiply_extended(left, right, high);
+
+		return low ^ high;
+	}
+
+	static inline uint64_t xxh3_avalanche(uint64_t value) noexcept {
+		value ^= value >> 37;
+		value *= 0x165667919e3779f9ul;
+
+		return value ^ value >> 32;
+	}
+	static inline uint64_t xxh64_avalanche(uint64_t value) noexcept {
+		value ^= value >> 33;
+		value *= xxh3_prime64_2;
+		value ^= value >> 29;
+		value *= xxh3_prime64_3;
+
+		return value ^ value >> 32;
+	}
+	static inline uint64_t xxh3_strong_avalanche(uint64_t value,
+	                                             uint64_t length) noexcept {
+		value ^= rotate_left(value, 49) ^ rotate_left(value, 24);
+		value *= 0x9fb21c651e98df25ul;
+		value ^= (value >> 35) + length;
+		value *= 0x9fb21c651e98df25ul;
+
+		return value ^ value >> 28;
+	}
+
+	static inline uint64_t xxh3_mix16(const byte_t *input, const byte_t *secret,
+	                                  uint64_t seed) noexcept {
+		return xxh3_fold64(xxh3_read64(input) ^ (xxh3_read64(secret) + seed),
+		                   xxh3_read64(input + 8)
+		                       ^ (xxh3_read64(secret + 8) - seed));
+	}
+	static inline void_t xxh3_mix32(uint64_t &low, uint64_t &high,
+	                                const byte_t *first, const byte_t *second,
+	                                const byte_t *secret,
+	                                uint64_t seed) noexcept {
+		low += xxh3_mix16(first, secret, seed);
+		low ^= xxh3_read64(second) + xxh3_read64(second + 8);
+		high += xxh3_mix16(second, secret + 16, seed);
+		high ^= xxh3_read64(first) + xxh3_read64(first + 8);
+	}
+
+
+	/**
+	 * Copy bytes between buffers that never overlap.
+	 * @param [in] source Bytes to copy.
+	 * @param [out] destination Where to copy the bytes.
+	 * @param [in] length Number of bytes to copy.
+	 */
+	static inline void_t xxh3_copy(const byte_t *source, byte_t *destination,
+	                               size_t length) noexcept {
+		for (size_t i = 0ul; i < length; i++)
+			destination[i] = source[i];
+	}
+
+	/**
+	 * Derive a secret from the default one and a seed.
+	 * @param [in] seed Seed to derive from.
+	 * @param [out] secret Where to write the derived secret.
+	 */
+	static void_t xxh3_derive_secret(uint64_t seed, byte_t *secret) noexcept {
+		for (size_t i = 0ul; i < xxh3_secret_size; i += 16ul) {
+			store_little_endian(secret + i,
+			                    xxh3_read64(xxh3_default_secret + i) + seed);
+			store_little_endian(secret + i + 8ul,
+			                    xxh3_read64(xxh3_default_secret + i + 8ul)
+			                        - seed);
+		}
+	}
+
+
+
+	/**
+	 * Accumulate consecutive stripes.
+	 * @param [in,out] accumulators The 8 accumulators.
+	 * @param [in] input First stripe.
+	 * @param [in] secret Secret of the first stripe, advanced 8 bytes on
+	 * every stripe.
+	 * @param [in] stripes Number of stripes.
+	 */
+	typedef void_t (*xxh3_accumulate_function)(uint64_t *accumulators,
+	                                           const byte_t *input,
+	                                           const byte_t *secret,
+	                                           size_t stripes);
+	/**
+	 * Scramble the accumulators at the end of a block.
+	 * @param [in,out] accumulators The 8 accumulators.
+	 * @param [in] secret Secret of the scramble.
+	 */
+	typedef void_t (*xxh3_scramble_function)(uint64_t *accumulators,
+	                                         const byte_t *secret);
+
+
+#	if not stick_IS_ARCH_x86_64
+	static void_t xxh3_accumulate_scalar(uint64_t *accumulators,
+	                                     const byte_t *input,
+	                                     const byte_t *secret,
+	                                     size_t stripes) noexcept {
+		for (size_t s = 0ul; s < stripes; s++) {
+			const byte_t *stripe = input + s * xxh3_stripe_length;
+			const byte_t *key = secret + s * xxh3_secret_consume_rate;
+
+			for (size_t i = 0ul; i < 8ul; i++) {
+				uint64_t data = xxh3_read64(stripe + i * 8ul);
+				uint64_t keyed = data ^ xxh3_read64(key + i * 8ul);
+
+				accumulators[i ^ 1ul] += data;
+				accumulators[i] += (keyed & 0xfffffffful) * (keyed >> 32);
+			}
+		}
+	}
+	static void_t xxh3_scramble_scalar(uint64_t *accumulators,
+	                                   const byte_t *secret) noexcept {
+		for (size_t i = 0ul; i < 8ul; i++) {
+			uint64_t value = accumulators[i] ^ accumulators[i] >> 47;
+			value ^= xxh3_read64(secret + i * 8ul);
+			accumulators[i] = value * xxh3_prime32_1;
+		}
+	}
+#	endif
+
+#	if stick_IS_ARCH_x86_64
+	static void_t xxh3_accumulate_sse2(uint64_t *accumulators,
+	                                   const byte_t *input,
+	                                   const byte_t *secret,
+	                                   size_t stripes) noexcept {
+		auto lanes = reinterpret_cast<__m128i *>(accumulators);
+		__m128i accumulator[4];
+		for (size_t i = 0ul; i < 4ul; i++)
+			accumulator[i] = _mm_loadu_si128(lanes + i);
+
+		for (size_t s = 0ul; s < stripes; s++) {
+			auto data = reinterpret_cast<const __m128i *>(
+			    input + s * xxh3_stripe_length);
+			auto key = reinterpret_cast<const __m128i *>(
+			    secret + s * xxh3_secret_consume_rate);
+
+			for (size_t i = 0ul; i < 4ul; i++) {
+				__m128i data_vector = _mm_loadu_si128(data + i);
+				__m128i keyed = _mm_xor_si128(data_vector,
+				                              _mm_loadu_si128(key + i));
+				__m128i product = _mm_mul_epu32(
+				    keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+				__m128i swapped = _mm_shuffle_epi32(data_vector,
+				                                    _MM_SHUFFLE(1, 0, 3, 2));
+
+				accumulator[i] = _mm_add_epi64(
+				    accumulator[i], _mm_add_epi64(product, swapped));
+			}
+		}
+
+		for (size_t i = 0ul; i < 4ul; i++)
+			_mm_storeu_si128(lanes + i, accumulator[i]);
+	}
+	static void_t xxh3_scramble_sse2(uint64_t *accumulators,
+	                                 const byte_t *secret) noexcept {
+		auto lanes = reinterpret_cast<__m128i *>(accumulators);
+		auto key = reinterpret_cast<const __m128i *>(secret);
+		const __m128i prime = _mm_set1_epi32(
+		    static_cast<int32_t>(xxh3_prime32_1));
+
+		for (size_t i = 0ul; i < 4ul; i++) {
+			__m128i value = _mm_loadu_si128(lanes + i);
+			value = _mm_xor_si128(value, _mm_srli_epi64(value, 47));
+			value = _mm_xor_si128(value, _mm_loadu_si128(key + i));
+
+			__m128i high = _mm_shuffle_epi32(value, _MM_SHUFFLE(0, 3, 0, 1));
+			__m128i low_product = _mm_mul_epu32(value, prime);
+			__m128i high_product = _mm_mul_epu32(high, prime);
+
+			_mm_storeu_si128(lanes + i,
+			                 _mm_add_epi64(low_product,
+			                               _mm_slli_epi64(high_product, 32)));
+		}
+	}
+#	endif
+
+#	if stick_XXH3_AVX2
+	__attribute__((target("avx2"))) static void_t
+	xxh3_accumulate_avx2(uint64_t *accumulators, const byte_t *input,
+	                     const byte_t *secret, size_t stripes) noexcept {
+		auto lanes = reinterpret_cast<__m256i *>(accumulators);
+		__m256i first = _mm256_loadu_si256(lanes);
+		__m256i second = _mm256_loadu_si256(lanes + 1);
+
+		for (size_t s = 0ul; s < stripes; s++) {
+			auto data = reinterpret_cast<const __m256i *>(
+			    input + s * xxh3_stripe_length);
+			auto key = reinterpret_cast<const __m256i *>(
+			    secret + s * xxh3_secret_consume_rate);
+
+			__m256i data_first = _mm256_loadu_si256(data);
+			__m256i data_second = _mm256_loadu_si256(data + 1);
+			__m256i keyed_first = _mm256_xor_si256(data_first,
+			                                       _mm256_loadu_si256(key));
+			__m256i keyed_second = _mm256_xor_si256(
+			    data_second, _mm256_loadu_si256(key + 1));
+
+			first = _mm256_add_epi64(
+			    first,
+			    _mm256_add_epi64(
+			        _mm256_mul_epu32(keyed_first,
+			                         _mm256_srli_epi64(keyed_first, 32)),
+			        _mm256_shuffle_epi32(data_first, _MM_SHUFFLE(1, 0, 3, 2))));
+			second = _mm256_add_epi64(
+			    second,
+			    _mm256_add_epi64(
+			        _mm256_mul_epu32(keyed_second,
+			                         _mm256_srli_epi64(keyed_second, 32)),
+			        _mm256_shuffle_epi32(data_second,
+			                             _MM_SHUFFLE(1, 0, 3, 2))));
+		}
+
+		_mm256_storeu_si256(lanes, first);
+		_mm256_storeu_si256(lanes + 1, second);
+	}
+	__attribute__((target("avx2"))) static void_t
+	xxh3_scramble_avx2(uint64_t *accumulators, const byte_t *secret) noexcept {
+		auto lanes = reinterpret_cast<__m256i *>(accumulators);
+		auto key = reinterpret_cast<const __m256i *>(secret);
+		const __m256i prime = _mm256_set1_epi32(
+		    static_cast<int32_t>(xxh3_prime32_1));
+
+		for (size_t i = 0ul; i < 2ul; i++) {
+			__m256i value = _mm256_loadu_si256(lanes + i);
+			value = _mm256_xor_si256(value, _mm256_srli_epi64(value, 47));
+			value = _mm256_xor_si256(value, _mm256_loadu_si256(key + i));
+
+			__m256i low_product = _mm256_mul_epu32(value, prime);
+			__m256i high_product = _mm256_mul_epu32(
+			    _mm256_srli_epi64(value, 32), prime);
+
+			_mm256_storeu_si256(
+			    lanes + i,
+			    _mm256_add_epi64(low_product,
+			                     _mm256_slli_epi64(high_product, 32)));
+		}
+	}
+#	endif
+
+
+	/**
+	 * Vector kernels used for long inputs.
+	 */
+	struct xxh3_kernels {
+		xxh3_accumulate_function accumulate;   ///< Stripes accumulation.
+		xxh3_scramble_function scramble;   ///< Block end scramble.
+	};
+
+	/**
+	 * Pick the widest kernels the running CPU supports. Checked only once.
+	 * @return Kernels to use.
+	 */
+	static const xxh3_kernels &xxh3_select_kernels() noexcept {
+		static const xxh3_kernels kernels =
+#	if stick_XXH3_AVX2
+		    __builtin_cpu_supports("avx2")
+		        ? xxh3_kernels { xxh3_accumulate_avx2, xxh3_scramble_avx2 }
+		        : xxh3_kernels { xxh3_accumulate_sse2, xxh3_scramble_sse2 };
+#	elif stick_IS_ARCH_x86_64
+		    xxh3_kernels { xxh3_accumulate_sse2, xxh3_scramble_sse2 };
+#	else
+		    xxh3_kernels { xxh3_accumulate_scalar, xxh3_scramble_scalar };
+#	endif
+
+		return kernels;
+	}
+
+
+	/**
+	 * Initial value of the accumulators.
+	 * @param [out] accumulators The 8 accumulators.
+	 */
+	static inline void_t
+	xxh3_init_accumulators(uint64_t *accumulators) noexcept {
+		accumulators[0] = xxh3_prime32_3;
+		accumulators[1] = xxh3_prime64_1;
+		accumulators[2] = xxh3_prime64_2;
+		accumulators[3] = xxh3_prime64_3;
+		accumulators[4] = xxh3_prime64_4;
+		accumulators[5] = xxh3_prime32_2;
+		accumulators[6] = xxh3_prime64_5;
+		accumulators[7] = xxh3_prime32_1;
+	}
+
+	static uint64_t xxh3_merge_accumulators(const uint64_t *accumulators,
+	                                        const byte_t *secret,
+	                                        uint64_t result) noexcept {
+		for (size_t i = 0ul; i < 4ul; i++)
+			result += xxh3_fold64(
+			    accumulators[i * 2ul] ^ xxh3_read64(secret + i * 16ul),
+			    accumulators[i * 2ul + 1ul]
+			        ^ xxh3_read64(secret + i * 16ul + 8ul));
+
+		return xxh3_avalanche(result);
+	}
+
+	/**
+	 * Accumulate a whole input longer than 240 bytes.
+	 * @param [out] accumulators The 8 accumulators.
+	 * @param [in] input Data to hash.
+	 * @param [in] length Number of bytes to hash.
+	 * @param [in] secret Secret of the hash.
+	 */
+	static void_t xxh3_accumulate_long(uint64_t *accumulators,
+	                                   const byte_t *input, size_t length,
+	                                   const byte_t *secret) noexcept {
+		const xxh3_kernels &kernels = xxh3_select_kernels();
+		xxh3_init_accumulators(accumulators);
+
+		size_t blocks = (length - 1ul) / xxh3_block_length;
+		for (size_t i = 0ul; i < blocks; i++) {
+			kernels.accumulate(accumulators, input + i * xxh3_block_length,
+			                   secret, xxh3_stripes_per_block);
+			kernels.scramble(accumulators,
+			                 secret + xxh3_secret_size - xxh3_stripe_length);
+		}
+
+		size_t stripes = (length - 1ul - blocks * xxh3_block_length)
+		                 / xxh3_stripe_length;
+		kernels.accumulate(accumulators, input + blocks * xxh3_block_length,
+		                   secret, stripes);
+		kernels.accumulate(accumulators, input + length - xxh3_stripe_length,
+		                   secret + xxh3_secret_size - xxh3_stripe_length
+		                       - xxh3_secret_last_start,
+		                   1ul);
+	}
+
+
+
+	static uint64_t xxh3_64_short(const byte_t *input, size_t length,
+	                              uint64_t seed,
+	                              const byte_t *secret) noexcept {
+		if (8ul < length) {
+			uint64_t flip_low = (xxh3_read64(secret + 24)
+			                     ^ xxh3_read64(secret + 32))
+			                    + seed;
+			uint64_t flip_high = (xxh3_read64(secret + 40)
+			                      ^ xxh3_read64(secret + 48))
+			                     - seed;
+			uint64_t low = xxh3_read64(input) ^ flip_low;
+			uint64_t high = xxh3_read64(input + length - 8ul) ^ flip_high;
+
+			return xxh3_avalanche(length + byte_swap(low) + high
+			                      + xxh3_fold64(low, high));
+		}
+
+		if (4ul <= length) {
+			seed ^= static_cast<uint64_t>(
+			            byte_swap(static_cast<uint32_t>(seed)))
+			        << 32;
+			uint64_t flip = (xxh3_read64(secret + 8) ^ xxh3_read64(secret + 16))
+			                - seed;
+			uint64_t value = xxh3_read32(input + length - 4ul)
+			                 + (static_cast<uint64_t>(xxh3_read32(input))
+			                    << 32);
+
+			return xxh3_strong_avalanche(value ^ flip, length);
+		}
+
+		if (0ul < length) {
+			uint32_t combined = static_cast<uint32_t>(input[0]) << 16
+			                    | static_cast<uint32_t>(input[length >> 1])
+			                          << 24
+			                    | static_cast<uint32_t>(input[length - 1ul])
+			                    | static_cast<uint32_t>(length) << 8;
+			uint64_t flip = (xxh3_read32(secret) ^ xxh3_read32(secret + 4))
+			                + seed;
+
+			return xxh64_avalanche(combined ^ flip);
+		}
+
+		return xxh64_avalanche(seed ^ xxh3_read64(secret + 56)
+		                       ^ xxh3_read64(secret + 64));
+	}
+
+	static uint64_t xxh3_64_medium(const byte_t *input, size_t length,
+	                               uint64_t seed,
+	                               const byte_t *secret) noexcept {
+		uint64_t result = length * xxh3_prime64_1;
+
+		if (32ul < length) {
+			if (64ul < length) {
+				if (96ul < length) {
+					result += xxh3_mix16(input + 48, secret + 96, seed);
+					result += xxh3_mix16(input + length - 64ul, secret + 112,
+					                     seed);
+				}
+				result += xxh3_mix16(input + 32, secret + 64, seed);
+				result += xxh3_mix16(input + length - 48ul, secret + 80, seed);
+			}
+			result += xxh3_mix16(input + 16, secret + 32, seed);
+			result += xxh3_mix16(input + length - 32ul, secret + 48, seed);
+		}
+		result += xxh3_mix16(input, secret, seed);
+		result += xxh3_mix16(input + length - 16ul, secret + 16, seed);
+
+		return xxh3_avalanche(result);
+	}
+
+	static uint64_t xxh3_64_large(const byte_t *input, size_t length,
+	                              uint64_t seed,
+	                              const byte_t *secret) noexcept {
+		uint64_t result = length * xxh3_prime64_1;
+		size_t rounds = length / 16ul;
+
+		for (size_t i = 0ul; i < 8ul; i++)
+			result += xxh3_mix16(input + 16ul * i, secret + 16ul * i, seed);
+		result = xxh3_avalanche(result);
+
+		for (size_t i = 8ul; i < rounds; i++)
+			result += xxh3_mix16(input + 16ul * i,
+			                     secret + 16ul * (i - 8ul) + 3ul, seed);
+		result += xxh3_mix16(input + length - 16ul,
+		                     secret + xxh3_secret_size_min - 17ul, seed);
+
+		return xxh3_avalanche(result);
+	}
+
+
+	static uint128_t
+	xxh3_128_short(const byte_t *input, size_t length, uint64_t seed,
+	               const byte_t *secret) noexcept {
+		if (8ul < length) {
+			uint64_t flip_low = (xxh3_read64(secret + 32)
+			                     ^ xxh3_read64(secret + 40))
+			                    - seed;
+			uint64_t flip_high = (xxh3_read64(secret + 48)
+			                      ^ xxh3_read64(secret + 56))
+			                     + seed;
+			uint64_t input_low = xxh3_read64(input);
+			uint64_t input_high = xxh3_read64(input + length - 8ul);
+
+			uint64_t high;
+			uint64_t low = multiply_extended(input_low ^ input_high ^ flip_low,
+			                                 xxh3_prime64_1, high);
+			low += (length - 1ul) << 54;
+			input_high ^= flip_high;
+			high += input_high
+			        + static_cast<uint64_t>(static_cast<uint32_t>(input_high))
+			              * (xxh3_prime32_2 - 1u);
+			low ^= byte_swap(high);
+
+			uint64_t result_high;
+			uint64_t result_low = multiply_extended(low, xxh3_prime64_2,
+			                                        result_high);
+			result_high += high * xxh3_prime64_2;
+
+			return { xxh3_avalanche(result_low), xxh3_avalanche(result_high) };
+		}
+
+		if (4ul <= length) {
+			seed ^= static_cast<uint64_t>(
+			            byte_swap(static_cast<uint32_t>(seed)))
+			        << 32;
+			uint64_t value = xxh3_read32(input)
+			                 + (static_cast<uint64_t>(
+			                        xxh3_read32(input + length - 4ul))
+			                    << 32);
+			uint64_t flip = (xxh3_read64(secret + 16)
+			                 ^ xxh3_read64(secret + 24))
+			                + seed;
+
+			uint64_t high;
+			uint64_t low = multiply_extended(
+			    value ^ flip, xxh3_prime64_1 + (length << 2), high);
+			high += low << 1;
+			low ^= high >> 3;
+			low = (low ^ low >> 35) * 0x9fb21c651e98df25ul;
+			low ^= low >> 28;
+
+			return { low, xxh3_avalanche(high) };
+		}
+
+		if (0ul < length) {
+			uint32_t low = static_cast<uint32_t>(input[0]) << 16
+			               | static_cast<uint32_t>(input[length >> 1]) << 24
+			               | static_cast<uint32_t>(input[length - 1ul])
+			               | static_cast<uint32_t>(length) << 8;
+			uint32_t high = rotate_left(byte_swap(low), 13);
+			uint64_t flip_low = (static_cast<uint64_t>(xxh3_read32(secret))
+			                     ^ xxh3_read32(secret + 4))
+			                    + seed;
+			uint64_t flip_high = (static_cast<uint64_t>(xxh3_read32(secret + 8))
+			                      ^ xxh3_read32(secret + 12))
+			                     - seed;
+
+			return { xxh64_avalanche(low ^ flip_low),
+				     xxh64_avalanche(high ^ flip_high) };
+		}
+
+		return { xxh64_avalanche(seed ^ xxh3_read64(secret + 64)
+		                         ^ xxh3_read64(secret + 72)),
+			     xxh64_avalanche(seed ^ xxh3_read64(secret + 80)
+			                     ^ xxh3_read64(secret + 88)) };
+	}
+
+	static uint128_t
+	xxh3_128_mix_result(uint64_t low, uint64_t high, size_t length,
+	                    uint64_t seed) noexcept {
+		uint64_t result_high = low * xxh3_prime64_1 + high * xxh3_prime64_4
+		                       + (length - seed) * xxh3_prime64_2;
+
+		return { xxh3_avalanche(low + high),
+			     0ul - xxh3_avalanche(result_high) };
+	}
+
+	static uint128_t
+	xxh3_128_medium(const byte_t *input, size_t length, uint64_t seed,
+	                const byte_t *secret) noexcept {
+		uint64_t low = length * xxh3_prime64_1, high = 0ul;
+
+		if (32ul < length) {
+			if (64ul < length) {
+				if (96ul < length)
+					xxh3_mix32(low, high, input + 48, input + length - 64ul,
+					           secret + 96, seed);
+				xxh3_mix32(low, high, input + 32, input + length - 48ul,
+				           secret + 64, seed);
+			}
+			xxh3_mix32(low, high, input + 16, input + length - 32ul,
+			           secret + 32, seed);
+		}
+		xxh3_mix32(low, high, input, input + length - 16ul, secret, seed);
+
+		return xxh3_128_mix_result(low, high, length, seed);
+	}
+
+	static uint128_t
+	xxh3_128_large(const byte_t *input, size_t length, uint64_t seed,
+	               const byte_t *secret) noexcept {
+		uint64_t low = length * xxh3_prime64_1, high = 0ul;
+		size_t rounds = length / 32ul;
+
+		for (size_t i = 0ul; i < 4ul; i++)
+			xxh3_mix32(low, high, input + 32ul * i, input + 32ul * i + 16ul,
+			           secret + 32ul * i, seed);
+		low = xxh3_avalanche(low);
+		high = xxh3_avalanche(high);
+
+		for (size_t i = 4ul; i < rounds; i++)
+			xxh3_mix32(low, high, input + 32ul * i, input + 32ul * i + 16ul,
+			           secret + 3ul + 32ul * (i - 4ul), seed);
+		xxh3_mix32(low, high, input + length - 16ul, input + length - 32ul,
+		           secret + xxh3_secret_size_min - 17ul - 16ul, 0ul - seed);
+
+		return xxh3_128_mix_result(low, high, length, seed);
+	}
+
+
+	/**
+	 * Finish a long hash from its accumulators.
+	 * @param [in] accumulators The 8 accumulators.
+	 * @param [in] secret Secret of the hash.
+	 * @param [in] length Number of bytes hashed.
+	 * @return The 128 bits hash.
+	 */
+	static uint128_t
+	xxh3_128_merge(const uint64_t *accumulators, const byte_t *secret,
+	               uint64_t length) noexcept {
+		return { xxh3_merge_accumulators(accumulators,
+		                                 secret + xxh3_secret_merge_start,
+		                                 length * xxh3_prime64_1),
+			     xxh3_merge_accumulators(accumulators,
+			                             secret + xxh3_secret_size
+			                                 - xxh3_stripe_length
+			                                 - xxh3_secret_merge_start,
+			                             ~(length * xxh3_prime64_2)) };
+	}
+
+
+
+	uint64_t xxh3_64(const void_t *bytes, size_t length,
+	                 uint64_t seed) noexcept {
+		auto input = static_cast<const byte_t *>(bytes);
+
+		if (length <= 16ul)
+			return xxh3_64_short(input, length, seed, xxh3_default_secret);
+		if (length <= 128ul)
+			return xxh3_64_medium(input, length, seed, xxh3_default_secret);
+		if (length <= xxh3_mid_size_max)
+			return xxh3_64_large(input, length, seed, xxh3_default_secret);
+
+		byte_t derived_secret[xxh3_secret_size];
+		const byte_t *secret = xxh3_default_secret;
+		if (seed != 0ul) {
+			xxh3_derive_secret(seed, derived_secret);
+			secret = derived_secret;
+		}
+
+		uint64_t accumulators[8];
+		xxh3_accumulate_long(accumulators, input, length, secret);
+
+		return xxh3_merge_accumulators(accumulators,
+		                               secret + xxh3_secret_merge_start,
+		                               length * xxh3_prime64_1);
+	}
+
+	uint128_t xxh3_128(const void_t *bytes, size_t length,
+	                   uint64_t seed) noexcept {
+		auto input = static_cast<const byte_t *>(bytes);
+
+		if (length <= 16ul)
+			return xxh3_128_short(input, length, seed, xxh3_default_secret);
+		if (length <= 128ul)
+			return xxh3_128_medium(input, length, seed, xxh3_default_secret);
+		if (length <= xxh3_mid_size_max)
+			return xxh3_128_large(input, length, seed, xxh3_default_secret);
+
+		byte_t derived_secret[xxh3_secret_size];
+		const byte_t *secret = xxh3_default_secret;
+		if (seed != 0ul) {
+			xxh3_derive_secret(seed, derived_secret);
+			secret = derived_secret;
+		}
+
+		uint64_t accumulators[8];
+		xxh3_accumulate_long(accumulators, input, length, secret);
+
+		return xxh3_128_merge(accumulators, secret, length);
+	}
+
+	void_t xxh3_64_batch(const void_t *const *keys, const size_t *lengths,
+	                     uint64_t *hashes, size_t amount,
+	                     uint64_t seed) noexcept {
+		// Short keys are hashed inline, so the keys do not wait for each
+		// other behind a call and their multiplies overlap in the pipeline.
+		for (size_t i = 0ul; i < amount; i++) {
+			auto input = static_cast<const byte_t *>(keys[i]);
+
+			hashes[i] = lengths[i] <= 16ul
+			                ? xxh3_64_short(input, lengths[i], seed,
+			                                xxh3_default_secret)
+			                : xxh3_64(input, lengths[i], seed);
+		}
+	}
+
+
+
+	/**
+	 * Accumulate stripes of a stream, scrambling when a block is completed.
+	 * @param [in,out] accumulators The 8 accumulators.
+	 * @param [in] input First stripe.
+	 * @param [in] stripes Number of stripes to accumulate.
+	 * @param [in] accumulated Stripes already accumulated in the block.
+	 * @param [in] secret Secret of the hash.
+	 * @return Stripes accumulated in the block afterwards.
+	 */
+	static size_t xxh3_consume_stripes(uint64_t *accumulators,
+	                                   const byte_t *input, size_t stripes,
+	                                   size_t accumulated,
+	                                   const byte_t *secret) noexcept {
+		const xxh3_kernels &kernels = xxh3_select_kernels();
+
+		if (xxh3_stripes_per_block - accumulated <= stripes) {
+			size_t to_end = xxh3_stripes_per_block - accumulated;
+
+			kernels.accumulate(accumulators, input,
+			                   secret + accumulated * xxh3_secret_consume_rate,
+			                   to_end);
+			kernels.scramble(accumulators,
+			                 secret + xxh3_secret_size - xxh3_stripe_length);
+			kernels.accumulate(accumulators,
+			                   input + to_end * xxh3_stripe_length, secret,
+			                   stripes - to_end);
+
+			return stripes - to_end;
+		}
+
+		kernels.accumulate(accumulators, input,
+		                   secret + accumulated * xxh3_secret_consume_rate,
+		                   stripes);
+
+		return accumulated + stripes;
+	}
+
+
+	void_t hash_xxh3::process(const byte_t *bytes, size_t length) noexcept {
+		const size_t buffer_stripes = sizeof(this->buffer) / xxh3_stripe_length;
+
+		this->total_length += length;
+
+		if (length <= sizeof(this->buffer) - this->buffered) {
+			xxh3_copy(bytes, this->buffer + this->buffered, length);
+			this->buffered += length;
+
+			return;
+		}
+
+		if (this->buffered != 0ul) {
+			size_t fill = sizeof(this->buffer) - this->buffered;
+			xxh3_copy(bytes, this->buffer + this->buffered, fill);
+			bytes += fill;
+			length -= fill;
+
+			this->stripes = xxh3_consume_stripes(this->accumulators,
+			                                     this->buffer, buffer_stripes,
+			                                     this->stripes, this->secret);
+			this->buffered = 0ul;
+		}
+
+		// The last input bytes always stay in the buffer for the digest.
+		if (sizeof(this->buffer) < length) {
+			do {
+				this->stripes = xxh3_consume_stripes(this->accumulators, bytes,
+				                                     buffer_stripes,
+				                                     this->stripes,
+				                                     this->secret);
+				bytes += sizeof(this->buffer);
+				length -= sizeof(this->buffer);
+			} while (sizeof(this->buffer) < length);
+
+			// Keep the last stripe in case the digest needs to look back.
+			xxh3_copy(bytes - xxh3_stripe_length,
+			          this->buffer + sizeof(this->buffer) - xxh3_stripe_length,
+			          xxh3_stripe_length);
+		}
+
+		xxh3_copy(bytes, this->buffer, length);
+		this->buffered = length;
+	}
+
+	void_t hash_xxh3::restart() noexcept {
+		xxh3_init_accumulators(this->accumulators);
+		this->buffered = 0ul;
+		this->stripes = 0ul;
+		this->total_length = 0ul;
+	}
+
+	void_t hash_xxh3::digest_long(uint64_t *last_accumulators) const noexcept {
+		for (size_t i = 0ul; i < 8ul; i++)
+			last_accumulators[i] = this->accumulators[i];
+
+		const byte_t *last_secret = this->secret + xxh3_secret_size
+		                            - xxh3_stripe_length
+		                            - xxh3_secret_last_start;
+
+		if (xxh3_stripe_length <= this->buffered) {
+			xxh3_consume_stripes(last_accumulators, this->buffer,
+			                     (this->buffered - 1ul) / xxh3_stripe_length,
+			                     this->stripes, this->secret);
+			xxh3_select_kernels().accumulate(
+			    last_accumulators,
+			    this->buffer + this->buffered - xxh3_stripe_length, last_secret,
+			    1ul);
+		} else {
+			// Complete the stripe with the end of the previous buffer.
+			byte_t last_stripe[xxh3_stripe_length];
+			size_t catch_up = xxh3_stripe_length - this->buffered;
+
+			xxh3_copy(this->buffer + sizeof(this->buffer) - catch_up,
+			          last_stripe, catch_up);
+			xxh3_copy(this->buffer, last_stripe + catch_up, this->buffered);
+			xxh3_select_kernels().accumulate(last_accumulators, last_stripe,
+			                                 last_secret, 1ul);
+		}
+	}
+
+	uint1024_t hash_xxh3::calculate_hash() const noexcept {
+		if (this->size() == hash_size::_128bit)
+			return uint1024_t(this->finalize_128());
+
+		if (this->total_length <= xxh3_mid_size_max)
+			return xxh3_64(this->buffer, this->buffered, this->seed);
+
+		uint64_t last_accumulators[8];
+		this->digest_long(last_accumulators);
+
+		return xxh3_merge_accumulators(last_accumulators,
+		                               this->secret + xxh3_secret_merge_start,
+		                               this->total_length * xxh3_prime64_1);
+	}
+
+
+	hash_xxh3::hash_xxh3(hash_size length, uint64_t seed) noexcept
+	    : base_hash(length <= hash_size::_64bit ? hash_size::_64bit
+	                                            : hash_size::_128bit),
+	      seed(seed) {
+		if (seed == 0ul)
+			xxh3_copy(xxh3_default_secret, this->secret, xxh3_secret_size);
+		else
+			xxh3_derive_secret(seed, this->secret);
+
+		this->restart();
+	}
+	hash_xxh3::hash_xxh3(const string_view &data, hash_size length,
+	                     uint64_t seed) noexcept
+	    : hash_xxh3(length, seed) {
+		this->update(data);
+	}
+
+
+	uint128_t hash_xxh3::finalize_128() const noexcept {
+		if (this->total_length <= xxh3_mid_size_max)
+			return xxh3_128(this->buffer, this->buffered, this->seed);
+
+		uint64_t last_accumulators[8];
+		this->digest_long(last_accumulators);
+
+		return xxh3_128_merge(last_accumulators, this->secret,
+		                      this->total_length);
+	}
+
+
+	uint64_t hash_xxh3::hash(const void_t *bytes, size_t length,
+	                         uint64_t seed) noexcept {
+		return xxh3_64(bytes, length, seed);
+	}
+	void_t hash_xxh3::hash_batch(const void_t *const *keys,
+	                             const size_t *lengths, uint64_t *hashes,
+	                             size_t amount, uint64_t seed) noexcept {
+		xxh3_64_batch(keys, lengths, hashes, amount, seed);
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_crypto_hash_xxh3_
@@ -16,9 +16,13 @@ namespace stick {
 
 
 	base_error::base_error(const_cstring description) noexcept
-	    : description_cache(new string(description)) { }
+	    : description_cache(new string(description)) {
+		this->description_cache->share();
+	}
 	base_error::base_error(const string &description) noexcept
-	    : description_cache(new string(description)) { }
+	    : description_cache(new string(description)) {
+		this->description_cache->share();
+	}
 
 	base_error::~base_error() noexcept {
 		delete this->description_cache;
@@ -30,7 +34,7 @@ namespace stick {
 		return *this->description_cache;
 	}
 	const_cstring base_error::what() const noexcept {
-		return this->description();
+		return *this->description_cache;
 	}
 
 
@@ -16,13 +16,12 @@ namespace stick {
 
 
 	cast_error::cast_error(const_cstring description) noexcept
-	    : base_error(description) { }
+	    : base_error(description) {
+		this->description_cache->preppend("Casting error. ");
+	}
 	cast_error::cast_error(const string &description) noexcept
-	    : base_error(description) { }
-
-
-	string cast_error::description() const noexcept {
-		return string("Casting error. ") + *this->description_cache;
+	    : base_error(description) {
+		this->description_cache->preppend("Casting error. ");
 	}
 
 
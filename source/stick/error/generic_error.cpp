@@ -21,11 +21,6 @@ namespace stick {
 	    : base_error(description) { }
 
 
-	string generic_error::description() const noexcept {
-		return *this->description_cache;
-	}
-
-
 }   // namespace stick
 
 
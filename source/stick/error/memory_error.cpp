@@ -16,13 +16,12 @@ namespace stick {
 
 
 	memory_error::memory_error(const_cstring description) noexcept
-	    : base_error(description) { }
+	    : base_error(description) {
+		this->description_cache->preppend("Memory management error. ");
+	}
 	memory_error::memory_error(const string &description) noexcept
-	    : base_error(description) { }
-
-
-	string memory_error::description() const noexcept {
-		return string("Memory management error. ") + *this->description_cache;
+	    : base_error(description) {
+		this->description_cache->preppend("Memory management error. ");
 	}
 
 
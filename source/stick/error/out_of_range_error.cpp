@@ -16,13 +16,12 @@ namespace stick {
 
 
 	out_of_range_error::out_of_range_error(const_cstring description) noexcept
-	    : base_error(description) { }
+	    : base_error(description) {
+		this->description_cache->preppend("Out-of-range error. ");
+	}
 	out_of_range_error::out_of_range_error(const string &description) noexcept
-	    : base_error(description) { }
-
-
-	string out_of_range_error::description() const noexcept {
-		return string("Out-of-range error. ") + *this->description_cache;
+	    : base_error(description) {
+		this->description_cache->preppend("Out-of-range error. ");
 	}
 
 
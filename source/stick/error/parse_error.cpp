@@ -0,0 +1,31 @@
+/**
+ * Parse error. Implementation.
+ * @brief Parse error implementation.
+ * @file parse_error.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../include/stick/error/parse_error.hpp"
+
+#if defined(_stick_lib_error_parse_)
+
+
+#	include "../../../include/stick/string/string.hpp"
+
+
+namespace stick {
+
+
+	parse_error::parse_error(const_cstring description) noexcept
+	    : base_error(description) {
+		this->description_cache->preppend("Parsing error. ");
+	}
+	parse_error::parse_error(const string &description) noexcept
+	    : base_error(description) {
+		this->description_cache->preppend("Parsing error. ");
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_error_parse_
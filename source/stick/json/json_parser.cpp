@@ -0,0 +1,777 @@
+/**
+ * Two stage JSON parser implementation.
+ * @brief JSON parser implementation.
+ * @file json_parser.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../include/stick/json/json_parser.hpp"
+
+#if defined(_stick_lib_json_parser_)
+
+
+#	include "../../../include/stick/defines/arch.hpp"
+#	include "../../../include/stick/error/memory_error.hpp"
+#	include "../../../include/stick/error/out_of_range_error.hpp"
+#	include "../../../include/stick/error/parse_error.hpp"
+#	include "../../../include/stick/memory/management.tpp"
+#	include "../../../include/stick/string/casting.hpp"
+#	include "../../../include/stick/string/cstring.hpp"
+#	include "../../../include/stick/templates/bit.tpp"
+
+#	if stick_IS_ARCH_x86_64
+#		include <emmintrin.h>
+#	endif
+
+
+namespace stick {
+
+
+	/// Document bytes per structural the index is first sized for, typical
+	/// documents have fewer structurals.
+	static const size_t json_bytes_per_structural = 8ul;
+	/// Most structurals a block of 64 bytes adds, plus the end one.
+	static const size_t json_block_structurals = 65ul;
+
+
+	/**
+	 * Character class bit masks of a 64 bytes block, one bit per byte.
+	 */
+	struct json_block_masks {
+		uint64_t backslash;   ///< '\\' characters.
+		uint64_t quote;   ///< '"' characters.
+		uint64_t operators;   ///< '{', '}', '[', ']', ':' and ',' characters.
+		uint64_t whitespace;   ///< ' ', '\\t', '\\n' and '\\r' characters.
+		uint64_t control;   ///< Characters below 0x20.
+	};
+
+
+	/**
+	 * Check if a character is JSON whitespace.
+	 * @param [in] c Character to check.
+	 * @return True if c is whitespace, false otherwise.
+	 */
+	static inline bool_t json_is_whitespace(char_t c) noexcept {
+		return c == ' ' or c == '\n' or c == '\r' or c == '\t';
+	}
+
+	/**
+	 * Classify the 64 bytes of a block.
+	 * @param [in] block Pointer to 64 readable bytes.
+	 * @param [out] masks Class bit masks of the block.
+	 */
+	static inline void_t json_classify_block(const byte_t *block,
+	                                         json_block_masks &masks) noexcept {
+#	if stick_IS_ARCH_x86_64
+		const __m128i backslash = _mm_set1_epi8('\\');
+		const __m128i quote = _mm_set1_epi8('"');
+		const __m128i lower_case = _mm_set1_epi8(0x20);
+		const __m128i open_brace = _mm_set1_epi8('{');
+		const __m128i close_brace = _mm_set1_epi8('}');
+		const __m128i colon = _mm_set1_epi8(':');
+		const __m128i comma = _mm_set1_epi8(',');
+		const __m128i space = _mm_set1_epi8(' ');
+		const __m128i tab = _mm_set1_epi8('\t');
+		const __m128i new_line = _mm_set1_epi8('\n');
+		const __m128i carriage_return = _mm_set1_epi8('\r');
+		const __m128i last_control = _mm_set1_epi8(0x1f);
+
+		masks = { 0ul, 0ul, 0ul, 0ul, 0ul };
+		for (size_t i = 0ul; i < 4ul; i++) {
+			__m128i chunk = _mm_loadu_si128(
+			    reinterpret_cast<const __m128i *>(block + i * 16ul));
+			// '[' and ']' only differ from '{' and '}' in the 0x20 bit.
+			__m128i folded = _mm_or_si128(chunk, lower_case);
+
+			__m128i operators = _mm_or_si128(
+			    _mm_or_si128(_mm_cmpeq_epi8(folded, open_brace),
+			                 _mm_cmpeq_epi8(folded, close_brace)),
+			    _mm_or_si128(_mm_cmpeq_epi8(chunk, colon),
+			                 _mm_cmpeq_epi8(chunk, comma)));
+			__m128i whitespace = _mm_or_si128(
+			    _mm_or_si128(_mm_cmpeq_epi8(chunk, space),
+			                 _mm_cmpeq_epi8(chunk, tab)),
+			    _mm_or_si128(_mm_cmpeq_epi8(chunk, new_line),
+			                 _mm_cmpeq_epi8(chunk, carriage_return)));
+
+			masks.backslash |= static_cast<uint64_t>(static_cast<uint16_t>(
+			                       _mm_movemask_epi8(
+			                           _mm_cmpeq_epi8(chunk, backslash))))
+			                   << i * 16ul;
+			masks.quote |= static_cast<uint64_t>(static_cast<uint16_t>(
+			                   _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quote))))
+			               << i * 16ul;
+			masks.operators |= static_cast<uint64_t>(static_cast<uint16_t>(
+			                       _mm_movemask_epi8(operators)))
+			                   << i * 16ul;
+			masks.whitespace |= static_cast<uint64_t>(static_cast<uint16_t>(
+			                        _mm_movemask_epi8(whitespace)))
+			                    << i * 16ul;
+			// Unsigned c <= 0x1f, as c is its minimum with 0x1f.
+			masks.control |= static_cast<uint64_t>(static_cast<uint16_t>(
+			                     _mm_movemask_epi8(_mm_cmpeq_epi8(
+			                         _mm_min_epu8(chunk, last_control),
+			                         chunk))))
+			                 << i * 16ul;
+		}
+
+#	else
+		masks = { 0ul, 0ul, 0ul, 0ul, 0ul };
+		for (size_t i = 0ul; i < 64ul; i++) {
+			uint64_t bit = 1ul << i;
+			if (block[i] < 0x20)
+				masks.control |= bit;
+
+			switch (block[i]) {
+			case '\\':
+				masks.backslash |= bit;
+				break;
+			case '"':
+				masks.quote |= bit;
+				break;
+			case '{':
+			case '}':
+			case '[':
+			case ']':
+			case ':':
+			case ',':
+				masks.operators |= bit;
+				break;
+			case ' ':
+			case '\t':
+			case '\n':
+			case '\r':
+				masks.whitespace |= bit;
+				break;
+			default:
+				break;
+			}
+		}
+#	endif
+	}
+
+	/**
+	 * Find the characters escaped by an odd sequence of backslashes.
+	 * @param [in] backslash Backslash mask of the block.
+	 * @param [in,out] previous_odd_end 1 if the previous block ended in an
+	 * odd sequence of backslashes. Updated for the next block.
+	 * @return Mask of the escaped characters.
+	 */
+	static inline uint64_t
+	json_find_escaped(uint64_t backslash, uint64_t &previous_odd_end) noexcept {
+		const uint64_t even_bits = 0x5555555555555555ul;
+		const uint64_t odd_bits = ~even_bits;
+
+		uint64_t start_edges = backslash & ~(backslash << 1);
+		uint64_t even_start_mask = even_bits ^ previous_odd_end;
+		uint64_t even_starts = start_edges & even_start_mask;
+		uint64_t odd_starts = start_edges & ~even_start_mask;
+
+		uint64_t even_carries = backslash + even_starts;
+		uint64_t odd_carries = backslash + odd_starts;
+		bool_t ends_odd = odd_carries < backslash;
+
+		odd_carries |= previous_odd_end;
+		previous_odd_end = ends_odd ? 1ul : 0ul;
+
+		uint64_t even_carry_ends = even_carries & ~backslash;
+		uint64_t odd_carry_ends = odd_carries & ~backslash;
+
+		return (even_carry_ends & odd_bits) | (odd_carry_ends & even_bits);
+	}
+
+	/**
+	 * Compute a mask where every bit is the xor of itself and all the lower
+	 * bits, which turns quote marks into "inside string" ranges.
+	 * @param [in] bits Mask to transform.
+	 * @return Prefix xor mask.
+	 */
+	static inline uint64_t json_prefix_xor(uint64_t bits) noexcept {
+		bits ^= bits << 1;
+		bits ^= bits << 2;
+		bits ^= bits << 4;
+		bits ^= bits << 8;
+		bits ^= bits << 16;
+		bits ^= bits << 32;
+
+		return bits;
+	}
+
+	/**
+	 * Parse the 4 hex digits of a \\u escape sequence.
+	 * @param [in] digits Pointer to the 4 digits.
+	 * @throw parse_error when a digit is not hexadecimal.
+	 * @return Parsed code unit.
+	 */
+	static uint32_t json_parse_hex4(const_cstring digits) {
+		uint32_t code = 0u;
+		for (size_t i = 0ul; i < 4ul; i++) {
+			char_t c = digits[i];
+			code <<= 4;
+
+			if ('0' <= c and c <= '9')
+				code |= static_cast<uint32_t>(c - '0');
+			else if ('a' <= c and c <= 'f')
+				code |= static_cast<uint32_t>(c - 'a' + 10);
+			else if ('A' <= c and c <= 'F')
+				code |= static_cast<uint32_t>(c - 'A' + 10);
+			else
+				throw parse_error("Invalid \\u escape sequence.");
+		}
+
+		return code;
+	}
+
+
+
+	json_value::json_value(const json_document *document,
+	                       size_t position) noexcept
+	    : document(document), position(position) { }
+
+	void_t json_value::require(json_type expected) const {
+		if (this->type() != expected)
+			throw parse_error("JSON value has not the requested type.");
+	}
+
+
+	json_type json_value::type() const {
+		switch (this->document->structural_char(this->position)) {
+		case '{':
+			return json_type::object;
+		case '[':
+			return json_type::array;
+		case '"':
+			return json_type::string;
+		case 't':
+		case 'f':
+			return json_type::boolean;
+		case 'n':
+			return json_type::null_value;
+		case '-':
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			return json_type::number;
+		default:
+			throw parse_error("Unexpected character where a JSON value was "
+			                  "expected.");
+		}
+	}
+
+	bool_t json_value::is_null() const {
+		if (this->type() != json_type::null_value)
+			return false;
+
+		if (this->raw() != string_view("null", 4ul))
+			throw parse_error("Invalid JSON literal.");
+
+		return true;
+	}
+
+
+	bool_t json_value::get_bool() const {
+		this->require(json_type::boolean);
+
+		string_view literal = this->raw();
+		if (literal == string_view("true", 4ul))
+			return true;
+		else if (literal == string_view("false", 5ul))
+			return false;
+		else
+			throw parse_error("Invalid JSON literal.");
+	}
+	int64_t json_value::get_int64() const {
+		this->require(json_type::number);
+
+		string_view number = this->raw();
+
+		return str_cast_to_int64(number.data(), number.length());
+	}
+	uint64_t json_value::get_uint64() const {
+		this->require(json_type::number);
+
+		string_view number = this->raw();
+
+		return str_cast_to_uint64(number.data(), number.length());
+	}
+	double64_t json_value::get_double() const {
+		this->require(json_type::number);
+
+		string_view number = this->raw();
+
+		return str_cast_to_double64(number.data(), number.length());
+	}
+	string json_value::get_string() const {
+		this->require(json_type::string);
+
+		string_view content = this->raw();
+		const_cstring text = content.data();
+		size_t length = content.length();
+
+		string unescaped(length);
+		for (size_t i = 0ul, run_start = 0ul; i <= length; i++) {
+			if (i != length and text[i] != '\\')
+				continue;
+
+			if (run_start < i)
+				unescaped.append(text + run_start, i - run_start);
+			if (i == length)
+				break;
+
+			if (length <= ++i)
+				throw parse_error("Unterminated escape sequence.");
+
+			switch (text[i]) {
+			case '"':
+			case '\\':
+			case '/':
+				unescaped.append(text[i]);
+				break;
+			case 'b':
+				unescaped.append('\b');
+				break;
+			case 'f':
+				unescaped.append('\f');
+				break;
+			case 'n':
+				unescaped.append('\n');
+				break;
+			case 'r':
+				unescaped.append('\r');
+				break;
+			case 't':
+				unescaped.append('\t');
+				break;
+			case 'u': {
+				if (length < i + 5ul)
+					throw parse_error("Invalid \\u escape sequence.");
+
+				uint32_t code_point = json_parse_hex4(text + i + 1ul);
+				i += 4ul;
+
+				if (0xd800u <= code_point and code_point <= 0xdbffu) {
+					if (length < i + 7ul or text[i + 1ul] != '\\'
+					    or text[i + 2ul] != 'u')
+						throw parse_error("Unpaired UTF-16 surrogate.");
+
+					uint32_t low = json_parse_hex4(text + i + 3ul);
+					if (low < 0xdc00u or 0xdfffu < low)
+						throw parse_error("Unpaired UTF-16 surrogate.");
+
+					code_point = 0x10000u + ((code_point - 0xd800u) << 10)
+					             + (low - 0xdc00u);
+					i += 6ul;
+				} else if (0xdc00u <= code_point and code_point <= 0xdfffu)
+					throw parse_error("Unpaired UTF-16 surrogate.");
+
+				char_t utf8[4];
+				size_t utf8_length;
+				if (code_point < 0x80u) {
+					utf8[0] = static_cast<char_t>(code_point);
+					utf8_length = 1ul;
+				} else if (code_point < 0x800u) {
+					utf8[0] = static_cast<char_t>(0xc0u | code_point >> 6);
+					utf8[1] = static_cast<char_t>(0x80u | (code_point & 0x3fu));
+					utf8_length = 2ul;
+				} else if (code_point < 0x10000u) {
+					utf8[0] = static_cast<char_t>(0xe0u | code_point >> 12);
+					utf8[1] = static_cast<char_t>(0x80u
+					                              | (code_point >> 6 & 0x3fu));
+					utf8[2] = static_cast<char_t>(0x80u | (code_point & 0x3fu));
+					utf8_length = 3ul;
+				} else {
+					utf8[0] = static_cast<char_t>(0xf0u | code_point >> 18);
+					utf8[1] = static_cast<char_t>(0x80u
+					                              | (code_point >> 12 & 0x3fu));
+					utf8[2] = static_cast<char_t>(0x80u
+					                              | (code_point >> 6 & 0x3fu));
+					utf8[3] = static_cast<char_t>(0x80u | (code_point & 0x3fu));
+					utf8_length = 4ul;
+				}
+				unescaped.append(utf8, utf8_length);
+				break;
+			}
+			default:
+				throw parse_error("Invalid escape sequence.");
+			}
+
+			run_start = i + 1ul;
+		}
+
+		return unescaped;
+	}
+
+
+	string_view json_value::raw() const {
+		switch (this->type()) {
+		case json_type::array:
+		case json_type::object: {
+			size_t start = this->document->structurals[this->position];
+			size_t end = this->document->structurals
+			                 [this->document->tape[this->position]];
+
+			return { this->document->source + start, end - start + 1ul };
+		}
+		default:
+			return this->document->token(this->position);
+		}
+	}
+
+
+	size_t json_value::size() const {
+		size_t children = 0ul;
+		for (auto child = this->begin(), last = this->end(); child != last;
+		     ++child)
+			children++;
+
+		return children;
+	}
+
+	bool_t json_value::contains(const string_view &key) const {
+		this->require(json_type::object);
+
+		for (auto member = this->begin(), last = this->end(); member != last;
+		     ++member)
+			if (member.key_equals(key))
+				return true;
+
+		return false;
+	}
+
+
+	json_iterator json_value::begin() const {
+		json_type value_type = this->type();
+		if (value_type != json_type::array and value_type != json_type::object)
+			throw parse_error("Only JSON arrays and objects can be iterated.");
+
+		return { this->document, this->position + 1ul,
+			     value_type == json_type::object };
+	}
+	json_iterator json_value::end() const {
+		json_type value_type = this->type();
+		if (value_type != json_type::array and value_type != json_type::object)
+			throw parse_error("Only JSON arrays and objects can be iterated.");
+
+		return { this->document, this->document->tape[this->position],
+			     value_type == json_type::object };
+	}
+
+
+	json_value json_value::operator[](const string_view &key) const {
+		this->require(json_type::object);
+
+		for (auto member = this->begin(), last = this->end(); member != last;
+		     ++member)
+			if (member.key_equals(key))
+				return *member;
+
+		throw out_of_range_error("JSON object has no such key.");
+	}
+	json_value json_value::operator[](const_cstring key) const {
+		return this->operator[](string_view(key));
+	}
+	json_value json_value::operator[](size_t position) const {
+		this->require(json_type::array);
+
+		auto element = this->begin(), last = this->end();
+		for (; element != last and position != 0ul; ++element)
+			position--;
+
+		if (element == last)
+			throw out_of_range_error("Accessing a JSON array out of range.");
+
+		return *element;
+	}
+	json_value json_value::operator[](int32_t position) const {
+		return this->operator[](static_cast<size_t>(position));
+	}
+
+
+
+	json_iterator::json_iterator(const json_document *document,
+	                             size_t position, bool_t in_object) noexcept
+	    : document(document), position(position), in_object(in_object) { }
+
+
+	string_view json_iterator::key() const {
+		if (not this->in_object)
+			throw parse_error("JSON array elements have no key.");
+
+		if (this->document->structural_char(this->position) != '"')
+			throw parse_error("JSON object keys must be strings.");
+
+		return this->document->token(this->position);
+	}
+
+	bool_t json_iterator::key_equals(const string_view &key) const {
+		string_view raw = this->key();
+
+		for (char_t c : raw)
+			if (c == '\\')
+				return string_view(
+				           json_value(this->document, this->position)
+				               .get_string())
+				       == key;
+
+		return raw == key;
+	}
+
+	json_value json_iterator::operator*() const {
+		if (not this->in_object)
+			return { this->document, this->position };
+
+		if (this->document->structural_char(this->position + 1ul) != ':')
+			throw parse_error("Expected ':' after JSON object key.");
+
+		return { this->document, this->position + 2ul };
+	}
+
+	json_iterator &json_iterator::operator++() {
+		size_t value_position = this->position;
+		if (this->in_object) {
+			if (this->document->structural_char(this->position + 1ul) != ':')
+				throw parse_error("Expected ':' after JSON object key.");
+
+			value_position += 2ul;
+		}
+
+		size_t next = this->document->skip_value(value_position);
+		switch (this->document->structural_char(next)) {
+		case ',':
+			switch (this->document->structural_char(next + 1ul)) {
+			case '}':
+			case ']':
+				throw parse_error("Trailing ',' in JSON container.");
+			default:
+				this->position = next + 1ul;
+			}
+			break;
+		case '}':
+		case ']':
+			this->position = next;
+			break;
+		default:
+			throw parse_error("Expected ',' between JSON values.");
+		}
+
+		return *this;
+	}
+
+	bool_t json_iterator::operator==(const json_iterator &iterator) const
+	    noexcept {
+		return this->position == iterator.position
+		       and this->document == iterator.document;
+	}
+	bool_t json_iterator::operator!=(const json_iterator &iterator) const
+	    noexcept {
+		return not this->operator==(iterator);
+	}
+
+
+
+	char_t json_document::structural_char(size_t position) const noexcept {
+		if (this->structurals_amount <= position)
+			return str_end;
+
+		return this->source[this->structurals[position]];
+	}
+
+	size_t json_document::skip_value(size_t position) const noexcept {
+		return this->tape[position] + 1ul;
+	}
+
+	string_view json_document::token(size_t position) const {
+		size_t start = this->structurals[position];
+		// Only whitespace can lay between a token and the next structural.
+		size_t end = this->structurals[position + 1ul];
+		while (start + 1ul < end
+		       and json_is_whitespace(this->source[end - 1ul]))
+			end--;
+
+		if (this->source[start] != '"')
+			return { this->source + start, end - start };
+
+		if (end - start < 2ul or this->source[end - 1ul] != '"')
+			throw parse_error("Unterminated JSON string.");
+
+		return { this->source + start + 1ul, end - start - 2ul };
+	}
+
+
+	json_value json_document::root() const noexcept {
+		return { this, 0ul };
+	}
+
+	size_t json_document::structurals_size() const noexcept {
+		return this->structurals_amount;
+	}
+
+
+
+	size_t json_parser::index_structurals(const_cstring json, size_t length,
+	                                      uint32_t *&structurals) {
+		auto text = reinterpret_cast<const byte_t *>(json);
+
+		size_t capacity = length / json_bytes_per_structural
+		                  + json_block_structurals;
+		structurals = this->memory.allocate<uint32_t>(capacity);
+
+		uint64_t previous_odd_end = 0ul;
+		uint64_t previous_in_string = 0ul;
+		// The document start behaves as a separator for the first token.
+		uint64_t previous_separator = 1ul;
+
+		byte_t last_block[64];
+		size_t amount = 0ul;
+
+		for (size_t base = 0ul; base < length; base += 64ul) {
+			const byte_t *block = text + base;
+			if (length - base < 64ul) {
+				for (size_t i = 0ul; i < 64ul; i++)
+					last_block[i] = base + i < length ? text[base + i] : ' ';
+				block = last_block;
+			}
+
+			if (capacity < amount + json_block_structurals) {
+				// The old index stays in the arena until the next parse.
+				auto grown = this->memory.allocate<uint32_t>(capacity * 2ul);
+				copy(structurals, grown, amount);
+				structurals = grown;
+				capacity *= 2ul;
+			}
+
+			json_block_masks masks;
+			json_classify_block(block, masks);
+
+			uint64_t escaped = json_find_escaped(masks.backslash,
+			                                     previous_odd_end);
+			uint64_t quotes = masks.quote & ~escaped;
+			uint64_t in_string = json_prefix_xor(quotes) ^ previous_in_string;
+			previous_in_string = static_cast<uint64_t>(
+			    static_cast<int64_t>(in_string) >> 63);
+
+			// RFC 8259 wants control characters in strings escaped.
+			if ((masks.control & in_string) != 0ul)
+				throw parse_error("Unescaped control character in a JSON "
+				                  "string.");
+
+			uint64_t block_structurals = (masks.operators & ~in_string)
+			                             | quotes;
+
+			// Scalars start right after a structural or a whitespace.
+			uint64_t separators = block_structurals | masks.whitespace;
+			uint64_t after_separator = separators << 1 | previous_separator;
+			previous_separator = separators >> 63;
+
+			block_structurals |= after_separator & ~masks.whitespace
+			                     & ~in_string;
+			// Closing quotes are not needed, the string ends before the next
+			// structural.
+			block_structurals &= ~(quotes & ~in_string);
+
+			for (; block_structurals != 0ul;
+			     block_structurals &= block_structurals - 1ul)
+				structurals[amount++] = static_cast<uint32_t>(
+				    base + count_trailing_zeros(block_structurals));
+		}
+
+		if (previous_in_string != 0ul)
+			throw parse_error("Unterminated JSON string.");
+
+		structurals[amount] = static_cast<uint32_t>(length);
+
+		return amount;
+	}
+
+	void_t json_parser::build_tape(const_cstring json,
+	                               const uint32_t *structurals, size_t amount,
+	                               uint32_t *tape, uint32_t *stack) {
+		size_t depth = 0ul;
+
+		for (size_t i = 0ul; i < amount; i++) {
+			char_t c = json[structurals[i]];
+			tape[i] = static_cast<uint32_t>(i);
+
+			switch (c) {
+			case '{':
+			case '[':
+				// Every open bracket needs a closing one after it, more than
+				// half of the structurals open cannot balance, nor fit the
+				// stack.
+				if (amount < 2ul * (depth + 1ul))
+					throw parse_error("Unbalanced JSON brackets.");
+
+				stack[depth++] = static_cast<uint32_t>(i);
+				break;
+			case '}':
+			case ']': {
+				// Closing brackets are 2 characters after the opening ones.
+				if (depth == 0ul
+				    or json[structurals[stack[depth - 1ul]]] + 2 != c)
+					throw parse_error("Unbalanced JSON brackets.");
+
+				tape[stack[--depth]] = static_cast<uint32_t>(i);
+				break;
+			}
+			default:
+				break;
+			}
+		}
+
+		if (depth != 0ul)
+			throw parse_error("Unbalanced JSON brackets.");
+	}
+
+
+	json_parser::json_parser(size_t capacity) noexcept
+	    : memory(capacity * 2ul + 4096ul) { }
+
+
+	json_document json_parser::parse(const_cstring json, size_t length) {
+		if (json == nullptr)
+			throw memory_error("Parsing a nullptr JSON document.");
+
+		if (length == 0ul)
+			throw parse_error("Empty JSON document.");
+
+		if (stick_uint32_MAX <= length)
+			throw parse_error("JSON documents over 4 GiB cannot be indexed.");
+
+		this->memory.reset();
+
+		uint32_t *structurals;
+		size_t amount = this->index_structurals(json, length, structurals);
+		if (amount == 0ul)
+			throw parse_error("Empty JSON document.");
+
+		auto tape = this->memory.allocate<uint32_t>(amount);
+		build_tape(json, structurals, amount, tape,
+		           this->memory.allocate<uint32_t>(amount / 2ul + 1ul));
+
+		json_document document;
+		document.source = json;
+		document.source_length = length;
+		document.structurals = structurals;
+		document.tape = tape;
+		document.structurals_amount = amount;
+
+		if (document.skip_value(0ul) != amount)
+			throw parse_error("Unexpected content after the JSON root value.");
+
+		return document;
+	}
+	json_document json_parser::parse(const string_view &json) {
+		return this->parse(json.data(), json.length());
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_json_parser_
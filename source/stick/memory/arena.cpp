@@ -0,0 +1,133 @@
+/**
+ * Arena (bump) allocator implementation.
+ * @brief Arena allocator implementation.
+ * @file arena.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../include/stick/memory/arena.hpp"
+
+#if defined(_stick_lib_memory_arena_)
+
+
+#	include "../../../include/stick/error/memory_error.hpp"
+#	include "../../../include/stick/memory/management.tpp"
+
+
+namespace stick {
+
+
+	/// Bytes reserved for the block header, keeps block data 16-aligned.
+	static const size_t arena_header_size = 32ul;
+
+
+	byte_t *arena::block_data(block *memory_block) noexcept {
+		return reinterpret_cast<byte_t *>(memory_block) + arena_header_size;
+	}
+
+	void_t arena::add_block(size_t minimum_capacity) {
+		static_assert(sizeof(block) <= arena_header_size,
+		              "Arena block header does not fit its reserved space.");
+
+		size_t capacity = minimum_capacity < this->block_size
+		                      ? this->block_size
+		                      : minimum_capacity;
+
+		auto memory_block = reinterpret_cast<block *>(
+		    stick::allocate<byte_t>(arena_header_size + capacity));
+		memory_block->previous = this->current;
+		memory_block->capacity = capacity;
+		memory_block->used = 0ul;
+
+		this->current = memory_block;
+	}
+
+
+	arena::arena(size_t block_length) noexcept : block_size(block_length) { }
+	arena::arena(arena &&memory) noexcept
+	    : current(memory.current), block_size(memory.block_size) {
+		memory.current = nullptr;
+	}
+
+	arena::~arena() noexcept {
+		this->release();
+	}
+
+
+	voidptr_t arena::allocate_bytes(size_t bytes, size_t alignment) {
+		if (alignment == 0ul or (alignment & (alignment - 1ul)) != 0ul)
+			throw memory_error("Arena alignment must be a power of two.");
+
+		for (;;) {
+			if (this->current != nullptr) {
+				size_t address = reinterpret_cast<size_t>(
+				    block_data(this->current) + this->current->used);
+				size_t padding = (alignment - (address & (alignment - 1ul)))
+				                 & (alignment - 1ul);
+
+				if (this->current->used + padding + bytes
+				    <= this->current->capacity) {
+					this->current->used += padding + bytes;
+
+					return reinterpret_cast<voidptr_t>(address + padding);
+				}
+			}
+
+			this->add_block(bytes + alignment);
+		}
+	}
+
+
+	void_t arena::reset() {
+		if (this->current == nullptr)
+			return;
+
+		if (this->current->previous != nullptr) {
+			// Merge everything in a single block big enough for all of it.
+			size_t capacity = this->reserved_bytes();
+			this->release();
+			this->add_block(capacity);
+		}
+
+		this->current->used = 0ul;
+	}
+	void_t arena::release() noexcept {
+		while (this->current != nullptr) {
+			block *previous = this->current->previous;
+
+			auto memory = reinterpret_cast<byte_t *>(this->current);
+			deallocate(memory);
+
+			this->current = previous;
+		}
+	}
+
+
+	size_t arena::used_bytes() const noexcept {
+		return this->current == nullptr ? 0ul : this->current->used;
+	}
+	size_t arena::reserved_bytes() const noexcept {
+		size_t reserved = 0ul;
+		for (block *b = this->current; b != nullptr; b = b->previous)
+			reserved += b->capacity;
+
+		return reserved;
+	}
+
+
+	arena &arena::operator=(arena &&memory) noexcept {
+		if (&memory == this)
+			return *this;
+
+		this->release();
+		this->current = memory.current;
+		this->block_size = memory.block_size;
+		memory.current = nullptr;
+
+		return *this;
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_memory_arena_
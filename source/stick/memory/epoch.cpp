@@ -0,0 +1,228 @@
+/**
+ * Epoch based memory reclamation implementation.
+ * @brief Epoch based memory reclamation implementation.
+ * @file epoch.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../include/stick/memory/epoch.hpp"
+
+#if defined(_stick_lib_memory_epoch_)
+
+
+#	include "../../../include/stick/memory/management.tpp"
+#	include "../../../include/stick/thread/atomic.tpp"
+
+
+namespace stick {
+
+
+	/// Retires between two collections of a thread.
+	static const size_t epoch_collect_threshold = 64ul;
+
+
+	/**
+	 * Object waiting for the readers that could reach it.
+	 */
+	struct epoch_retired {
+		voidptr_t object;   ///< Retired object.
+		epoch_deleter deleter;   ///< Function releasing the object.
+		uint64_t epoch;   ///< Global epoch when it was retired.
+	};
+
+	/**
+	 * Per thread state. Records are never freed, a thread leaving hands its
+	 * record, and what it retired, to the next thread needing one.
+	 */
+	struct epoch_record {
+		/// Announced epoch shifted left with the low bit set while inside a
+		/// guard, 0 outside.
+		atomic<uint64_t> local;
+		size_t nesting;   ///< Guards alive in the thread.
+		atomic<bool_t> in_use;   ///< Whether a thread owns the record.
+		epoch_record *next;   ///< Next record of the list.
+
+		epoch_retired *retired;   ///< Objects waiting to be released.
+		size_t retired_count;   ///< Number of waiting objects.
+		size_t retired_capacity;   ///< Room of the retired array.
+		size_t retires;   ///< Retires since the last collection.
+
+		/// Keeps the announced epochs of two records in different cache
+		/// lines.
+		byte_t padding[64];
+	};
+
+
+	/// Epoch every reader announces, only ever grows.
+	static atomic<uint64_t> epoch_global;
+	/// First record of the list, records are only ever pushed.
+	static atomic<epoch_record *> epoch_records;
+
+
+	/**
+	 * Take a free record or push a new one.
+	 * @return Record owned by the calling thread.
+	 */
+	static epoch_record *epoch_acquire_record() {
+		for (epoch_record *record = epoch_records.load(memory_order::acquire);
+		     record != nullptr; record = record->next) {
+			bool_t expected = false;
+			if (not record->in_use.load(memory_order::relaxed)
+			    and record->in_use.compare_exchange_strong(
+			        expected, true, memory_order::acquire,
+			        memory_order::relaxed))
+				return record;
+		}
+
+		auto record = new epoch_record();
+		record->in_use.store(true, memory_order::relaxed);
+
+		record->next = epoch_records.load(memory_order::relaxed);
+		while (not epoch_records.compare_exchange_weak(
+		    record->next, record, memory_order::release,
+		    memory_order::relaxed)) { }
+
+		return record;
+	}
+
+	/**
+	 * Release the record of a thread when the thread ends.
+	 */
+	struct epoch_thread {
+		epoch_record *record = nullptr;   ///< Record owned by the thread.
+
+		/**
+		 * Hand the record over to other threads.
+		 */
+		~epoch_thread() noexcept {
+			if (this->record != nullptr)
+				this->record->in_use.store(false, memory_order::release);
+		}
+	};
+
+	/// Record of the calling thread.
+	static thread_local epoch_thread epoch_this_thread;
+
+	/**
+	 * Get the record of the calling thread, taking one the first time.
+	 * @return Record owned by the calling thread.
+	 */
+	static inline epoch_record *epoch_local_record() {
+		if (epoch_this_thread.record == nullptr)
+			epoch_this_thread.record = epoch_acquire_record();
+
+		return epoch_this_thread.record;
+	}
+
+
+	/**
+	 * Move the global epoch forward if every thread inside a guard has
+	 * already announced the current one.
+	 */
+	static void_t epoch_try_advance() noexcept {
+		uint64_t global = epoch_global.load(memory_order::seq_cst);
+
+		for (epoch_record *record = epoch_records.load(memory_order::acquire);
+		     record != nullptr; record = record->next) {
+			uint64_t local = record->local.load(memory_order::seq_cst);
+			if ((local & 1ul) != 0ul and local >> 1 != global)
+				return;
+		}
+
+		epoch_global.compare_exchange_strong(global, global + 1ul,
+		                                     memory_order::seq_cst,
+		                                     memory_order::relaxed);
+	}
+
+	/**
+	 * Release the objects of a record retired two epochs ago or more. No
+	 * reader can be inside a guard entered before their retirement.
+	 * @param [in,out] record Record owned by the calling thread.
+	 */
+	static void_t epoch_release(epoch_record *record) noexcept {
+		uint64_t global = epoch_global.load(memory_order::acquire);
+
+		size_t kept = 0ul;
+		for (size_t i = 0ul; i < record->retired_count; i++) {
+			epoch_retired &retired = record->retired[i];
+			if (retired.epoch + 2ul <= global)
+				retired.deleter(retired.object);
+			else
+				record->retired[kept++] = retired;
+		}
+
+		record->retired_count = kept;
+		record->retires = 0ul;
+	}
+
+
+	epoch_guard::epoch_guard() {
+		epoch_record *record = epoch_local_record();
+		if (record->nesting++ != 0ul)
+			return;
+
+		uint64_t global = epoch_global.load(memory_order::relaxed);
+		record->local.store(global << 1 | 1ul, memory_order::relaxed);
+		// Later loads of shared pointers must not move before the announce.
+		atomic_fence(memory_order::seq_cst);
+	}
+
+	epoch_guard::~epoch_guard() noexcept {
+		epoch_record *record = epoch_this_thread.record;
+		if (--record->nesting == 0ul)
+			record->local.store(0ul, memory_order::release);
+	}
+
+
+	void_t epoch_retire(voidptr_t object, epoch_deleter deleter) {
+		epoch_record *record = epoch_local_record();
+
+		if (record->retired_count == record->retired_capacity) {
+			size_t capacity = record->retired_capacity == 0ul
+			                      ? epoch_collect_threshold
+			                      : record->retired_capacity << 1;
+			auto retired = allocate<epoch_retired>(capacity);
+			if (record->retired != nullptr) {
+				copy(record->retired, retired, record->retired_count);
+				deallocate(record->retired);
+			}
+
+			record->retired = retired;
+			record->retired_capacity = capacity;
+		}
+
+		record->retired[record->retired_count++] = {
+			object, deleter, epoch_global.load(memory_order::seq_cst)
+		};
+
+		if (++record->retires == epoch_collect_threshold) {
+			epoch_try_advance();
+			epoch_release(record);
+		}
+	}
+
+	void_t epoch_collect() {
+		epoch_record *record = epoch_local_record();
+
+		epoch_try_advance();
+		epoch_release(record);
+
+		// Records of ended threads keep their retired objects until taken
+		// again, release them meanwhile.
+		for (epoch_record *other = epoch_records.load(memory_order::acquire);
+		     other != nullptr; other = other->next) {
+			bool_t expected = false;
+			if (not other->in_use.load(memory_order::relaxed)
+			    and other->in_use.compare_exchange_strong(
+			        expected, true, memory_order::acquire,
+			        memory_order::relaxed)) {
+				epoch_release(other);
+				other->in_use.store(false, memory_order::release);
+			}
+		}
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_memory_epoch_
@@ -0,0 +1,347 @@
+/**
+ * Hazard pointer memory reclamation implementation.
+ * @brief Hazard pointer memory reclamation implementation.
+ * @file hazard.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../include/stick/memory/hazard.hpp"
+
+#if defined(_stick_lib_memory_hazard_)
+
+
+#	include "../../../include/stick/memory/management.tpp"
+
+
+namespace stick {
+
+
+	/// Retires between two scans of a thread, at least.
+	static const size_t hazard_collect_threshold = 64ul;
+	/// Free slots a thread keeps for its next hazard pointers.
+	static const size_t hazard_cached_slots = 8ul;
+
+
+	/**
+	 * Announce of a reader. Slots are never freed, a released one is taken
+	 * again by the next hazard pointer needing one.
+	 */
+	struct hazard_slot {
+		atomic<voidptr_t> object;   ///< Announced object, nullptr if none.
+		atomic<bool_t> in_use;   ///< Whether a hazard pointer owns the slot.
+		hazard_slot *next;   ///< Next slot of the list.
+
+		/// Keeps the announces of two slots in different cache lines.
+		byte_t padding[64];
+	};
+
+	/**
+	 * Object waiting for no reader to announce it.
+	 */
+	struct hazard_retired {
+		voidptr_t object;   ///< Retired object.
+		hazard_deleter deleter;   ///< Function releasing the object.
+	};
+
+	/**
+	 * Objects an ended thread could not release yet, adopted by the next
+	 * thread scanning.
+	 */
+	struct hazard_orphans {
+		hazard_retired *retired;   ///< Objects waiting to be released.
+		size_t count;   ///< Number of waiting objects.
+		hazard_orphans *next;   ///< Next batch of the list.
+	};
+
+
+	/// First slot of the list, slots are only ever pushed.
+	static atomic<hazard_slot *> hazard_slots;
+	/// Number of slots of the list.
+	static atomic<size_t> hazard_slot_count;
+	/// Batches left by ended threads.
+	static atomic<hazard_orphans *> hazard_orphan_list;
+
+
+	/**
+	 * Per thread state.
+	 */
+	struct hazard_thread {
+		/// Released slots kept for the next hazard pointers of the thread.
+		hazard_slot *cached[hazard_cached_slots];
+		size_t cached_count = 0ul;   ///< Number of kept slots.
+
+		hazard_retired *retired = nullptr;   ///< Objects waiting.
+		size_t retired_count = 0ul;   ///< Number of waiting objects.
+		size_t retired_capacity = 0ul;   ///< Room of the retired array.
+
+		/// Open addressing set of the announces seen by the last scan.
+		voidptr_t *announces = nullptr;
+		size_t announces_capacity = 0ul;   ///< Room of the set.
+
+		/**
+		 * Give the kept slots back and leave what could not be released to
+		 * the next thread scanning.
+		 */
+		~hazard_thread() noexcept;
+	};
+
+	/// State of the calling thread.
+	static thread_local hazard_thread hazard_this_thread;
+
+
+	/**
+	 * Take a free slot or push a new one.
+	 * @return Slot owned by the caller.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	static hazard_slot *hazard_acquire_slot() {
+		for (hazard_slot *slot = hazard_slots.load(memory_order::acquire);
+		     slot != nullptr; slot = slot->next) {
+			bool_t expected = false;
+			if (not slot->in_use.load(memory_order::relaxed)
+			    and slot->in_use.compare_exchange_strong(
+			        expected, true, memory_order::acquire,
+			        memory_order::relaxed))
+				return slot;
+		}
+
+		auto slot = new hazard_slot();
+		slot->in_use.store(true, memory_order::relaxed);
+
+		slot->next = hazard_slots.load(memory_order::relaxed);
+		while (not hazard_slots.compare_exchange_weak(
+		    slot->next, slot, memory_order::release,
+		    memory_order::relaxed)) { }
+		hazard_slot_count.fetch_add(1ul, memory_order::relaxed);
+
+		return slot;
+	}
+
+
+	/**
+	 * Make room in the retired array of a thread.
+	 * @param [in,out] thread State of the calling thread.
+	 * @param [in] wanted Objects that must fit.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	static void_t hazard_reserve(hazard_thread &thread, size_t wanted) {
+		if (wanted <= thread.retired_capacity)
+			return;
+
+		size_t capacity = thread.retired_capacity == 0ul
+		                      ? hazard_collect_threshold
+		                      : thread.retired_capacity;
+		while (capacity < wanted)
+			capacity <<= 1;
+
+		auto retired = allocate<hazard_retired>(capacity);
+		if (thread.retired != nullptr) {
+			copy(thread.retired, retired, thread.retired_count);
+			deallocate(thread.retired);
+		}
+
+		thread.retired = retired;
+		thread.retired_capacity = capacity;
+	}
+
+	/**
+	 * Take every batch left by ended threads.
+	 * @param [in,out] thread State of the calling thread.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	static void_t hazard_adopt(hazard_thread &thread) {
+		if (hazard_orphan_list.load(memory_order::relaxed) == nullptr)
+			return;
+
+		hazard_orphans *orphans
+		    = hazard_orphan_list.exchange(nullptr, memory_order::acquire);
+		while (orphans != nullptr) {
+			try {
+				hazard_reserve(thread, thread.retired_count + orphans->count);
+			} catch (...) {
+				// Leave the batches not adopted for another thread.
+				hazard_orphans *last = orphans;
+				while (last->next != nullptr)
+					last = last->next;
+				last->next = hazard_orphan_list.load(memory_order::relaxed);
+				while (not hazard_orphan_list.compare_exchange_weak(
+				    last->next, orphans, memory_order::release,
+				    memory_order::relaxed)) { }
+				throw;
+			}
+
+			copy(orphans->retired, thread.retired + thread.retired_count,
+			     orphans->count);
+			thread.retired_count += orphans->count;
+
+			hazard_orphans *next = orphans->next;
+			deallocate(orphans->retired);
+			delete orphans;
+			orphans = next;
+		}
+	}
+
+	/**
+	 * Get where a pointer starts looking in the announces set.
+	 * @param [in] object Announced pointer.
+	 * @return Unmasked position.
+	 */
+	static inline size_t hazard_hash(voidptr_t object) noexcept {
+		return static_cast<size_t>(
+		    (reinterpret_cast<uint64_t>(object) >> 4) * 0x9e3779b97f4a7c15ul
+		    >> 32);
+	}
+
+	/**
+	 * Gather every announce in the set of a thread.
+	 * @param [in,out] thread State of the calling thread.
+	 * @return Number of slots of the set minus one.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	static size_t hazard_gather(hazard_thread &thread) {
+		// Objects were unlinked before being retired, so a reader announcing
+		// one after this point fails to find it again.
+		atomic_fence(memory_order::seq_cst);
+
+		// Slots pushed later can only announce objects still linked.
+		hazard_slot *first = hazard_slots.load(memory_order::acquire);
+		size_t slots = 0ul;
+		for (hazard_slot *slot = first; slot != nullptr; slot = slot->next)
+			slots++;
+
+		size_t capacity = 16ul;
+		while (capacity < slots << 1)
+			capacity <<= 1;
+		if (capacity > thread.announces_capacity) {
+			auto announces = allocate_uninitialized<voidptr_t>(capacity);
+			if (thread.announces != nullptr)
+				deallocate_raw(thread.announces);
+			thread.announces = announces;
+			thread.announces_capacity = capacity;
+		}
+
+		size_t mask = thread.announces_capacity - 1ul;
+		set<voidptr_t>(thread.announces, nullptr, thread.announces_capacity);
+		for (hazard_slot *slot = first; slot != nullptr; slot = slot->next) {
+			voidptr_t object = slot->object.load(memory_order::seq_cst);
+			if (object == nullptr)
+				continue;
+
+			size_t i = hazard_hash(object);
+			while (thread.announces[i & mask] != nullptr
+			       and thread.announces[i & mask] != object)
+				i++;
+			thread.announces[i & mask] = object;
+		}
+
+		return mask;
+	}
+
+	/**
+	 * Release the retired objects of a thread nobody announces.
+	 * @param [in,out] thread State of the calling thread.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	static void_t hazard_scan(hazard_thread &thread) {
+		size_t mask = hazard_gather(thread);
+
+		size_t kept = 0ul;
+		for (size_t i = 0ul; i < thread.retired_count; i++) {
+			hazard_retired &retired = thread.retired[i];
+
+			size_t j = hazard_hash(retired.object);
+			while (thread.announces[j & mask] != nullptr
+			       and thread.announces[j & mask] != retired.object)
+				j++;
+
+			if (thread.announces[j & mask] == nullptr)
+				retired.deleter(retired.object);
+			else
+				thread.retired[kept++] = retired;
+		}
+
+		thread.retired_count = kept;
+	}
+
+
+	hazard_thread::~hazard_thread() noexcept {
+		for (size_t i = 0ul; i < this->cached_count; i++)
+			this->cached[i]->in_use.store(false, memory_order::release);
+
+		try {
+			if (this->retired_count != 0ul)
+				hazard_scan(*this);
+		} catch (...) { }
+		if (this->announces != nullptr)
+			deallocate_raw(this->announces);
+
+		if (this->retired_count == 0ul) {
+			if (this->retired != nullptr)
+				deallocate(this->retired);
+			return;
+		}
+
+		auto orphans =
+		    new hazard_orphans { this->retired, this->retired_count, nullptr };
+		orphans->next = hazard_orphan_list.load(memory_order::relaxed);
+		while (not hazard_orphan_list.compare_exchange_weak(
+		    orphans->next, orphans, memory_order::release,
+		    memory_order::relaxed)) { }
+	}
+
+
+	hazard_pointer::hazard_pointer() {
+		hazard_thread &thread = hazard_this_thread;
+
+		this->slot = thread.cached_count != 0ul
+		                 ? thread.cached[--thread.cached_count]
+		                 : hazard_acquire_slot();
+	}
+
+	hazard_pointer::~hazard_pointer() noexcept {
+		hazard_thread &thread = hazard_this_thread;
+
+		this->clear();
+		if (thread.cached_count < hazard_cached_slots)
+			thread.cached[thread.cached_count++] = this->slot;
+		else
+			this->slot->in_use.store(false, memory_order::release);
+	}
+
+
+	void_t hazard_pointer::reset(voidptr_t object) noexcept {
+		this->slot->object.store(object, memory_order::seq_cst);
+	}
+	void_t hazard_pointer::clear() noexcept {
+		this->slot->object.store(nullptr, memory_order::release);
+	}
+
+
+	void_t hazard_retire(voidptr_t object, hazard_deleter deleter) {
+		hazard_thread &thread = hazard_this_thread;
+
+		hazard_reserve(thread, thread.retired_count + 1ul);
+		thread.retired[thread.retired_count++] = { object, deleter };
+
+		// Scanning when there are twice as many objects as announces
+		// releases at least half of them, so each retire costs O(1).
+		size_t threshold = hazard_slot_count.load(memory_order::relaxed) << 1;
+		if (thread.retired_count
+		    >= (threshold < hazard_collect_threshold ? hazard_collect_threshold
+		                                             : threshold)) {
+			hazard_adopt(thread);
+			hazard_scan(thread);
+		}
+	}
+
+	void_t hazard_collect() {
+		hazard_thread &thread = hazard_this_thread;
+
+		hazard_adopt(thread);
+		hazard_scan(thread);
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_memory_hazard_
@@ -11,11 +11,1271 @@
 
 #	include "../../../include/stick/error/cast_error.hpp"
 #	include "../../../include/stick/string/cstring.hpp"
+#	include "../../../include/stick/templates/bit.tpp"
 
 
 namespace stick {
 
 
+	/**
+	 * Parse a plain decimal integer (optional sign and up to 19 digits) without
+	 * going through the floating point path.
+	 * @param [in] string String to be parsed.
+	 * @param [in] length Length of the string to be parsed.
+	 * @param [out] magnitude Absolute value of the parsed integer.
+	 * @param [out] is_negative If the integer had a minus sign.
+	 * @return True if the string is a plain integer, false otherwise.
+	 */
+	static bool_t parse_plain_integer(const_cstring string, size_t length,
+	                                  uint64_t &magnitude,
+	                                  bool_t &is_negative) noexcept {
+		size_t index = 0ul;
+		is_negative = length != 0ul and string[0ul] == '-';
+		if (is_negative)
+			index++;
+
+		size_t digits = length - index;
+		if (digits == 0ul or 19ul < digits
+		    or (string[index] == '0' and digits != 1ul))
+			return false;
+
+		magnitude = 0ul;
+		for (; index < length; index++) {
+			auto digit = static_cast<uchar_t>(string[index] - '0');
+			if (9u < digit)
+				return false;
+
+			magnitude = magnitude * 10ul + digit;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Parse a plain decimal integer that fits in int64_t.
+	 * @param [in] string String to be parsed.
+	 * @param [in] length Length of the string to be parsed.
+	 * @param [out] integer Parsed integer.
+	 * @return True if the string is a plain integer fitting int64_t, false
+	 * otherwise.
+	 */
+	static bool_t parse_signed_integer(const_cstring string, size_t length,
+	                                   int64_t &integer) noexcept {
+		uint64_t magnitude;
+		bool_t is_negative;
+		if (not parse_plain_integer(string, length, magnitude, is_negative))
+			return false;
+
+		if (magnitude > static_cast<uint64_t>(stick_int64_MAX) + is_negative)
+			return false;
+
+		integer = static_cast<int64_t>(is_negative ? 0ul - magnitude
+		                                           : magnitude);
+
+		return true;
+	}
+
+	/**
+	 * Parse a plain decimal integer that fits in uint64_t.
+	 * @param [in] string String to be parsed.
+	 * @param [in] length Length of the string to be parsed.
+	 * @param [out] integer Parsed integer.
+	 * @return True if the string is a plain positive integer, false
+	 * otherwise.
+	 */
+	static bool_t parse_unsigned_integer(const_cstring string, size_t length,
+	                                     uint64_t &integer) noexcept {
+		bool_t is_negative;
+
+		return parse_plain_integer(string, length, integer, is_negative)
+		       and not is_negative;
+	}
+
+	/**
+	 * Decimal number as written in a string, split into its parts.
+	 */
+	struct decimal_parts {
+		const_cstring integer;   ///< First digit of the integer part.
+		size_t integer_length;   ///< Digits of the integer part.
+		const_cstring fraction;   ///< First digit of the decimal part.
+		size_t fraction_length;   ///< Digits of the decimal part.
+		ssize_t exponent;   ///< Explicit exponent.
+		bool_t is_negative;   ///< If the number had a minus sign.
+	};
+
+	/// Explicit exponents saturate here, far past the range of any float.
+	static const ssize_t decimal_exponent_limit = 100000l;
+
+	/**
+	 * Split a decimal number into its parts, checking its syntax: an optional
+	 * minus sign, an integer part without leading zeros, an optional decimal
+	 * part and an optional exponent.
+	 * @param [in] string String to be parsed.
+	 * @param [in] length Length of the string to be parsed.
+	 * @return Parts of the number.
+	 * @throw cast_error when the string is not a number.
+	 */
+	static decimal_parts split_decimal(const_cstring string, size_t length) {
+		decimal_parts parts;
+		size_t index = 0ul;
+		parts.is_negative = length != 0ul and string[0ul] == '-';
+		if (parts.is_negative)
+			index++;
+
+		parts.integer = string + index;
+		if (index < length and string[index] == '0')
+			index++;
+		else if (index < length and char_is_numeric(string[index]))
+			do
+				index++;
+			while (index < length and char_is_numeric(string[index]));
+		else
+			throw cast_error("Given string is not a number. No integer part.");
+		parts.integer_length = static_cast<size_t>(string + index
+		                                           - parts.integer);
+
+		parts.fraction = string + index;
+		if (index < length and string[index] == '.') {
+			parts.fraction = string + ++index;
+
+			if (length <= index or not char_is_numeric(string[index]))
+				throw cast_error(
+				    "Given string is not a number. Expected decimal values.");
+
+			do
+				index++;
+			while (index < length and char_is_numeric(string[index]));
+		}
+		parts.fraction_length = static_cast<size_t>(string + index
+		                                            - parts.fraction);
+
+		parts.exponent = 0l;
+		if (index < length and (string[index] == 'E' or string[index] == 'e')) {
+			bool_t negative_exponent = false;
+			if (++index < length
+			    and (string[index] == '+' or string[index] == '-'))
+				negative_exponent = string[index++] == '-';
+
+			if (length <= index or not char_is_numeric(string[index]))
+				throw cast_error(
+				    "Given string is not a number. Invalid exponent.");
+
+			for (; index < length and char_is_numeric(string[index]); index++)
+				if (parts.exponent < decimal_exponent_limit)
+					parts.exponent = parts.exponent * 10l
+					                 + (string[index] - '0');
+
+			if (negative_exponent)
+				parts.exponent = -parts.exponent;
+		}
+
+		if (index != length)
+			throw cast_error("Given string is not a number. "
+			                 "Could not be parsed completely.");
+
+		return parts;
+	}
+
+
+	/// Powers of ten in the table of Eisel-Lemire.
+	static const ssize_t eisel_lemire_min_power = -348l;
+	static const ssize_t eisel_lemire_max_power = 347l;
+
+	/**
+	 * 128 bits approximations of the powers of ten, rounded down: their
+	 * first 128 bits, the most significant one set. High half first.
+	 */
+	static const uint64_t eisel_lemire_powers[][2] = {
+		{ 0xfa8fd5a0081c0288ul, 0x1732c869cd60e453ul },   // 1e-348
+		{ 0x9c99e58405118195ul, 0x0e7fbd42205c8eb4ul },   // 1e-347
+		{ 0xc3c05ee50655e1faul, 0x521fac92a873b261ul },   // 1e-346
+		{ 0xf4b0769e47eb5a78ul, 0xe6a797b752909ef9ul },   // 1e-345
+		{ 0x98ee4a22ecf3188bul, 0x9028bed2939a635cul },   // 1e-344
+		{ 0xbf29dcaba82fdeaeul, 0x7432ee873880fc33ul },   // 1e-343
+		{ 0xeef453d6923bd65aul, 0x113faa2906a13b3ful },   // 1e-342
+		{ 0x9558b4661b6565f8ul, 0x4ac7ca59a424c507ul },   // 1e-341
+		{ 0xbaaee17fa23ebf76ul, 0x5d79bcf00d2df649ul },   // 1e-340
+		{ 0xe95a99df8ace6f53ul, 0xf4d82c2c107973dcul },   // 1e-339
+		{ 0x91d8a02bb6c10594ul, 0x79071b9b8a4be869ul },   // 1e-338
+		{ 0xb64ec836a47146f9ul, 0x9748e2826cdee284ul },   // 1e-337
+		{ 0xe3e27a444d8d98b7ul, 0xfd1b1b2308169b25ul },   // 1e-336
+		{ 0x8e6d8c6ab0787f72ul, 0xfe30f0f5e50e20f7ul },   // 1e-335
+		{ 0xb208ef855c969f4ful, 0xbdbd2d335e51a935ul },   // 1e-334
+		{ 0xde8b2b66b3bc4723ul, 0xad2c788035e61382ul },   // 1e-333
+		{ 0x8b16fb203055ac76ul, 0x4c3bcb5021afcc31ul },   // 1e-332
+		{ 0xaddcb9e83c6b1793ul, 0xdf4abe242a1bbf3dul },   // 1e-331
+		{ 0xd953e8624b85dd78ul, 0xd71d6dad34a2af0dul },   // 1e-330
+		{ 0x87d4713d6f33aa6bul, 0x8672648c40e5ad68ul },   // 1e-329
+		{ 0xa9c98d8ccb009506ul, 0x680efdaf511f18c2ul },   // 1e-328
+		{ 0xd43bf0effdc0ba48ul, 0x0212bd1b2566def2ul },   // 1e-327
+		{ 0x84a57695fe98746dul, 0x014bb630f7604b57ul },   // 1e-326
+		{ 0xa5ced43b7e3e9188ul, 0x419ea3bd35385e2dul },   // 1e-325
+		{ 0xcf42894a5dce35eaul, 0x52064cac828675b9ul },   // 1e-324
+		{ 0x818995ce7aa0e1b2ul, 0x7343efebd1940993ul },   // 1e-323
+		{ 0xa1ebfb4219491a1ful, 0x1014ebe6c5f90bf8ul },   // 1e-322
+		{ 0xca66fa129f9b60a6ul, 0xd41a26e077774ef6ul },   // 1e-321
+		{ 0xfd00b897478238d0ul, 0x8920b098955522b4ul },   // 1e-320
+		{ 0x9e20735e8cb16382ul, 0x55b46e5f5d5535b0ul },   // 1e-319
+		{ 0xc5a890362fddbc62ul, 0xeb2189f734aa831dul },   // 1e-318
+		{ 0xf712b443bbd52b7bul, 0xa5e9ec7501d523e4ul },   // 1e-317
+		{ 0x9a6bb0aa55653b2dul, 0x47b233c92125366eul },   // 1e-316
+		{ 0xc1069cd4eabe89f8ul, 0x999ec0bb696e840aul },   // 1e-315
+		{ 0xf148440a256e2c76ul, 0xc00670ea43ca250dul },   // 1e-314
+		{ 0x96cd2a865764dbcaul, 0x380406926a5e5728ul },   // 1e-313
+		{ 0xbc807527ed3e12bcul, 0xc605083704f5ecf2ul },   // 1e-312
+		{ 0xeba09271e88d976bul, 0xf7864a44c633682eul },   // 1e-311
+		{ 0x93445b8731587ea3ul, 0x7ab3ee6afbe0211dul },   // 1e-310
+		{ 0xb8157268fdae9e4cul, 0x5960ea05bad82964ul },   // 1e-309
+		{ 0xe61acf033d1a45dful, 0x6fb92487298e33bdul },   // 1e-308
+		{ 0x8fd0c16206306babul, 0xa5d3b6d479f8e056ul },   // 1e-307
+		{ 0xb3c4f1ba87bc8696ul, 0x8f48a4899877186cul },   // 1e-306
+		{ 0xe0b62e2929aba83cul, 0x331acdabfe94de87ul },   // 1e-305
+		{ 0x8c71dcd9ba0b4925ul, 0x9ff0c08b7f1d0b14ul },   // 1e-304
+		{ 0xaf8e5410288e1b6ful, 0x07ecf0ae5ee44dd9ul },   // 1e-303
+		{ 0xdb71e91432b1a24aul, 0xc9e82cd9f69d6150ul },   // 1e-302
+		{ 0x892731ac9faf056eul, 0xbe311c083a225cd2ul },   // 1e-301
+		{ 0xab70fe17c79ac6caul, 0x6dbd630a48aaf406ul },   // 1e-300
+		{ 0xd64d3d9db981787dul, 0x092cbbccdad5b108ul },   // 1e-299
+		{ 0x85f0468293f0eb4eul, 0x25bbf56008c58ea5ul },   // 1e-298
+		{ 0xa76c582338ed2621ul, 0xaf2af2b80af6f24eul },   // 1e-297
+		{ 0xd1476e2c07286faaul, 0x1af5af660db4aee1ul },   // 1e-296
+		{ 0x82cca4db847945caul, 0x50d98d9fc890ed4dul },   // 1e-295
+		{ 0xa37fce126597973cul, 0xe50ff107bab528a0ul },   // 1e-294
+		{ 0xcc5fc196fefd7d0cul, 0x1e53ed49a96272c8ul },   // 1e-293
+		{ 0xff77b1fcbebcdc4ful, 0x25e8e89c13bb0f7aul },   // 1e-292
+		{ 0x9faacf3df73609b1ul, 0x77b191618c54e9acul },   // 1e-291
+		{ 0xc795830d75038c1dul, 0xd59df5b9ef6a2417ul },   // 1e-290
+		{ 0xf97ae3d0d2446f25ul, 0x4b0573286b44ad1dul },   // 1e-289
+		{ 0x9becce62836ac577ul, 0x4ee367f9430aec32ul },   // 1e-288
+		{ 0xc2e801fb244576d5ul, 0x229c41f793cda73ful },   // 1e-287
+		{ 0xf3a20279ed56d48aul, 0x6b43527578c1110ful },   // 1e-286
+		{ 0x9845418c345644d6ul, 0x830a13896b78aaa9ul },   // 1e-285
+		{ 0xbe5691ef416bd60cul, 0x23cc986bc656d553ul },   // 1e-284
+		{ 0xedec366b11c6cb8ful, 0x2cbfbe86b7ec8aa8ul },   // 1e-283
+		{ 0x94b3a202eb1c3f39ul, 0x7bf7d71432f3d6a9ul },   // 1e-282
+		{ 0xb9e08a83a5e34f07ul, 0xdaf5ccd93fb0cc53ul },   // 1e-281
+		{ 0xe858ad248f5c22c9ul, 0xd1b3400f8f9cff68ul },   // 1e-280
+		{ 0x91376c36d99995beul, 0x23100809b9c21fa1ul },   // 1e-279
+		{ 0xb58547448ffffb2dul, 0xabd40a0c2832a78aul },   // 1e-278
+		{ 0xe2e69915b3fff9f9ul, 0x16c90c8f323f516cul },   // 1e-277
+		{ 0x8dd01fad907ffc3bul, 0xae3da7d97f6792e3ul },   // 1e-276
+		{ 0xb1442798f49ffb4aul, 0x99cd11cfdf41779cul },   // 1e-275
+		{ 0xdd95317f31c7fa1dul, 0x40405643d711d583ul },   // 1e-274
+		{ 0x8a7d3eef7f1cfc52ul, 0x482835ea666b2572ul },   // 1e-273
+		{ 0xad1c8eab5ee43b66ul, 0xda3243650005eecful },   // 1e-272
+		{ 0xd863b256369d4a40ul, 0x90bed43e40076a82ul },   // 1e-271
+		{ 0x873e4f75e2224e68ul, 0x5a7744a6e804a291ul },   // 1e-270
+		{ 0xa90de3535aaae202ul, 0x711515d0a205cb36ul },   // 1e-269
+		{ 0xd3515c2831559a83ul, 0x0d5a5b44ca873e03ul },   // 1e-268
+		{ 0x8412d9991ed58091ul, 0xe858790afe9486c2ul },   // 1e-267
+		{ 0xa5178fff668ae0b6ul, 0x626e974dbe39a872ul },   // 1e-266
+		{ 0xce5d73ff402d98e3ul, 0xfb0a3d212dc8128ful },   // 1e-265
+		{ 0x80fa687f881c7f8eul, 0x7ce66634bc9d0b99ul },   // 1e-264
+		{ 0xa139029f6a239f72ul, 0x1c1fffc1ebc44e80ul },   // 1e-263
+		{ 0xc987434744ac874eul, 0xa327ffb266b56220ul },   // 1e-262
+		{ 0xfbe9141915d7a922ul, 0x4bf1ff9f0062baa8ul },   // 1e-261
+		{ 0x9d71ac8fada6c9b5ul, 0x6f773fc3603db4a9ul },   // 1e-260
+		{ 0xc4ce17b399107c22ul, 0xcb550fb4384d21d3ul },   // 1e-259
+		{ 0xf6019da07f549b2bul, 0x7e2a53a146606a48ul },   // 1e-258
+		{ 0x99c102844f94e0fbul, 0x2eda7444cbfc426dul },   // 1e-257
+		{ 0xc0314325637a1939ul, 0xfa911155fefb5308ul },   // 1e-256
+		{ 0xf03d93eebc589f88ul, 0x793555ab7eba27caul },   // 1e-255
+		{ 0x96267c7535b763b5ul, 0x4bc1558b2f3458deul },   // 1e-254
+		{ 0xbbb01b9283253ca2ul, 0x9eb1aaedfb016f16ul },   // 1e-253
+		{ 0xea9c227723ee8bcbul, 0x465e15a979c1cadcul },   // 1e-252
+		{ 0x92a1958a7675175ful, 0x0bfacd89ec191ec9ul },   // 1e-251
+		{ 0xb749faed14125d36ul, 0xcef980ec671f667bul },   // 1e-250
+		{ 0xe51c79a85916f484ul, 0x82b7e12780e7401aul },   // 1e-249
+		{ 0x8f31cc0937ae58d2ul, 0xd1b2ecb8b0908810ul },   // 1e-248
+		{ 0xb2fe3f0b8599ef07ul, 0x861fa7e6dcb4aa15ul },   // 1e-247
+		{ 0xdfbdcece67006ac9ul, 0x67a791e093e1d49aul },   // 1e-246
+		{ 0x8bd6a141006042bdul, 0xe0c8bb2c5c6d24e0ul },   // 1e-245
+		{ 0xaecc49914078536dul, 0x58fae9f773886e18ul },   // 1e-244
+		{ 0xda7f5bf590966848ul, 0xaf39a475506a899eul },   // 1e-243
+		{ 0x888f99797a5e012dul, 0x6d8406c952429603ul },   // 1e-242
+		{ 0xaab37fd7d8f58178ul, 0xc8e5087ba6d33b83ul },   // 1e-241
+		{ 0xd5605fcdcf32e1d6ul, 0xfb1e4a9a90880a64ul },   // 1e-240
+		{ 0x855c3be0a17fcd26ul, 0x5cf2eea09a55067ful },   // 1e-239
+		{ 0xa6b34ad8c9dfc06ful, 0xf42faa48c0ea481eul },   // 1e-238
+		{ 0xd0601d8efc57b08bul, 0xf13b94daf124da26ul },   // 1e-237
+		{ 0x823c12795db6ce57ul, 0x76c53d08d6b70858ul },   // 1e-236
+		{ 0xa2cb1717b52481edul, 0x54768c4b0c64ca6eul },   // 1e-235
+		{ 0xcb7ddcdda26da268ul, 0xa9942f5dcf7dfd09ul },   // 1e-234
+		{ 0xfe5d54150b090b02ul, 0xd3f93b35435d7c4cul },   // 1e-233
+		{ 0x9efa548d26e5a6e1ul, 0xc47bc5014a1a6daful },   // 1e-232
+		{ 0xc6b8e9b0709f109aul, 0x359ab6419ca1091bul },   // 1e-231
+		{ 0xf867241c8cc6d4c0ul, 0xc30163d203c94b62ul },   // 1e-230
+		{ 0x9b407691d7fc44f8ul, 0x79e0de63425dcf1dul },   // 1e-229
+		{ 0xc21094364dfb5636ul, 0x985915fc12f542e4ul },   // 1e-228
+		{ 0xf294b943e17a2bc4ul, 0x3e6f5b7b17b2939dul },   // 1e-227
+		{ 0x979cf3ca6cec5b5aul, 0xa705992ceecf9c42ul },   // 1e-226
+		{ 0xbd8430bd08277231ul, 0x50c6ff782a838353ul },   // 1e-225
+		{ 0xece53cec4a314ebdul, 0xa4f8bf5635246428ul },   // 1e-224
+		{ 0x940f4613ae5ed136ul, 0x871b7795e136be99ul },   // 1e-223
+		{ 0xb913179899f68584ul, 0x28e2557b59846e3ful },   // 1e-222
+		{ 0xe757dd7ec07426e5ul, 0x331aeada2fe589cful },   // 1e-221
+		{ 0x9096ea6f3848984ful, 0x3ff0d2c85def7621ul },   // 1e-220
+		{ 0xb4bca50b065abe63ul, 0x0fed077a756b53a9ul },   // 1e-219
+		{ 0xe1ebce4dc7f16dfbul, 0xd3e8495912c62894ul },   // 1e-218
+		{ 0x8d3360f09cf6e4bdul, 0x64712dd7abbbd95cul },   // 1e-217
+		{ 0xb080392cc4349decul, 0xbd8d794d96aacfb3ul },   // 1e-216
+		{ 0xdca04777f541c567ul, 0xecf0d7a0fc5583a0ul },   // 1e-215
+		{ 0x89e42caaf9491b60ul, 0xf41686c49db57244ul },   // 1e-214
+		{ 0xac5d37d5b79b6239ul, 0x311c2875c522ced5ul },   // 1e-213
+		{ 0xd77485cb25823ac7ul, 0x7d633293366b828bul },   // 1e-212
+		{ 0x86a8d39ef77164bcul, 0xae5dff9c02033197ul },   // 1e-211
+		{ 0xa8530886b54dbdebul, 0xd9f57f830283fdfcul },   // 1e-210
+		{ 0xd267caa862a12d66ul, 0xd072df63c324fd7bul },   // 1e-209
+		{ 0x8380dea93da4bc60ul, 0x4247cb9e59f71e6dul },   // 1e-208
+		{ 0xa46116538d0deb78ul, 0x52d9be85f074e608ul },   // 1e-207
+		{ 0xcd795be870516656ul, 0x67902e276c921f8bul },   // 1e-206
+		{ 0x806bd9714632dff6ul, 0x00ba1cd8a3db53b6ul },   // 1e-205
+		{ 0xa086cfcd97bf97f3ul, 0x80e8a40eccd228a4ul },   // 1e-204
+		{ 0xc8a883c0fdaf7df0ul, 0x6122cd128006b2cdul },   // 1e-203
+		{ 0xfad2a4b13d1b5d6cul, 0x796b805720085f81ul },   // 1e-202
+		{ 0x9cc3a6eec6311a63ul, 0xcbe3303674053bb0ul },   // 1e-201
+		{ 0xc3f490aa77bd60fcul, 0xbedbfc4411068a9cul },   // 1e-200
+		{ 0xf4f1b4d515acb93bul, 0xee92fb5515482d44ul },   // 1e-199
+		{ 0x991711052d8bf3c5ul, 0x751bdd152d4d1c4aul },   // 1e-198
+		{ 0xbf5cd54678eef0b6ul, 0xd262d45a78a0635dul },   // 1e-197
+		{ 0xef340a98172aace4ul, 0x86fb897116c87c34ul },   // 1e-196
+		{ 0x9580869f0e7aac0eul, 0xd45d35e6ae3d4da0ul },   // 1e-195
+		{ 0xbae0a846d2195712ul, 0x8974836059cca109ul },   // 1e-194
+		{ 0xe998d258869facd7ul, 0x2bd1a438703fc94bul },   // 1e-193
+		{ 0x91ff83775423cc06ul, 0x7b6306a34627ddcful },   // 1e-192
+		{ 0xb67f6455292cbf08ul, 0x1a3bc84c17b1d542ul },   // 1e-191
+		{ 0xe41f3d6a7377eecaul, 0x20caba5f1d9e4a93ul },   // 1e-190
+		{ 0x8e938662882af53eul, 0x547eb47b7282ee9cul },   // 1e-189
+		{ 0xb23867fb2a35b28dul, 0xe99e619a4f23aa43ul },   // 1e-188
+		{ 0xdec681f9f4c31f31ul, 0x6405fa00e2ec94d4ul },   // 1e-187
+		{ 0x8b3c113c38f9f37eul, 0xde83bc408dd3dd04ul },   // 1e-186
+		{ 0xae0b158b4738705eul, 0x9624ab50b148d445ul },   // 1e-185
+		{ 0xd98ddaee19068c76ul, 0x3badd624dd9b0957ul },   // 1e-184
+		{ 0x87f8a8d4cfa417c9ul, 0xe54ca5d70a80e5d6ul },   // 1e-183
+		{ 0xa9f6d30a038d1dbcul, 0x5e9fcf4ccd211f4cul },   // 1e-182
+		{ 0xd47487cc8470652bul, 0x7647c3200069671ful },   // 1e-181
+		{ 0x84c8d4dfd2c63f3bul, 0x29ecd9f40041e073ul },   // 1e-180
+		{ 0xa5fb0a17c777cf09ul, 0xf468107100525890ul },   // 1e-179
+		{ 0xcf79cc9db955c2ccul, 0x7182148d4066eeb4ul },   // 1e-178
+		{ 0x81ac1fe293d599bful, 0xc6f14cd848405530ul },   // 1e-177
+		{ 0xa21727db38cb002ful, 0xb8ada00e5a506a7cul },   // 1e-176
+		{ 0xca9cf1d206fdc03bul, 0xa6d90811f0e4851cul },   // 1e-175
+		{ 0xfd442e4688bd304aul, 0x908f4a166d1da663ul },   // 1e-174
+		{ 0x9e4a9cec15763e2eul, 0x9a598e4e043287feul },   // 1e-173
+		{ 0xc5dd44271ad3cdbaul, 0x40eff1e1853f29fdul },   // 1e-172
+		{ 0xf7549530e188c128ul, 0xd12bee59e68ef47cul },   // 1e-171
+		{ 0x9a94dd3e8cf578b9ul, 0x82bb74f8301958ceul },   // 1e-170
+		{ 0xc13a148e3032d6e7ul, 0xe36a52363c1faf01ul },   // 1e-169
+		{ 0xf18899b1bc3f8ca1ul, 0xdc44e6c3cb279ac1ul },   // 1e-168
+		{ 0x96f5600f15a7b7e5ul, 0x29ab103a5ef8c0b9ul },   // 1e-167
+		{ 0xbcb2b812db11a5deul, 0x7415d448f6b6f0e7ul },   // 1e-166
+		{ 0xebdf661791d60f56ul, 0x111b495b3464ad21ul },   // 1e-165
+		{ 0x936b9fcebb25c995ul, 0xcab10dd900beec34ul },   // 1e-164
+		{ 0xb84687c269ef3bfbul, 0x3d5d514f40eea742ul },   // 1e-163
+		{ 0xe65829b3046b0afaul, 0x0cb4a5a3112a5112ul },   // 1e-162
+		{ 0x8ff71a0fe2c2e6dcul, 0x47f0e785eaba72abul },   // 1e-161
+		{ 0xb3f4e093db73a093ul, 0x59ed216765690f56ul },   // 1e-160
+		{ 0xe0f218b8d25088b8ul, 0x306869c13ec3532cul },   // 1e-159
+		{ 0x8c974f7383725573ul, 0x1e414218c73a13fbul },   // 1e-158
+		{ 0xafbd2350644eeacful, 0xe5d1929ef90898faul },   // 1e-157
+		{ 0xdbac6c247d62a583ul, 0xdf45f746b74abf39ul },   // 1e-156
+		{ 0x894bc396ce5da772ul, 0x6b8bba8c328eb783ul },   // 1e-155
+		{ 0xab9eb47c81f5114ful, 0x066ea92f3f326564ul },   // 1e-154
+		{ 0xd686619ba27255a2ul, 0xc80a537b0efefebdul },   // 1e-153
+		{ 0x8613fd0145877585ul, 0xbd06742ce95f5f36ul },   // 1e-152
+		{ 0xa798fc4196e952e7ul, 0x2c48113823b73704ul },   // 1e-151
+		{ 0xd17f3b51fca3a7a0ul, 0xf75a15862ca504c5ul },   // 1e-150
+		{ 0x82ef85133de648c4ul, 0x9a984d73dbe722fbul },   // 1e-149
+		{ 0xa3ab66580d5fdaf5ul, 0xc13e60d0d2e0ebbaul },   // 1e-148
+		{ 0xcc963fee10b7d1b3ul, 0x318df905079926a8ul },   // 1e-147
+		{ 0xffbbcfe994e5c61ful, 0xfdf17746497f7052ul },   // 1e-146
+		{ 0x9fd561f1fd0f9bd3ul, 0xfeb6ea8bedefa633ul },   // 1e-145
+		{ 0xc7caba6e7c5382c8ul, 0xfe64a52ee96b8fc0ul },   // 1e-144
+		{ 0xf9bd690a1b68637bul, 0x3dfdce7aa3c673b0ul },   // 1e-143
+		{ 0x9c1661a651213e2dul, 0x06bea10ca65c084eul },   // 1e-142
+		{ 0xc31bfa0fe5698db8ul, 0x486e494fcff30a62ul },   // 1e-141
+		{ 0xf3e2f893dec3f126ul, 0x5a89dba3c3efccfaul },   // 1e-140
+		{ 0x986ddb5c6b3a76b7ul, 0xf89629465a75e01cul },   // 1e-139
+		{ 0xbe89523386091465ul, 0xf6bbb397f1135823ul },   // 1e-138
+		{ 0xee2ba6c0678b597ful, 0x746aa07ded582e2cul },   // 1e-137
+		{ 0x94db483840b717eful, 0xa8c2a44eb4571cdcul },   // 1e-136
+		{ 0xba121a4650e4ddebul, 0x92f34d62616ce413ul },   // 1e-135
+		{ 0xe896a0d7e51e1566ul, 0x77b020baf9c81d17ul },   // 1e-134
+		{ 0x915e2486ef32cd60ul, 0x0ace1474dc1d122eul },   // 1e-133
+		{ 0xb5b5ada8aaff80b8ul, 0x0d819992132456baul },   // 1e-132
+		{ 0xe3231912d5bf60e6ul, 0x10e1fff697ed6c69ul },   // 1e-131
+		{ 0x8df5efabc5979c8ful, 0xca8d3ffa1ef463c1ul },   // 1e-130
+		{ 0xb1736b96b6fd83b3ul, 0xbd308ff8a6b17cb2ul },   // 1e-129
+		{ 0xddd0467c64bce4a0ul, 0xac7cb3f6d05ddbdeul },   // 1e-128
+		{ 0x8aa22c0dbef60ee4ul, 0x6bcdf07a423aa96bul },   // 1e-127
+		{ 0xad4ab7112eb3929dul, 0x86c16c98d2c953c6ul },   // 1e-126
+		{ 0xd89d64d57a607744ul, 0xe871c7bf077ba8b7ul },   // 1e-125
+		{ 0x87625f056c7c4a8bul, 0x11471cd764ad4972ul },   // 1e-124
+		{ 0xa93af6c6c79b5d2dul, 0xd598e40d3dd89bcful },   // 1e-123
+		{ 0xd389b47879823479ul, 0x4aff1d108d4ec2c3ul },   // 1e-122
+		{ 0x843610cb4bf160cbul, 0xcedf722a585139baul },   // 1e-121
+		{ 0xa54394fe1eedb8feul, 0xc2974eb4ee658828ul },   // 1e-120
+		{ 0xce947a3da6a9273eul, 0x733d226229feea32ul },   // 1e-119
+		{ 0x811ccc668829b887ul, 0x0806357d5a3f525ful },   // 1e-118
+		{ 0xa163ff802a3426a8ul, 0xca07c2dcb0cf26f7ul },   // 1e-117
+		{ 0xc9bcff6034c13052ul, 0xfc89b393dd02f0b5ul },   // 1e-116
+		{ 0xfc2c3f3841f17c67ul, 0xbbac2078d443ace2ul },   // 1e-115
+		{ 0x9d9ba7832936edc0ul, 0xd54b944b84aa4c0dul },   // 1e-114
+		{ 0xc5029163f384a931ul, 0x0a9e795e65d4df11ul },   // 1e-113
+		{ 0xf64335bcf065d37dul, 0x4d4617b5ff4a16d5ul },   // 1e-112
+		{ 0x99ea0196163fa42eul, 0x504bced1bf8e4e45ul },   // 1e-111
+		{ 0xc06481fb9bcf8d39ul, 0xe45ec2862f71e1d6ul },   // 1e-110
+		{ 0xf07da27a82c37088ul, 0x5d767327bb4e5a4cul },   // 1e-109
+		{ 0x964e858c91ba2655ul, 0x3a6a07f8d510f86ful },   // 1e-108
+		{ 0xbbe226efb628afeaul, 0x890489f70a55368bul },   // 1e-107
+		{ 0xeadab0aba3b2dbe5ul, 0x2b45ac74ccea842eul },   // 1e-106
+		{ 0x92c8ae6b464fc96ful, 0x3b0b8bc90012929dul },   // 1e-105
+		{ 0xb77ada0617e3bbcbul, 0x09ce6ebb40173744ul },   // 1e-104
+		{ 0xe55990879ddcaabdul, 0xcc420a6a101d0515ul },   // 1e-103
+		{ 0x8f57fa54c2a9eab6ul, 0x9fa946824a12232dul },   // 1e-102
+		{ 0xb32df8e9f3546564ul, 0x47939822dc96abf9ul },   // 1e-101
+		{ 0xdff9772470297ebdul, 0x59787e2b93bc56f7ul },   // 1e-100
+		{ 0x8bfbea76c619ef36ul, 0x57eb4edb3c55b65aul },   // 1e-99
+		{ 0xaefae51477a06b03ul, 0xede622920b6b23f1ul },   // 1e-98
+		{ 0xdab99e59958885c4ul, 0xe95fab368e45ecedul },   // 1e-97
+		{ 0x88b402f7fd75539bul, 0x11dbcb0218ebb414ul },   // 1e-96
+		{ 0xaae103b5fcd2a881ul, 0xd652bdc29f26a119ul },   // 1e-95
+		{ 0xd59944a37c0752a2ul, 0x4be76d3346f0495ful },   // 1e-94
+		{ 0x857fcae62d8493a5ul, 0x6f70a4400c562ddbul },   // 1e-93
+		{ 0xa6dfbd9fb8e5b88eul, 0xcb4ccd500f6bb952ul },   // 1e-92
+		{ 0xd097ad07a71f26b2ul, 0x7e2000a41346a7a7ul },   // 1e-91
+		{ 0x825ecc24c873782ful, 0x8ed400668c0c28c8ul },   // 1e-90
+		{ 0xa2f67f2dfa90563bul, 0x728900802f0f32faul },   // 1e-89
+		{ 0xcbb41ef979346bcaul, 0x4f2b40a03ad2ffb9ul },   // 1e-88
+		{ 0xfea126b7d78186bcul, 0xe2f610c84987bfa8ul },   // 1e-87
+		{ 0x9f24b832e6b0f436ul, 0x0dd9ca7d2df4d7c9ul },   // 1e-86
+		{ 0xc6ede63fa05d3143ul, 0x91503d1c79720dbbul },   // 1e-85
+		{ 0xf8a95fcf88747d94ul, 0x75a44c6397ce912aul },   // 1e-84
+		{ 0x9b69dbe1b548ce7cul, 0xc986afbe3ee11abaul },   // 1e-83
+		{ 0xc24452da229b021bul, 0xfbe85badce996168ul },   // 1e-82
+		{ 0xf2d56790ab41c2a2ul, 0xfae27299423fb9c3ul },   // 1e-81
+		{ 0x97c560ba6b0919a5ul, 0xdccd879fc967d41aul },   // 1e-80
+		{ 0xbdb6b8e905cb600ful, 0x5400e987bbc1c920ul },   // 1e-79
+		{ 0xed246723473e3813ul, 0x290123e9aab23b68ul },   // 1e-78
+		{ 0x9436c0760c86e30bul, 0xf9a0b6720aaf6521ul },   // 1e-77
+		{ 0xb94470938fa89bceul, 0xf808e40e8d5b3e69ul },   // 1e-76
+		{ 0xe7958cb87392c2c2ul, 0xb60b1d1230b20e04ul },   // 1e-75
+		{ 0x90bd77f3483bb9b9ul, 0xb1c6f22b5e6f48c2ul },   // 1e-74
+		{ 0xb4ecd5f01a4aa828ul, 0x1e38aeb6360b1af3ul },   // 1e-73
+		{ 0xe2280b6c20dd5232ul, 0x25c6da63c38de1b0ul },   // 1e-72
+		{ 0x8d590723948a535ful, 0x579c487e5a38ad0eul },   // 1e-71
+		{ 0xb0af48ec79ace837ul, 0x2d835a9df0c6d851ul },   // 1e-70
+		{ 0xdcdb1b2798182244ul, 0xf8e431456cf88e65ul },   // 1e-69
+		{ 0x8a08f0f8bf0f156bul, 0x1b8e9ecb641b58fful },   // 1e-68
+		{ 0xac8b2d36eed2dac5ul, 0xe272467e3d222f3ful },   // 1e-67
+		{ 0xd7adf884aa879177ul, 0x5b0ed81dcc6abb0ful },   // 1e-66
+		{ 0x86ccbb52ea94baeaul, 0x98e947129fc2b4e9ul },   // 1e-65
+		{ 0xa87fea27a539e9a5ul, 0x3f2398d747b36224ul },   // 1e-64
+		{ 0xd29fe4b18e88640eul, 0x8eec7f0d19a03aadul },   // 1e-63
+		{ 0x83a3eeeef9153e89ul, 0x1953cf68300424acul },   // 1e-62
+		{ 0xa48ceaaab75a8e2bul, 0x5fa8c3423c052dd7ul },   // 1e-61
+		{ 0xcdb02555653131b6ul, 0x3792f412cb06794dul },   // 1e-60
+		{ 0x808e17555f3ebf11ul, 0xe2bbd88bbee40bd0ul },   // 1e-59
+		{ 0xa0b19d2ab70e6ed6ul, 0x5b6aceaeae9d0ec4ul },   // 1e-58
+		{ 0xc8de047564d20a8bul, 0xf245825a5a445275ul },   // 1e-57
+		{ 0xfb158592be068d2eul, 0xeed6e2f0f0d56712ul },   // 1e-56
+		{ 0x9ced737bb6c4183dul, 0x55464dd69685606bul },   // 1e-55
+		{ 0xc428d05aa4751e4cul, 0xaa97e14c3c26b886ul },   // 1e-54
+		{ 0xf53304714d9265dful, 0xd53dd99f4b3066a8ul },   // 1e-53
+		{ 0x993fe2c6d07b7fabul, 0xe546a8038efe4029ul },   // 1e-52
+		{ 0xbf8fdb78849a5f96ul, 0xde98520472bdd033ul },   // 1e-51
+		{ 0xef73d256a5c0f77cul, 0x963e66858f6d4440ul },   // 1e-50
+		{ 0x95a8637627989aadul, 0xdde7001379a44aa8ul },   // 1e-49
+		{ 0xbb127c53b17ec159ul, 0x5560c018580d5d52ul },   // 1e-48
+		{ 0xe9d71b689dde71aful, 0xaab8f01e6e10b4a6ul },   // 1e-47
+		{ 0x9226712162ab070dul, 0xcab3961304ca70e8ul },   // 1e-46
+		{ 0xb6b00d69bb55c8d1ul, 0x3d607b97c5fd0d22ul },   // 1e-45
+		{ 0xe45c10c42a2b3b05ul, 0x8cb89a7db77c506aul },   // 1e-44
+		{ 0x8eb98a7a9a5b04e3ul, 0x77f3608e92adb242ul },   // 1e-43
+		{ 0xb267ed1940f1c61cul, 0x55f038b237591ed3ul },   // 1e-42
+		{ 0xdf01e85f912e37a3ul, 0x6b6c46dec52f6688ul },   // 1e-41
+		{ 0x8b61313bbabce2c6ul, 0x2323ac4b3b3da015ul },   // 1e-40
+		{ 0xae397d8aa96c1b77ul, 0xabec975e0a0d081aul },   // 1e-39
+		{ 0xd9c7dced53c72255ul, 0x96e7bd358c904a21ul },   // 1e-38
+		{ 0x881cea14545c7575ul, 0x7e50d64177da2e54ul },   // 1e-37
+		{ 0xaa242499697392d2ul, 0xdde50bd1d5d0b9e9ul },   // 1e-36
+		{ 0xd4ad2dbfc3d07787ul, 0x955e4ec64b44e864ul },   // 1e-35
+		{ 0x84ec3c97da624ab4ul, 0xbd5af13bef0b113eul },   // 1e-34
+		{ 0xa6274bbdd0fadd61ul, 0xecb1ad8aeacdd58eul },   // 1e-33
+		{ 0xcfb11ead453994baul, 0x67de18eda5814af2ul },   // 1e-32
+		{ 0x81ceb32c4b43fcf4ul, 0x80eacf948770ced7ul },   // 1e-31
+		{ 0xa2425ff75e14fc31ul, 0xa1258379a94d028dul },   // 1e-30
+		{ 0xcad2f7f5359a3b3eul, 0x096ee45813a04330ul },   // 1e-29
+		{ 0xfd87b5f28300ca0dul, 0x8bca9d6e188853fcul },   // 1e-28
+		{ 0x9e74d1b791e07e48ul, 0x775ea264cf55347dul },   // 1e-27
+		{ 0xc612062576589ddaul, 0x95364afe032a819dul },   // 1e-26
+		{ 0xf79687aed3eec551ul, 0x3a83ddbd83f52204ul },   // 1e-25
+		{ 0x9abe14cd44753b52ul, 0xc4926a9672793542ul },   // 1e-24
+		{ 0xc16d9a0095928a27ul, 0x75b7053c0f178293ul },   // 1e-23
+		{ 0xf1c90080baf72cb1ul, 0x5324c68b12dd6338ul },   // 1e-22
+		{ 0x971da05074da7beeul, 0xd3f6fc16ebca5e03ul },   // 1e-21
+		{ 0xbce5086492111aeaul, 0x88f4bb1ca6bcf584ul },   // 1e-20
+		{ 0xec1e4a7db69561a5ul, 0x2b31e9e3d06c32e5ul },   // 1e-19
+		{ 0x9392ee8e921d5d07ul, 0x3aff322e62439fcful },   // 1e-18
+		{ 0xb877aa3236a4b449ul, 0x09befeb9fad487c2ul },   // 1e-17
+		{ 0xe69594bec44de15bul, 0x4c2ebe687989a9b3ul },   // 1e-16
+		{ 0x901d7cf73ab0acd9ul, 0x0f9d37014bf60a10ul },   // 1e-15
+		{ 0xb424dc35095cd80ful, 0x538484c19ef38c94ul },   // 1e-14
+		{ 0xe12e13424bb40e13ul, 0x2865a5f206b06fb9ul },   // 1e-13
+		{ 0x8cbccc096f5088cbul, 0xf93f87b7442e45d3ul },   // 1e-12
+		{ 0xafebff0bcb24aafeul, 0xf78f69a51539d748ul },   // 1e-11
+		{ 0xdbe6fecebdedd5beul, 0xb573440e5a884d1bul },   // 1e-10
+		{ 0x89705f4136b4a597ul, 0x31680a88f8953030ul },   // 1e-9
+		{ 0xabcc77118461cefcul, 0xfdc20d2b36ba7c3dul },   // 1e-8
+		{ 0xd6bf94d5e57a42bcul, 0x3d32907604691b4cul },   // 1e-7
+		{ 0x8637bd05af6c69b5ul, 0xa63f9a49c2c1b10ful },   // 1e-6
+		{ 0xa7c5ac471b478423ul, 0x0fcf80dc33721d53ul },   // 1e-5
+		{ 0xd1b71758e219652bul, 0xd3c36113404ea4a8ul },   // 1e-4
+		{ 0x83126e978d4fdf3bul, 0x645a1cac083126e9ul },   // 1e-3
+		{ 0xa3d70a3d70a3d70aul, 0x3d70a3d70a3d70a3ul },   // 1e-2
+		{ 0xccccccccccccccccul, 0xccccccccccccccccul },   // 1e-1
+		{ 0x8000000000000000ul, 0x0000000000000000ul },   // 1e0
+		{ 0xa000000000000000ul, 0x0000000000000000ul },   // 1e1
+		{ 0xc800000000000000ul, 0x0000000000000000ul },   // 1e2
+		{ 0xfa00000000000000ul, 0x0000000000000000ul },   // 1e3
+		{ 0x9c40000000000000ul, 0x0000000000000000ul },   // 1e4
+		{ 0xc350000000000000ul, 0x0000000000000000ul },   // 1e5
+		{ 0xf424000000000000ul, 0x0000000000000000ul },   // 1e6
+		{ 0x9896800000000000ul, 0x0000000000000000ul },   // 1e7
+		{ 0xbebc200000000000ul, 0x0000000000000000ul },   // 1e8
+		{ 0xee6b280000000000ul, 0x0000000000000000ul },   // 1e9
+		{ 0x9502f90000000000ul, 0x0000000000000000ul },   // 1e10
+		{ 0xba43b74000000000ul, 0x0000000000000000ul },   // 1e11
+		{ 0xe8d4a51000000000ul, 0x0000000000000000ul },   // 1e12
+		{ 0x9184e72a00000000ul, 0x0000000000000000ul },   // 1e13
+		{ 0xb5e620f480000000ul, 0x0000000000000000ul },   // 1e14
+		{ 0xe35fa931a0000000ul, 0x0000000000000000ul },   // 1e15
+		{ 0x8e1bc9bf04000000ul, 0x0000000000000000ul },   // 1e16
+		{ 0xb1a2bc2ec5000000ul, 0x0000000000000000ul },   // 1e17
+		{ 0xde0b6b3a76400000ul, 0x0000000000000000ul },   // 1e18
+		{ 0x8ac7230489e80000ul, 0x0000000000000000ul },   // 1e19
+		{ 0xad78ebc5ac620000ul, 0x0000000000000000ul },   // 1e20
+		{ 0xd8d726b7177a8000ul, 0x0000000000000000ul },   // 1e21
+		{ 0x878678326eac9000ul, 0x0000000000000000ul },   // 1e22
+		{ 0xa968163f0a57b400ul, 0x0000000000000000ul },   // 1e23
+		{ 0xd3c21bcecceda100ul, 0x0000000000000000ul },   // 1e24
+		{ 0x84595161401484a0ul, 0x0000000000000000ul },   // 1e25
+		{ 0xa56fa5b99019a5c8ul, 0x0000000000000000ul },   // 1e26
+		{ 0xcecb8f27f4200f3aul, 0x0000000000000000ul },   // 1e27
+		{ 0x813f3978f8940984ul, 0x4000000000000000ul },   // 1e28
+		{ 0xa18f07d736b90be5ul, 0x5000000000000000ul },   // 1e29
+		{ 0xc9f2c9cd04674edeul, 0xa400000000000000ul },   // 1e30
+		{ 0xfc6f7c4045812296ul, 0x4d00000000000000ul },   // 1e31
+		{ 0x9dc5ada82b70b59dul, 0xf020000000000000ul },   // 1e32
+		{ 0xc5371912364ce305ul, 0x6c28000000000000ul },   // 1e33
+		{ 0xf684df56c3e01bc6ul, 0xc732000000000000ul },   // 1e34
+		{ 0x9a130b963a6c115cul, 0x3c7f400000000000ul },   // 1e35
+		{ 0xc097ce7bc90715b3ul, 0x4b9f100000000000ul },   // 1e36
+		{ 0xf0bdc21abb48db20ul, 0x1e86d40000000000ul },   // 1e37
+		{ 0x96769950b50d88f4ul, 0x1314448000000000ul },   // 1e38
+		{ 0xbc143fa4e250eb31ul, 0x17d955a000000000ul },   // 1e39
+		{ 0xeb194f8e1ae525fdul, 0x5dcfab0800000000ul },   // 1e40
+		{ 0x92efd1b8d0cf37beul, 0x5aa1cae500000000ul },   // 1e41
+		{ 0xb7abc627050305adul, 0xf14a3d9e40000000ul },   // 1e42
+		{ 0xe596b7b0c643c719ul, 0x6d9ccd05d0000000ul },   // 1e43
+		{ 0x8f7e32ce7bea5c6ful, 0xe4820023a2000000ul },   // 1e44
+		{ 0xb35dbf821ae4f38bul, 0xdda2802c8a800000ul },   // 1e45
+		{ 0xe0352f62a19e306eul, 0xd50b2037ad200000ul },   // 1e46
+		{ 0x8c213d9da502de45ul, 0x4526f422cc340000ul },   // 1e47
+		{ 0xaf298d050e4395d6ul, 0x9670b12b7f410000ul },   // 1e48
+		{ 0xdaf3f04651d47b4cul, 0x3c0cdd765f114000ul },   // 1e49
+		{ 0x88d8762bf324cd0ful, 0xa5880a69fb6ac800ul },   // 1e50
+		{ 0xab0e93b6efee0053ul, 0x8eea0d047a457a00ul },   // 1e51
+		{ 0xd5d238a4abe98068ul, 0x72a4904598d6d880ul },   // 1e52
+		{ 0x85a36366eb71f041ul, 0x47a6da2b7f864750ul },   // 1e53
+		{ 0xa70c3c40a64e6c51ul, 0x999090b65f67d924ul },   // 1e54
+		{ 0xd0cf4b50cfe20765ul, 0xfff4b4e3f741cf6dul },   // 1e55
+		{ 0x82818f1281ed449ful, 0xbff8f10e7a8921a4ul },   // 1e56
+		{ 0xa321f2d7226895c7ul, 0xaff72d52192b6a0dul },   // 1e57
+		{ 0xcbea6f8ceb02bb39ul, 0x9bf4f8a69f764490ul },   // 1e58
+		{ 0xfee50b7025c36a08ul, 0x02f236d04753d5b4ul },   // 1e59
+		{ 0x9f4f2726179a2245ul, 0x01d762422c946590ul },   // 1e60
+		{ 0xc722f0ef9d80aad6ul, 0x424d3ad2b7b97ef5ul },   // 1e61
+		{ 0xf8ebad2b84e0d58bul, 0xd2e0898765a7deb2ul },   // 1e62
+		{ 0x9b934c3b330c8577ul, 0x63cc55f49f88eb2ful },   // 1e63
+		{ 0xc2781f49ffcfa6d5ul, 0x3cbf6b71c76b25fbul },   // 1e64
+		{ 0xf316271c7fc3908aul, 0x8bef464e3945ef7aul },   // 1e65
+		{ 0x97edd871cfda3a56ul, 0x97758bf0e3cbb5acul },   // 1e66
+		{ 0xbde94e8e43d0c8ecul, 0x3d52eeed1cbea317ul },   // 1e67
+		{ 0xed63a231d4c4fb27ul, 0x4ca7aaa863ee4bddul },   // 1e68
+		{ 0x945e455f24fb1cf8ul, 0x8fe8caa93e74ef6aul },   // 1e69
+		{ 0xb975d6b6ee39e436ul, 0xb3e2fd538e122b44ul },   // 1e70
+		{ 0xe7d34c64a9c85d44ul, 0x60dbbca87196b616ul },   // 1e71
+		{ 0x90e40fbeea1d3a4aul, 0xbc8955e946fe31cdul },   // 1e72
+		{ 0xb51d13aea4a488ddul, 0x6babab6398bdbe41ul },   // 1e73
+		{ 0xe264589a4dcdab14ul, 0xc696963c7eed2dd1ul },   // 1e74
+		{ 0x8d7eb76070a08aecul, 0xfc1e1de5cf543ca2ul },   // 1e75
+		{ 0xb0de65388cc8ada8ul, 0x3b25a55f43294bcbul },   // 1e76
+		{ 0xdd15fe86affad912ul, 0x49ef0eb713f39ebeul },   // 1e77
+		{ 0x8a2dbf142dfcc7abul, 0x6e3569326c784337ul },   // 1e78
+		{ 0xacb92ed9397bf996ul, 0x49c2c37f07965404ul },   // 1e79
+		{ 0xd7e77a8f87daf7fbul, 0xdc33745ec97be906ul },   // 1e80
+		{ 0x86f0ac99b4e8dafdul, 0x69a028bb3ded71a3ul },   // 1e81
+		{ 0xa8acd7c0222311bcul, 0xc40832ea0d68ce0cul },   // 1e82
+		{ 0xd2d80db02aabd62bul, 0xf50a3fa490c30190ul },   // 1e83
+		{ 0x83c7088e1aab65dbul, 0x792667c6da79e0faul },   // 1e84
+		{ 0xa4b8cab1a1563f52ul, 0x577001b891185938ul },   // 1e85
+		{ 0xcde6fd5e09abcf26ul, 0xed4c0226b55e6f86ul },   // 1e86
+		{ 0x80b05e5ac60b6178ul, 0x544f8158315b05b4ul },   // 1e87
+		{ 0xa0dc75f1778e39d6ul, 0x696361ae3db1c721ul },   // 1e88
+		{ 0xc913936dd571c84cul, 0x03bc3a19cd1e38e9ul },   // 1e89
+		{ 0xfb5878494ace3a5ful, 0x04ab48a04065c723ul },   // 1e90
+		{ 0x9d174b2dcec0e47bul, 0x62eb0d64283f9c76ul },   // 1e91
+		{ 0xc45d1df942711d9aul, 0x3ba5d0bd324f8394ul },   // 1e92
+		{ 0xf5746577930d6500ul, 0xca8f44ec7ee36479ul },   // 1e93
+		{ 0x9968bf6abbe85f20ul, 0x7e998b13cf4e1ecbul },   // 1e94
+		{ 0xbfc2ef456ae276e8ul, 0x9e3fedd8c321a67eul },   // 1e95
+		{ 0xefb3ab16c59b14a2ul, 0xc5cfe94ef3ea101eul },   // 1e96
+		{ 0x95d04aee3b80ece5ul, 0xbba1f1d158724a12ul },   // 1e97
+		{ 0xbb445da9ca61281ful, 0x2a8a6e45ae8edc97ul },   // 1e98
+		{ 0xea1575143cf97226ul, 0xf52d09d71a3293bdul },   // 1e99
+		{ 0x924d692ca61be758ul, 0x593c2626705f9c56ul },   // 1e100
+		{ 0xb6e0c377cfa2e12eul, 0x6f8b2fb00c77836cul },   // 1e101
+		{ 0xe498f455c38b997aul, 0x0b6dfb9c0f956447ul },   // 1e102
+		{ 0x8edf98b59a373fecul, 0x4724bd4189bd5eacul },   // 1e103
+		{ 0xb2977ee300c50fe7ul, 0x58edec91ec2cb657ul },   // 1e104
+		{ 0xdf3d5e9bc0f653e1ul, 0x2f2967b66737e3edul },   // 1e105
+		{ 0x8b865b215899f46cul, 0xbd79e0d20082ee74ul },   // 1e106
+		{ 0xae67f1e9aec07187ul, 0xecd8590680a3aa11ul },   // 1e107
+		{ 0xda01ee641a708de9ul, 0xe80e6f4820cc9495ul },   // 1e108
+		{ 0x884134fe908658b2ul, 0x3109058d147fdcddul },   // 1e109
+		{ 0xaa51823e34a7eedeul, 0xbd4b46f0599fd415ul },   // 1e110
+		{ 0xd4e5e2cdc1d1ea96ul, 0x6c9e18ac7007c91aul },   // 1e111
+		{ 0x850fadc09923329eul, 0x03e2cf6bc604ddb0ul },   // 1e112
+		{ 0xa6539930bf6bff45ul, 0x84db8346b786151cul },   // 1e113
+		{ 0xcfe87f7cef46ff16ul, 0xe612641865679a63ul },   // 1e114
+		{ 0x81f14fae158c5f6eul, 0x4fcb7e8f3f60c07eul },   // 1e115
+		{ 0xa26da3999aef7749ul, 0xe3be5e330f38f09dul },   // 1e116
+		{ 0xcb090c8001ab551cul, 0x5cadf5bfd3072cc5ul },   // 1e117
+		{ 0xfdcb4fa002162a63ul, 0x73d9732fc7c8f7f6ul },   // 1e118
+		{ 0x9e9f11c4014dda7eul, 0x2867e7fddcdd9afaul },   // 1e119
+		{ 0xc646d63501a1511dul, 0xb281e1fd541501b8ul },   // 1e120
+		{ 0xf7d88bc24209a565ul, 0x1f225a7ca91a4226ul },   // 1e121
+		{ 0x9ae757596946075ful, 0x3375788de9b06958ul },   // 1e122
+		{ 0xc1a12d2fc3978937ul, 0x0052d6b1641c83aeul },   // 1e123
+		{ 0xf209787bb47d6b84ul, 0xc0678c5dbd23a49aul },   // 1e124
+		{ 0x9745eb4d50ce6332ul, 0xf840b7ba963646e0ul },   // 1e125
+		{ 0xbd176620a501fbfful, 0xb650e5a93bc3d898ul },   // 1e126
+		{ 0xec5d3fa8ce427afful, 0xa3e51f138ab4cebeul },   // 1e127
+		{ 0x93ba47c980e98cdful, 0xc66f336c36b10137ul },   // 1e128
+		{ 0xb8a8d9bbe123f017ul, 0xb80b0047445d4184ul },   // 1e129
+		{ 0xe6d3102ad96cec1dul, 0xa60dc059157491e5ul },   // 1e130
+		{ 0x9043ea1ac7e41392ul, 0x87c89837ad68db2ful },   // 1e131
+		{ 0xb454e4a179dd1877ul, 0x29babe4598c311fbul },   // 1e132
+		{ 0xe16a1dc9d8545e94ul, 0xf4296dd6fef3d67aul },   // 1e133
+		{ 0x8ce2529e2734bb1dul, 0x1899e4a65f58660cul },   // 1e134
+		{ 0xb01ae745b101e9e4ul, 0x5ec05dcff72e7f8ful },   // 1e135
+		{ 0xdc21a1171d42645dul, 0x76707543f4fa1f73ul },   // 1e136
+		{ 0x899504ae72497ebaul, 0x6a06494a791c53a8ul },   // 1e137
+		{ 0xabfa45da0edbde69ul, 0x0487db9d17636892ul },   // 1e138
+		{ 0xd6f8d7509292d603ul, 0x45a9d2845d3c42b6ul },   // 1e139
+		{ 0x865b86925b9bc5c2ul, 0x0b8a2392ba45a9b2ul },   // 1e140
+		{ 0xa7f26836f282b732ul, 0x8e6cac7768d7141eul },   // 1e141
+		{ 0xd1ef0244af2364fful, 0x3207d795430cd926ul },   // 1e142
+		{ 0x8335616aed761f1ful, 0x7f44e6bd49e807b8ul },   // 1e143
+		{ 0xa402b9c5a8d3a6e7ul, 0x5f16206c9c6209a6ul },   // 1e144
+		{ 0xcd036837130890a1ul, 0x36dba887c37a8c0ful },   // 1e145
+		{ 0x802221226be55a64ul, 0xc2494954da2c9789ul },   // 1e146
+		{ 0xa02aa96b06deb0fdul, 0xf2db9baa10b7bd6cul },   // 1e147
+		{ 0xc83553c5c8965d3dul, 0x6f92829494e5acc7ul },   // 1e148
+		{ 0xfa42a8b73abbf48cul, 0xcb772339ba1f17f9ul },   // 1e149
+		{ 0x9c69a97284b578d7ul, 0xff2a760414536efbul },   // 1e150
+		{ 0xc38413cf25e2d70dul, 0xfef5138519684abaul },   // 1e151
+		{ 0xf46518c2ef5b8cd1ul, 0x7eb258665fc25d69ul },   // 1e152
+		{ 0x98bf2f79d5993802ul, 0xef2f773ffbd97a61ul },   // 1e153
+		{ 0xbeeefb584aff8603ul, 0xaafb550ffacfd8faul },   // 1e154
+		{ 0xeeaaba2e5dbf6784ul, 0x95ba2a53f983cf38ul },   // 1e155
+		{ 0x952ab45cfa97a0b2ul, 0xdd945a747bf26183ul },   // 1e156
+		{ 0xba756174393d88dful, 0x94f971119aeef9e4ul },   // 1e157
+		{ 0xe912b9d1478ceb17ul, 0x7a37cd5601aab85dul },   // 1e158
+		{ 0x91abb422ccb812eeul, 0xac62e055c10ab33aul },   // 1e159
+		{ 0xb616a12b7fe617aaul, 0x577b986b314d6009ul },   // 1e160
+		{ 0xe39c49765fdf9d94ul, 0xed5a7e85fda0b80bul },   // 1e161
+		{ 0x8e41ade9fbebc27dul, 0x14588f13be847307ul },   // 1e162
+		{ 0xb1d219647ae6b31cul, 0x596eb2d8ae258fc8ul },   // 1e163
+		{ 0xde469fbd99a05fe3ul, 0x6fca5f8ed9aef3bbul },   // 1e164
+		{ 0x8aec23d680043beeul, 0x25de7bb9480d5854ul },   // 1e165
+		{ 0xada72ccc20054ae9ul, 0xaf561aa79a10ae6aul },   // 1e166
+		{ 0xd910f7ff28069da4ul, 0x1b2ba1518094da04ul },   // 1e167
+		{ 0x87aa9aff79042286ul, 0x90fb44d2f05d0842ul },   // 1e168
+		{ 0xa99541bf57452b28ul, 0x353a1607ac744a53ul },   // 1e169
+		{ 0xd3fa922f2d1675f2ul, 0x42889b8997915ce8ul },   // 1e170
+		{ 0x847c9b5d7c2e09b7ul, 0x69956135febada11ul },   // 1e171
+		{ 0xa59bc234db398c25ul, 0x43fab9837e699095ul },   // 1e172
+		{ 0xcf02b2c21207ef2eul, 0x94f967e45e03f4bbul },   // 1e173
+		{ 0x8161afb94b44f57dul, 0x1d1be0eebac278f5ul },   // 1e174
+		{ 0xa1ba1ba79e1632dcul, 0x6462d92a69731732ul },   // 1e175
+		{ 0xca28a291859bbf93ul, 0x7d7b8f7503cfdcfeul },   // 1e176
+		{ 0xfcb2cb35e702af78ul, 0x5cda735244c3d43eul },   // 1e177
+		{ 0x9defbf01b061adabul, 0x3a0888136afa64a7ul },   // 1e178
+		{ 0xc56baec21c7a1916ul, 0x088aaa1845b8fdd0ul },   // 1e179
+		{ 0xf6c69a72a3989f5bul, 0x8aad549e57273d45ul },   // 1e180
+		{ 0x9a3c2087a63f6399ul, 0x36ac54e2f678864bul },   // 1e181
+		{ 0xc0cb28a98fcf3c7ful, 0x84576a1bb416a7ddul },   // 1e182
+		{ 0xf0fdf2d3f3c30b9ful, 0x656d44a2a11c51d5ul },   // 1e183
+		{ 0x969eb7c47859e743ul, 0x9f644ae5a4b1b325ul },   // 1e184
+		{ 0xbc4665b596706114ul, 0x873d5d9f0dde1feeul },   // 1e185
+		{ 0xeb57ff22fc0c7959ul, 0xa90cb506d155a7eaul },   // 1e186
+		{ 0x9316ff75dd87cbd8ul, 0x09a7f12442d588f2ul },   // 1e187
+		{ 0xb7dcbf5354e9beceul, 0x0c11ed6d538aeb2ful },   // 1e188
+		{ 0xe5d3ef282a242e81ul, 0x8f1668c8a86da5faul },   // 1e189
+		{ 0x8fa475791a569d10ul, 0xf96e017d694487bcul },   // 1e190
+		{ 0xb38d92d760ec4455ul, 0x37c981dcc395a9acul },   // 1e191
+		{ 0xe070f78d3927556aul, 0x85bbe253f47b1417ul },   // 1e192
+		{ 0x8c469ab843b89562ul, 0x93956d7478ccec8eul },   // 1e193
+		{ 0xaf58416654a6babbul, 0x387ac8d1970027b2ul },   // 1e194
+		{ 0xdb2e51bfe9d0696aul, 0x06997b05fcc0319eul },   // 1e195
+		{ 0x88fcf317f22241e2ul, 0x441fece3bdf81f03ul },   // 1e196
+		{ 0xab3c2fddeeaad25aul, 0xd527e81cad7626c3ul },   // 1e197
+		{ 0xd60b3bd56a5586f1ul, 0x8a71e223d8d3b074ul },   // 1e198
+		{ 0x85c7056562757456ul, 0xf6872d5667844e49ul },   // 1e199
+		{ 0xa738c6bebb12d16cul, 0xb428f8ac016561dbul },   // 1e200
+		{ 0xd106f86e69d785c7ul, 0xe13336d701beba52ul },   // 1e201
+		{ 0x82a45b450226b39cul, 0xecc0024661173473ul },   // 1e202
+		{ 0xa34d721642b06084ul, 0x27f002d7f95d0190ul },   // 1e203
+		{ 0xcc20ce9bd35c78a5ul, 0x31ec038df7b441f4ul },   // 1e204
+		{ 0xff290242c83396ceul, 0x7e67047175a15271ul },   // 1e205
+		{ 0x9f79a169bd203e41ul, 0x0f0062c6e984d386ul },   // 1e206
+		{ 0xc75809c42c684dd1ul, 0x52c07b78a3e60868ul },   // 1e207
+		{ 0xf92e0c3537826145ul, 0xa7709a56ccdf8a82ul },   // 1e208
+		{ 0x9bbcc7a142b17ccbul, 0x88a66076400bb691ul },   // 1e209
+		{ 0xc2abf989935ddbfeul, 0x6acff893d00ea435ul },   // 1e210
+		{ 0xf356f7ebf83552feul, 0x0583f6b8c4124d43ul },   // 1e211
+		{ 0x98165af37b2153deul, 0xc3727a337a8b704aul },   // 1e212
+		{ 0xbe1bf1b059e9a8d6ul, 0x744f18c0592e4c5cul },   // 1e213
+		{ 0xeda2ee1c7064130cul, 0x1162def06f79df73ul },   // 1e214
+		{ 0x9485d4d1c63e8be7ul, 0x8addcb5645ac2ba8ul },   // 1e215
+		{ 0xb9a74a0637ce2ee1ul, 0x6d953e2bd7173692ul },   // 1e216
+		{ 0xe8111c87c5c1ba99ul, 0xc8fa8db6ccdd0437ul },   // 1e217
+		{ 0x910ab1d4db9914a0ul, 0x1d9c9892400a22a2ul },   // 1e218
+		{ 0xb54d5e4a127f59c8ul, 0x2503beb6d00cab4bul },   // 1e219
+		{ 0xe2a0b5dc971f303aul, 0x2e44ae64840fd61dul },   // 1e220
+		{ 0x8da471a9de737e24ul, 0x5ceaecfed289e5d2ul },   // 1e221
+		{ 0xb10d8e1456105dadul, 0x7425a83e872c5f47ul },   // 1e222
+		{ 0xdd50f1996b947518ul, 0xd12f124e28f77719ul },   // 1e223
+		{ 0x8a5296ffe33cc92ful, 0x82bd6b70d99aaa6ful },   // 1e224
+		{ 0xace73cbfdc0bfb7bul, 0x636cc64d1001550bul },   // 1e225
+		{ 0xd8210befd30efa5aul, 0x3c47f7e05401aa4eul },   // 1e226
+		{ 0x8714a775e3e95c78ul, 0x65acfaec34810a71ul },   // 1e227
+		{ 0xa8d9d1535ce3b396ul, 0x7f1839a741a14d0dul },   // 1e228
+		{ 0xd31045a8341ca07cul, 0x1ede48111209a050ul },   // 1e229
+		{ 0x83ea2b892091e44dul, 0x934aed0aab460432ul },   // 1e230
+		{ 0xa4e4b66b68b65d60ul, 0xf81da84d5617853ful },   // 1e231
+		{ 0xce1de40642e3f4b9ul, 0x36251260ab9d668eul },   // 1e232
+		{ 0x80d2ae83e9ce78f3ul, 0xc1d72b7c6b426019ul },   // 1e233
+		{ 0xa1075a24e4421730ul, 0xb24cf65b8612f81ful },   // 1e234
+		{ 0xc94930ae1d529cfcul, 0xdee033f26797b627ul },   // 1e235
+		{ 0xfb9b7cd9a4a7443cul, 0x169840ef017da3b1ul },   // 1e236
+		{ 0x9d412e0806e88aa5ul, 0x8e1f289560ee864eul },   // 1e237
+		{ 0xc491798a08a2ad4eul, 0xf1a6f2bab92a27e2ul },   // 1e238
+		{ 0xf5b5d7ec8acb58a2ul, 0xae10af696774b1dbul },   // 1e239
+		{ 0x9991a6f3d6bf1765ul, 0xacca6da1e0a8ef29ul },   // 1e240
+		{ 0xbff610b0cc6edd3ful, 0x17fd090a58d32af3ul },   // 1e241
+		{ 0xeff394dcff8a948eul, 0xddfc4b4cef07f5b0ul },   // 1e242
+		{ 0x95f83d0a1fb69cd9ul, 0x4abdaf101564f98eul },   // 1e243
+		{ 0xbb764c4ca7a4440ful, 0x9d6d1ad41abe37f1ul },   // 1e244
+		{ 0xea53df5fd18d5513ul, 0x84c86189216dc5edul },   // 1e245
+		{ 0x92746b9be2f8552cul, 0x32fd3cf5b4e49bb4ul },   // 1e246
+		{ 0xb7118682dbb66a77ul, 0x3fbc8c33221dc2a1ul },   // 1e247
+		{ 0xe4d5e82392a40515ul, 0x0fabaf3feaa5334aul },   // 1e248
+		{ 0x8f05b1163ba6832dul, 0x29cb4d87f2a7400eul },   // 1e249
+		{ 0xb2c71d5bca9023f8ul, 0x743e20e9ef511012ul },   // 1e250
+		{ 0xdf78e4b2bd342cf6ul, 0x914da9246b255416ul },   // 1e251
+		{ 0x8bab8eefb6409c1aul, 0x1ad089b6c2f7548eul },   // 1e252
+		{ 0xae9672aba3d0c320ul, 0xa184ac2473b529b1ul },   // 1e253
+		{ 0xda3c0f568cc4f3e8ul, 0xc9e5d72d90a2741eul },   // 1e254
+		{ 0x8865899617fb1871ul, 0x7e2fa67c7a658892ul },   // 1e255
+		{ 0xaa7eebfb9df9de8dul, 0xddbb901b98feeab7ul },   // 1e256
+		{ 0xd51ea6fa85785631ul, 0x552a74227f3ea565ul },   // 1e257
+		{ 0x8533285c936b35deul, 0xd53a88958f87275ful },   // 1e258
+		{ 0xa67ff273b8460356ul, 0x8a892abaf368f137ul },   // 1e259
+		{ 0xd01fef10a657842cul, 0x2d2b7569b0432d85ul },   // 1e260
+		{ 0x8213f56a67f6b29bul, 0x9c3b29620e29fc73ul },   // 1e261
+		{ 0xa298f2c501f45f42ul, 0x8349f3ba91b47b8ful },   // 1e262
+		{ 0xcb3f2f7642717713ul, 0x241c70a936219a73ul },   // 1e263
+		{ 0xfe0efb53d30dd4d7ul, 0xed238cd383aa0110ul },   // 1e264
+		{ 0x9ec95d1463e8a506ul, 0xf4363804324a40aaul },   // 1e265
+		{ 0xc67bb4597ce2ce48ul, 0xb143c6053edcd0d5ul },   // 1e266
+		{ 0xf81aa16fdc1b81daul, 0xdd94b7868e94050aul },   // 1e267
+		{ 0x9b10a4e5e9913128ul, 0xca7cf2b4191c8326ul },   // 1e268
+		{ 0xc1d4ce1f63f57d72ul, 0xfd1c2f611f63a3f0ul },   // 1e269
+		{ 0xf24a01a73cf2dccful, 0xbc633b39673c8cecul },   // 1e270
+		{ 0x976e41088617ca01ul, 0xd5be0503e085d813ul },   // 1e271
+		{ 0xbd49d14aa79dbc82ul, 0x4b2d8644d8a74e18ul },   // 1e272
+		{ 0xec9c459d51852ba2ul, 0xddf8e7d60ed1219eul },   // 1e273
+		{ 0x93e1ab8252f33b45ul, 0xcabb90e5c942b503ul },   // 1e274
+		{ 0xb8da1662e7b00a17ul, 0x3d6a751f3b936243ul },   // 1e275
+		{ 0xe7109bfba19c0c9dul, 0x0cc512670a783ad4ul },   // 1e276
+		{ 0x906a617d450187e2ul, 0x27fb2b80668b24c5ul },   // 1e277
+		{ 0xb484f9dc9641e9daul, 0xb1f9f660802dedf6ul },   // 1e278
+		{ 0xe1a63853bbd26451ul, 0x5e7873f8a0396973ul },   // 1e279
+		{ 0x8d07e33455637eb2ul, 0xdb0b487b6423e1e8ul },   // 1e280
+		{ 0xb049dc016abc5e5ful, 0x91ce1a9a3d2cda62ul },   // 1e281
+		{ 0xdc5c5301c56b75f7ul, 0x7641a140cc7810fbul },   // 1e282
+		{ 0x89b9b3e11b6329baul, 0xa9e904c87fcb0a9dul },   // 1e283
+		{ 0xac2820d9623bf429ul, 0x546345fa9fbdcd44ul },   // 1e284
+		{ 0xd732290fbacaf133ul, 0xa97c177947ad4095ul },   // 1e285
+		{ 0x867f59a9d4bed6c0ul, 0x49ed8eabcccc485dul },   // 1e286
+		{ 0xa81f301449ee8c70ul, 0x5c68f256bfff5a74ul },   // 1e287
+		{ 0xd226fc195c6a2f8cul, 0x73832eec6fff3111ul },   // 1e288
+		{ 0x83585d8fd9c25db7ul, 0xc831fd53c5ff7eabul },   // 1e289
+		{ 0xa42e74f3d032f525ul, 0xba3e7ca8b77f5e55ul },   // 1e290
+		{ 0xcd3a1230c43fb26ful, 0x28ce1bd2e55f35ebul },   // 1e291
+		{ 0x80444b5e7aa7cf85ul, 0x7980d163cf5b81b3ul },   // 1e292
+		{ 0xa0555e361951c366ul, 0xd7e105bcc332621ful },   // 1e293
+		{ 0xc86ab5c39fa63440ul, 0x8dd9472bf3fefaa7ul },   // 1e294
+		{ 0xfa856334878fc150ul, 0xb14f98f6f0feb951ul },   // 1e295
+		{ 0x9c935e00d4b9d8d2ul, 0x6ed1bf9a569f33d3ul },   // 1e296
+		{ 0xc3b8358109e84f07ul, 0x0a862f80ec4700c8ul },   // 1e297
+		{ 0xf4a642e14c6262c8ul, 0xcd27bb612758c0faul },   // 1e298
+		{ 0x98e7e9cccfbd7dbdul, 0x8038d51cb897789cul },   // 1e299
+		{ 0xbf21e44003acdd2cul, 0xe0470a63e6bd56c3ul },   // 1e300
+		{ 0xeeea5d5004981478ul, 0x1858ccfce06cac74ul },   // 1e301
+		{ 0x95527a5202df0ccbul, 0x0f37801e0c43ebc8ul },   // 1e302
+		{ 0xbaa718e68396cffdul, 0xd30560258f54e6baul },   // 1e303
+		{ 0xe950df20247c83fdul, 0x47c6b82ef32a2069ul },   // 1e304
+		{ 0x91d28b7416cdd27eul, 0x4cdc331d57fa5441ul },   // 1e305
+		{ 0xb6472e511c81471dul, 0xe0133fe4adf8e952ul },   // 1e306
+		{ 0xe3d8f9e563a198e5ul, 0x58180fddd97723a6ul },   // 1e307
+		{ 0x8e679c2f5e44ff8ful, 0x570f09eaa7ea7648ul },   // 1e308
+		{ 0xb201833b35d63f73ul, 0x2cd2cc6551e513daul },   // 1e309
+		{ 0xde81e40a034bcf4ful, 0xf8077f7ea65e58d1ul },   // 1e310
+		{ 0x8b112e86420f6191ul, 0xfb04afaf27faf782ul },   // 1e311
+		{ 0xadd57a27d29339f6ul, 0x79c5db9af1f9b563ul },   // 1e312
+		{ 0xd94ad8b1c7380874ul, 0x18375281ae7822bcul },   // 1e313
+		{ 0x87cec76f1c830548ul, 0x8f2293910d0b15b5ul },   // 1e314
+		{ 0xa9c2794ae3a3c69aul, 0xb2eb3875504ddb22ul },   // 1e315
+		{ 0xd433179d9c8cb841ul, 0x5fa60692a46151ebul },   // 1e316
+		{ 0x849feec281d7f328ul, 0xdbc7c41ba6bcd333ul },   // 1e317
+		{ 0xa5c7ea73224deff3ul, 0x12b9b522906c0800ul },   // 1e318
+		{ 0xcf39e50feae16beful, 0xd768226b34870a00ul },   // 1e319
+		{ 0x81842f29f2cce375ul, 0xe6a1158300d46640ul },   // 1e320
+		{ 0xa1e53af46f801c53ul, 0x60495ae3c1097fd0ul },   // 1e321
+		{ 0xca5e89b18b602368ul, 0x385bb19cb14bdfc4ul },   // 1e322
+		{ 0xfcf62c1dee382c42ul, 0x46729e03dd9ed7b5ul },   // 1e323
+		{ 0x9e19db92b4e31ba9ul, 0x6c07a2c26a8346d1ul },   // 1e324
+		{ 0xc5a05277621be293ul, 0xc7098b7305241885ul },   // 1e325
+		{ 0xf70867153aa2db38ul, 0xb8cbee4fc66d1ea7ul },   // 1e326
+		{ 0x9a65406d44a5c903ul, 0x737f74f1dc043328ul },   // 1e327
+		{ 0xc0fe908895cf3b44ul, 0x505f522e53053ff2ul },   // 1e328
+		{ 0xf13e34aabb430a15ul, 0x647726b9e7c68feful },   // 1e329
+		{ 0x96c6e0eab509e64dul, 0x5eca783430dc19f5ul },   // 1e330
+		{ 0xbc789925624c5fe0ul, 0xb67d16413d132072ul },   // 1e331
+		{ 0xeb96bf6ebadf77d8ul, 0xe41c5bd18c57e88ful },   // 1e332
+		{ 0x933e37a534cbaae7ul, 0x8e91b962f7b6f159ul },   // 1e333
+		{ 0xb80dc58e81fe95a1ul, 0x723627bbb5a4adb0ul },   // 1e334
+		{ 0xe61136f2227e3b09ul, 0xcec3b1aaa30dd91cul },   // 1e335
+		{ 0x8fcac257558ee4e6ul, 0x213a4f0aa5e8a7b1ul },   // 1e336
+		{ 0xb3bd72ed2af29e1ful, 0xa988e2cd4f62d19dul },   // 1e337
+		{ 0xe0accfa875af45a7ul, 0x93eb1b80a33b8605ul },   // 1e338
+		{ 0x8c6c01c9498d8b88ul, 0xbc72f130660533c3ul },   // 1e339
+		{ 0xaf87023b9bf0ee6aul, 0xeb8fad7c7f8680b4ul },   // 1e340
+		{ 0xdb68c2ca82ed2a05ul, 0xa67398db9f6820e1ul },   // 1e341
+		{ 0x892179be91d43a43ul, 0x88083f8943a1148cul },   // 1e342
+		{ 0xab69d82e364948d4ul, 0x6a0a4f6b948959b0ul },   // 1e343
+		{ 0xd6444e39c3db9b09ul, 0x848ce34679abb01cul },   // 1e344
+		{ 0x85eab0e41a6940e5ul, 0xf2d80e0c0c0b4e11ul },   // 1e345
+		{ 0xa7655d1d2103911ful, 0x6f8e118f0f0e2195ul },   // 1e346
+		{ 0xd13eb46469447567ul, 0x4b7195f2d2d1a9fbul },   // 1e347
+	};
+
+	/**
+	 * Build the bits of a double.
+	 * @param [in] bits Exponent and mantissa bits.
+	 * @param [in] is_negative If the number is negative.
+	 * @return Double with those bits.
+	 */
+	static inline double64_t double_from_bits(uint64_t bits,
+	                                          bool_t is_negative) noexcept {
+		bits |= static_cast<uint64_t>(is_negative) << 63;
+
+		double64_t number;
+		__builtin_memcpy(&number, &bits, sizeof(number));
+
+		return number;
+	}
+
+	/**
+	 * Round mantissa * 10^exponent to the nearest double with the algorithm of
+	 * Eisel and Lemire: multiply the mantissa by a 128 bits approximation of
+	 * the power of ten, and keep the top bits when the approximation cannot
+	 * change them.
+	 * @param [in] mantissa Decimal digits, not 0.
+	 * @param [in] exponent Power of ten.
+	 * @param [out] bits Exponent and mantissa bits of the double.
+	 * @return True if the bits were found, false when the approximation is
+	 * too close to call, or the result is subnormal or infinite.
+	 */
+	static bool_t eisel_lemire(uint64_t mantissa, ssize_t exponent,
+	                           uint64_t &bits) noexcept {
+		if (exponent < eisel_lemire_min_power
+		    or eisel_lemire_max_power < exponent)
+			return false;
+
+		size_t zeros = count_leading_zeros(mantissa);
+		mantissa <<= zeros;
+		// log2(10) * exponent, plus the 64 bits of the mantissa and the bias.
+		auto binary_exponent
+		    = static_cast<uint64_t>(((217706l * exponent) >> 16) + 64l + 1023l)
+		      - zeros;
+
+		const uint64_t *power
+		    = eisel_lemire_powers[exponent - eisel_lemire_min_power];
+		uint64_t high;
+		uint64_t low = multiply_extended(mantissa, power[0ul], high);
+
+		// The low half of the power could carry into the kept bits.
+		if ((high & 0x1fful) == 0x1fful and low + mantissa < mantissa) {
+			uint64_t wider_high;
+			uint64_t wider_low
+			    = multiply_extended(mantissa, power[1ul], wider_high);
+
+			uint64_t merged_low = low + wider_high;
+			if (merged_low < low)
+				high++;
+			if ((high & 0x1fful) == 0x1fful and merged_low + 1ul == 0ul
+			    and wider_low + mantissa < mantissa)
+				return false;
+			low = merged_low;
+		}
+
+		uint64_t top = high >> 63;
+		uint64_t rounded = high >> (top + 9ul);
+		binary_exponent -= 1ul ^ top;
+
+		// Exactly half way, the dropped bits decide.
+		if (low == 0ul and (high & 0x1fful) == 0ul and (rounded & 3ul) == 1ul)
+			return false;
+
+		rounded += rounded & 1ul;
+		rounded >>= 1;
+		if ((rounded >> 53) != 0ul) {
+			rounded >>= 1;
+			binary_exponent++;
+		}
+
+		if (binary_exponent - 1ul >= 0x7fful - 1ul)
+			return false;
+
+		bits = binary_exponent << 52 | (rounded & 0xffffffffffffful);
+
+		return true;
+	}
+
+
+	/// Digits a big_decimal keeps, enough to round any double.
+	static const size_t big_decimal_digits = 800ul;
+	/// Largest power of two a big_decimal is shifted by at once.
+	static const size_t big_decimal_max_shift = 60ul;
+
+	/**
+	 * Decimal number with many digits, to round the numbers Eisel-Lemire
+	 * cannot. It is scaled by powers of two until its integer part holds the
+	 * bits of the double.
+	 */
+	struct big_decimal {
+		uchar_t digits[big_decimal_digits];   ///< Digit values, first first.
+		size_t count;   ///< Digits in use.
+		ssize_t point;   ///< Digits before the decimal point.
+		bool_t truncated;   ///< If nonzero digits were dropped.
+	};
+
+	/**
+	 * Drop the trailing zeros of a big_decimal.
+	 * @param [in,out] number Decimal to trim.
+	 */
+	static void_t big_decimal_trim(big_decimal &number) noexcept {
+		while (number.count != 0ul and number.digits[number.count - 1ul] == 0)
+			number.count--;
+
+		if (number.count == 0ul)
+			number.point = 0l;
+	}
+
+	/**
+	 * Append a digit to a big_decimal, dropping it when it is full.
+	 * @param [in,out] number Decimal to append to.
+	 * @param [in] digit Digit value.
+	 */
+	static void_t big_decimal_push(big_decimal &number,
+	                               uchar_t digit) noexcept {
+		if (number.count < big_decimal_digits)
+			number.digits[number.count++] = digit;
+		else if (digit != 0)
+			number.truncated = true;
+	}
+
+	/**
+	 * Multiply a big_decimal by a power of two.
+	 * @param [in,out] number Decimal to multiply.
+	 * @param [in] shift Power of two, up to big_decimal_max_shift.
+	 */
+	static void_t big_decimal_left_shift(big_decimal &number,
+	                                     size_t shift) noexcept {
+		// 2^60 adds up to 19 digits, written from the last one backwards.
+		uchar_t shifted[big_decimal_digits + 20ul];
+		size_t first = big_decimal_digits + 20ul;
+
+		uint64_t carry = 0ul;
+		for (size_t i = number.count; i-- > 0ul;) {
+			carry += static_cast<uint64_t>(number.digits[i]) << shift;
+			shifted[--first] = static_cast<uchar_t>(carry % 10ul);
+			carry /= 10ul;
+		}
+		for (; carry != 0ul; carry /= 10ul)
+			shifted[--first] = static_cast<uchar_t>(carry % 10ul);
+
+		size_t produced = big_decimal_digits + 20ul - first;
+		number.point += static_cast<ssize_t>(produced - number.count);
+
+		number.count = 0ul;
+		for (size_t i = 0ul; i < produced; i++)
+			big_decimal_push(number, shifted[first + i]);
+
+		big_decimal_trim(number);
+	}
+
+	/**
+	 * Divide a big_decimal by a power of two.
+	 * @param [in,out] number Decimal to divide.
+	 * @param [in] shift Power of two, up to big_decimal_max_shift.
+	 */
+	static void_t big_decimal_right_shift(big_decimal &number,
+	                                      size_t shift) noexcept {
+		size_t read = 0ul, write = 0ul;
+
+		// Take enough leading digits for the first quotient digit.
+		uint64_t remainder = 0ul;
+		for (; (remainder >> shift) == 0ul; read++) {
+			if (number.count <= read) {
+				if (remainder == 0ul) {
+					number.count = 0ul;
+					number.point = 0l;
+
+					return;
+				}
+
+				for (; (remainder >> shift) == 0ul; read++)
+					remainder *= 10ul;
+				break;
+			}
+
+			remainder = remainder * 10ul + number.digits[read];
+		}
+		number.point -= static_cast<ssize_t>(read) - 1l;
+
+		uint64_t mask = (1ul << shift) - 1ul;
+		for (; read < number.count; read++) {
+			number.digits[write++] = static_cast<uchar_t>(remainder >> shift);
+			remainder = (remainder & mask) * 10ul + number.digits[read];
+		}
+
+		number.count = write;
+		for (; remainder != 0ul; remainder = (remainder & mask) * 10ul)
+			big_decimal_push(number, static_cast<uchar_t>(remainder >> shift));
+
+		big_decimal_trim(number);
+	}
+
+	/**
+	 * Multiply a big_decimal by a power of two.
+	 * @param [in,out] number Decimal to multiply.
+	 * @param [in] shift Power of two, negative to divide.
+	 */
+	static void_t big_decimal_shift(big_decimal &number,
+	                                ssize_t shift) noexcept {
+		if (number.count == 0ul)
+			return;
+
+		auto max_shift = static_cast<ssize_t>(big_decimal_max_shift);
+		for (; max_shift < shift; shift -= max_shift)
+			big_decimal_left_shift(number, big_decimal_max_shift);
+		for (; shift < -max_shift; shift += max_shift)
+			big_decimal_right_shift(number, big_decimal_max_shift);
+
+		if (0l < shift)
+			big_decimal_left_shift(number, static_cast<size_t>(shift));
+		else if (shift < 0l)
+			big_decimal_right_shift(number, static_cast<size_t>(-shift));
+	}
+
+	/**
+	 * Round the integer part of a big_decimal to the nearest, ties to even.
+	 * @param [in] number Decimal to round, below 2^64.
+	 * @return Rounded integer part.
+	 */
+	static uint64_t big_decimal_round(const big_decimal &number) noexcept {
+		// Below 0.1, it rounds to 0.
+		uint64_t integer = 0ul;
+		if (number.point < 0l)
+			return integer;
+
+		auto point = static_cast<size_t>(number.point);
+		for (size_t i = 0ul; i < point; i++)
+			integer = integer * 10ul
+			          + (i < number.count ? number.digits[i] : 0ul);
+
+		if (number.count <= point)
+			return integer;
+
+		// Exactly half way only if nothing follows the 5.
+		bool_t round_up
+		    = number.digits[point] == 5 and point + 1ul == number.count
+		          ? number.truncated or (integer & 1ul) == 1ul
+		          : 5 <= number.digits[point];
+
+		return integer + round_up;
+	}
+
+	/**
+	 * Round a decimal number to the nearest double, from its digits.
+	 * @param [in] parts Parts of the number.
+	 * @return Exponent and mantissa bits of the double.
+	 */
+	static uint64_t big_decimal_to_double(const decimal_parts &parts) noexcept {
+		big_decimal number;
+		number.count = 0ul;
+		number.point = 0l;
+		number.truncated = false;
+
+		for (size_t i = 0ul; i < parts.integer_length; i++) {
+			auto digit = static_cast<uchar_t>(parts.integer[i] - '0');
+			if (number.count == 0ul and digit == 0)
+				continue;
+
+			number.point++;
+			big_decimal_push(number, digit);
+		}
+		for (size_t i = 0ul; i < parts.fraction_length; i++) {
+			auto digit = static_cast<uchar_t>(parts.fraction[i] - '0');
+			if (number.count == 0ul and digit == 0)
+				number.point--;
+			else
+				big_decimal_push(number, digit);
+		}
+		number.point += parts.exponent;
+		big_decimal_trim(number);
+
+		// Zero, or past the smallest subnormal and the largest double.
+		if (number.count == 0ul or number.point < -330l)
+			return 0ul;
+		if (310l < number.point)
+			return 0x7fful << 52;
+
+		// Scale into [0.5, 1), by powers of two that move the decimal point
+		// a digit or more.
+		static const ssize_t point_shifts[] = { 1l, 3l, 6l, 9l, 13l,
+			                                    16l, 19l, 23l, 26l };
+		ssize_t exponent = 0l;
+		while (0l < number.point) {
+			ssize_t shift
+			    = number.point < 9l ? point_shifts[number.point] : 27l;
+			big_decimal_shift(number, -shift);
+			exponent += shift;
+		}
+		while (number.point < 0l
+		       or (number.point == 0l and number.digits[0ul] < 5)) {
+			ssize_t shift
+			    = -number.point < 9l ? point_shifts[-number.point] : 27l;
+			big_decimal_shift(number, shift);
+			exponent -= shift;
+		}
+
+		// Doubles go in [1, 2), subnormals keep the smallest exponent.
+		exponent += 1022l;
+		if (exponent < 1l) {
+			big_decimal_shift(number, exponent - 1l);
+			exponent = 1l;
+		}
+		if (0x7ffl <= exponent)
+			return 0x7fful << 52;
+
+		big_decimal_shift(number, 53l);
+		uint64_t mantissa = big_decimal_round(number);
+		if (mantissa == 1ul << 53) {
+			mantissa >>= 1;
+			if (0x7ffl <= ++exponent)
+				return 0x7fful << 52;
+		}
+		if ((mantissa & (1ul << 52)) == 0ul)
+			exponent = 0l;
+
+		return static_cast<uint64_t>(exponent) << 52
+		       | (mantissa & 0xffffffffffffful);
+	}
+
+	/**
+	 * Round a decimal number to the nearest double: exactly with a single
+	 * double operation when it can, with Eisel-Lemire, and with a big_decimal
+	 * when Eisel-Lemire cannot tell.
+	 * @param [in] parts Parts of the number.
+	 * @return Nearest double, infinity past the largest one.
+	 */
+	static double64_t decimal_to_double(const decimal_parts &parts) noexcept {
+		static const double64_t powers_of_ten[] = {
+			1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+			1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+			1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+
+		// First 19 significant digits, and whether any other was not zero.
+		uint64_t mantissa = 0ul;
+		size_t digits = 0ul;
+		ssize_t exponent = parts.exponent;
+		bool_t truncated = false;
+		for (size_t i = 0ul; i < parts.integer_length; i++) {
+			auto digit = static_cast<uint64_t>(parts.integer[i] - '0');
+			if (digits < 19ul) {
+				mantissa = mantissa * 10ul + digit;
+				digits += mantissa != 0ul;
+			} else {
+				exponent++;
+				truncated = truncated or digit != 0ul;
+			}
+		}
+		for (size_t i = 0ul; i < parts.fraction_length; i++) {
+			auto digit = static_cast<uint64_t>(parts.fraction[i] - '0');
+			if (digits < 19ul) {
+				mantissa = mantissa * 10ul + digit;
+				digits += mantissa != 0ul;
+				exponent--;
+			} else
+				truncated = truncated or digit != 0ul;
+		}
+
+		if (mantissa == 0ul)
+			return double_from_bits(0ul, parts.is_negative);
+
+		// Both the mantissa and the power of ten are exact doubles.
+		if (not truncated and mantissa <= (1ul << 53) and -22l <= exponent
+		    and exponent <= 22l) {
+			auto number = static_cast<double64_t>(mantissa);
+			if (exponent < 0l)
+				number /= powers_of_ten[-exponent];
+			else
+				number *= powers_of_ten[exponent];
+
+			return parts.is_negative ? -number : number;
+		}
+
+		// Dropped digits put the number between both mantissas.
+		uint64_t bits, upper_bits;
+		if (eisel_lemire(mantissa, exponent, bits)
+		    and (not truncated
+		         or (eisel_lemire(mantissa + 1ul, exponent, upper_bits)
+		             and bits == upper_bits)))
+			return double_from_bits(bits, parts.is_negative);
+
+		return double_from_bits(big_decimal_to_double(parts),
+		                        parts.is_negative);
+	}
+
+
 	nullptr_t str_cast_to_null(const_cstring string, size_t length) {
 		if (length == 4u and str_equal(string, "null", 4))
 			return nullptr;
@@ -41,6 +1301,14 @@ namespace stick {
 
 
 	int8_t str_cast_to_int8(const_cstring string, size_t length) {
+		int64_t integer;
+		if (parse_signed_integer(string, length, integer)) {
+			if (stick_int8_MIN > integer or integer > stick_int8_MAX)
+				throw cast_error("Cast number cannot fit in int8 type.");
+
+			return static_cast<int8_t>(integer);
+		}
+
 		double128_t number = str_cast_to_double128(string, length);
 		if (stick_int8_MIN > number or number > stick_int8_MAX)
 			throw cast_error("Cast number cannot fit in int8 type.");
@@ -52,6 +1320,14 @@ namespace stick {
 	}
 
 	int16_t str_cast_to_int16(const_cstring string, size_t length) {
+		int64_t integer;
+		if (parse_signed_integer(string, length, integer)) {
+			if (stick_int16_MIN > integer or integer > stick_int16_MAX)
+				throw cast_error("Cast number cannot fit in int16 type.");
+
+			return static_cast<int16_t>(integer);
+		}
+
 		double128_t number = str_cast_to_double128(string, length);
 		if (stick_int16_MIN > number or number > stick_int16_MAX)
 			throw cast_error("Cast number cannot fit in int16 type.");
@@ -63,6 +1339,14 @@ namespace stick {
 	}
 
 	int32_t str_cast_to_int32(const_cstring string, size_t length) {
+		int64_t integer;
+		if (parse_signed_integer(string, length, integer)) {
+			if (stick_int32_MIN > integer or integer > stick_int32_MAX)
+				throw cast_error("Cast number cannot fit in int32 type.");
+
+			return static_cast<int32_t>(integer);
+		}
+
 		double128_t number = str_cast_to_double128(string, length);
 		if (stick_int32_MIN > number or number > stick_int32_MAX)
 			throw cast_error("Cast number cannot fit in int32 type.");
@@ -74,6 +1358,14 @@ namespace stick {
 	}
 
 	int64_t str_cast_to_int64(const_cstring string, size_t length) {
+		int64_t integer;
+		if (parse_signed_integer(string, length, integer)) {
+			if (stick_int64_MIN > integer or integer > stick_int64_MAX)
+				throw cast_error("Cast number cannot fit in int64 type.");
+
+			return static_cast<int64_t>(integer);
+		}
+
 		double128_t number = str_cast_to_double128(string, length);
 		if (stick_int64_MIN > number or number > stick_int64_MAX)
 			throw cast_error("Cast number cannot fit in int64 type.");
@@ -86,6 +1378,14 @@ namespace stick {
 
 
 	uint8_t str_cast_to_uint8(const_cstring string, size_t length) {
+		uint64_t integer;
+		if (parse_unsigned_integer(string, length, integer)) {
+			if (integer > stick_uint8_MAX)
+				throw cast_error("Cast number cannot fit in uint8 type.");
+
+			return static_cast<uint8_t>(integer);
+		}
+
 		double128_t number = str_cast_to_double128(string, length);
 		if (stick_uint8_MIN > number or number > stick_uint8_MAX)
 			throw cast_error("Cast number cannot fit in uint8 type.");
@@ -97,6 +1397,14 @@ namespace stick {
 	}
 
 	uint16_t str_cast_to_uint16(const_cstring string, size_t length) {
+		uint64_t integer;
+		if (parse_unsigned_integer(string, length, integer)) {
+			if (integer > stick_uint16_MAX)
+				throw cast_error("Cast number cannot fit in uint16 type.");
+
+			return static_cast<uint16_t>(integer);
+		}
+
 		double128_t number = str_cast_to_double128(string, length);
 		if (stick_uint16_MIN > number or number > stick_uint16_MAX)
 			throw cast_error("Cast number cannot fit in uint16 type.");
@@ -108,6 +1416,14 @@ namespace stick {
 	}
 
 	uint32_t str_cast_to_uint32(const_cstring string, size_t length) {
+		uint64_t integer;
+		if (parse_unsigned_integer(string, length, integer)) {
+			if (integer > stick_uint32_MAX)
+				throw cast_error("Cast number cannot fit in uint32 type.");
+
+			return static_cast<uint32_t>(integer);
+		}
+
 		double128_t number = str_cast_to_double128(string, length);
 		if (stick_uint32_MIN > number or number > stick_uint32_MAX)
 			throw cast_error("Cast number cannot fit in uint32 type.");
@@ -119,6 +1435,14 @@ namespace stick {
 	}
 
 	uint64_t str_cast_to_uint64(const_cstring string, size_t length) {
+		uint64_t integer;
+		if (parse_unsigned_integer(string, length, integer)) {
+			if (integer > stick_uint64_MAX)
+				throw cast_error("Cast number cannot fit in uint64 type.");
+
+			return static_cast<uint64_t>(integer);
+		}
+
 		double128_t number = str_cast_to_double128(string, length);
 		if (stick_uint64_MIN > number or number > stick_uint64_MAX)
 			throw cast_error("Cast number cannot fit in uint64 type.");
@@ -131,7 +1455,7 @@ namespace stick {
 
 
 	float32_t str_cast_to_float32(const_cstring string, size_t length) {
-		return static_cast<float32_t>(str_cast_to_double128(string, length));
+		return static_cast<float32_t>(str_cast_to_double64(string, length));
 	}
 	float32_t str_cast_to_float32(const_cstring string) {
 		return str_cast_to_float32(string, str_length(string));
@@ -139,82 +1463,33 @@ namespace stick {
 
 
 	double64_t str_cast_to_double64(const_cstring string, size_t length) {
-		return static_cast<double64_t>(str_cast_to_double128(string, length));
+		return decimal_to_double(split_decimal(string, length));
 	}
 	double64_t str_cast_to_double64(const_cstring string) {
 		return str_cast_to_double64(string, str_length(string));
 	}
 
 	double128_t str_cast_to_double128(const_cstring string, size_t length) {
+		decimal_parts parts = split_decimal(string, length);
 
-		size_t index = 0ul;
-		bool_t is_negative = string[index] == '-';
-		if (is_negative)
-			index++;
-
-		double128_t integer_part = 0.0l;
-		if (string[index] == '0')
-			index++;
-		else if (char_is_numeric(string[index]))
-			do
-				(integer_part *= 10) += string[index++] - '0';
-			while (char_is_numeric(string[index]));
-		else
-			throw cast_error("Given string is not a number. No integer part.");
-
-		double128_t decimal_part = 0.0l;
-		if (string[index] == '.') {
-			index++;
-
-			if (not char_is_numeric(string[index]))
-				throw cast_error(
-				    "Given string is not a number. Expected decimal values.");
+		double128_t number = 0.0l;
+		for (size_t i = 0ul; i < parts.integer_length; i++)
+			(number *= 10) += parts.integer[i] - '0';
 
-			double128_t factor = 0.1l;
-			do {
-				decimal_part += (string[index++] - '0') * factor;
-				factor *= 0.1l;
-			} while (char_is_numeric(string[index]));
+		double128_t factor = 0.1l;
+		for (size_t i = 0ul; i < parts.fraction_length; i++) {
+			number += (parts.fraction[i] - '0') * factor;
+			factor *= 0.1l;
 		}
 
-		uint8_t exponent = 0;
-		bool_t negative_exponent = false;
-		if (string[index] == 'E' or string[index] == 'e') {
-			index++;
-
-			if (string[index] == '+')
-				index++;
-			else if (string[index] == '-') {
-				negative_exponent = true;
-				index++;
-			}
+		// Scaling stops once the number reaches 0 or infinity.
+		for (ssize_t i = 0l; i < parts.exponent and number * 10 != number; i++)
+			number *= 10;
+		for (ssize_t i = 0l; parts.exponent < -i and number / 10 != number;
+		     i++)
+			number /= 10;
 
-			if (string[index] == '0')
-				index++;
-			else if (char_is_numeric(string[index]))
-				do
-					exponent = exponent * 10 + (string[index++] - '0');
-				while (char_is_numeric(string[index]));
-			else
-				throw cast_error(
-				    "Given string is not a number. Invalid exponent.");
-		}
-
-		if (index != length)
-			throw cast_error("Given string is not a number. "
-			                 "Could not be parsed completely.");
-
-		double128_t number = integer_part + decimal_part;
-		if (negative_exponent)
-			for (uint8_t i = 0; i < exponent; i++)
-				number /= 10;
-		else   // positive exponent
-			for (uint8_t i = 0; i < exponent; i++)
-				number *= 10;
-		if (is_negative)
-			number = -number;
-
-		return number;
+		return parts.is_negative ? -number : number;
 	}
 	double128_t str_cast_to_double128(const_cstring string) {
 		return str_cast_to_double128(string, str_length(string));
@@ -9,13 +9,153 @@
 #if defined(_stick_lib_string_cstring_)
 
 
+#	include "../../../include/stick/defines/arch.hpp"
 #	include "../../../include/stick/error/memory_error.hpp"
 #	include "../../../include/stick/memory/management.tpp"
+#	include "../../../include/stick/templates/bit.tpp"
+
+#	if stick_IS_ARCH_x86_64
+#		include <emmintrin.h>
+#	endif
 
 
 namespace stick {
 
 
+#	if stick_IS_ARCH_x86_64
+	/**
+	 * Turn the ASCII upper case letters of 16 characters into lower case.
+	 * @param [in] chunk Characters to turn.
+	 * @return The characters with the letters in lower case.
+	 */
+	static inline __m128i str_chunk_to_lower(__m128i chunk) noexcept {
+		// Upper case letters are the only characters with c - 'A' <= 'Z' - 'A'
+		// as unsigned bytes.
+		__m128i offset = _mm_sub_epi8(chunk, _mm_set1_epi8('A'));
+		__m128i upper_case = _mm_cmpeq_epi8(
+		    _mm_min_epu8(offset, _mm_set1_epi8('Z' - 'A')), offset);
+
+		return _mm_or_si128(chunk,
+		                    _mm_and_si128(upper_case, _mm_set1_epi8(0x20)));
+	}
+
+	/**
+	 * Compare 16 characters of two strings.
+	 * @tparam ignore_case Compare ASCII letters in lower case.
+	 * @param [in] str_1 First 16 characters to compare.
+	 * @param [in] str_2 Second 16 characters to compare.
+	 * @return Bit mask with a bit set for every different character.
+	 */
+	template<bool_t ignore_case>
+	static inline uint32_t str_chunk_mismatch(const_cstring str_1,
+	                                          const_cstring str_2) noexcept {
+		__m128i chunk_1
+		    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str_1));
+		__m128i chunk_2
+		    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str_2));
+		if (ignore_case) {
+			chunk_1 = str_chunk_to_lower(chunk_1);
+			chunk_2 = str_chunk_to_lower(chunk_2);
+		}
+
+		return static_cast<uint32_t>(
+		           _mm_movemask_epi8(_mm_cmpeq_epi8(chunk_1, chunk_2)))
+		       ^ 0xffffu;
+	}
+#	endif
+
+	/**
+	 * Find the first position where two strings differ.
+	 * @tparam ignore_case Compare ASCII letters in lower case.
+	 * @param [in] str_1 First string to compare.
+	 * @param [in] str_2 Second string to compare.
+	 * @param [in] length Length to compare in the strings.
+	 * @return Position of the first different character, length if the
+	 * strings are identical.
+	 */
+	template<bool_t ignore_case>
+	static inline size_t str_find_mismatch(const_cstring str_1,
+	                                       const_cstring str_2,
+	                                       size_t length) noexcept {
+		size_t i = 0ul;
+
+#	if stick_IS_ARCH_x86_64
+		// 64 characters per branch while they match, then find the first
+		// different chunk.
+		for (; i + 64ul <= length; i += 64ul)
+			if ((str_chunk_mismatch<ignore_case>(str_1 + i, str_2 + i)
+			     | str_chunk_mismatch<ignore_case>(str_1 + i + 16ul,
+			                                       str_2 + i + 16ul)
+			     | str_chunk_mismatch<ignore_case>(str_1 + i + 32ul,
+			                                       str_2 + i + 32ul)
+			     | str_chunk_mismatch<ignore_case>(str_1 + i + 48ul,
+			                                       str_2 + i + 48ul))
+			    != 0u)
+				break;
+
+		for (; i + 16ul <= length; i += 16ul) {
+			uint32_t mismatch
+			    = str_chunk_mismatch<ignore_case>(str_1 + i, str_2 + i);
+			if (mismatch != 0u)
+				return i + count_trailing_zeros(mismatch);
+		}
+#	endif
+
+		for (; i < length; i++)
+			if (ignore_case ? char_to_lower(str_1[i]) != char_to_lower(str_2[i])
+			                : str_1[i] != str_2[i])
+				return i;
+
+		return length;
+	}
+	/**
+	 * Find the first position where two null terminated strings differ,
+	 * reading neither past its end.
+	 * @param [in] str_1 First string to compare.
+	 * @param [in] str_2 Second string to compare.
+	 * @return Position of the first different character, the length of the
+	 * first string if the second starts with it.
+	 */
+	static inline size_t str_find_mismatch(const_cstring str_1,
+	                                       const_cstring str_2) noexcept {
+		// A character matching one of the first string is not the end of
+		// the second.
+		size_t i = 0ul;
+		for (; str_1[i] != str_end and str_1[i] == str_2[i]; i++)
+			;
+
+		return i;
+	}
+
+	/**
+	 * Order two strings given the position where they first differ.
+	 * @tparam ignore_case Compare ASCII letters in lower case.
+	 * @param [in] str_1 First string to compare.
+	 * @param [in] length_1 Length of the first string.
+	 * @param [in] str_2 Second string to compare.
+	 * @param [in] length_2 Length of the second string.
+	 * @param [in] position Position of the first different character, the
+	 * shortest length if there is none.
+	 * @return Negative if the first string goes before the second, positive
+	 * if it goes after and 0 if they are identical.
+	 */
+	template<bool_t ignore_case>
+	static inline int32_t str_order(const_cstring str_1, size_t length_1,
+	                                const_cstring str_2, size_t length_2,
+	                                size_t position) noexcept {
+		if (position < length_1 and position < length_2) {
+			auto char_1 = static_cast<uchar_t>(
+			    ignore_case ? char_to_lower(str_1[position]) : str_1[position]);
+			auto char_2 = static_cast<uchar_t>(
+			    ignore_case ? char_to_lower(str_2[position]) : str_2[position]);
+
+			return char_1 < char_2 ? -1 : 1;
+		}
+
+		return length_1 < length_2 ? -1 : (length_2 < length_1 ? 1 : 0);
+	}
+
+
 	cstring new_str(const_cstring str, size_t length) {
 		if (str == nullptr)
 			throw memory_error("Creating string from a nullptr.");
@@ -59,14 +199,13 @@ namespace stick {
 		if (str_1 == nullptr or str_2 == nullptr)
 			throw memory_error("Comparing length of a nullptr string.");
 
-		for (size_t i = 0ul; i < length; i++)
-			if (str_1[i] != str_2[i])
-				return false;
-
-		return true;
+		return str_find_mismatch<false>(str_1, str_2, length) == length;
 	}
 	bool_t str_equal(const_cstring str_1, const_cstring str_2) {
-		return str_equal(str_1, str_2, str_length(str_1));
+		if (str_1 == nullptr or str_2 == nullptr)
+			throw memory_error("Comparing length of a nullptr string.");
+
+		return str_1[str_find_mismatch(str_1, str_2)] == str_end;
 	}
 
 
@@ -74,16 +213,59 @@ namespace stick {
 		if (str_1 == nullptr or str_2 == nullptr)
 			throw memory_error("Checking sort of a nullptr string.");
 
-		for (size_t i = 0ul; i < length; i++)
-			if (str_1[i] < str_2[i])
-				return true;
-			else if (str_1[i] > str_2[i])
-				return false;
-
-		return true;
+		return str_order<false>(str_1, length, str_2, length,
+		                        str_find_mismatch<false>(str_1, str_2, length))
+		       <= 0;
 	}
 	bool_t str_sorted(const_cstring str_1, const_cstring str_2) {
-		return str_sorted(str_1, str_2, str_length(str_1));
+		if (str_1 == nullptr or str_2 == nullptr)
+			throw memory_error("Checking sort of a nullptr string.");
+
+		size_t position = str_find_mismatch(str_1, str_2);
+
+		return str_1[position] == str_end
+		       or static_cast<uchar_t>(str_1[position])
+		              < static_cast<uchar_t>(str_2[position]);
+	}
+
+
+	size_t str_mismatch(const_cstring str_1, const_cstring str_2,
+	                    size_t length) noexcept {
+		return str_find_mismatch<false>(str_1, str_2, length);
+	}
+	size_t str_mismatch_ignore_case(const_cstring str_1, const_cstring str_2,
+	                                size_t length) noexcept {
+		return str_find_mismatch<true>(str_1, str_2, length);
+	}
+
+	bool_t str_equal(const_cstring str_1, size_t length_1, const_cstring str_2,
+	                 size_t length_2) noexcept {
+		return length_1 == length_2
+		       and str_find_mismatch<false>(str_1, str_2, length_1) == length_1;
+	}
+	bool_t str_equal_ignore_case(const_cstring str_1, size_t length_1,
+	                             const_cstring str_2,
+	                             size_t length_2) noexcept {
+		return length_1 == length_2
+		       and str_find_mismatch<true>(str_1, str_2, length_1) == length_1;
+	}
+
+	int32_t str_compare(const_cstring str_1, size_t length_1,
+	                    const_cstring str_2, size_t length_2) noexcept {
+		return str_order<false>(
+		    str_1, length_1, str_2, length_2,
+		    str_find_mismatch<false>(str_1, str_2,
+		                             length_1 < length_2 ? length_1
+		                                                 : length_2));
+	}
+	int32_t str_compare_ignore_case(const_cstring str_1, size_t length_1,
+	                                const_cstring str_2,
+	                                size_t length_2) noexcept {
+		return str_order<true>(
+		    str_1, length_1, str_2, length_2,
+		    str_find_mismatch<true>(str_1, str_2,
+		                            length_1 < length_2 ? length_1
+		                                                : length_2));
 	}
 
 
@@ -93,6 +275,11 @@ namespace stick {
 		else
 			return false;
 	}
+	char_t char_to_lower(const char_t character) noexcept {
+		return 'A' <= character and character <= 'Z'
+		           ? static_cast<char_t>(character + ('a' - 'A'))
+		           : character;
+	}
 
 	bool_t str_is_numeric(const_cstring str, size_t length) {
 		if (str == nullptr)
@@ -0,0 +1,198 @@
+/**
+ * String interning pools implementation.
+ * @brief String interning pools implementation.
+ * @file intern_pool.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../include/stick/string/intern_pool.hpp"
+
+#if defined(_stick_lib_string_intern_pool_)
+
+
+#	include "../../../include/stick/error/out_of_range_error.hpp"
+#	include "../../../include/stick/memory/management.tpp"
+#	include "../../../include/stick/templates/bit.tpp"
+#	include "../../../include/stick/thread/scoped_lock.tpp"
+
+
+namespace stick {
+
+
+	/// Most strings a pool holds, one per handle.
+	static const size_t intern_max_handles = 1ul << 32;
+
+
+	/**
+	 * Copy a string into an arena, after its header.
+	 * @param [in,out] memory Arena of the pool.
+	 * @param [in] text Characters of the string.
+	 * @param [in] handle Handle of the string.
+	 * @throw memory_error when memory cannot be allocated.
+	 * @throw out_of_range_error when every handle is taken.
+	 * @return Stored string.
+	 */
+	static const interned_entry *intern_store(arena &memory,
+	                                          const string_view &text,
+	                                          size_t handle) {
+		if (intern_max_handles <= handle)
+			throw out_of_range_error("Interning more strings than handles.");
+
+		auto entry = static_cast<interned_entry *>(memory.allocate_bytes(
+		    sizeof(interned_entry) + text.length() + 1ul,
+		    alignof(interned_entry)));
+		entry->hash = hasher<string_view>()(text);
+		entry->length = text.length();
+		entry->handle = static_cast<intern_handle>(handle);
+
+		auto characters = reinterpret_cast<cstring>(entry + 1);
+		if (not text.empty())
+			copy(text.data(), characters, text.length());
+		characters[text.length()] = str_end;
+
+		return entry;
+	}
+
+	/**
+	 * Get the block of a concurrent pool holding a handle.
+	 * @param [in] handle Handle of a string.
+	 * @return Index of the block.
+	 */
+	static inline size_t intern_block_of(size_t handle) noexcept {
+		return 63ul
+		       - count_leading_zeros(
+		           static_cast<uint64_t>(handle / intern_block_handles + 1ul));
+	}
+	/**
+	 * Get the first handle of a block of a concurrent pool.
+	 * @param [in] block Index of the block.
+	 * @return First handle of the block.
+	 */
+	static inline size_t intern_block_start(size_t block) noexcept {
+		return intern_block_handles * ((1ul << block) - 1ul);
+	}
+
+
+	interned_string::interned_string(const interned_entry *entry) noexcept
+	    : entry(entry) { }
+
+
+	intern_pool::intern_pool(size_t block_length) noexcept
+	    : memory(block_length) { }
+
+
+	size_t intern_pool::size() const noexcept {
+		return this->strings.size();
+	}
+	size_t intern_pool::reserved_bytes() const noexcept {
+		return this->memory.reserved_bytes();
+	}
+
+
+	interned_string intern_pool::intern(const string_view &text) {
+		const interned_string *found = this->lookup.find(text);
+		if (found != nullptr)
+			return *found;
+
+		interned_string tempy(
+		    intern_store(this->memory, text, this->strings.size()));
+		this->strings.push_back(tempy);
+		try {
+			this->lookup.insert(tempy);
+		} catch (...) {
+			this->strings.pop_back();
+			throw;
+		}
+
+		return tempy;
+	}
+	interned_string intern_pool::find(const string_view &text) const noexcept {
+		const interned_string *found = this->lookup.find(text);
+
+		return found == nullptr ? interned_string() : *found;
+	}
+	interned_string intern_pool::get(intern_handle handle) const {
+		if (this->strings.size() <= handle)
+			throw out_of_range_error("Getting a string not in the pool.");
+
+		return this->strings[static_cast<size_t>(handle)];
+	}
+
+	intern_pool &intern_pool::clear() {
+		this->lookup.clear();
+		this->strings.clear();
+		this->memory.reset();
+
+		return *this;
+	}
+
+
+	concurrent_intern_pool::concurrent_intern_pool(size_t block_length)
+	    : memory(block_length) { }
+
+	concurrent_intern_pool::~concurrent_intern_pool() noexcept {
+		for (auto &block : this->blocks) {
+			const interned_entry **entries = block.load(memory_order::relaxed);
+			if (entries != nullptr)
+				deallocate(entries);
+		}
+	}
+
+
+	size_t concurrent_intern_pool::size() const noexcept {
+		return this->count.load(memory_order::acquire);
+	}
+
+
+	interned_string concurrent_intern_pool::intern(const string_view &text) {
+		interned_string found;
+		if (this->lookup.find(text, found))
+			return found;
+
+		scoped_lock<mutex> guard(this->writer);
+		// Another thread may have stored it while this one waited.
+		if (this->lookup.find(text, found))
+			return found;
+
+		// Only writers change them, and they hold the lock.
+		size_t handle = this->count.load(memory_order::relaxed);
+		interned_string tempy(intern_store(this->memory, text, handle));
+
+		size_t block = intern_block_of(handle);
+		const interned_entry **entries
+		    = this->blocks[block].load(memory_order::relaxed);
+		if (entries == nullptr) {
+			entries = allocate<const interned_entry *>(intern_block_handles
+			                                           << block);
+			this->blocks[block].store(entries, memory_order::release);
+		}
+		entries[handle - intern_block_start(block)] = tempy.entry;
+
+		// Publish the handle first, so whoever finds the string can resolve
+		// its handle.
+		this->count.store(handle + 1ul, memory_order::release);
+		this->lookup.insert(tempy, tempy);
+
+		return tempy;
+	}
+	interned_string
+	concurrent_intern_pool::find(const string_view &text) const {
+		interned_string found;
+		this->lookup.find(text, found);
+
+		return found;
+	}
+	interned_string concurrent_intern_pool::get(intern_handle handle) const {
+		if (this->count.load(memory_order::acquire) <= handle)
+			throw out_of_range_error("Getting a string not in the pool.");
+
+		size_t block = intern_block_of(handle);
+
+		return interned_string(this->blocks[block].load(
+		    memory_order::acquire)[handle - intern_block_start(block)]);
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_string_intern_pool_
@@ -10,47 +10,185 @@
 
 
 #	include "../../../include/stick/string/cstring.hpp"
+#	include "../../../include/stick/thread/atomic.tpp"
+#	include "../../../include/stick/thread/thread_pool.hpp"
 
 
 namespace stick {
 
 
-	string::string() noexcept : data(str_end) { }
+	/// Start positions searched by each task of a parallel find.
+	static const size_t string_find_chunk = 1ul << 20;
+
+
+	/**
+	 * Find where a pattern appears in a text. Boyer-Moore Algorithm will be
+	 * used for wide dictionary size, otherwise Knuth-Morris-Pratt Algorithm
+	 * will be used.
+	 * @param [in] text Text to look within.
+	 * @param [in] text_length Length of the text.
+	 * @param [in] pattern Pattern to look for.
+	 * @param [in] pattern_length Length of the pattern, not 0.
+	 * @param [in] max_matches Max number of matches to look for.
+	 * @param [in] wide_dict If characters pool is varied.
+	 * @param [in] alphabet_size Max ASCII code of possible characters.
+	 * @return Array of the positions where the match was found.
+	 */
+	static array<size_t> string_find(const_cstring text, size_t text_length,
+	                                 const_cstring pattern,
+	                                 size_t pattern_length, size_t max_matches,
+	                                 bool_t wide_dict, size_t alphabet_size) {
+		array<size_t> matches_found;
+		if (text_length < pattern_length or max_matches == 0ul)
+			return matches_found;
+
+		if (wide_dict) {
+			// Implemented using Boyer-Moore Algorithm for String Pattern
+			auto pattern_index = allocate<ssize_t>(alphabet_size);
+			set(pattern_index, -1l, alphabet_size);
+			for (size_t i = 0ul; i < pattern_length; i++)
+				pattern_index[static_cast<uchar_t>(pattern[i])]
+				    = static_cast<ssize_t>(i);
+
+			for (size_t j = 0ul; j <= text_length - pattern_length
+			                     and matches_found.size() < max_matches;) {
+				ssize_t i = static_cast<ssize_t>(pattern_length) - 1;
+				while (i >= 0l
+				       and pattern[i] == text[j + static_cast<size_t>(i)])
+					i--;
+				if (i < 0l) {
+					matches_found.push_back(j);
+					j += j + pattern_length < text_length
+					         ? pattern_length
+					               - static_cast<size_t>(
+					                   pattern_index[static_cast<uchar_t>(
+					                       text[j + pattern_length])])
+					         : 1ul;
+				} else {
+					i -= pattern_index[static_cast<uchar_t>(
+					    text[j + static_cast<size_t>(i)])];
+					j += 1l < i ? static_cast<size_t>(i) : 1ul;
+				}
+			}
+
+			deallocate(pattern_index);
+
+		} else {
+			// Implemented using Knuth-Morris-Pratt Algorithm
+			auto pattern_index = allocate<size_t>(pattern_length);
+			pattern_index[0ul] = 0ul;
+			for (size_t i = 1ul, l = 0ul; i < pattern_length;) {
+				if (pattern[i] == pattern[l])
+					pattern_index[i++] = ++l;
+				else {
+					if (l != 0)
+						l = pattern_index[l - 1];
+					else
+						pattern_index[i++] = 0ul;
+				}
+			}
+
+			for (size_t i = 0ul, j = 0ul;
+			     i < text_length and matches_found.size() < max_matches;) {
+				if (pattern[j] == text[i]) {
+					j++;
+					i++;
+				}
+
+				if (j == pattern_length) {
+					matches_found.push_back(i - j);
+					j = pattern_index[j - 1];
+				} else if (i < text_length and pattern[j] != text[i]) {
+					if (j != 0)
+						j = pattern_index[j - 1];
+					else
+						i++;
+				}
+			}
+
+			deallocate(pattern_index);
+		}
+
+		return matches_found;
+	}
+
+
+	void_t string::own() {
+		if (this->shareable and this->data.shared())
+			this->data = shared_buffer<char_t>(
+			    this->data, this->length() + 1ul, this->available_pool());
+	}
+	void_t string::leak() {
+		// Leaked characters are never shared again, so later calls only read
+		// the flags and threads can use the writable accessors at once.
+		if (this->shareable and not this->leaked) {
+			this->own();
+			this->leaked = true;
+		}
+	}
+
+
+	string::string() noexcept : data(1ul) {
+		this->data[0ul] = str_end;
+	}
 	string::string(const_cstring str, size_t length, size_t pool_length)
-	    : data_size(length), pool(pool_length),
-	      data(str, length, pool_length + 1) {
+	    : data(str, length, pool_length + 1), data_size(length),
+	      pool(pool_length) {
 		this->data[this->length()] = str_end;
 	}
 	string::string(const_cstring str) : string(str, str_length(str)) { }
 	string::string(const char_t c, size_t repetitions, size_t pool_length)
-	    : data_size(repetitions), pool(pool_length),
-	      data(repetitions + pool_length + 1ul) {
+	    : data(repetitions + pool_length + 1ul), data_size(repetitions),
+	      pool(pool_length) {
 		set(this->data.operator char_t *(), c, this->length());
 		this->data[this->length()] = str_end;
 	}
 	string::string(size_t length, size_t pool_length) noexcept
-	    : data_size(0ul), pool(pool_length), data(length + pool_length + 1) {
+	    : data(length + pool_length + 1), data_size(0ul), pool(pool_length) {
 		this->data[0ul] = str_end;
 	}
+	string::string(const string &str) noexcept
+	    : data_size(str.data_size), pool(str.pool), shareable(str.shareable) {
+		// Leaked characters may be written through pointers held elsewhere.
+		if ((str.shareable and not str.leaked) or str.data.is_null())
+			this->data = str.data;
+		else
+			this->data = shared_buffer<char_t>(str.data, str.length() + 1ul,
+			                                   str.available_pool());
+	}
 
 	string::~string() noexcept {
-		this->data = allocate_value(str_end);
+		this->data.reset();
 		this->data_size = 0ul;
 		this->pool = 0ul;
 	}
 
 
-	char_t *string::begin() const noexcept {
+	const_cstring string::begin() const noexcept {
+		return this->data;
+	}
+	cstring string::begin() {
+		this->leak();
+
 		return this->data;
 	}
-	char_t *string::end() const noexcept {
+	const_cstring string::end() const noexcept {
 		return this->data + this->length();
 	}
+	cstring string::end() {
+		return this->begin() + this->length();
+	}
 
-	char_t *string::rbegin() const noexcept {
+	const_cstring string::rbegin() const noexcept {
+		return this->end() - 1ul;
+	}
+	cstring string::rbegin() {
 		return this->end() - 1ul;
 	}
-	char_t *string::rend() const noexcept {
+	const_cstring string::rend() const noexcept {
+		return this->begin() - 1ul;
+	}
+	cstring string::rend() {
 		return this->begin() - 1ul;
 	}
 
@@ -59,7 +197,7 @@ namespace stick {
 		return this->data_size;
 	}
 	size_t string::allocated_chars() const noexcept {
-		return this->data.allocated_elems();
+		return this->data.capacity();
 	}
 
 	size_t string::available_pool() const noexcept {
@@ -77,12 +215,23 @@ namespace stick {
 		return *this;
 	}
 
+	string &string::share() noexcept {
+		this->shareable = true;
+
+		return *this;
+	}
+	bool_t string::is_shareable() const noexcept {
+		return this->shareable;
+	}
+
 
 	string &string::expand(size_t length) noexcept {
-		scoped_pointer<char_t> tempy(data.allocated_elems() + length);
+		shared_buffer<char_t> tempy(this->allocated_chars() + length);
 		str_copy(this->data, this->length(), tempy);
 
+		// Pointers handed out before point to the old characters.
 		this->data = move(tempy);
+		this->leaked = false;
 
 		return *this;
 	}
@@ -100,9 +249,10 @@ namespace stick {
 		if (this->length() + size == 0ul)
 			*this = move(string());
 		else {
-			scoped_pointer<char_t> tempy(this->data, this->length(),
-			                             size + 1ul);
+			shared_buffer<char_t> tempy(this->data, this->length() + 1ul,
+			                            size);
 			this->data = move(tempy);
+			this->leaked = false;
 		}
 
 		return *this;
@@ -112,8 +262,10 @@ namespace stick {
 	string &string::append(const_cstring str, size_t length) {
 		if (this->available_pool() < length)
 			this->expand(length - this->available_pool() + this->pool);
+		else
+			this->own();
 
-		str_copy(str, length, this->end());
+		str_copy(str, length, this->data + this->length());
 		this->data_size += length;
 
 		return *this;
@@ -130,11 +282,12 @@ namespace stick {
 
 	string &string::preppend(const_cstring str, size_t length) {
 		if (this->available_pool() < length) {
-			scoped_pointer<char_t> tempy(
-			    str, length, this->length() + this->available_pool() + pool);
-			str_copy(this->data, this->length(), &tempy[length], false);
+			shared_buffer<char_t> tempy(str, length,
+			                            this->allocated_chars() + this->pool);
+			str_copy(this->data, this->length(), &tempy[length]);
 			this->data = move(tempy);
 		} else {
+			this->own();
 			str_move(this->data, this->length(), &this->data[length], true,
 			         false);
 			str_copy(str, length, this->data, true);
@@ -152,6 +305,7 @@ namespace stick {
 
 
 	string &string::clear() noexcept {
+		this->own();
 		this->data[0ul] = str_end;
 		this->data_size = 0ul;
 
@@ -194,6 +348,7 @@ namespace stick {
 		if (max_length < this->length() - start_position)
 			max_length = this->length() - start_position;
 
+		this->own();
 		str_copy(&this->data[start_position], max_length, this->data);
 
 		return *this;
@@ -215,11 +370,7 @@ namespace stick {
 	}
 
 	string &string::reverse() noexcept {
-		string reversed_str(this->length());
-		for (auto c = this->rbegin(); c != this->rend(); c--)
-			reversed_str.append(*c);
-
-		return *this = move(reversed_str);
+		return *this = this->mirror();
 	}
 
 
@@ -232,92 +383,145 @@ namespace stick {
 		if (this->length() == 0 or pattern_length == 0)
 			return {};
 
+		return string_find(this->data, this->length(), pattern,
+		                   pattern_length, max_matches, wide_dict,
+		                   alphabet_size);
+	}
+	array<size_t> string::find(const_cstring pattern, size_t max_matches,
+	                           bool_t wide_dict, size_t alphabet_size) const {
+		return this->find(pattern, str_length(pattern), max_matches, wide_dict,
+		                  alphabet_size);
+	}
+	array<size_t> string::find(const string &pattern, size_t max_matches,
+	                           bool_t wide_dict,
+	                           size_t alphabet_size) const noexcept {
+		return this->find(pattern, pattern.length(), max_matches, wide_dict,
+		                  alphabet_size);
+	}
 
-		size_t max_possible_matches = this->length() - pattern_length + 1;
-		if (max_matches > max_possible_matches)
-			max_matches = max_possible_matches;
-
-		array<size_t> matches_found(max_matches);
+	array<size_t> string::find_parallel(const_cstring pattern,
+	                                    size_t pattern_length,
+	                                    size_t max_matches, bool_t wide_dict,
+	                                    size_t alphabet_size,
+	                                    thread_pool &pool) const {
+		if (this->data == nullptr or pattern == nullptr)
+			throw memory_error("Finding a/in a nullptr.");
 
-		if (wide_dict) {
-			// Implemented using Boyer-Moore Algorithm for String Pattern
-			auto pattern_index = allocate<ssize_t>(alphabet_size);
-			set(pattern_index, -1l, alphabet_size);
-			for (size_t i = 0ul; i < pattern_length; i++)
-				pattern_index[static_cast<uchar_t>(pattern[i])]
-				    = static_cast<ssize_t>(i);
+		if (this->length() < pattern_length or pattern_length == 0
+		    or max_matches == 0)
+			return {};
 
-			for (size_t j = 0ul; j <= this->length() - pattern_length
-			                     and matches_found.size() < max_matches;) {
-				ssize_t i = static_cast<ssize_t>(pattern_length) - 1;
-				while (i >= 0l
-				       and pattern[i] == this->data[j + static_cast<size_t>(i)])
-					i--;
-				if (i < 0l) {
-					matches_found.push_back(j);
-					j += j + pattern_length < this->length()
-					         ? pattern_length
-					               - static_cast<size_t>(
-					                   pattern_index[static_cast<uchar_t>(
-					                       this->data[j + pattern_length])])
-					         : 1ul;
-				} else {
-					i -= pattern_index[static_cast<uchar_t>(
-					    this->data[j + static_cast<size_t>(i)])];
-					j += 1l < i ? static_cast<size_t>(i) : 1ul;
+		const_cstring text = this->data;
+		size_t starts = this->length() - pattern_length + 1ul;
+		size_t chunks = (starts + string_find_chunk - 1ul) / string_find_chunk;
+		if (chunks == 1ul)
+			return string_find(text, this->length(), pattern, pattern_length,
+			                   max_matches, wide_dict, alphabet_size);
+
+		// Matches of each chunk, and how many once it is done.
+		array<array<size_t>> found(chunks);
+		for (size_t k = 0ul; k < chunks; k++)
+			found.emplace_back();
+		auto counts = allocate<atomic<size_t>>(chunks);
+		for (size_t k = 0ul; k < chunks; k++)
+			counts[k].store(-1ul, memory_order::relaxed);
+
+		atomic<size_t> next;   // Next chunk to search.
+		atomic<size_t> cutoff(chunks);   // Chunks from here on are not needed.
+		size_t prefix = 0ul;   // Leading chunks already counted.
+		size_t prefix_matches = 0ul;   // Matches in those chunks.
+		atomic<bool_t> counting;   // Whether a thread is counting.
+
+		auto search = [&]() {
+			for (size_t k; (k = next.fetch_add(1ul, memory_order::relaxed))
+			               < cutoff.load(memory_order::relaxed);) {
+				size_t first = k * string_find_chunk;
+				size_t last = first + string_find_chunk + pattern_length - 1ul;
+				if (last > this->length())
+					last = this->length();
+
+				// Matches starting in the chunk fit in the chunk plus the
+				// pattern length - 1 that overlaps the next one, and no match
+				// starting in the next one fits.
+				found[k] = string_find(text + first, last - first, pattern,
+				                       pattern_length, max_matches, wide_dict,
+				                       alphabet_size);
+				for (auto &position : found[k])
+					position += first;
+				counts[k].store(found[k].size(), memory_order::release);
+
+				// Once the leading chunks hold enough matches, the rest can be
+				// skipped. Best effort: a count missed here is seen when the
+				// next chunk ends.
+				if (counting.exchange(true, memory_order::acquire))
+					continue;
+
+				size_t count;
+				while (prefix_matches < max_matches and prefix < chunks
+				       and (count = counts[prefix].load(memory_order::acquire))
+				               != -1ul) {
+					prefix_matches += count;
+					if (++prefix < chunks and prefix_matches >= max_matches)
+						cutoff.store(prefix, memory_order::relaxed);
 				}
-			}
-
-			deallocate(pattern_index);
 
-		} else {
-			// Implemented using Knuth-Morris-Pratt Algorithm
-			auto pattern_index = allocate<size_t>(pattern_length);
-			for (size_t i = 1ul, l = 0ul; i <= pattern_length;) {
-				if (pattern[i] == pattern[l])
-					pattern_index[i++] = ++l;
-				else {
-					if (l != 0)
-						l = pattern_index[l - 1];
-					else
-						pattern_index[i++] = 0ul;
-				}
+				counting.store(false, memory_order::release);
 			}
-			pattern_index[0] = 0ul;
+		};
+
+		try {
+			task_group group(pool);
+			for (size_t i = 0ul; i < pool.size() and i + 1ul < chunks; i++)
+				group.run(search);
+			search();
+			group.wait();
+		} catch (...) {
+			deallocate(counts);
+			throw;
+		}
+		deallocate(counts);
+
+		size_t searched = cutoff.load(memory_order::relaxed);
+		size_t total = 0ul;
+		for (size_t k = 0ul; k < searched; k++)
+			total += found[k].size();
+		if (total > max_matches)
+			total = max_matches;
+		if (total == 0ul)
+			return {};
 
-			for (size_t i = 0ul, j = 0ul;
-			     i < this->length() and matches_found.size() < max_matches;) {
-				if (pattern[j] == this->data[i]) {
-					j++;
-					i++;
-				}
+		array<size_t> matches_found(total);
+		for (size_t k = 0ul; k < searched; k++)
+			for (auto position : found[k]) {
+				if (matches_found.size() == total)
+					return matches_found;
 
-				if (j == pattern_length) {
-					matches_found.push_back(i - j);
-					j = pattern_index[j - 1];
-				} else if (i < this->length() and pattern[j] != this->data[i]) {
-					if (j != 0)
-						j = pattern_index[j - 1];
-					else
-						i++;
-				}
+				matches_found.push_back(position);
 			}
 
-			deallocate(pattern_index);
-		}
-
-		return matches_found.compact();
+		return matches_found;
 	}
-	array<size_t> string::find(const_cstring pattern, size_t max_matches,
-	                           bool_t wide_dict, size_t alphabet_size) const {
-		return this->find(pattern, str_length(pattern), max_matches, wide_dict,
-		                  alphabet_size);
+	array<size_t> string::find_parallel(const string &pattern,
+	                                    size_t max_matches, bool_t wide_dict,
+	                                    size_t alphabet_size,
+	                                    thread_pool &pool) const {
+		return this->find_parallel(pattern, pattern.length(), max_matches,
+		                           wide_dict, alphabet_size, pool);
 	}
-	array<size_t> string::find(const string &pattern, size_t max_matches,
-	                           bool_t wide_dict,
-	                           size_t alphabet_size) const noexcept {
-		return this->find(pattern, pattern.length(), max_matches, wide_dict,
-		                  alphabet_size);
+	array<size_t> string::find_parallel(const_cstring pattern,
+	                                    size_t pattern_length,
+	                                    size_t max_matches, bool_t wide_dict,
+	                                    size_t alphabet_size) const {
+		return this->find_parallel(pattern, pattern_length, max_matches,
+		                           wide_dict, alphabet_size,
+		                           thread_pool::shared());
+	}
+	array<size_t> string::find_parallel(const string &pattern,
+	                                    size_t max_matches, bool_t wide_dict,
+	                                    size_t alphabet_size) const {
+		return this->find_parallel(pattern, pattern.length(), max_matches,
+		                           wide_dict, alphabet_size,
+		                           thread_pool::shared());
 	}
 
 
@@ -356,6 +560,7 @@ namespace stick {
 
 		} else {
 
+			this->own();
 			if (replacement_length < pattern_length) {
 				for (size_t i = 0ul, offset; i < matches.size() - 1ul; i++) {
 					offset = i * (pattern_length - replacement_length);
@@ -405,6 +610,19 @@ namespace stick {
 	}
 
 
+	int32_t string::compare(const string &str) const noexcept {
+		return str_compare(this->data, this->length(), str.data, str.length());
+	}
+	bool_t string::equal_ignore_case(const string &str) const noexcept {
+		return str_equal_ignore_case(this->data, this->length(), str.data,
+		                             str.length());
+	}
+	int32_t string::compare_ignore_case(const string &str) const noexcept {
+		return str_compare_ignore_case(this->data, this->length(), str.data,
+		                               str.length());
+	}
+
+
 	string string::operator+(const_cstring str) const {
 		return string(*this).append(str);
 	}
@@ -422,41 +640,66 @@ namespace stick {
 	string &string::operator=(const_cstring str) noexcept {
 		size_t length = str_length(str);
 
-		if (length > this->length())
-			this->data = scoped_pointer<char_t>(length + this->pool);
-
+		if (this->allocated_chars() < length + 1ul)
+			this->data = shared_buffer<char_t>(length + this->pool + 1ul);
+		else
+			this->own();
 
 		this->data_size = length;
 		str_copy(str, this->length(), this->data);
 
 		return *this;
 	}
+	string &string::operator=(const string &str) noexcept {
+		if (&str == this)
+			return *this;
+
+		string tempy(str);
+
+		return *this = move(tempy);
+	}
 	string &string::operator=(string &&str) noexcept {
 		this->data_size = str.data_size;
 		this->pool = str.pool;
+		this->shareable = str.shareable;
+		this->leaked = str.leaked;
 		this->data = move(str.data);
 
 		str.data_size = 0ul;
 		str.pool = 0ul;
+		str.shareable = false;
+		str.leaked = false;
 
 		return *this;
 	}
 
 	bool_t string::operator==(const string &str) const noexcept {
-		for (size_t i = 0ul; i < this->length(); i++)
-			if (this->data[i] != str[i])
-				return false;
-
-		return true;
+		return str_equal(this->data, this->length(), str.data, str.length());
 	}
 
 	bool_t string::operator!=(const string &str) const noexcept {
 		return not this->operator==(str);
 	}
 
-	string::operator cstring() const noexcept {
+	bool_t string::operator<(const string &str) const noexcept {
+		return this->compare(str) < 0;
+	}
+	bool_t string::operator<=(const string &str) const noexcept {
+		return this->compare(str) <= 0;
+	}
+	bool_t string::operator>(const string &str) const noexcept {
+		return this->compare(str) > 0;
+	}
+	bool_t string::operator>=(const string &str) const noexcept {
+		return this->compare(str) >= 0;
+	}
+
+	string::operator const_cstring() const noexcept {
 		return this->data;
 	}
+	string::operator cstring() {
+		return this->begin();
+	}
 
 
 }   // namespace stick
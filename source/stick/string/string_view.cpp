@@ -0,0 +1,111 @@
+/**
+ * Non-owning view over a sequence of characters implementation.
+ * @brief String view class implementation.
+ * @file string_view.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../include/stick/string/string_view.hpp"
+
+#if defined(_stick_lib_string_string_view_)
+
+
+#	include "../../../include/stick/error/out_of_range_error.hpp"
+#	include "../../../include/stick/string/cstring.hpp"
+#	include "../../../include/stick/string/string.hpp"
+
+
+namespace stick {
+
+
+	string_view::string_view(const_cstring str, size_t length) noexcept
+	    : str(str), str_length(length) { }
+	string_view::string_view(const_cstring str)
+	    : str(str), str_length(stick::str_length(str)) { }
+	string_view::string_view(const string &str) noexcept
+	    : str(str), str_length(str.length()) { }
+
+
+	const_cstring string_view::begin() const noexcept {
+		return this->str;
+	}
+	const_cstring string_view::end() const noexcept {
+		return this->str + this->str_length;
+	}
+
+
+	const_cstring string_view::data() const noexcept {
+		return this->str;
+	}
+	size_t string_view::length() const noexcept {
+		return this->str_length;
+	}
+	bool_t string_view::empty() const noexcept {
+		return this->str_length == 0ul;
+	}
+
+
+	string_view string_view::substr(size_t start_position,
+	                                size_t max_length) const {
+		if (this->length() < start_position)
+			throw out_of_range_error("Viewing outside the string_view.");
+
+		if (max_length > this->length() - start_position)
+			max_length = this->length() - start_position;
+
+		return { this->str + start_position, max_length };
+	}
+
+
+	int32_t string_view::compare(const string_view &str) const noexcept {
+		return str_compare(this->str, this->length(), str.str, str.length());
+	}
+	bool_t
+	string_view::equal_ignore_case(const string_view &str) const noexcept {
+		return str_equal_ignore_case(this->str, this->length(), str.str,
+		                             str.length());
+	}
+	int32_t
+	string_view::compare_ignore_case(const string_view &str) const noexcept {
+		return str_compare_ignore_case(this->str, this->length(), str.str,
+		                               str.length());
+	}
+
+
+	char_t string_view::operator[](size_t position) const {
+		if (this->length() <= position)
+			throw out_of_range_error("Accessing a char outside the view.");
+
+		return this->str[position];
+	}
+
+	bool_t string_view::operator==(const string_view &str) const noexcept {
+		return str_equal(this->str, this->length(), str.str, str.length());
+	}
+	bool_t string_view::operator!=(const string_view &str) const noexcept {
+		return not this->operator==(str);
+	}
+	bool_t string_view::operator<(const string_view &str) const noexcept {
+		return this->compare(str) < 0;
+	}
+	bool_t string_view::operator<=(const string_view &str) const noexcept {
+		return this->compare(str) <= 0;
+	}
+	bool_t string_view::operator>(const string_view &str) const noexcept {
+		return this->compare(str) > 0;
+	}
+	bool_t string_view::operator>=(const string_view &str) const noexcept {
+		return this->compare(str) >= 0;
+	}
+
+	string_view::operator string() const noexcept {
+		if (this->empty())
+			return {};
+
+		return { this->str, this->str_length };
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_string_string_view_
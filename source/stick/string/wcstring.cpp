@@ -9,13 +9,121 @@
 #if defined(_stick_lib_string_wcstring_)
 
 
+#	include "../../../include/stick/defines/arch.hpp"
 #	include "../../../include/stick/error/memory_error.hpp"
 #	include "../../../include/stick/memory/management.tpp"
+#	include "../../../include/stick/string/cstring.hpp"
+#	include "../../../include/stick/templates/bit.tpp"
+
+#	if stick_IS_ARCH_x86_64
+#		include <emmintrin.h>
+#	endif
 
 
 namespace stick {
 
 
+	/**
+	 * Find the first position where two strings differ, ignoring the case of
+	 * ASCII letters.
+	 * @param [in] str_1 First string to compare.
+	 * @param [in] str_2 Second string to compare.
+	 * @param [in] length Length to compare in the strings.
+	 * @return Position of the first different character, length if the
+	 * strings are identical.
+	 */
+	static inline size_t wstr_find_mismatch_ignore_case(
+	    const_wcstring str_1, const_wcstring str_2, size_t length) noexcept {
+		size_t i = 0ul;
+
+#	if stick_IS_ARCH_x86_64
+		// 4 characters at a time where they are 32 bits wide.
+		if (sizeof(wchar_t) == 4ul) {
+			const __m128i first_letter = _mm_set1_epi32(L'A' - 1);
+			const __m128i last_letter = _mm_set1_epi32(L'Z' + 1);
+			const __m128i lower_case = _mm_set1_epi32(L'a' - L'A');
+
+			for (; i + 4ul <= length; i += 4ul) {
+				__m128i chunk_1 = _mm_loadu_si128(
+				    reinterpret_cast<const __m128i *>(str_1 + i));
+				__m128i chunk_2 = _mm_loadu_si128(
+				    reinterpret_cast<const __m128i *>(str_2 + i));
+				chunk_1 = _mm_or_si128(
+				    chunk_1,
+				    _mm_and_si128(
+				        _mm_and_si128(_mm_cmpgt_epi32(chunk_1, first_letter),
+				                      _mm_cmplt_epi32(chunk_1, last_letter)),
+				        lower_case));
+				chunk_2 = _mm_or_si128(
+				    chunk_2,
+				    _mm_and_si128(
+				        _mm_and_si128(_mm_cmpgt_epi32(chunk_2, first_letter),
+				                      _mm_cmplt_epi32(chunk_2, last_letter)),
+				        lower_case));
+
+				auto mismatch = static_cast<uint32_t>(_mm_movemask_epi8(
+				                    _mm_cmpeq_epi32(chunk_1, chunk_2)))
+				                ^ 0xffffu;
+				if (mismatch != 0u)
+					return i + count_trailing_zeros(mismatch) / 4ul;
+			}
+		}
+#	endif
+
+		for (; i < length; i++)
+			if (wchar_to_lower(str_1[i]) != wchar_to_lower(str_2[i]))
+				return i;
+
+		return length;
+	}
+	/**
+	 * Find the first position where two null terminated strings differ,
+	 * reading neither past its end.
+	 * @param [in] str_1 First string to compare.
+	 * @param [in] str_2 Second string to compare.
+	 * @return Position of the first different character, the length of the
+	 * first string if the second starts with it.
+	 */
+	static inline size_t wstr_find_mismatch(const_wcstring str_1,
+	                                        const_wcstring str_2) noexcept {
+		// A character matching one of the first string is not the end of
+		// the second.
+		size_t i = 0ul;
+		for (; str_1[i] != wstr_end and str_1[i] == str_2[i]; i++)
+			;
+
+		return i;
+	}
+
+	/**
+	 * Order two strings given the position where they first differ.
+	 * @param [in] str_1 First string to compare.
+	 * @param [in] length_1 Length of the first string.
+	 * @param [in] str_2 Second string to compare.
+	 * @param [in] length_2 Length of the second string.
+	 * @param [in] position Position of the first different character, the
+	 * shortest length if there is none.
+	 * @param [in] ignore_case Compare ASCII letters in lower case.
+	 * @return Negative if the first string goes before the second, positive
+	 * if it goes after and 0 if they are identical.
+	 */
+	static inline int32_t wstr_order(const_wcstring str_1, size_t length_1,
+	                                 const_wcstring str_2, size_t length_2,
+	                                 size_t position,
+	                                 bool_t ignore_case) noexcept {
+		if (position < length_1 and position < length_2) {
+			wchar_t char_1 = ignore_case ? wchar_to_lower(str_1[position])
+			                             : str_1[position];
+			wchar_t char_2 = ignore_case ? wchar_to_lower(str_2[position])
+			                             : str_2[position];
+
+			return char_1 < char_2 ? -1 : 1;
+		}
+
+		return length_1 < length_2 ? -1 : (length_2 < length_1 ? 1 : 0);
+	}
+
+
 	wcstring new_wstr(const_wcstring str, size_t length) {
 		if (str == nullptr)
 			throw memory_error("Creating string from a nullptr.");
@@ -60,14 +168,13 @@ namespace stick {
 		if (str_1 == nullptr or str_2 == nullptr)
 			throw memory_error("Comparing length of a nullptr string.");
 
-		for (size_t i = 0ul; i < length; i++)
-			if (str_1[i] != str_2[i])
-				return false;
-
-		return true;
+		return wstr_mismatch(str_1, str_2, length) == length;
 	}
 	bool_t wstr_equal(const_wcstring str_1, const_wcstring str_2) {
-		return wstr_equal(str_1, str_2, wstr_length(str_1));
+		if (str_1 == nullptr or str_2 == nullptr)
+			throw memory_error("Comparing length of a nullptr string.");
+
+		return str_1[wstr_find_mismatch(str_1, str_2)] == wstr_end;
 	}
 
 
@@ -76,16 +183,65 @@ namespace stick {
 		if (str_1 == nullptr or str_2 == nullptr)
 			throw memory_error("Checking sort of a nullptr string.");
 
-		for (size_t i = 0ul; i < length; i++)
-			if (str_1[i] < str_2[i])
-				return true;
-			else if (str_1[i] > str_2[i])
-				return false;
-
-		return true;
+		return wstr_order(str_1, length, str_2, length,
+		                  wstr_mismatch(str_1, str_2, length), false)
+		       <= 0;
 	}
 	bool_t wstr_sorted(const_wcstring str_1, const_wcstring str_2) {
-		return wstr_sorted(str_1, str_2, wstr_length(str_1));
+		if (str_1 == nullptr or str_2 == nullptr)
+			throw memory_error("Checking sort of a nullptr string.");
+
+		size_t position = wstr_find_mismatch(str_1, str_2);
+
+		return str_1[position] == wstr_end
+		       or str_1[position] < str_2[position];
+	}
+
+
+	size_t wstr_mismatch(const_wcstring str_1, const_wcstring str_2,
+	                     size_t length) noexcept {
+		// Equality does not care about the width of the characters, the
+		// first different byte is in the first different character.
+		return str_mismatch(reinterpret_cast<const_cstring>(str_1),
+		                    reinterpret_cast<const_cstring>(str_2),
+		                    length * sizeof(wchar_t))
+		       / sizeof(wchar_t);
+	}
+	size_t wstr_mismatch_ignore_case(const_wcstring str_1,
+	                                 const_wcstring str_2,
+	                                 size_t length) noexcept {
+		return wstr_find_mismatch_ignore_case(str_1, str_2, length);
+	}
+
+	bool_t wstr_equal(const_wcstring str_1, size_t length_1,
+	                  const_wcstring str_2, size_t length_2) noexcept {
+		return length_1 == length_2
+		       and wstr_mismatch(str_1, str_2, length_1) == length_1;
+	}
+	bool_t wstr_equal_ignore_case(const_wcstring str_1, size_t length_1,
+	                              const_wcstring str_2,
+	                              size_t length_2) noexcept {
+		return length_1 == length_2
+		       and wstr_find_mismatch_ignore_case(str_1, str_2, length_1)
+		               == length_1;
+	}
+
+	int32_t wstr_compare(const_wcstring str_1, size_t length_1,
+	                     const_wcstring str_2, size_t length_2) noexcept {
+		return wstr_order(
+		    str_1, length_1, str_2, length_2,
+		    wstr_mismatch(str_1, str_2,
+		                  length_1 < length_2 ? length_1 : length_2),
+		    false);
+	}
+	int32_t wstr_compare_ignore_case(const_wcstring str_1, size_t length_1,
+	                                 const_wcstring str_2,
+	                                 size_t length_2) noexcept {
+		return wstr_order(
+		    str_1, length_1, str_2, length_2,
+		    wstr_find_mismatch_ignore_case(
+		        str_1, str_2, length_1 < length_2 ? length_1 : length_2),
+		    true);
 	}
 
 
@@ -95,6 +251,11 @@ namespace stick {
 		else
 			return false;
 	}
+	wchar_t wchar_to_lower(const wchar_t character) noexcept {
+		return L'A' <= character and character <= L'Z'
+		           ? static_cast<wchar_t>(character + (L'a' - L'A'))
+		           : character;
+	}
 
 	bool_t wstr_is_numeric(const_wcstring str, size_t length) {
 		if (str == nullptr)
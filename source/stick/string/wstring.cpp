@@ -17,19 +17,19 @@ namespace stick {
 
 	wstring::wstring() noexcept : data(wstr_end) { }
 	wstring::wstring(const_wcstring str, size_t length, size_t pool_length)
-	    : data_size(length), pool(pool_length),
-	      data(str, length, pool_length + 1) {
+	    : data(str, length, pool_length + 1), data_size(length),
+	      pool(pool_length) {
 		this->data[this->length()] = wstr_end;
 	}
 	wstring::wstring(const_wcstring str) : wstring(str, wstr_length(str)) { }
 	wstring::wstring(const wchar_t c, size_t repetitions, size_t pool_length)
-	    : data_size(repetitions), pool(pool_length),
-	      data(repetitions + pool_length + 1) {
+	    : data(repetitions + pool_length + 1), data_size(repetitions),
+	      pool(pool_length) {
 		set(this->data.operator wchar_t *(), c, this->length());
 		this->data[this->length()] = wstr_end;
 	}
 	wstring::wstring(size_t length, size_t pool_length) noexcept
-	    : data_size(0ul), pool(pool_length), data(length + pool_length + 1) {
+	    : data(length + pool_length + 1), data_size(0ul), pool(pool_length) {
 		this->data[0ul] = wstr_end;
 	}
 
@@ -405,6 +405,20 @@ namespace stick {
 	}
 
 
+	int32_t wstring::compare(const wstring &str) const noexcept {
+		return wstr_compare(this->data, this->length(), str.data,
+		                    str.length());
+	}
+	bool_t wstring::equal_ignore_case(const wstring &str) const noexcept {
+		return wstr_equal_ignore_case(this->data, this->length(), str.data,
+		                              str.length());
+	}
+	int32_t wstring::compare_ignore_case(const wstring &str) const noexcept {
+		return wstr_compare_ignore_case(this->data, this->length(), str.data,
+		                                str.length());
+	}
+
+
 	wstring wstring::operator+(const_wcstring str) const {
 		return wstring(*this).append(str);
 	}
@@ -443,17 +457,26 @@ namespace stick {
 	}
 
 	bool_t wstring::operator==(const wstring &str) const noexcept {
-		for (size_t i = 0ul; i < this->length(); i++)
-			if (this->data[i] != str[i])
-				return false;
-
-		return true;
+		return wstr_equal(this->data, this->length(), str.data, str.length());
 	}
 
 	bool_t wstring::operator!=(const wstring &str) const noexcept {
 		return not this->operator==(str);
 	}
 
+	bool_t wstring::operator<(const wstring &str) const noexcept {
+		return this->compare(str) < 0;
+	}
+	bool_t wstring::operator<=(const wstring &str) const noexcept {
+		return this->compare(str) <= 0;
+	}
+	bool_t wstring::operator>(const wstring &str) const noexcept {
+		return this->compare(str) > 0;
+	}
+	bool_t wstring::operator>=(const wstring &str) const noexcept {
+		return this->compare(str) >= 0;
+	}
+
 	wstring::operator wcstring() const noexcept {
 		return this->data;
 	}
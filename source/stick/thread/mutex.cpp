@@ -0,0 +1,126 @@
+/**
+ * Mutex and condition variable implementation.
+ * @brief Mutex and condition variable implementation.
+ * @file mutex.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../include/stick/thread/mutex.hpp"
+
+#if defined(_stick_lib_thread_mutex_)
+
+
+#	include "../../../include/stick/defines/os.hpp"
+#	include "../../../include/stick/thread/spin_lock.hpp"
+
+#	if stick_OS_ID == stick_OS_ID_LINUX
+#		include <linux/futex.h>
+#		include <sys/syscall.h>
+#		include <unistd.h>
+#	endif
+
+
+namespace stick {
+
+
+	/// Pauses of a thread on a held mutex before it goes to sleep.
+	static const size_t mutex_spins = 128ul;
+	/// Value of a mutex held with threads that may be sleeping on it.
+	static const uint32_t mutex_sleepers = 2u;
+
+
+	/**
+	 * Sleep while a word keeps a value. May also return early.
+	 * @param [in] word Word to sleep on.
+	 * @param [in] value Value it must have to sleep.
+	 */
+	static void_t mutex_sleep(atomic<uint32_t> &word, uint32_t value) noexcept {
+#	if stick_OS_ID == stick_OS_ID_LINUX
+		syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word),
+		        FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0);
+#	else
+		(void) word;
+		(void) value;
+		thread_yield();
+#	endif
+	}
+
+	/**
+	 * Wake threads sleeping on a word.
+	 * @param [in] word Word they sleep on.
+	 * @param [in] count Most threads to wake.
+	 */
+	static void_t mutex_wake(atomic<uint32_t> &word, int_t count) noexcept {
+#	if stick_OS_ID == stick_OS_ID_LINUX
+		syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word),
+		        FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+#	else
+		(void) word;
+		(void) count;
+#	endif
+	}
+
+
+	void_t mutex::lock() noexcept {
+		uint32_t expected = 0u;
+		if (this->state.compare_exchange_strong(expected, 1u,
+		                                        memory_order::acquire,
+		                                        memory_order::relaxed))
+			return;
+
+		// The holder may be about to release it, spin before sleeping
+		// unless others already sleep.
+		for (size_t i = 0ul; i < mutex_spins and expected == 1u; i++) {
+			cpu_relax();
+			expected = this->state.load(memory_order::relaxed);
+			if (expected == 0u
+			    and this->state.compare_exchange_weak(expected, 1u,
+			                                          memory_order::acquire,
+			                                          memory_order::relaxed))
+				return;
+		}
+
+		// Taken as held with sleepers, as this thread cannot tell whether
+		// it was the last one.
+		while (this->state.exchange(mutex_sleepers, memory_order::acquire)
+		       != 0u)
+			mutex_sleep(this->state, mutex_sleepers);
+	}
+	bool_t mutex::try_lock() noexcept {
+		uint32_t expected = 0u;
+
+		return this->state.compare_exchange_strong(expected, 1u,
+		                                           memory_order::acquire,
+		                                           memory_order::relaxed);
+	}
+	void_t mutex::unlock() noexcept {
+		if (this->state.exchange(0u, memory_order::release) == mutex_sleepers)
+			mutex_wake(this->state, 1);
+	}
+
+
+	void_t condition::wait(mutex &lock) noexcept {
+		this->waiters.fetch_add(1u, memory_order::seq_cst);
+		uint32_t sequence = this->sequence.load(memory_order::seq_cst);
+
+		lock.unlock();
+		mutex_sleep(this->sequence, sequence);
+		lock.lock();
+
+		this->waiters.fetch_sub(1u, memory_order::relaxed);
+	}
+	void_t condition::notify_one() noexcept {
+		this->sequence.fetch_add(1u, memory_order::seq_cst);
+		if (this->waiters.load(memory_order::seq_cst) != 0u)
+			mutex_wake(this->sequence, 1);
+	}
+	void_t condition::notify_all() noexcept {
+		this->sequence.fetch_add(1u, memory_order::seq_cst);
+		if (this->waiters.load(memory_order::seq_cst) != 0u)
+			mutex_wake(this->sequence, stick_int32_MAX);
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_thread_mutex_
@@ -0,0 +1,36 @@
+/**
+ * Spin and ticket locks implementation.
+ * @brief Spin and ticket locks implementation.
+ * @file spin_lock.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../include/stick/thread/spin_lock.hpp"
+
+#if defined(_stick_lib_thread_spin_lock_)
+
+
+#	include "../../../include/stick/defines/os.hpp"
+
+#	if stick_OS_ID == stick_OS_ID_WINDOWS
+#		include <windows.h>
+#	else
+#		include <sched.h>
+#	endif
+
+
+namespace stick {
+
+
+	void_t thread_yield() noexcept {
+#	if stick_OS_ID == stick_OS_ID_WINDOWS
+		SwitchToThread();
+#	else
+		sched_yield();
+#	endif
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_thread_spin_lock_
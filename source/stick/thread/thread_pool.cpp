@@ -0,0 +1,584 @@
+/**
+ * Work stealing thread pool implementation.
+ * @brief Work stealing thread pool implementation.
+ * @file thread_pool.cpp
+ * @author Julio C. Galindo (stickM4N)
+ */
+#include "../../../include/stick/thread/thread_pool.hpp"
+
+#if defined(_stick_lib_thread_thread_pool_)
+
+
+#	include "../../../include/stick/data_structures/deque.tpp"
+#	include "../../../include/stick/defines/os.hpp"
+#	include "../../../include/stick/error/generic_error.hpp"
+#	include "../../../include/stick/memory/management.tpp"
+#	include "../../../include/stick/thread/atomic.tpp"
+#	include "../../../include/stick/thread/mutex.hpp"
+#	include "../../../include/stick/thread/scoped_lock.tpp"
+#	include "../../../include/stick/thread/spin_lock.hpp"
+
+#	if stick_OS_ID == stick_OS_ID_WINDOWS
+#		include <windows.h>
+#	else
+#		include <pthread.h>
+#		include <sched.h>
+#		include <unistd.h>
+#	endif
+
+
+namespace stick {
+
+
+	/// Slots of the first ring of a worker.
+	static const size_t thread_pool_ring_slots = 256ul;
+	/// Pauses of an idle thread before it starts yielding the CPU.
+	static const size_t thread_pool_pauses = 64ul;
+	/// Yields of an idle worker before it goes to sleep.
+	static const size_t thread_pool_yields = 64ul;
+	/// CPU of a worker that is not pinned.
+	static const size_t thread_pool_no_cpu = -1ul;
+
+
+#	if stick_OS_ID == stick_OS_ID_WINDOWS
+	/// Native handle of a worker thread.
+	typedef HANDLE thread_pool_thread;
+#	else
+	/// Native handle of a worker thread.
+	typedef pthread_t thread_pool_thread;
+#	endif
+
+
+	/**
+	 * Circular array of a Chase-Lev deque. Replaced rings are kept until the
+	 * worker ends, a thief may still be reading them.
+	 */
+	struct thread_pool_ring {
+		ssize_t mask = 0l;   ///< Number of slots minus one.
+		atomic<thread_pool_task *> *slots = nullptr;   ///< Queued tasks.
+		thread_pool_ring *previous = nullptr;   ///< Ring this one replaced.
+	};
+
+	/**
+	 * Worker thread and its Chase-Lev deque. The owner pushes and takes at
+	 * the bottom, thieves steal at the top.
+	 */
+	struct thread_pool_worker {
+		atomic<ssize_t> top;   ///< Position of the oldest task.
+		/// Keeps the thieves end in its own cache line.
+		byte_t top_padding[64];
+		atomic<ssize_t> bottom;   ///< Position after the newest task.
+		atomic<thread_pool_ring *> ring;   ///< Current ring.
+		/// Keeps the owner end in its own cache line.
+		byte_t bottom_padding[64];
+
+		thread_pool_state *state = nullptr;   ///< Pool of the worker.
+		size_t index = 0ul;   ///< Position in the pool.
+		size_t cpu = thread_pool_no_cpu;   ///< CPU to pin the thread to.
+		thread_pool_thread thread;   ///< Thread running the worker.
+		bool_t started = false;   ///< Whether the thread was started.
+	};
+
+	struct thread_pool_state {
+		array<thread_pool_worker *> workers;   ///< Workers of the pool.
+
+		/// Tasks submitted from threads outside the pool.
+		deque<thread_pool_task *> injected;
+		mutex injected_lock;   ///< Guards the injected tasks.
+		atomic<size_t> injected_count;   ///< Number of injected tasks.
+
+		mutex sleep_lock;   ///< Guards going to sleep and stopping.
+		condition sleep;   ///< Where idle workers sleep.
+		atomic<size_t> sleepers;   ///< Workers sleeping or about to.
+		bool_t stop = false;   ///< Whether the pool is ending.
+	};
+
+
+	/// Worker running in the calling thread, if any.
+	static thread_local thread_pool_worker *thread_pool_this_worker = nullptr;
+	/// State of the victim picker of the calling thread.
+	static thread_local uint64_t thread_pool_seed = 0x9e3779b97f4a7c15ul;
+
+
+	/**
+	 * Wait a bit before looking for work again. Pauses the first times and
+	 * yields the CPU after.
+	 * @param [in,out] spins Times the thread already waited.
+	 */
+	static inline void_t thread_pool_relax(size_t &spins) noexcept {
+		if (spins++ < thread_pool_pauses)
+			cpu_relax();
+		else
+			thread_yield();
+	}
+
+	/**
+	 * Pin the calling thread to a CPU.
+	 * @param [in] cpu CPU to run on, thread_pool_no_cpu to leave it free.
+	 */
+	static void_t thread_pool_pin(size_t cpu) noexcept {
+		if (cpu == thread_pool_no_cpu)
+			return;
+
+#	if stick_OS_ID == stick_OS_ID_LINUX
+		if (cpu >= CPU_SETSIZE)
+			return;
+
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#	elif stick_OS_ID == stick_OS_ID_WINDOWS
+		if (cpu < sizeof(DWORD_PTR) * 8ul)
+			SetThreadAffinityMask(GetCurrentThread(),
+			                      static_cast<DWORD_PTR>(1) << cpu);
+#	endif
+	}
+
+
+	/**
+	 * Create an empty ring.
+	 * @param [in] slots Number of slots, a power of 2.
+	 * @return The ring.
+	 * @throw memory_error when memory cannot be allocated.
+	 */
+	static thread_pool_ring *thread_pool_create_ring(size_t slots) {
+		auto ring = construct_at(allocate_uninitialized<thread_pool_ring>());
+		try {
+			ring->slots
+			    = allocate_uninitialized<atomic<thread_pool_task *>>(slots);
+		} catch (...) {
+			deallocate_raw(ring);
+			throw;
+		}
+		ring->mask = static_cast<ssize_t>(slots - 1ul);
+
+		return ring;
+	}
+
+	/**
+	 * Release a ring and every ring it replaced.
+	 * @param [in] ring Newest ring.
+	 */
+	static void_t thread_pool_release_rings(thread_pool_ring *ring) noexcept {
+		while (ring != nullptr) {
+			thread_pool_ring *previous = ring->previous;
+			deallocate_raw(ring->slots);
+			deallocate_raw(ring);
+			ring = previous;
+		}
+	}
+
+
+	/**
+	 * Queue a task at the bottom of a worker deque. Only called by the
+	 * owner.
+	 * @param [in,out] worker Worker running in the calling thread.
+	 * @param [in] task Task to queue.
+	 * @throw memory_error when the ring cannot grow.
+	 */
+	static void_t thread_pool_push(thread_pool_worker *worker,
+	                               thread_pool_task *task) {
+		ssize_t bottom = worker->bottom.load(memory_order::relaxed);
+		ssize_t top = worker->top.load(memory_order::acquire);
+		thread_pool_ring *ring = worker->ring.load(memory_order::relaxed);
+
+		if (bottom - top > ring->mask) {
+			thread_pool_ring *grown = thread_pool_create_ring(
+			    static_cast<size_t>(ring->mask + 1l) << 1);
+			for (ssize_t i = top; i < bottom; i++)
+				grown->slots[i & grown->mask].store(
+				    ring->slots[i & ring->mask].load(memory_order::relaxed),
+				    memory_order::relaxed);
+			grown->previous = ring;
+
+			worker->ring.store(grown, memory_order::release);
+			ring = grown;
+		}
+
+		ring->slots[bottom & ring->mask].store(task, memory_order::relaxed);
+		worker->bottom.store(bottom + 1l, memory_order::release);
+	}
+
+	/**
+	 * Take the newest task of a worker deque. Only called by the owner.
+	 * @param [in,out] worker Worker running in the calling thread.
+	 * @return The task, nullptr if the deque is empty.
+	 */
+	static thread_pool_task *
+	thread_pool_take(thread_pool_worker *worker) noexcept {
+		ssize_t bottom = worker->bottom.load(memory_order::relaxed) - 1l;
+		thread_pool_ring *ring = worker->ring.load(memory_order::relaxed);
+		worker->bottom.store(bottom, memory_order::relaxed);
+		atomic_fence(memory_order::seq_cst);
+		ssize_t top = worker->top.load(memory_order::relaxed);
+
+		if (top > bottom) {
+			worker->bottom.store(bottom + 1l, memory_order::relaxed);
+			return nullptr;
+		}
+
+		thread_pool_task *task
+		    = ring->slots[bottom & ring->mask].load(memory_order::relaxed);
+		if (top == bottom) {
+			// Last task, race the thieves for it.
+			if (not worker->top.compare_exchange_strong(
+			        top, top + 1l, memory_order::seq_cst,
+			        memory_order::relaxed))
+				task = nullptr;
+			worker->bottom.store(bottom + 1l, memory_order::relaxed);
+		}
+
+		return task;
+	}
+
+	/**
+	 * Steal the oldest task of a worker deque. Called by any thread.
+	 * @param [in,out] worker Worker to steal from.
+	 * @return The task, nullptr if the deque is empty or another thread
+	 * took the task first.
+	 */
+	static thread_pool_task *
+	thread_pool_steal(thread_pool_worker *worker) noexcept {
+		ssize_t top = worker->top.load(memory_order::acquire);
+		atomic_fence(memory_order::seq_cst);
+		ssize_t bottom = worker->bottom.load(memory_order::acquire);
+
+		if (top >= bottom)
+			return nullptr;
+
+		thread_pool_ring *ring = worker->ring.load(memory_order::acquire);
+		thread_pool_task *task
+		    = ring->slots[top & ring->mask].load(memory_order::relaxed);
+		if (not worker->top.compare_exchange_strong(top, top + 1l,
+		                                            memory_order::seq_cst,
+		                                            memory_order::relaxed))
+			return nullptr;
+
+		return task;
+	}
+
+
+	/**
+	 * Look for a task: the own deque first, then the injected tasks, then
+	 * the other workers starting at a random one.
+	 * @param [in,out] state Pool to look in.
+	 * @param [in,out] worker Worker running in the calling thread, nullptr
+	 * if it is not a worker of the pool.
+	 * @return The task, nullptr if none was found.
+	 */
+	static thread_pool_task *thread_pool_find(thread_pool_state *state,
+	                                          thread_pool_worker *worker) {
+		thread_pool_task *task = nullptr;
+		if (worker != nullptr and (task = thread_pool_take(worker)) != nullptr)
+			return task;
+
+		if (state->injected_count.load(memory_order::relaxed) != 0ul) {
+			scoped_lock<mutex> lock(state->injected_lock);
+			if (not state->injected.empty()) {
+				task = state->injected.front();
+				state->injected.pop_front();
+				state->injected_count.store(state->injected.size(),
+				                            memory_order::relaxed);
+				return task;
+			}
+		}
+
+		// Xorshift, cheap and good enough to spread the thieves.
+		thread_pool_seed ^= thread_pool_seed << 13;
+		thread_pool_seed ^= thread_pool_seed >> 7;
+		thread_pool_seed ^= thread_pool_seed << 17;
+
+		size_t count = state->workers.size();
+		size_t start = thread_pool_seed % count;
+		for (size_t i = 0ul; i < count; i++) {
+			thread_pool_worker *victim = state->workers[(start + i) % count];
+			if (victim != worker
+			    and (task = thread_pool_steal(victim)) != nullptr)
+				return task;
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Wake a sleeping worker, if any, after queueing a task.
+	 * @param [in,out] state Pool the task was queued in.
+	 */
+	static void_t thread_pool_wake(thread_pool_state *state) {
+		// Pairs with the sleepers count increment before the last look for
+		// work, either the worker finds the task or this finds the worker.
+		atomic_fence(memory_order::seq_cst);
+		if (state->sleepers.load(memory_order::relaxed) == 0ul)
+			return;
+
+		scoped_lock<mutex> lock(state->sleep_lock);
+		state->sleep.notify_one();
+	}
+
+
+	/**
+	 * Run tasks until the pool stops.
+	 * @param [in,out] worker Worker running in the new thread.
+	 */
+	static void_t thread_pool_work(thread_pool_worker *worker) {
+		thread_pool_state *state = worker->state;
+
+		thread_pool_this_worker = worker;
+		thread_pool_seed += worker->index;
+		thread_pool_pin(worker->cpu);
+
+		while (true) {
+			thread_pool_task *task = thread_pool_find(state, worker);
+
+			for (size_t spins = 0ul; task == nullptr
+			                         and spins < thread_pool_pauses
+			                                         + thread_pool_yields;) {
+				thread_pool_relax(spins);
+				task = thread_pool_find(state, worker);
+			}
+
+			if (task == nullptr) {
+				scoped_lock<mutex> lock(state->sleep_lock);
+				state->sleepers.fetch_add(1ul, memory_order::seq_cst);
+
+				task = thread_pool_find(state, worker);
+				if (task == nullptr) {
+					if (state->stop) {
+						state->sleepers.fetch_sub(1ul, memory_order::relaxed);
+						return;
+					}
+
+					state->sleep.wait(state->sleep_lock);
+				}
+
+				state->sleepers.fetch_sub(1ul, memory_order::relaxed);
+				if (task == nullptr)
+					continue;
+			}
+
+			task->run(task);
+		}
+	}
+
+#	if stick_OS_ID == stick_OS_ID_WINDOWS
+	/**
+	 * Entry point of a worker thread.
+	 * @param [in,out] worker Worker running in the new thread.
+	 * @return 0.
+	 */
+	static DWORD WINAPI thread_pool_entry(LPVOID worker) {
+		thread_pool_work(static_cast<thread_pool_worker *>(worker));
+
+		return 0;
+	}
+#	else
+	/**
+	 * Entry point of a worker thread.
+	 * @param [in,out] worker Worker running in the new thread.
+	 * @return nullptr.
+	 */
+	static void_t *thread_pool_entry(void_t *worker) {
+		thread_pool_work(static_cast<thread_pool_worker *>(worker));
+
+		return nullptr;
+	}
+#	endif
+
+	/**
+	 * Start the thread of a worker.
+	 * @param [in,out] worker Worker to run.
+	 * @throw generic_error when the thread cannot be started.
+	 */
+	static void_t thread_pool_start(thread_pool_worker *worker) {
+#	if stick_OS_ID == stick_OS_ID_WINDOWS
+		worker->thread
+		    = CreateThread(nullptr, 0, thread_pool_entry, worker, 0, nullptr);
+		if (worker->thread == nullptr)
+#	else
+		if (pthread_create(&worker->thread, nullptr, thread_pool_entry, worker)
+		    != 0)
+#	endif
+			throw generic_error("Starting a thread of a pool failed.");
+
+		worker->started = true;
+	}
+
+	/**
+	 * Wait for the thread of a worker to end, if it was started.
+	 * @param [in,out] worker Worker to wait for.
+	 */
+	static void_t thread_pool_join(thread_pool_worker *worker) noexcept {
+		if (not worker->started)
+			return;
+
+#	if stick_OS_ID == stick_OS_ID_WINDOWS
+		WaitForSingleObject(worker->thread, INFINITE);
+		CloseHandle(worker->thread);
+#	else
+		pthread_join(worker->thread, nullptr);
+#	endif
+		worker->started = false;
+	}
+
+
+	/**
+	 * Run every queued task, stop the workers and release the pool.
+	 * @param [in] state Pool to stop.
+	 */
+	static void_t thread_pool_stop(thread_pool_state *state) noexcept {
+		{
+			scoped_lock<mutex> lock(state->sleep_lock);
+			state->stop = true;
+			state->sleep.notify_all();
+		}
+
+		for (auto worker : state->workers)
+			thread_pool_join(worker);
+
+		for (auto worker : state->workers) {
+			thread_pool_release_rings(worker->ring.load(memory_order::relaxed));
+			destroy_range(worker);
+			deallocate_raw(worker);
+		}
+
+		destroy_range(state);
+		deallocate_raw(state);
+	}
+
+
+	thread_pool::thread_pool(size_t threads)
+	    : thread_pool(threads, array<size_t>()) { }
+	thread_pool::thread_pool(size_t threads, const array<size_t> &cpus) {
+		if (threads == 0ul)
+			threads = thread_pool::hardware_threads();
+
+		this->state =
+		    construct_at(allocate_uninitialized<thread_pool_state>());
+		try {
+			for (size_t i = 0ul; i < threads; i++) {
+				auto worker =
+				    construct_at(allocate_uninitialized<thread_pool_worker>());
+				worker->state = this->state;
+				worker->index = i;
+				try {
+					if (not cpus.empty())
+						worker->cpu = cpus[i % cpus.size()];
+					this->state->workers.push_back(worker);
+				} catch (...) {
+					// Stopping the pool only releases the stored workers.
+					destroy_range(worker);
+					deallocate_raw(worker);
+					throw;
+				}
+
+				worker->ring.store(
+				    thread_pool_create_ring(thread_pool_ring_slots),
+				    memory_order::relaxed);
+			}
+
+			for (auto worker : this->state->workers)
+				thread_pool_start(worker);
+		} catch (...) {
+			thread_pool_stop(this->state);
+			throw;
+		}
+	}
+
+	thread_pool::~thread_pool() noexcept {
+		thread_pool_stop(this->state);
+	}
+
+
+	size_t thread_pool::size() const noexcept {
+		return this->state->workers.size();
+	}
+
+
+	void_t thread_pool::submit(thread_pool_task *task) {
+		thread_pool_worker *worker = thread_pool_this_worker;
+
+		if (worker != nullptr and worker->state == this->state)
+			thread_pool_push(worker, task);
+		else {
+			scoped_lock<mutex> lock(this->state->injected_lock);
+			this->state->injected.push_back(task);
+			this->state->injected_count.store(this->state->injected.size(),
+			                                  memory_order::relaxed);
+		}
+
+		thread_pool_wake(this->state);
+	}
+
+	bool_t thread_pool::help() {
+		thread_pool_worker *worker = thread_pool_this_worker;
+		if (worker != nullptr and worker->state != this->state)
+			worker = nullptr;
+
+		thread_pool_task *task = thread_pool_find(this->state, worker);
+		if (task == nullptr)
+			return false;
+
+		task->run(task);
+
+		return true;
+	}
+
+
+	size_t thread_pool::hardware_threads() noexcept {
+#	if stick_OS_ID == stick_OS_ID_WINDOWS
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		auto hardware = static_cast<size_t>(info.dwNumberOfProcessors);
+#	else
+		long online = sysconf(_SC_NPROCESSORS_ONLN);
+		size_t hardware = online > 0l ? static_cast<size_t>(online) : 0ul;
+#	endif
+
+		return hardware == 0ul ? 1ul : hardware;
+	}
+
+	thread_pool &thread_pool::shared() {
+		static thread_pool pool;
+
+		return pool;
+	}
+
+
+	task_group::task_group(thread_pool &pool) : pool(pool) { }
+
+	task_group::~task_group() noexcept {
+		size_t spins = 0ul;
+		while (this->pending.load(memory_order::acquire) != 0ul)
+			if (not this->pool.help())
+				thread_pool_relax(spins);
+	}
+
+
+	void_t task_group::finish(bool_t failed) noexcept {
+		if (failed)
+			this->failed.store(true, memory_order::relaxed);
+
+		this->pending.fetch_sub(1ul, memory_order::release);
+	}
+
+
+	void_t task_group::wait() {
+		size_t spins = 0ul;
+		while (this->pending.load(memory_order::acquire) != 0ul)
+			if (this->pool.help())
+				spins = 0ul;
+			else
+				thread_pool_relax(spins);
+
+		if (this->failed.load(memory_order::relaxed)) {
+			this->failed.store(false, memory_order::relaxed);
+			throw generic_error("A task of the group threw an exception.");
+		}
+	}
+
+
+}   // namespace stick
+
+
+#endif   //_stick_lib_thread_thread_pool_